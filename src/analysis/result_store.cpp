@@ -0,0 +1,308 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   result_store.cpp
+ *
+ * @brief
+ * Append-only binary file of fixed size result records. The file starts
+ * with a header of four ints: a magic number, a version number, the number
+ * of values per record and an unused int. Each record is four ints (a flag
+ * that is set to one when the record is written, the task index, the task
+ * status and an unused int) followed by the values as doubles and the mask
+ * values as ints. Slots for records are reserved with a GA counter, so
+ * processors can write records at the same time without coordination.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#include <string.h>
+#include <algorithm>
+#include "gridpack/analysis/result_store.hpp"
+#include "gridpack/utilities/exception.hpp"
+
+#define rst gridpack::analysis::ResultStore
+#define rsr gridpack::analysis::ResultStoreReader
+
+#define RESULT_STORE_MAGIC 0x53525047
+#define RESULT_STORE_VERSION 1
+#define RESULT_STORE_HEADER (4*sizeof(int))
+
+/**
+ * Constructor
+ * @param comm communicator on which ResultStore is defined
+ * @param filename name of file holding records
+ * @param nvalues number of values in each record
+ */
+rst::ResultStore(const parallel::Communicator &comm, std::string filename,
+    int nvalues)
+{
+  p_comm = static_cast<MPI_Comm>(comm);
+  p_GAgrp = comm.getGroup();
+  p_nvalues = nvalues;
+  p_recordSize = 4*sizeof(int) + nvalues*(sizeof(double)+sizeof(int));
+
+  int ierr = MPI_File_open(p_comm, const_cast<char*>(filename.c_str()),
+      MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &p_fh);
+  if (ierr != MPI_SUCCESS) {
+    char buf[256];
+    sprintf(buf,"ResultStore: unable to open file %s\n",filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  MPI_File_set_size(p_fh, 0);
+  p_open = true;
+  if (comm.rank() == 0) {
+    int header[4];
+    header[0] = RESULT_STORE_MAGIC;
+    header[1] = RESULT_STORE_VERSION;
+    header[2] = nvalues;
+    header[3] = 0;
+    MPI_Status status;
+    MPI_File_write_at(p_fh, 0, header, 4, MPI_INT, &status);
+  }
+
+  p_GAcounter = GA_Create_handle();
+  int one = 1;
+  GA_Set_data(p_GAcounter,one,&one,C_INT);
+  GA_Set_pgroup(p_GAcounter,p_GAgrp);
+  GA_Allocate(p_GAcounter);
+  GA_Zero(p_GAcounter);
+}
+
+/**
+ * Destructor
+ */
+rst::~ResultStore(void)
+{
+  close();
+  GA_Destroy(p_GAcounter);
+}
+
+/**
+ * Append a record to the store
+ * @param task index of task that generated record
+ * @param status status of task (e.g. whether calculation succeeded)
+ * @param vals vector of values
+ * @param mask vector of mask values
+ */
+void rst::appendRecord(int task, int status, const std::vector<double> &vals,
+    const std::vector<int> &mask)
+{
+  if (!p_open) {
+    char buf[256];
+    sprintf(buf,"ResultStore::appendRecord: store has been closed\n");
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  completeWrites(false);
+
+  // Build record in a buffer that stays alive until the write finishes
+  p_buffers.push_back(std::vector<char>(p_recordSize,0));
+  char *record = &(p_buffers.back()[0]);
+  int head[4];
+  head[0] = 1;
+  head[1] = task;
+  head[2] = status;
+  head[3] = 0;
+  memcpy(record, head, 4*sizeof(int));
+  int nval = std::min(static_cast<int>(vals.size()),p_nvalues);
+  if (nval > 0) {
+    memcpy(record+4*sizeof(int), &vals[0], nval*sizeof(double));
+  }
+  int nmask = std::min(static_cast<int>(mask.size()),p_nvalues);
+  if (nmask > 0) {
+    memcpy(record+4*sizeof(int)+p_nvalues*sizeof(double), &mask[0],
+        nmask*sizeof(int));
+  }
+
+  // Reserve a slot for the record and start writing it
+  int zero = 0;
+  long one = 1;
+  int slot = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero,one));
+  MPI_Offset offset = static_cast<MPI_Offset>(RESULT_STORE_HEADER)
+    + static_cast<MPI_Offset>(slot)*static_cast<MPI_Offset>(p_recordSize);
+  MPI_Request request;
+  MPI_File_iwrite_at(p_fh, offset, record, p_recordSize, MPI_BYTE, &request);
+  p_requests.push_back(request);
+}
+
+/**
+ * Wait until all records appended by this processor have been written
+ */
+void rst::flush(void)
+{
+  completeWrites(true);
+}
+
+/**
+ * Write any outstanding records and close the file
+ */
+void rst::close(void)
+{
+  if (!p_open) return;
+  completeWrites(true);
+  MPI_File_close(&p_fh);
+  p_open = false;
+}
+
+/**
+ * Release buffers of writes that have finished
+ * @param wait wait for all writes to finish
+ */
+void rst::completeWrites(bool wait)
+{
+  std::list<MPI_Request>::iterator it = p_requests.begin();
+  std::list<std::vector<char> >::iterator bit = p_buffers.begin();
+  while (it != p_requests.end()) {
+    int done;
+    MPI_Status status;
+    if (wait) {
+      MPI_Wait(&(*it), &status);
+      done = 1;
+    } else {
+      MPI_Test(&(*it), &done, &status);
+    }
+    if (done) {
+      it = p_requests.erase(it);
+      bit = p_buffers.erase(bit);
+    } else {
+      it++;
+      bit++;
+    }
+  }
+}
+
+/**
+ * Constructor
+ * @param filename name of file written by ResultStore
+ */
+rsr::ResultStoreReader(std::string filename)
+{
+  p_file.open(filename.c_str(), std::ios::in|std::ios::binary);
+  int header[4];
+  if (!p_file.read(reinterpret_cast<char*>(header),sizeof(header))
+      || header[0] != RESULT_STORE_MAGIC) {
+    char buf[256];
+    sprintf(buf,"ResultStoreReader: file %s is not a result store\n",
+        filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  if (header[1] != RESULT_STORE_VERSION) {
+    char buf[256];
+    sprintf(buf,"ResultStoreReader: unknown version %d in file %s\n",
+        header[1],filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  p_nvalues = header[2];
+  p_recordSize = 4*sizeof(int) + p_nvalues*(sizeof(double)+sizeof(int));
+}
+
+/**
+ * Default destructor
+ */
+rsr::~ResultStoreReader(void)
+{
+  p_file.close();
+}
+
+/**
+ * @return number of values in each record
+ */
+int rsr::numValues(void) const
+{
+  return p_nvalues;
+}
+
+/**
+ * Return number of record slots in the file
+ * @return number of record slots
+ */
+int rsr::numSlots(void)
+{
+  p_file.clear();
+  p_file.seekg(0, std::ios::end);
+  long size = static_cast<long>(p_file.tellg());
+  if (size < static_cast<long>(RESULT_STORE_HEADER)) return 0;
+  // A partially written record at the end of the file is not counted
+  return static_cast<int>((size-RESULT_STORE_HEADER)/p_recordSize);
+}
+
+/**
+ * Read a record
+ * @param idx index of record slot
+ * @param task index of task that generated record
+ * @param status status of task
+ * @param vals vector of values
+ * @param mask vector of mask values
+ * @return false if record slot has not been written yet
+ */
+bool rsr::getRecord(int idx, int *task, int *status,
+    std::vector<double> &vals, std::vector<int> &mask)
+{
+  std::vector<char> record(p_recordSize);
+  p_file.clear();
+  p_file.seekg(static_cast<std::streamoff>(RESULT_STORE_HEADER)
+      + static_cast<std::streamoff>(idx)*p_recordSize, std::ios::beg);
+  if (!p_file.read(&record[0],p_recordSize)) return false;
+  int head[4];
+  memcpy(head, &record[0], 4*sizeof(int));
+  // Slots that have been reserved but not written are still zero
+  if (head[0] != 1) return false;
+  *task = head[1];
+  *status = head[2];
+  vals.resize(p_nvalues);
+  mask.resize(p_nvalues);
+  if (p_nvalues > 0) {
+    memcpy(&vals[0], &record[4*sizeof(int)], p_nvalues*sizeof(double));
+    memcpy(&mask[0], &record[4*sizeof(int)+p_nvalues*sizeof(double)],
+        p_nvalues*sizeof(int));
+  }
+  return true;
+}
+
+/**
+ * Aggregate all records that have been written so far
+ * @param mval smallest mask value that is included
+ * @param count number of values included for each row
+ * @param vmin minimum value for each row
+ * @param vmax maximum value for each row
+ * @param mean mean value for each row
+ * @return number of records found
+ */
+int rsr::statistics(int mval, std::vector<int> &count,
+    std::vector<double> &vmin, std::vector<double> &vmax,
+    std::vector<double> &mean)
+{
+  count.assign(p_nvalues,0);
+  vmin.assign(p_nvalues,0.0);
+  vmax.assign(p_nvalues,0.0);
+  mean.assign(p_nvalues,0.0);
+  std::vector<double> vals;
+  std::vector<int> mask;
+  int nslots = numSlots();
+  int nrecords = 0;
+  int i, j, task, status;
+  for (i=0; i<nslots; i++) {
+    if (!getRecord(i, &task, &status, vals, mask)) continue;
+    nrecords++;
+    for (j=0; j<p_nvalues; j++) {
+      if (mask[j] < mval) continue;
+      if (count[j] == 0 || vals[j] < vmin[j]) vmin[j] = vals[j];
+      if (count[j] == 0 || vals[j] > vmax[j]) vmax[j] = vals[j];
+      mean[j] += vals[j];
+      count[j]++;
+    }
+  }
+  for (j=0; j<p_nvalues; j++) {
+    if (count[j] > 0) mean[j] /= static_cast<double>(count[j]);
+  }
+  return nrecords;
+}
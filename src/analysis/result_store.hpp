@@ -0,0 +1,163 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   result_store.hpp
+ *
+ * @brief
+ * Append-only binary file of fixed size result records. Each record holds
+ * the results of one task (e.g. a contingency calculation) as a vector of
+ * values and a vector of mask values, like a column of a StatBlock. Records
+ * are added by individual processors without any collective operations and
+ * are written asynchronously, so task groups do not wait on each other or
+ * on the file system. Records can be read back and aggregated with
+ * ResultStoreReader, either after the run or while it is still in
+ * progress.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _result_store_hpp_
+#define _result_store_hpp_
+
+#include <ga.h>
+#include <mpi.h>
+#include <list>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "gridpack/parallel/communicator.hpp"
+
+namespace gridpack {
+namespace analysis {
+
+class ResultStore {
+public:
+  /**
+   * Constructor. This is collective on comm. Any existing file with the
+   * same name is overwritten
+   * @param comm communicator on which ResultStore is defined
+   * @param filename name of file holding records
+   * @param nvalues number of values in each record
+   */
+  ResultStore(const parallel::Communicator &comm, std::string filename,
+      int nvalues);
+
+  /**
+   * Destructor. Closes the file if close has not been called, so it is
+   * collective in that case
+   */
+  ~ResultStore(void);
+
+  /**
+   * Append a record to the store. This is not collective and returns
+   * before the record has been written. Values and mask vectors that are
+   * shorter than the record size are padded with zeros
+   * @param task index of task that generated record
+   * @param status status of task (e.g. whether calculation succeeded)
+   * @param vals vector of values
+   * @param mask vector of mask values
+   */
+  void appendRecord(int task, int status, const std::vector<double> &vals,
+      const std::vector<int> &mask);
+
+  /**
+   * Wait until all records appended by this processor have been written.
+   * This is not collective
+   */
+  void flush(void);
+
+  /**
+   * Write any outstanding records and close the file. This is collective
+   */
+  void close(void);
+
+private:
+
+  /**
+   * Release buffers of writes that have finished
+   * @param wait wait for all writes to finish
+   */
+  void completeWrites(bool wait);
+
+  MPI_Comm p_comm;
+  MPI_File p_fh;
+  bool p_open;
+
+  int p_GAgrp;
+  int p_GAcounter;
+
+  int p_nvalues;
+  int p_recordSize;
+
+  // outstanding writes and the buffers that hold their records
+  std::list<MPI_Request> p_requests;
+  std::list<std::vector<char> > p_buffers;
+};
+
+class ResultStoreReader {
+public:
+  /**
+   * Constructor. This is not collective
+   * @param filename name of file written by ResultStore
+   */
+  ResultStoreReader(std::string filename);
+
+  /**
+   * Default destructor
+   */
+  ~ResultStoreReader(void);
+
+  /**
+   * @return number of values in each record
+   */
+  int numValues(void) const;
+
+  /**
+   * Return number of record slots in the file. If the file is still being
+   * written, some slots may not be filled in yet
+   * @return number of record slots
+   */
+  int numSlots(void);
+
+  /**
+   * Read a record
+   * @param idx index of record slot
+   * @param task index of task that generated record
+   * @param status status of task
+   * @param vals vector of values
+   * @param mask vector of mask values
+   * @return false if record slot has not been written yet
+   */
+  bool getRecord(int idx, int *task, int *status, std::vector<double> &vals,
+      std::vector<int> &mask);
+
+  /**
+   * Aggregate all records that have been written so far. Only values with a
+   * mask value of mval or greater are included
+   * @param mval smallest mask value that is included
+   * @param count number of values included for each row
+   * @param vmin minimum value for each row
+   * @param vmax maximum value for each row
+   * @param mean mean value for each row
+   * @return number of records found
+   */
+  int statistics(int mval, std::vector<int> &count, std::vector<double> &vmin,
+      std::vector<double> &vmax, std::vector<double> &mean);
+
+private:
+
+  std::ifstream p_file;
+  int p_nvalues;
+  int p_recordSize;
+};
+
+} // namespace analysis
+} // namespace gridpack
+
+#endif
@@ -22,12 +22,55 @@
 
 #include "gridpack/analysis/stat_block.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/utilities/exception.hpp"
 
 #define stb gridpack::analysis::StatBlock
+#define sbr gridpack::analysis::StatBlockReader
 
 #define BLOCKSIZE 100
 
+// Binary file format written by writeBinary
+#define STAT_BLOCK_MAGIC 0x42535047
+#define STAT_BLOCK_VERSION 1
+#define STAT_BLOCK_HEADER (8*sizeof(int))
+#define STAT_BLOCK_LABEL (4*sizeof(int))
+#define STAT_BLOCK_SINGLE 1
+#define STAT_BLOCK_DELTA 2
+#define STAT_BLOCK_BRANCH 4
+#define STAT_BLOCK_MIN_BOUND 8
+#define STAT_BLOCK_MAX_BOUND 16
+
 #include <fstream>
+#include <float.h>
+#include <string.h>
+
+namespace {
+
+/**
+ * Offsets of the sections of a binary stat block file
+ * @param nrows number of rows in table
+ * @param ncols number of columns in table
+ * @param esize size of a stored value in bytes
+ * @param bounds offset of row bounds
+ * @param base offset of base case values
+ * @param summary offset of column summaries
+ * @param data offset of first column
+ * @param colsize size of a column (values and mask values) in bytes
+ */
+void binaryOffsets(int nrows, int ncols, int esize, long *bounds,
+    long *base, long *summary, long *data, long *colsize)
+{
+  long lrows = static_cast<long>(nrows);
+  long lcols = static_cast<long>(ncols);
+  *bounds = static_cast<long>(STAT_BLOCK_HEADER)
+    + lrows*static_cast<long>(STAT_BLOCK_LABEL);
+  *base = *bounds + 2*lrows*static_cast<long>(sizeof(double));
+  *summary = *base + lrows*static_cast<long>(sizeof(double));
+  *data = *summary + 4*lcols*static_cast<long>(sizeof(double));
+  *colsize = lrows*(static_cast<long>(esize)+1);
+}
+
+}
 
 /**
  * Constructor
@@ -878,3 +921,572 @@ void stb::sumColumnValues(std::string filename, int mval)
   GA_Destroy(g_buf);
   GA_Pgroup_sync(p_GAgrp);
 }
+
+/**
+ * Write the contents of the table to a binary file that is organized by
+ * columns. The file consists of
+ *   a header of 8 ints: a magic number, a version number, the number of
+ *     rows, the number of columns, a set of flags (single precision values,
+ *     values stored as differences, branch labels, minimum bounds, maximum
+ *     bounds) and three unused ints
+ *   the row labels: three ints (gidx, idx1, idx2) and a 4 character tag for
+ *     each row
+ *   the row bounds as pairs of doubles
+ *   the base case values (column 0) as doubles
+ *   the column summaries: count, minimum, maximum and mean as doubles
+ *   the columns: the values of each column as doubles or floats followed by
+ *     the mask values as signed chars
+ * All sections have a fixed size, so each processor can write the parts of
+ * the columns that it owns directly to the file
+ * @param filename name of binary file
+ * @param single store values as single precision floats
+ * @param delta store values as differences from the base case values
+ */
+void stb::writeBinary(std::string filename, bool single, bool delta)
+{
+  GA_Pgroup_sync(p_GAgrp);
+  int one = 1;
+  int two = 2;
+  int esize = single ? sizeof(float) : sizeof(double);
+  long bounds_off, base_off, summary_off, data_off, colsize;
+  binaryOffsets(p_nrows,p_ncols,esize,&bounds_off,&base_off,&summary_off,
+      &data_off,&colsize);
+
+  MPI_File fh;
+  int ierr = MPI_File_open(p_comm, const_cast<char*>(filename.c_str()),
+      MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+  if (ierr != MPI_SUCCESS) {
+    char buf[256];
+    sprintf(buf,"StatBlock::writeBinary: unable to open file %s\n",
+        filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  MPI_File_set_size(fh, 0);
+  MPI_Status status;
+  int lo[2];
+  int hi[2];
+  int ld;
+  int i, j;
+
+  // Header, row labels and bounds are written by process 0
+  if (p_me == 0) {
+    int header[8];
+    header[0] = STAT_BLOCK_MAGIC;
+    header[1] = STAT_BLOCK_VERSION;
+    header[2] = p_nrows;
+    header[3] = p_ncols;
+    header[4] = 0;
+    if (single) header[4] |= STAT_BLOCK_SINGLE;
+    if (delta) header[4] |= STAT_BLOCK_DELTA;
+    if (p_branch_flag) header[4] |= STAT_BLOCK_BRANCH;
+    if (p_min_bound) header[4] |= STAT_BLOCK_MIN_BOUND;
+    if (p_max_bound) header[4] |= STAT_BLOCK_MAX_BOUND;
+    header[5] = 0;
+    header[6] = 0;
+    header[7] = 0;
+    MPI_File_write_at(fh, 0, header, 8, MPI_INT, &status);
+    if (p_nrows > 0) {
+      int ilo = 0;
+      int ihi = p_nrows-1;
+      std::vector<index_set> idx_buf(p_nrows);
+      NGA_Get(p_tags,&ilo,&ihi,&idx_buf[0],&one);
+      std::vector<char> labels(p_nrows*STAT_BLOCK_LABEL,0);
+      for (i=0; i<p_nrows; i++) {
+        char *ptr = &labels[i*STAT_BLOCK_LABEL];
+        memcpy(ptr,&idx_buf[i].gidx,sizeof(int));
+        memcpy(ptr+sizeof(int),&idx_buf[i].idx1,sizeof(int));
+        memcpy(ptr+2*sizeof(int),&idx_buf[i].idx2,sizeof(int));
+        memcpy(ptr+3*sizeof(int),idx_buf[i].tag,3);
+      }
+      MPI_File_write_at(fh, static_cast<MPI_Offset>(STAT_BLOCK_HEADER),
+          &labels[0], p_nrows*STAT_BLOCK_LABEL, MPI_BYTE, &status);
+      std::vector<double> minmax(2*p_nrows,0.0);
+      if (p_min_bound || p_max_bound) {
+        lo[0] = 0;
+        hi[0] = p_nrows-1;
+        lo[1] = 0;
+        hi[1] = 1;
+        NGA_Get(p_bounds,lo,hi,&minmax[0],&two);
+      }
+      MPI_File_write_at(fh, static_cast<MPI_Offset>(bounds_off),
+          &minmax[0], 2*p_nrows, MPI_DOUBLE, &status);
+    }
+  }
+
+  // Each process writes the part of the table that it owns and accumulates
+  // the column summaries for that part
+  std::vector<double> vcnt(p_ncols,0.0);
+  std::vector<double> vsum(p_ncols,0.0);
+  std::vector<double> vmin(p_ncols,DBL_MAX);
+  std::vector<double> vmax(p_ncols,-DBL_MAX);
+  NGA_Distribution(p_data,p_me,lo,hi);
+  if (lo[0] >= 0 && lo[0] <= hi[0] && lo[1] >= 0 && lo[1] <= hi[1]) {
+    int nrows = hi[0]-lo[0]+1;
+    int ncols = hi[1]-lo[1]+1;
+    std::vector<double> val_buf(nrows*ncols);
+    std::vector<int> mask_buf(nrows*ncols);
+    std::vector<double> base(nrows);
+    ld = ncols;
+    NGA_Get(p_data,lo,hi,&val_buf[0],&ld);
+    NGA_Get(p_mask,lo,hi,&mask_buf[0],&ld);
+    int blo[2], bhi[2];
+    blo[0] = lo[0];
+    bhi[0] = hi[0];
+    blo[1] = 0;
+    bhi[1] = 0;
+    NGA_Get(p_data,blo,bhi,&base[0],&one);
+    if (lo[1] == 0) {
+      MPI_File_write_at(fh, static_cast<MPI_Offset>(base_off
+            + static_cast<long>(lo[0])*sizeof(double)),
+          &base[0], nrows, MPI_DOUBLE, &status);
+    }
+    std::vector<double> dcol;
+    std::vector<float> fcol;
+    std::vector<signed char> mcol(nrows);
+    if (single) {
+      fcol.resize(nrows);
+    } else {
+      dcol.resize(nrows);
+    }
+    for (j=0; j<ncols; j++) {
+      int jcol = lo[1]+j;
+      for (i=0; i<nrows; i++) {
+        int idx = i*ncols+j;
+        double val = val_buf[idx];
+        int mask = mask_buf[idx];
+        if (mask >= 1) {
+          vcnt[jcol] += 1.0;
+          vsum[jcol] += val;
+          if (val < vmin[jcol]) vmin[jcol] = val;
+          if (val > vmax[jcol]) vmax[jcol] = val;
+        }
+        if (delta) val -= base[i];
+        if (single) {
+          fcol[i] = static_cast<float>(val);
+        } else {
+          dcol[i] = val;
+        }
+        if (mask > 127) mask = 127;
+        if (mask < -128) mask = -128;
+        mcol[i] = static_cast<signed char>(mask);
+      }
+      long offset = data_off + static_cast<long>(jcol)*colsize;
+      if (single) {
+        MPI_File_write_at(fh, static_cast<MPI_Offset>(offset
+              + static_cast<long>(lo[0])*esize),
+            &fcol[0], nrows, MPI_FLOAT, &status);
+      } else {
+        MPI_File_write_at(fh, static_cast<MPI_Offset>(offset
+              + static_cast<long>(lo[0])*esize),
+            &dcol[0], nrows, MPI_DOUBLE, &status);
+      }
+      MPI_File_write_at(fh, static_cast<MPI_Offset>(offset
+            + static_cast<long>(p_nrows)*esize + static_cast<long>(lo[0])),
+          &mcol[0], nrows, MPI_BYTE, &status);
+    }
+  }
+
+  // Combine column summaries and write them out
+  if (p_ncols > 0) {
+    char cplus[2];
+    strcpy(cplus,"+");
+    char cmin[4];
+    strcpy(cmin,"min");
+    char cmax[4];
+    strcpy(cmax,"max");
+    GA_Pgroup_dgop(p_GAgrp,&vcnt[0],p_ncols,cplus);
+    GA_Pgroup_dgop(p_GAgrp,&vsum[0],p_ncols,cplus);
+    GA_Pgroup_dgop(p_GAgrp,&vmin[0],p_ncols,cmin);
+    GA_Pgroup_dgop(p_GAgrp,&vmax[0],p_ncols,cmax);
+    if (p_me == 0) {
+      std::vector<double> summary(4*p_ncols,0.0);
+      for (j=0; j<p_ncols; j++) {
+        if (vcnt[j] > 0.0) {
+          summary[4*j] = vcnt[j];
+          summary[4*j+1] = vmin[j];
+          summary[4*j+2] = vmax[j];
+          summary[4*j+3] = vsum[j]/vcnt[j];
+        }
+      }
+      MPI_File_write_at(fh, static_cast<MPI_Offset>(summary_off),
+          &summary[0], 4*p_ncols, MPI_DOUBLE, &status);
+    }
+  }
+  MPI_File_close(&fh);
+  GA_Pgroup_sync(p_GAgrp);
+}
+
+/**
+ * Constructor
+ * @param filename name of file written by StatBlock::writeBinary
+ */
+sbr::StatBlockReader(std::string filename)
+{
+  p_file.open(filename.c_str(), std::ios::in|std::ios::binary);
+  int header[8];
+  if (!p_file.read(reinterpret_cast<char*>(header),sizeof(header))
+      || header[0] != STAT_BLOCK_MAGIC) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader: file %s is not a stat block file\n",
+        filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  if (header[1] != STAT_BLOCK_VERSION) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader: unknown version %d in file %s\n",
+        header[1],filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  p_nrows = header[2];
+  p_ncols = header[3];
+  p_single = ((header[4] & STAT_BLOCK_SINGLE) != 0);
+  p_delta = ((header[4] & STAT_BLOCK_DELTA) != 0);
+  p_branch_flag = ((header[4] & STAT_BLOCK_BRANCH) != 0);
+  p_min_bound = ((header[4] & STAT_BLOCK_MIN_BOUND) != 0);
+  p_max_bound = ((header[4] & STAT_BLOCK_MAX_BOUND) != 0);
+  int esize = p_single ? sizeof(float) : sizeof(double);
+  long bounds_off, base_off, summary_off;
+  binaryOffsets(p_nrows,p_ncols,esize,&bounds_off,&base_off,&summary_off,
+      &p_dataOffset,&p_columnSize);
+
+  // Read row labels, bounds, base case values and column summaries. These
+  // sections follow each other in the file
+  std::vector<char> labels(p_nrows*STAT_BLOCK_LABEL);
+  p_bounds.resize(2*p_nrows);
+  p_base.resize(p_nrows);
+  p_summary.resize(4*p_ncols);
+  bool ok = true;
+  if (p_nrows > 0) {
+    ok = ok && p_file.read(&labels[0],labels.size());
+    ok = ok && p_file.read(reinterpret_cast<char*>(&p_bounds[0]),
+        p_bounds.size()*sizeof(double));
+    ok = ok && p_file.read(reinterpret_cast<char*>(&p_base[0]),
+        p_base.size()*sizeof(double));
+  }
+  if (p_ncols > 0) {
+    ok = ok && p_file.read(reinterpret_cast<char*>(&p_summary[0]),
+        p_summary.size()*sizeof(double));
+  }
+  if (!ok) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader: file %s is truncated\n",filename.c_str());
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  p_gidx.resize(p_nrows);
+  p_idx1.resize(p_nrows);
+  p_idx2.resize(p_nrows);
+  p_tags.resize(p_nrows);
+  int i;
+  for (i=0; i<p_nrows; i++) {
+    char *ptr = &labels[i*STAT_BLOCK_LABEL];
+    char tag[4];
+    memcpy(&p_gidx[i],ptr,sizeof(int));
+    memcpy(&p_idx1[i],ptr+sizeof(int),sizeof(int));
+    memcpy(&p_idx2[i],ptr+2*sizeof(int),sizeof(int));
+    memcpy(tag,ptr+3*sizeof(int),3);
+    tag[3] = '\0';
+    p_tags[i] = tag;
+  }
+}
+
+/**
+ * Default destructor
+ */
+sbr::~StatBlockReader(void)
+{
+  p_file.close();
+}
+
+/**
+ * @return number of rows in table
+ */
+int sbr::numRows(void) const
+{
+  return p_nrows;
+}
+
+/**
+ * @return number of columns in table
+ */
+int sbr::numColumns(void) const
+{
+  return p_ncols;
+}
+
+/**
+ * Read a column of data from the file
+ * @param idx index of column
+ * @param vals vector of column values
+ * @param mask vector of mask values
+ */
+void sbr::getColumn(int idx, std::vector<double> &vals, std::vector<int> &mask)
+{
+  if (idx < 0 || idx >= p_ncols) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader::getColumn: illegal column index %d\n",idx);
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  vals.resize(p_nrows);
+  mask.resize(p_nrows);
+  if (p_nrows == 0) return;
+  int i;
+  int esize = p_single ? sizeof(float) : sizeof(double);
+  std::vector<char> column(p_columnSize);
+  p_file.clear();
+  p_file.seekg(static_cast<std::streamoff>(p_dataOffset)
+      + static_cast<std::streamoff>(idx)*p_columnSize, std::ios::beg);
+  if (!p_file.read(&column[0],p_columnSize)) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader::getColumn: unable to read column %d\n",idx);
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  if (p_single) {
+    std::vector<float> fcol(p_nrows);
+    memcpy(&fcol[0],&column[0],p_nrows*sizeof(float));
+    for (i=0; i<p_nrows; i++) vals[i] = static_cast<double>(fcol[i]);
+  } else {
+    memcpy(&vals[0],&column[0],p_nrows*sizeof(double));
+  }
+  // The base case values are stored separately at full precision
+  if (idx == 0) {
+    vals = p_base;
+  } else if (p_delta) {
+    for (i=0; i<p_nrows; i++) vals[i] += p_base[i];
+  }
+  const signed char *mptr =
+    reinterpret_cast<const signed char*>(&column[p_nrows*esize]);
+  for (i=0; i<p_nrows; i++) mask[i] = static_cast<int>(mptr[i]);
+}
+
+/**
+ * Return the summary of a column that is stored in the file
+ * @param idx index of column
+ * @param count number of values included in summary
+ * @param min minimum value in column
+ * @param max maximum value in column
+ * @param mean mean value of column
+ */
+void sbr::getColumnSummary(int idx, int *count, double *min, double *max,
+    double *mean) const
+{
+  if (idx < 0 || idx >= p_ncols) {
+    char buf[256];
+    sprintf(buf,"StatBlockReader::getColumnSummary: illegal column index %d\n",
+        idx);
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  *count = static_cast<int>(p_summary[4*idx]);
+  *min = p_summary[4*idx+1];
+  *max = p_summary[4*idx+2];
+  *mean = p_summary[4*idx+3];
+}
+
+/**
+ * Write the label of a row into a character buffer
+ * @param idx index of row
+ * @param flag if false, do not include tag id
+ * @param buf character buffer
+ */
+void sbr::rowLabel(int idx, bool flag, char *buf) const
+{
+  if (flag) {
+    if (p_branch_flag) {
+      sprintf(buf,"%8d %8d %8d %s",p_gidx[idx],p_idx1[idx],p_idx2[idx],
+          p_tags[idx].c_str());
+    } else {
+      sprintf(buf,"%8d %8d %s",p_gidx[idx],p_idx1[idx],p_tags[idx].c_str());
+    }
+  } else {
+    if (p_branch_flag) {
+      sprintf(buf,"%8d %8d %8d",p_gidx[idx],p_idx1[idx],p_idx2[idx]);
+    } else {
+      sprintf(buf,"%8d %8d",p_gidx[idx],p_idx1[idx]);
+    }
+  }
+}
+
+/**
+ * Write out file containing mean value and RMS deviation for values in table
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ * @param flag if false, do not include tag ids in output
+ */
+void sbr::writeMeanAndRMS(std::string filename, int mval, bool flag)
+{
+  std::vector<double> vavg(p_nrows,0.0);
+  std::vector<double> vavg2(p_nrows,0.0);
+  std::vector<double> vdiff2(p_nrows,0.0);
+  std::vector<int> vcnt(p_nrows,0);
+  std::vector<double> vals;
+  std::vector<int> mask;
+  int i, j;
+  for (j=0; j<p_ncols; j++) {
+    getColumn(j,vals,mask);
+    for (i=0; i<p_nrows; i++) {
+      if (mask[i] >= mval) {
+        vcnt[i]++;
+        vavg[i] += vals[i];
+        vavg2[i] += vals[i]*vals[i];
+        if (j>0) {
+          double diff = vals[i] - p_base[i];
+          vdiff2[i] += diff*diff;
+        }
+      }
+    }
+  }
+  char sbuf[256];
+  std::ofstream fout;
+  fout.open(filename.c_str());
+  for (i=0; i<p_nrows; i++) {
+    double avg = vavg[i];
+    double avg2 = vavg2[i];
+    double diff2 = vdiff2[i];
+    int ncnt = vcnt[i];
+    if (ncnt > 0) {
+      avg /= ((double)ncnt);
+    } else {
+      avg = 0.0;
+    }
+    if (ncnt > 1) {
+      avg2 = (avg2-((double)ncnt)*avg*avg)/((double)(ncnt-1));
+      diff2 /= ((double)(ncnt-1));
+    } else {
+      avg2 = 0.0;
+      diff2 = 0.0;
+    }
+    if (avg2 > 0.0) {
+      avg2 = sqrt(avg2);
+    } else {
+      avg2 = 0.0;
+    }
+    if (diff2 > 0.0) {
+      diff2 = sqrt(diff2);
+    } else {
+      diff2 = 0.0;
+    }
+    rowLabel(i,flag,sbuf);
+    char *ptr = sbuf+strlen(sbuf);
+    sprintf(ptr," %16.8e %16.8e %16.8e",avg,avg2,diff2);
+    fout << sbuf << std::endl;
+  }
+  fout.close();
+}
+
+/**
+ * Write out file containing Min an Max values in table for each row
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ * @param flag if false, do not include tag ids in output
+ */
+void sbr::writeMinAndMax(std::string filename, int mval, bool flag)
+{
+  std::vector<double> vmin(p_base);
+  std::vector<double> vmax(p_base);
+  std::vector<int> jmin(p_nrows,0);
+  std::vector<int> jmax(p_nrows,0);
+  std::vector<double> vals;
+  std::vector<int> mask;
+  int i, j;
+  for (j=0; j<p_ncols; j++) {
+    getColumn(j,vals,mask);
+    for (i=0; i<p_nrows; i++) {
+      if (mask[i] >= mval) {
+        if (vals[i] > vmax[i]) {
+          vmax[i] = vals[i];
+          jmax[i] = j;
+        }
+        if (vals[i] < vmin[i]) {
+          vmin[i] = vals[i];
+          jmin[i] = j;
+        }
+      }
+    }
+  }
+  char sbuf[256];
+  std::ofstream fout;
+  fout.open(filename.c_str());
+  for (i=0; i<p_nrows; i++) {
+    rowLabel(i,flag,sbuf);
+    char *ptr = sbuf+strlen(sbuf);
+    sprintf(ptr," %16.8e %16.8e %16.8e %16.8e %16.8e",p_base[i],vmin[i],
+        vmax[i],vmin[i]-p_base[i],vmax[i]-p_base[i]);
+    ptr = sbuf+strlen(sbuf);
+    if (p_min_bound) {
+      sprintf(ptr," %16.8e",p_bounds[2*i]);
+    }
+    ptr = sbuf+strlen(sbuf);
+    if (p_max_bound) {
+      sprintf(ptr," %16.8e",p_bounds[2*i+1]);
+    }
+    ptr = sbuf+strlen(sbuf);
+    sprintf(ptr," %8d %8d",jmin[i],jmax[i]);
+    fout << sbuf << std::endl;
+  }
+  fout.close();
+}
+
+/**
+ * Write out file containing number of mask entries at each row that
+ * correspond to a given value
+ * @param filename name of file containing results
+ * @param mval count number of times this mask value occurs
+ * @param flag if false, do not include tag ids in output
+ */
+void sbr::writeMaskValueCount(std::string filename, int mval, bool flag)
+{
+  std::vector<int> vcnt(p_nrows,0);
+  std::vector<double> vals;
+  std::vector<int> mask;
+  int i, j;
+  for (j=0; j<p_ncols; j++) {
+    getColumn(j,vals,mask);
+    for (i=0; i<p_nrows; i++) {
+      if (mask[i] == mval) vcnt[i]++;
+    }
+  }
+  char sbuf[256];
+  std::ofstream fout;
+  fout.open(filename.c_str());
+  for (i=0; i<p_nrows; i++) {
+    rowLabel(i,flag,sbuf);
+    char *ptr = sbuf+strlen(sbuf);
+    sprintf(ptr," %8d",vcnt[i]);
+    fout << sbuf << std::endl;
+  }
+  fout.close();
+}
+
+/**
+ * Sum up the values in the columns and print the result as a function
+ * of column index
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ */
+void sbr::sumColumnValues(std::string filename, int mval)
+{
+  std::vector<double> vals;
+  std::vector<int> mask;
+  int i, j;
+  char sbuf[128];
+  std::ofstream fout;
+  fout.open(filename.c_str());
+  for (j=0; j<p_ncols; j++) {
+    getColumn(j,vals,mask);
+    double sum = 0.0;
+    for (i=0; i<p_nrows; i++) {
+      if (mask[i] >= mval) sum += vals[i];
+    }
+    double sum_avg=0.0;
+    if (p_nrows > 0) sum_avg = sum/(static_cast<double>(p_nrows));
+    sprintf(sbuf,"%8d %16.8e %16.8e",j,sum,sum_avg);
+    fout << sbuf << std::endl;
+  }
+  fout.close();
+}
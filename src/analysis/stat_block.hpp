@@ -25,7 +25,9 @@
 
 #include <ga.h>
 #include <map>
+#include <string>
 #include <vector>
+#include <fstream>
 #include "gridpack/parallel/communicator.hpp"
 
 namespace gridpack {
@@ -123,6 +125,23 @@ public:
    * @param mval only include values with this mask value or greater
    */
   void sumColumnValues(std::string filename, int mval=1);
+
+  /**
+   * Write the contents of the table to a binary file that is organized by
+   * columns. Each processor writes the part of the table that it owns, so
+   * nothing is gathered on a single processor. The file also contains the
+   * row labels, bounds and a summary (count, minimum, maximum and mean of
+   * values with mask value 1 or greater) for each column. The text reports
+   * can be generated from the file with StatBlockReader. This is collective
+   * @param filename name of binary file
+   * @param single store values as single precision floats
+   * @param delta store values as differences from the base case values in
+   *              column 0. This is mostly useful in combination with single,
+   *              since the differences are usually much smaller than the
+   *              values themselves
+   */
+  void writeBinary(std::string filename, bool single = false,
+      bool delta = false);
 private:
 
   int p_data;
@@ -146,6 +165,122 @@ private:
 
 };
 
+class StatBlockReader {
+public:
+  /**
+   * Constructor. This is not collective
+   * @param filename name of file written by StatBlock::writeBinary
+   */
+  StatBlockReader(std::string filename);
+
+  /**
+   * Default destructor
+   */
+  ~StatBlockReader(void);
+
+  /**
+   * @return number of rows in table
+   */
+  int numRows(void) const;
+
+  /**
+   * @return number of columns in table
+   */
+  int numColumns(void) const;
+
+  /**
+   * Read a column of data from the file
+   * @param idx index of column
+   * @param vals vector of column values
+   * @param mask vector of mask values
+   */
+  void getColumn(int idx, std::vector<double> &vals, std::vector<int> &mask);
+
+  /**
+   * Return the summary of a column that is stored in the file. Only values
+   * with a mask value of 1 or greater are included
+   * @param idx index of column
+   * @param count number of values included in summary
+   * @param min minimum value in column
+   * @param max maximum value in column
+   * @param mean mean value of column
+   */
+  void getColumnSummary(int idx, int *count, double *min, double *max,
+      double *mean) const;
+
+  /**
+   * The following functions write the same files as the corresponding
+   * functions in StatBlock. Columns are read one at a time, so only a few
+   * vectors the length of a column are held in memory
+   */
+
+  /**
+   * Write out file containing mean value and RMS deviation for values in table
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMeanAndRMS(std::string filename, int mval=1, bool flag = true);
+
+  /**
+   * Write out file containing Min an Max values in table for each row
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMinAndMax(std::string filename, int mval=1, bool flag = true);
+
+  /**
+   * Write out file containing number of mask entries at each row that
+   * correspond to a given value
+   * @param filename name of file containing results
+   * @param mval count number of times this mask value occurs
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMaskValueCount(std::string filename, int mval, bool flag = true);
+
+  /**
+   * Sum up the values in the columns and print the result as a function
+   * of column index
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   */
+  void sumColumnValues(std::string filename, int mval=1);
+
+private:
+
+  /**
+   * Write the label of a row into a character buffer
+   * @param idx index of row
+   * @param flag if false, do not include tag id
+   * @param buf character buffer
+   */
+  void rowLabel(int idx, bool flag, char *buf) const;
+
+  std::ifstream p_file;
+
+  int p_nrows;
+  int p_ncols;
+
+  bool p_single;
+  bool p_delta;
+  bool p_max_bound;
+  bool p_min_bound;
+  bool p_branch_flag;
+
+  // row labels, bounds, base case values and column summaries
+  std::vector<int> p_gidx;
+  std::vector<int> p_idx1;
+  std::vector<int> p_idx2;
+  std::vector<std::string> p_tags;
+  std::vector<double> p_bounds;
+  std::vector<double> p_base;
+  std::vector<double> p_summary;
+
+  long p_dataOffset;
+  long p_columnSize;
+};
+
 
 } // namespace gridpack
 } // namespace analysis
@@ -0,0 +1,126 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   result_store_test.cpp
+ *
+ * @brief  A simple test of the GridPACK result store module
+ *
+ *
+ */
+
+// -------------------------------------------------------------
+
+#include <iostream>
+#include <ga.h>
+#include "gridpack/parallel/parallel.hpp"
+#include "gridpack/analysis/result_store.hpp"
+#include "gridpack/environment/environment.hpp"
+
+#define NVALUES  20
+
+// -------------------------------------------------------------
+//  Main Program
+// -------------------------------------------------------------
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc, argv);
+  // Create an artificial scope so that all objects call their destructors
+  // before GA_Terminate is called
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+    int nproc = world.size();
+    if (me == 0) {
+      printf("Testing ResultStore on %d processors\n\n",nproc);
+    }
+    int i, j;
+    std::string filename("result_store_test.bin");
+    // Each processor appends two records. The second record is shorter
+    // than the record size, so it should be padded with zeros
+    {
+      gridpack::analysis::ResultStore store(world,filename,NVALUES);
+      for (i=0; i<2; i++) {
+        int task = 2*me+i;
+        std::vector<double> vals;
+        std::vector<int> mask;
+        for (j=0; j<NVALUES-i; j++) {
+          vals.push_back(static_cast<double>(100*task+j));
+          mask.push_back(j%3);
+        }
+        store.appendRecord(task,i,vals,mask);
+      }
+      store.close();
+    }
+
+    // Read back all records and check values
+    int chk = 1;
+    if (me == 0) {
+      gridpack::analysis::ResultStoreReader reader(filename);
+      if (reader.numValues() != NVALUES) {
+        printf("Expected %d values per record, found %d\n",NVALUES,
+            reader.numValues());
+        chk = 0;
+      }
+      int nslots = reader.numSlots();
+      if (nslots != 2*nproc) {
+        printf("Expected %d records, found %d\n",2*nproc,nslots);
+        chk = 0;
+      }
+      std::vector<int> found(2*nproc,0);
+      for (i=0; i<nslots; i++) {
+        int task, status;
+        std::vector<double> vals;
+        std::vector<int> mask;
+        if (!reader.getRecord(i,&task,&status,vals,mask)) {
+          printf("Record %d was not written\n",i);
+          chk = 0;
+          continue;
+        }
+        if (task < 0 || task >= 2*nproc || status != task%2 ||
+            vals.size() != NVALUES || mask.size() != NVALUES) {
+          printf("Mistake found in record %d task: %d status: %d\n",
+              i,task,status);
+          chk = 0;
+          continue;
+        }
+        found[task]++;
+        for (j=0; j<NVALUES; j++) {
+          double val = static_cast<double>(100*task+j);
+          int mval = j%3;
+          if (j >= NVALUES-status) {
+            val = 0.0;
+            mval = 0;
+          }
+          if (vals[j] != val || mask[j] != mval) {
+            printf("Mistake found in record %d at value %d. Expected val: %f"
+                " mask: %d Actual val: %f mask: %d\n",i,j,val,mval,
+                vals[j],mask[j]);
+            chk = 0;
+            break;
+          }
+        }
+      }
+      for (i=0; i<2*nproc; i++) {
+        if (found[i] != 1) {
+          printf("Record for task %d found %d times\n",i,found[i]);
+          chk = 0;
+        }
+      }
+    }
+    world.sync();
+    if (me == 0) {
+      if (chk == 1) {
+        printf("Result store records OK\n");
+      } else {
+        printf("Error found in result store records\n");
+      }
+    }
+  }
+  return 0;
+}
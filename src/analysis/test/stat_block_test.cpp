@@ -0,0 +1,188 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   stat_block_test.cpp
+ *
+ * @brief  A test of the binary output of the GridPACK stat block module.
+ * Tables are written with StatBlock::writeBinary, read back with
+ * StatBlockReader and the text files written by the reader are compared
+ * with the text files written by the StatBlock
+ *
+ *
+ */
+
+// -------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <ga.h>
+#include "gridpack/parallel/parallel.hpp"
+#include "gridpack/analysis/stat_block.hpp"
+#include "gridpack/environment/environment.hpp"
+
+#define NROWS  12
+#define NCOLS  7
+
+// Test values are multiples of 0.25 so that they, and their differences
+// from the base case, are exact in single precision
+double testValue(int row, int col)
+{
+  return 0.25*static_cast<double>((7*row+3*col+5*row*col)%41) - 3.0;
+}
+
+int testMask(int row, int col)
+{
+  if (col == 0) return 1;
+  return (row+2*col)%3;
+}
+
+/**
+ * Compare the contents of two text files
+ * @param file1 name of first file
+ * @param file2 name of second file
+ * @return true if both files exist and are identical
+ */
+bool sameFile(const std::string &file1, const std::string &file2)
+{
+  std::ifstream f1(file1.c_str());
+  std::ifstream f2(file2.c_str());
+  if (!f1.is_open() || !f2.is_open()) return false;
+  std::stringstream s1, s2;
+  s1 << f1.rdbuf();
+  s2 << f2.rdbuf();
+  return s1.str() == s2.str() && s1.str().size() > 0;
+}
+
+/**
+ * Write a stat block in binary for each combination of the single and delta
+ * flags, read it back and check it against the original values and the
+ * text output of the stat block
+ * @param world communicator
+ * @param branch use branch labels (true) or bus labels (false)
+ * @return true if no errors were found
+ */
+bool testBlock(gridpack::parallel::Communicator &world, bool branch)
+{
+  int me = world.rank();
+  int i, j;
+  std::string name(branch ? "branch" : "bus");
+  gridpack::analysis::StatBlock block(world,NROWS,NCOLS);
+  if (me == 0) {
+    std::vector<int> idx1, idx2;
+    std::vector<std::string> tags;
+    std::vector<double> vmin, vmax;
+    for (i=0; i<NROWS; i++) {
+      idx1.push_back(i+1);
+      idx2.push_back(i+101);
+      tags.push_back(i%2 == 0 ? "1" : "BR");
+      vmin.push_back(-2.0-0.5*static_cast<double>(i));
+      vmax.push_back(4.0+0.5*static_cast<double>(i));
+    }
+    if (branch) {
+      block.addRowLabels(idx1,idx2,tags);
+    } else {
+      block.addRowLabels(idx1,tags);
+      block.addRowMinValue(vmin);
+      block.addRowMaxValue(vmax);
+    }
+    for (j=0; j<NCOLS; j++) {
+      std::vector<double> vals;
+      std::vector<int> mask;
+      for (i=0; i<NROWS; i++) {
+        vals.push_back(testValue(i,j));
+        mask.push_back(testMask(i,j));
+      }
+      block.addColumnValues(j,vals,mask);
+    }
+  }
+  world.sync();
+
+  // Text output from the stat block itself
+  block.writeMeanAndRMS(name+"_rms.txt");
+  block.writeMinAndMax(name+"_minmax.txt");
+  block.writeMaskValueCount(name+"_count.txt",2);
+  block.sumColumnValues(name+"_sum.txt");
+
+  bool ok = true;
+  int k;
+  for (k=0; k<4; k++) {
+    bool single = (k%2 == 1);
+    bool delta = (k/2 == 1);
+    char sbuf[128];
+    sprintf(sbuf,"%s_single%d_delta%d",name.c_str(),single,delta);
+    std::string prefix(sbuf);
+    block.writeBinary(prefix+".bin",single,delta);
+    if (me != 0) continue;
+    gridpack::analysis::StatBlockReader reader(prefix+".bin");
+    if (reader.numRows() != NROWS || reader.numColumns() != NCOLS) {
+      printf("%s: expected %d rows and %d columns, found %d and %d\n",
+          prefix.c_str(),NROWS,NCOLS,reader.numRows(),reader.numColumns());
+      ok = false;
+      continue;
+    }
+    for (j=0; j<NCOLS; j++) {
+      std::vector<double> vals;
+      std::vector<int> mask;
+      reader.getColumn(j,vals,mask);
+      for (i=0; i<NROWS; i++) {
+        if (vals[i] != testValue(i,j) || mask[i] != testMask(i,j)) {
+          printf("%s: mistake in row %d column %d. Expected val: %f"
+              " mask: %d Actual val: %f mask: %d\n",prefix.c_str(),i,j,
+              testValue(i,j),testMask(i,j),vals[i],mask[i]);
+          ok = false;
+        }
+      }
+    }
+    reader.writeMeanAndRMS(prefix+"_rms.txt");
+    reader.writeMinAndMax(prefix+"_minmax.txt");
+    reader.writeMaskValueCount(prefix+"_count.txt",2);
+    reader.sumColumnValues(prefix+"_sum.txt");
+    const char *files[4] = {"_rms.txt","_minmax.txt","_count.txt","_sum.txt"};
+    for (i=0; i<4; i++) {
+      if (!sameFile(name+files[i],prefix+files[i])) {
+        printf("%s: file %s does not match %s\n",prefix.c_str(),
+            (prefix+files[i]).c_str(),(name+files[i]).c_str());
+        ok = false;
+      }
+    }
+  }
+  int iok = ok ? 1 : 0;
+  int chk;
+  MPI_Allreduce(&iok,&chk,1,MPI_INT,MPI_MIN,static_cast<MPI_Comm>(world));
+  return chk == 1;
+}
+
+// -------------------------------------------------------------
+//  Main Program
+// -------------------------------------------------------------
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc, argv);
+  // Create an artificial scope so that all objects call their destructors
+  // before GA_Terminate is called
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+    int nproc = world.size();
+    if (me == 0) {
+      printf("Testing StatBlock binary output on %d processors\n\n",nproc);
+    }
+    bool ok = testBlock(world,false);
+    ok = testBlock(world,true) && ok;
+    if (me == 0) {
+      if (ok) {
+        printf("StatBlock binary output OK\n");
+      } else {
+        printf("Error found in StatBlock binary output\n");
+      }
+    }
+  }
+  return 0;
+}
@@ -17,6 +17,7 @@
 
 #include <vector>
 #include <iostream>
+#include <typeinfo>
 #include <cstring>
 #include <stdio.h>
 
@@ -41,6 +42,8 @@ gridpack::powerflow::PFBus::PFBus(void)
   p_theta = 0.0;
   p_angle = 0.0;
   p_voltage = 0.0;
+  p_saveV = 0.0;
+  p_saveA = 0.0;
   /*p_pl = 0.0;
   p_ql = 0.0;
   p_ip = 0.0;
@@ -136,6 +139,49 @@ bool gridpack::powerflow::PFBus::matrixDiagValues(RealType *values)
   return false;
 }
 
+/**
+ * Return the values of the diagonal blocks of a set of PFBus components.
+ * All components in comps are the same type as this one.
+ * @param n: number of buses
+ * @param comps: buses
+ * @param offsets: location in values of the block of each bus
+ * @param values: array that receives the blocks
+ * @param ok: 1 for each bus that contributes a block, 0 otherwise
+ */
+void gridpack::powerflow::PFBus::matrixDiagValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, ComplexType *values, int *ok)
+{
+  // Classes derived from PFBus may override matrixDiagValues, so only
+  // skip the virtual call if this set is made of PFBus objects
+  if (typeid(*this) != typeid(PFBus)) {
+    gridpack::component::MatVecInterface::matrixDiagValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBus*>(comps[i])->PFBus::matrixDiagValues(
+        values+offsets[i]);
+  }
+}
+
+void gridpack::powerflow::PFBus::matrixDiagValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, RealType *values, int *ok)
+{
+  // Classes derived from PFBus may override matrixDiagValues, so only
+  // skip the virtual call if this set is made of PFBus objects
+  if (typeid(*this) != typeid(PFBus)) {
+    gridpack::component::MatVecInterface::matrixDiagValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBus*>(comps[i])->PFBus::matrixDiagValues(
+        values+offsets[i]);
+  }
+}
+
 /**
  * Return the size of the block that this component contributes to the
  * vector
@@ -622,6 +668,33 @@ void gridpack::powerflow::PFBus::resetVoltage(void)
   }
 }
 
+/**
+ * Save current voltage and phase angle
+ */
+void gridpack::powerflow::PFBus::saveVoltage(void)
+{
+  p_saveV = p_v;
+  p_saveA = p_a;
+}
+
+/**
+ * Restore voltage and phase angle to the values saved by saveVoltage
+ */
+void gridpack::powerflow::PFBus::restoreVoltage(void)
+{
+  p_v = p_saveV;
+  p_a = p_saveA;
+  if (p_vMag_ptr) *p_vMag_ptr = p_v;
+  if (p_vAng_ptr) {
+    double pi = 4.0*atan(1.0);
+    if (p_a >= 0.0) {
+      *p_vAng_ptr = fmod(p_a+pi,2.0*pi)-pi;
+    } else {
+      *p_vAng_ptr = fmod(p_a-pi,2.0*pi)+pi;
+    }
+  }
+}
+
 /**
  * Set voltage limits on bus
  * @param vmin lower value of voltage
@@ -1864,6 +1937,83 @@ bool gridpack::powerflow::PFBranch::matrixReverseValues(RealType *values)
   return false;
 }
 
+/**
+ * Return the values of the forward/reverse blocks of a set of PFBranch
+ * components. All components in comps are the same type as this one.
+ * @param n: number of branches
+ * @param comps: branches
+ * @param offsets: location in values of the block of each branch
+ * @param values: array that receives the blocks
+ * @param ok: 1 for each branch that contributes a block, 0 otherwise
+ */
+void gridpack::powerflow::PFBranch::matrixForwardValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, ComplexType *values, int *ok)
+{
+  // Classes derived from PFBranch may override matrixForwardValues, so only
+  // skip the virtual call if this set is made of PFBranch objects
+  if (typeid(*this) != typeid(PFBranch)) {
+    gridpack::component::MatVecInterface::matrixForwardValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBranch*>(comps[i])->PFBranch::matrixForwardValues(
+        values+offsets[i]);
+  }
+}
+
+void gridpack::powerflow::PFBranch::matrixForwardValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, RealType *values, int *ok)
+{
+  // Classes derived from PFBranch may override matrixForwardValues, so only
+  // skip the virtual call if this set is made of PFBranch objects
+  if (typeid(*this) != typeid(PFBranch)) {
+    gridpack::component::MatVecInterface::matrixForwardValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBranch*>(comps[i])->PFBranch::matrixForwardValues(
+        values+offsets[i]);
+  }
+}
+
+void gridpack::powerflow::PFBranch::matrixReverseValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, ComplexType *values, int *ok)
+{
+  // Classes derived from PFBranch may override matrixReverseValues, so only
+  // skip the virtual call if this set is made of PFBranch objects
+  if (typeid(*this) != typeid(PFBranch)) {
+    gridpack::component::MatVecInterface::matrixReverseValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBranch*>(comps[i])->PFBranch::matrixReverseValues(
+        values+offsets[i]);
+  }
+}
+
+void gridpack::powerflow::PFBranch::matrixReverseValuesBlock(int n,
+    gridpack::component::MatVecInterface *const *comps,
+    const int *offsets, RealType *values, int *ok)
+{
+  // Classes derived from PFBranch may override matrixReverseValues, so only
+  // skip the virtual call if this set is made of PFBranch objects
+  if (typeid(*this) != typeid(PFBranch)) {
+    gridpack::component::MatVecInterface::matrixReverseValuesBlock(n, comps,
+        offsets, values, ok);
+    return;
+  }
+  for (int i=0; i<n; i++) {
+    ok[i] = static_cast<PFBranch*>(comps[i])->PFBranch::matrixReverseValues(
+        values+offsets[i]);
+  }
+}
+
 // Calculate contributions to the admittance matrix from the branches
 void gridpack::powerflow::PFBranch::setYBus(void)
 {
@@ -62,6 +62,22 @@ class PFBus
     bool matrixDiagValues(ComplexType *values);
     bool matrixDiagValues(RealType *values);
 
+    /**
+     * Return the values of the diagonal blocks of a set of PFBus
+     * components without a virtual call for each bus
+     * @param n: number of buses
+     * @param comps: buses
+     * @param offsets: location in values of the block of each bus
+     * @param values: array that receives the blocks
+     * @param ok: 1 for each bus that contributes a block, 0 otherwise
+     */
+    void matrixDiagValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    void matrixDiagValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+
     /**
      * Return size of vector block contributed by component
      * @param isize: number of vector elements
@@ -132,6 +148,17 @@ class PFBus
      */
     void resetVoltage(void);
 
+    /**
+     * Save current voltage and phase angle so that they can be restored by
+     * restoreVoltage
+     */
+    void saveVoltage(void);
+
+    /**
+     * Restore voltage and phase angle to the values saved by saveVoltage
+     */
+    void restoreVoltage(void);
+
     /**
      * Set voltage limits on bus
      * @param vmin lower value of voltage
@@ -434,6 +461,7 @@ class PFBus
     double p_P0, p_Q0; //double p_sbusr, p_sbusi;
     double p_angle;   // initial bus angle read from parser
     double p_voltage; // initial bus voltage read from parser
+    double p_saveV, p_saveA; // voltage and angle saved by saveVoltage
     // newly added priavate variables:
     std::vector<double> p_pg, p_qg, p_pFac;
     std::vector<double> p_savePg;
@@ -495,6 +523,7 @@ private:
       & p_ybusr & p_ybusi
       & p_P0 & p_Q0
       & p_angle & p_voltage
+      & p_saveV & p_saveA
       & p_pg & p_qg & p_pFac & p_qmin & p_qmax
       & p_qmin_orig & p_qmax_orig & p_pFac_orig
       & p_gstatus
@@ -549,6 +578,28 @@ class PFBranch
     bool matrixForwardValues(RealType *values);
     bool matrixReverseValues(RealType *values);
 
+    /**
+     * Return the values of the forward/reverse blocks of a set of PFBranch
+     * components without a virtual call for each branch
+     * @param n: number of branches
+     * @param comps: branches
+     * @param offsets: location in values of the block of each branch
+     * @param values: array that receives the blocks
+     * @param ok: 1 for each branch that contributes a block, 0 otherwise
+     */
+    void matrixForwardValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    void matrixForwardValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+    void matrixReverseValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    void matrixReverseValuesBlock(int n,
+        gridpack::component::MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+
     /**
      * Set values of YBus matrix. These can then be used in subsequent
      * calculations
@@ -18,6 +18,7 @@
  */
 // -------------------------------------------------------------
 
+#include <fstream>
 #include "gridpack/include/gridpack.hpp"
 #include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
 #include "ca_driver.hpp"
@@ -204,6 +205,55 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   if (!cursor->get("checkQLimit",&check_Qlim)) {
     check_Qlim = false;
   }
+  // Solve contingencies with a low rank update of the base Jacobian
+  bool use_low_rank;
+  if (!cursor->get("useLowRankSolver",&use_low_rank)) {
+    use_low_rank = false;
+  }
+  int max_rank;
+  if (!cursor->get("maxUpdateRank",&max_rank)) {
+    max_rank = 32;
+  }
+  // Start contingency calculations from the base case solution instead of
+  // the voltages in the network configuration file
+  bool warm_start;
+  if (!cursor->get("warmStart",&warm_start)) {
+    warm_start = false;
+  }
+  // Number of contingencies taken from the task manager at a time and a file
+  // of estimated contingency costs. If the file has one cost for each
+  // contingency, the most expensive contingencies are run first. The time
+  // spent on each contingency is written back to the file at the end of the
+  // run
+  int task_chunk;
+  if (!cursor->get("taskChunkSize",&task_chunk)) {
+    task_chunk = 1;
+  }
+  std::string cost_file;
+  if (!cursor->get("taskCostFile",&cost_file)) {
+    cost_file.clear();
+  }
+  // File to which the results of each contingency are appended as they
+  // finish. Records can be read with gridpack::analysis::ResultStoreReader
+  std::string result_file;
+  if (!cursor->get("resultStore",&result_file)) {
+    result_file.clear();
+  }
+  // Write statistics as binary files instead of text reports. The reports
+  // can be generated from the binary files with ca_stats.x, which uses
+  // gridpack::analysis::StatBlockReader
+  bool binary_stats;
+  if (!cursor->get("binaryStatistics",&binary_stats)) {
+    binary_stats = false;
+  }
+  bool binary_single;
+  if (!cursor->get("binarySinglePrecision",&binary_single)) {
+    binary_single = false;
+  }
+  bool binary_delta;
+  if (!cursor->get("binaryDelta",&binary_delta)) {
+    binary_delta = false;
+  }
   gridpack::parallel::Communicator task_comm = world.divide(grp_size);
 
   // Keep track of failed calculations
@@ -237,6 +287,7 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   // Some buses may violate the voltage limits in the base problem. Flag these
   // buses to ignore voltage violations on them.
   pf_app.ignoreVoltageViolations();
+  if (warm_start) pf_app.saveVoltages();
 
   // Read in contingency file name
   std::string contingencyfile;
@@ -285,7 +336,20 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   // equal to the number of contingencies
   gridpack::parallel::TaskManager taskmgr(world);
   int ntasks = events.size();
-  taskmgr.set(ntasks);
+  taskmgr.setChunkSize(task_chunk);
+  std::vector<double> task_costs;
+  bool have_costs = false;
+  if (!cost_file.empty()) {
+    std::ifstream fin(cost_file.c_str());
+    double cost;
+    while (fin >> cost) task_costs.push_back(cost);
+    have_costs = (task_costs.size() == ntasks);
+  }
+  if (world.all(have_costs)) {
+    taskmgr.set(ntasks,task_costs);
+  } else {
+    taskmgr.set(ntasks);
+  }
 
   int nbus = pf_network->totalBuses();
   // Get bus voltage information for base case
@@ -446,14 +510,35 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
     pflow_stats.addRowMaxValue(pmax);
     qflow_stats.addRowMaxValue(pmax);
   }
+  // Each record in the result store holds voltage magnitudes followed by
+  // real and reactive power flows. The number of flows is fixed here,
+  // since nsize is reused while parsing contingency results
+  const int nflows = nsize;
+  boost::scoped_ptr<gridpack::analysis::ResultStore> results;
+  std::vector<double> rvals;
+  std::vector<int> rmask;
+  if (!result_file.empty()) {
+    results.reset(new gridpack::analysis::ResultStore(world,result_file,
+          nmags+2*nflows));
+  }
   timer->stop(t_store);
 #endif
   if (check_Qlim) pf_app.clearQlimViolations();
+  // Factor the Jacobian that all contingency calculations start from
+  if (use_low_rank) {
+    if (warm_start) {
+      pf_app.restoreVoltages();
+    } else {
+      pf_app.resetVoltages();
+    }
+    pf_app.initLowRankSolver(max_rank);
+  }
 
 
   // Evaluate contingencies using the task manager
   int task_id;
   char sbuf[128];
+  gridpack::powerflow::ContingencyDelta delta;
   // nextTask returns the same task_id on all processors in task_comm. When the
   // calculation runs out of task, nextTask will return false.
   while (taskmgr.nextTask(task_comm, &task_id)) {
@@ -490,15 +575,27 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
       }
     }
     if (print_calcs) pf_app.writeHeader(sbuf);
-    // Reset all voltages back to their original values
-    pf_app.resetVoltages();
-    // Set contingency
-    pf_app.setContingency(events[task_id]);
+    // Reset all voltages back to their original or base case values
+    if (warm_start) {
+      pf_app.restoreVoltages();
+    } else {
+      pf_app.resetVoltages();
+    }
+    // Set contingency. Only the buses and branches it changes are visited
+    pf_app.getContingencyDelta(events[task_id], delta);
+    pf_app.applyContingency(delta);
     // Solve power flow equations for this system
 #ifdef USE_SUCCESS
     contingency_idx.push_back(task_id);
 #endif
-    if (pf_app.solve()) {
+    bool pf_ok;
+    int result_status = 0;
+    if (use_low_rank) {
+      pf_ok = pf_app.solveLowRank();
+    } else {
+      pf_ok = pf_app.solve();
+    }
+    if (pf_ok) {
 #ifdef USE_SUCCESS
       contingency_success.push_back(true);
 #endif
@@ -511,6 +608,15 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
       bool ok1 = pf_app.checkVoltageViolations();
       bool ok2 = pf_app.checkLineOverloadViolations();
       bool ok = ok1 && ok2;
+      if (ok) {
+        result_status = 1;
+      } else if (!ok1 && !ok2) {
+        result_status = 4;
+      } else if (!ok1) {
+        result_status = 2;
+      } else {
+        result_status = 3;
+      }
       // Include results of violation checks in output
       if (ok) {
         sprintf(sbuf,"\nNo violation for contingency %s\n",
@@ -733,14 +839,46 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
       timer->stop(t_store);
 #endif
     } 
+#ifdef USE_STATBLOCK
+    // Append results to the result store without waiting for other tasks
+    if (results && task_comm.rank() == 0) {
+      timer->start(t_store);
+      rvals.assign(nmags+2*nflows,0.0);
+      rmask.assign(nmags+2*nflows,0);
+      for (i=0; i<vmag.size() && i<nmags; i++) {
+        rvals[i] = vmag[i];
+        rmask[i] = mag_mask[i];
+      }
+      for (i=0; i<pflow.size() && i<nflows; i++) {
+        rvals[nmags+i] = pflow[i];
+        rvals[nmags+nflows+i] = qflow[i];
+        rmask[nmags+i] = mask[i];
+        rmask[nmags+nflows+i] = mask[i];
+      }
+      results->appendRecord(task_id,result_status,rvals,rmask);
+      timer->stop(t_store);
+    }
+#endif
     // Return network to its original base case state
-    pf_app.unSetContingency(events[task_id]);
+    pf_app.revertContingency(delta);
     // Close output file for this contingency
     if (print_calcs) pf_app.close();
   }
   // Print statistics from task manager describing the number of tasks performed
   // per processor
   taskmgr.printStats();
+#ifdef USE_STATBLOCK
+  if (results) results->close();
+#endif
+  if (!cost_file.empty()) {
+    std::vector<double> task_times;
+    taskmgr.getTaskTimes(task_times);
+    if (world.rank() == 0) {
+      std::ofstream fout(cost_file.c_str());
+      int i;
+      for (i=0; i<ntasks; i++) fout << task_times[i] << std::endl;
+    }
+  }
 
   // Gather stats on successful contingency calculations
 #ifdef USE_SUCCESS
@@ -785,22 +923,32 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
 #ifdef USE_STATBLOCK
   int t_stats = timer->createCategory("Write Statistics");
   timer->start(t_stats);
-  vmag_stats.writeMeanAndRMS("vmag.txt",1,false);
-  vmag_stats.writeMinAndMax("vmag_mm.txt",1,false);
-  if (check_Qlim) vmag_stats.writeMaskValueCount("pq_change_cnt.txt",2,false);
-  vang_stats.writeMeanAndRMS("vang.txt",1,false);
-  vang_stats.writeMinAndMax("vang_mm.txt",1,false);
-  pgen_stats.writeMeanAndRMS("pgen.txt",1);
-  pgen_stats.writeMinAndMax("pgen_mm.txt",1);
-  qgen_stats.writeMeanAndRMS("qgen.txt",1);
-  qgen_stats.writeMinAndMax("qgen_mm.txt",1);
-  pflow_stats.writeMeanAndRMS("pflow.txt",1);
-  pflow_stats.writeMinAndMax("pflow_mm.txt",1);
-  pflow_stats.writeMaskValueCount("line_flt_cnt.txt",2);
-  qflow_stats.writeMeanAndRMS("qflow.txt",1);
-  qflow_stats.writeMinAndMax("qflow_mm.txt",1);
-  perf_stats.writeMinAndMax("perf_mm.txt",1);
-  perf_stats.sumColumnValues("perf_sum.txt",1);
+  if (binary_stats) {
+    vmag_stats.writeBinary("vmag.bin",binary_single,binary_delta);
+    vang_stats.writeBinary("vang.bin",binary_single,binary_delta);
+    pgen_stats.writeBinary("pgen.bin",binary_single,binary_delta);
+    qgen_stats.writeBinary("qgen.bin",binary_single,binary_delta);
+    pflow_stats.writeBinary("pflow.bin",binary_single,binary_delta);
+    qflow_stats.writeBinary("qflow.bin",binary_single,binary_delta);
+    perf_stats.writeBinary("perf.bin",binary_single,binary_delta);
+  } else {
+    vmag_stats.writeMeanAndRMS("vmag.txt",1,false);
+    vmag_stats.writeMinAndMax("vmag_mm.txt",1,false);
+    if (check_Qlim) vmag_stats.writeMaskValueCount("pq_change_cnt.txt",2,false);
+    vang_stats.writeMeanAndRMS("vang.txt",1,false);
+    vang_stats.writeMinAndMax("vang_mm.txt",1,false);
+    pgen_stats.writeMeanAndRMS("pgen.txt",1);
+    pgen_stats.writeMinAndMax("pgen_mm.txt",1);
+    qgen_stats.writeMeanAndRMS("qgen.txt",1);
+    qgen_stats.writeMinAndMax("qgen_mm.txt",1);
+    pflow_stats.writeMeanAndRMS("pflow.txt",1);
+    pflow_stats.writeMinAndMax("pflow_mm.txt",1);
+    pflow_stats.writeMaskValueCount("line_flt_cnt.txt",2);
+    qflow_stats.writeMeanAndRMS("qflow.txt",1);
+    qflow_stats.writeMinAndMax("qflow_mm.txt",1);
+    perf_stats.writeMinAndMax("perf_mm.txt",1);
+    perf_stats.sumColumnValues("perf_sum.txt",1);
+  }
   timer->stop(t_stats);
 #endif
   timer->stop(t_total);
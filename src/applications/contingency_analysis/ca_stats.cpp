@@ -0,0 +1,96 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ca_stats.cpp
+ *
+ * @brief
+ * Generate the text statistics files of the contingency analysis from the
+ * binary files that are written if binaryStatistics is set. The program
+ * is run in the directory containing the binary files and writes the same
+ * text files as a contingency analysis run without binaryStatistics. Use
+ * the -qlim argument if the run checked generator reactive power limits
+ */
+// -------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include "gridpack/analysis/stat_block.hpp"
+#include "gridpack/utilities/exception.hpp"
+
+/**
+ * Open a binary statistics file if it exists
+ * @param filename name of binary file
+ * @return reader for file or NULL if the file does not exist
+ */
+gridpack::analysis::StatBlockReader* openStats(const char *filename)
+{
+  if (access(filename,R_OK) != 0) {
+    printf("Statistics file %s not found\n",filename);
+    return NULL;
+  }
+  return new gridpack::analysis::StatBlockReader(filename);
+}
+
+int
+main(int argc, char **argv)
+{
+  bool check_Qlim = false;
+  int i;
+  for (i=1; i<argc; i++) {
+    if (strcmp(argv[i],"-qlim") == 0) {
+      check_Qlim = true;
+    } else {
+      printf("Usage: %s [-qlim]\n",argv[0]);
+      return 1;
+    }
+  }
+  try {
+    gridpack::analysis::StatBlockReader *stats;
+    if ((stats = openStats("vmag.bin")) != NULL) {
+      stats->writeMeanAndRMS("vmag.txt",1,false);
+      stats->writeMinAndMax("vmag_mm.txt",1,false);
+      if (check_Qlim) stats->writeMaskValueCount("pq_change_cnt.txt",2,false);
+      delete stats;
+    }
+    if ((stats = openStats("vang.bin")) != NULL) {
+      stats->writeMeanAndRMS("vang.txt",1,false);
+      stats->writeMinAndMax("vang_mm.txt",1,false);
+      delete stats;
+    }
+    if ((stats = openStats("pgen.bin")) != NULL) {
+      stats->writeMeanAndRMS("pgen.txt",1);
+      stats->writeMinAndMax("pgen_mm.txt",1);
+      delete stats;
+    }
+    if ((stats = openStats("qgen.bin")) != NULL) {
+      stats->writeMeanAndRMS("qgen.txt",1);
+      stats->writeMinAndMax("qgen_mm.txt",1);
+      delete stats;
+    }
+    if ((stats = openStats("pflow.bin")) != NULL) {
+      stats->writeMeanAndRMS("pflow.txt",1);
+      stats->writeMinAndMax("pflow_mm.txt",1);
+      stats->writeMaskValueCount("line_flt_cnt.txt",2);
+      delete stats;
+    }
+    if ((stats = openStats("qflow.bin")) != NULL) {
+      stats->writeMeanAndRMS("qflow.txt",1);
+      stats->writeMinAndMax("qflow_mm.txt",1);
+      delete stats;
+    }
+    if ((stats = openStats("perf.bin")) != NULL) {
+      stats->writeMinAndMax("perf_mm.txt",1);
+      stats->sumColumnValues("perf_sum.txt",1);
+      delete stats;
+    }
+  } catch (const gridpack::Exception &e) {
+    return 1;
+  }
+  return 0;
+}
@@ -386,8 +386,9 @@ void gridpack::dynamic_simulation_r::DSAppModule::solve(
 
   // Solve linear equations of fy11ybus * X = Y_c
   timer->start(t_solve);
-  gridpack::math::LinearMatrixSolver solver2(*fy11ybus);
-  boost::shared_ptr<gridpack::math::Matrix> fy11X(solver2.solve(*Y_cDense)); 
+  // Only values differ from prefy11ybus, so reuse its factorization
+  solver1.refactor(*fy11ybus);
+  boost::shared_ptr<gridpack::math::Matrix> fy11X(solver1.solve(*Y_cDense)); 
   timer->stop(t_solve);
   ///p_branchIO.header("\n=== fy11X: ============\n");
   ///fy11X->print();
@@ -440,8 +441,9 @@ void gridpack::dynamic_simulation_r::DSAppModule::solve(
     
   // Solve linear equations of posfy11ybus * X = Y_c
   timer->start(t_solve);
-  gridpack::math::LinearMatrixSolver solver3(*posfy11ybus);
-  boost::shared_ptr<gridpack::math::Matrix> posfy11X(solver3.solve(*Y_cDense)); 
+  // Only values differ from prefy11ybus, so reuse its factorization
+  solver1.refactor(*posfy11ybus);
+  boost::shared_ptr<gridpack::math::Matrix> posfy11X(solver1.solve(*Y_cDense)); 
   timer->stop(t_solve);
   ///p_branchIO.header("\n=== posfy11X: ============\n");
   ///posfy11X->print();
@@ -864,8 +866,9 @@ void gridpack::dynamic_simulation_r::DSAppModule::solve(
 
   // Solve linear equations of fy11ybus * X = Y_c
   timer->start(t_solve);
-  gridpack::math::LinearMatrixSolver solver2(*fy11ybus);
-  boost::shared_ptr<gridpack::math::Matrix> fy11X(solver2.solve(*Y_cDense)); 
+  // Only values differ from prefy11ybus, so reuse its factorization
+  solver1.refactor(*fy11ybus);
+  boost::shared_ptr<gridpack::math::Matrix> fy11X(solver1.solve(*Y_cDense)); 
   timer->stop(t_solve);
   
   // Form reduced admittance matrix fy11: fy11 = Y_b * X
@@ -890,8 +893,9 @@ void gridpack::dynamic_simulation_r::DSAppModule::solve(
     
   // Solve linear equations of posfy11ybus * X = Y_c
   timer->start(t_solve);
-  gridpack::math::LinearMatrixSolver solver3(*posfy11ybus);
-  boost::shared_ptr<gridpack::math::Matrix> posfy11X(solver3.solve(*Y_cDense)); 
+  // Only values differ from prefy11ybus, so reuse its factorization
+  solver1.refactor(*posfy11ybus);
+  boost::shared_ptr<gridpack::math::Matrix> posfy11X(solver1.solve(*Y_cDense)); 
   timer->stop(t_solve);
   
   // Form reduced admittance matrix posfy11: posfy11 = Y_b * X
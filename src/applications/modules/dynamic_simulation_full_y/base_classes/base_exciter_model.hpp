@@ -66,6 +66,26 @@ class BaseExciterModel
      */
     virtual void corrector(double t_inc, bool flag);
 
+    /**
+     * Estimate local error of the last corrector step. This is the
+     * largest difference between the predicted and corrected values of
+     * the state variables
+     * @param t_inc time step increment
+     * @return error estimate (zero if the model does not provide one)
+     */
+    virtual double getStepError(double t_inc);
+
+    /**
+     * Save the state at the start of a time step so that the step can be
+     * repeated with a shorter time increment
+     */
+    virtual void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    virtual void restoreState();
+
     /**
      * Set the field voltage parameter inside the exciter
      * @param fldv value of the field voltage
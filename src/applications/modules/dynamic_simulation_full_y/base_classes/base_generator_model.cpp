@@ -119,6 +119,32 @@ void gridpack::dynamic_simulation::BaseGeneratorModel::corrector(
 	
 }
 
+/**
+ * Estimate local error of the last corrector step
+ * @param t_inc time step increment
+ * @return error estimate (zero if the model does not provide one)
+ */
+double gridpack::dynamic_simulation::BaseGeneratorModel::getStepError(
+    double t_inc)
+{
+  return 0.0;
+}
+
+/**
+ * Save the state at the start of a time step so that the step can be
+ * repeated with a shorter time increment
+ */
+void gridpack::dynamic_simulation::BaseGeneratorModel::saveState()
+{
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::BaseGeneratorModel::restoreState()
+{
+}
+
 void gridpack::dynamic_simulation::BaseGeneratorModel::setWideAreaFreqforPSS(double freq){
 	p_wideareafreq = freq;
 }
@@ -78,6 +78,32 @@ void gridpack::dynamic_simulation::BasePssModel::corrector(
 {
 }
 
+/**
+ * Estimate local error of the last corrector step
+ * @param t_inc time step increment
+ * @return error estimate (zero if the model does not provide one)
+ */
+double gridpack::dynamic_simulation::BasePssModel::getStepError(
+    double t_inc)
+{
+  return 0.0;
+}
+
+/**
+ * Save the state at the start of a time step so that the step can be
+ * repeated with a shorter time increment
+ */
+void gridpack::dynamic_simulation::BasePssModel::saveState()
+{
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::BasePssModel::restoreState()
+{
+}
+
 /** 
  * Get the value of the field current parameter
  * @return value of field current
@@ -66,6 +66,21 @@ bool gridpack::dynamic_simulation::BaseRelayModel::updateRelay(
   return true;
 }
 
+/**
+ * Save the state at the start of a time step so that the step can be
+ * repeated with a shorter time increment
+ */
+void gridpack::dynamic_simulation::BaseRelayModel::saveState()
+{
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::BaseRelayModel::restoreState()
+{
+}
+
 /**
  * Return internal status of relay (margin by which threshold has bee
  * exceeded)
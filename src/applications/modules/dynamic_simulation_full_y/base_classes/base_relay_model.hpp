@@ -58,6 +58,17 @@ class BaseRelayModel
      */
     virtual bool updateRelay(double delta_t);
 
+    /**
+     * Save the state at the start of a time step so that the step can be
+     * repeated with a shorter time increment
+     */
+    virtual void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    virtual void restoreState();
+
     /**
      * Return internal status of relay (margin by which threshold has bee
      * exceeded)
@@ -19,12 +19,16 @@
 
 #include "gridpack/parser/PTI23_parser.hpp"
 #include "gridpack/parser/PTI33_parser.hpp"
+#include "gridpack/parser/network_snapshot.hpp"
+#include "boost/smart_ptr/scoped_ptr.hpp"
 #include "gridpack/mapper/full_map.hpp"
 #include "gridpack/mapper/bus_vector_map.hpp"
 #include "gridpack/math/math.hpp"
 #include "gridpack/parallel/global_vector.hpp"
+#include "gridpack/parallel/component_threads.hpp"
 #include "dsf_app_module.hpp"
 #include <iostream>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -51,6 +55,13 @@ gridpack::dynamic_simulation::DSFullApp::DSFullApp(void)
   p_generators_read_in = false;
   p_save_time_series = false;
   p_monitorGenerators = false;
+  p_ensemble = false;
+  p_ensembleRelays = false;
+  p_ybusMapped = false;
+  p_generatorEngine = false;
+  p_adaptiveStep = false;
+  p_stepTolerance = 1.0e-4;
+  p_maxStepMultiple = 8;
 }
 
 /**
@@ -66,6 +77,13 @@ gridpack::dynamic_simulation::DSFullApp::DSFullApp(gridpack::parallel::Communica
   p_generators_read_in = false;
   p_save_time_series = false;
   p_monitorGenerators = false;
+  p_ensemble = false;
+  p_ensembleRelays = false;
+  p_ybusMapped = false;
+  p_generatorEngine = false;
+  p_adaptiveStep = false;
+  p_stepTolerance = 1.0e-4;
+  p_maxStepMultiple = 8;
 }
 
 /**
@@ -125,8 +143,39 @@ void gridpack::dynamic_simulation::DSFullApp::readNetwork(
   p_monitorGenerators = cursor->get("monitorGenerators",false);
   p_maximumFrequency = cursor->get("frequencyMaximum",61.8);
 
+  // Advance GENROU generators together as arrays
+  p_generatorEngine = cursor->get("useGeneratorEngine",false);
+  // Integration scheme. The "adaptive" scheme lengthens the step in
+  // multiples of timeStep while the local error estimate is small
+  std::string scheme = cursor->get("integrationScheme","fixed");
+  p_adaptiveStep = (scheme == "adaptive");
+  p_stepTolerance = cursor->get("stepTolerance",1.0e-4);
+  p_maxStepMultiple = cursor->get("maxStepMultiple",8);
+  if (p_maxStepMultiple < 1) p_maxStepMultiple = 1;
+  // Threads used for loops over buses and branches on each process
+  gridpack::parallel::ComponentThreads::setNumThreads(
+      cursor->get("threadsPerProcess",1));
+  gridpack::parallel::ComponentThreads::setChunkSize(
+      cursor->get("threadChunkSize",16));
+
+  // Binary snapshot of the network. If the snapshot exists and is up to
+  // date with the network configuration file it is loaded instead of the
+  // file, otherwise it is written after the network has been partitioned.
+  // The snapshot does not include the generator parameters
+  std::string snapshot;
+  if (otherfile == NULL) snapshot = cursor->get("networkSnapshot","");
+  int useSnapshot = 0;
+  if (snapshot.size() > 0) {
+    useSnapshot = gridpack::parser::NetworkSnapshot<DSFullNetwork>::isCurrent(
+        snapshot,filename,p_comm.size());
+    p_comm.min(&useSnapshot,1);
+  }
+
   // load input file
-  if (filetype == PTI23) {
+  if (useSnapshot) {
+    gridpack::parser::NetworkSnapshot<DSFullNetwork> parser(network);
+    parser.parse(snapshot);
+  } else if (filetype == PTI23) {
     gridpack::parser::PTI23_parser<DSFullNetwork> parser(network);
     if (filename.size() > 0) parser.parse(filename.c_str());
   } else if (filetype == PTI33) {
@@ -140,6 +189,10 @@ void gridpack::dynamic_simulation::DSFullApp::readNetwork(
 
   // partition network
   network->partition();
+  if (snapshot.size() > 0 && !useSnapshot) {
+    gridpack::parser::NetworkSnapshot<DSFullNetwork> writer(network);
+    writer.write(snapshot,true,filename);
+  }
 
   // Create serial IO object to export data from buses or branches
   p_busIO.reset(new gridpack::serial_io::SerialBusIO<DSFullNetwork>(512, network));
@@ -177,6 +230,19 @@ void gridpack::dynamic_simulation::DSFullApp::setNetwork(
   if (p_time_step == 0.0) {
     // TODO: some kind of error
   }
+  p_generatorEngine = cursor->get("useGeneratorEngine",false);
+  // Integration scheme. The "adaptive" scheme lengthens the step in
+  // multiples of timeStep while the local error estimate is small
+  std::string scheme = cursor->get("integrationScheme","fixed");
+  p_adaptiveStep = (scheme == "adaptive");
+  p_stepTolerance = cursor->get("stepTolerance",1.0e-4);
+  p_maxStepMultiple = cursor->get("maxStepMultiple",8);
+  if (p_maxStepMultiple < 1) p_maxStepMultiple = 1;
+  // Threads used for loops over buses and branches on each process
+  gridpack::parallel::ComponentThreads::setNumThreads(
+      cursor->get("threadsPerProcess",1));
+  gridpack::parallel::ComponentThreads::setChunkSize(
+      cursor->get("threadChunkSize",16));
 
   // Create serial IO object to export data from buses or branches
   p_busIO.reset(new gridpack::serial_io::SerialBusIO<DSFullNetwork>(512, network));
@@ -217,6 +283,7 @@ void gridpack::dynamic_simulation::DSFullApp::initialize()
 {
   // create factory
   p_factory.reset(new gridpack::dynamic_simulation::DSFullFactory(p_network));
+  p_factory->setGeneratorEngine(p_generatorEngine);
   // p_factory->dumpData();
   p_factory->load();
 
@@ -245,6 +312,144 @@ void gridpack::dynamic_simulation::DSFullApp::reload()
 {
   p_factory->load();
   p_factory->setYBus();
+  // The admittance values held by the buses have been reset and must be
+  // mapped again
+  p_ybusMapped = false;
+}
+
+/**
+ * Share the Y-bus and its factorization among subsequent calls to solve()
+ */
+void gridpack::dynamic_simulation::DSFullApp::beginEnsemble()
+{
+  p_ensemble = true;
+  p_ybusMapped = false;
+  p_ensembleRelays = p_factory->hasRelays();
+}
+
+/**
+ * Stop sharing the Y-bus and release it
+ */
+void gridpack::dynamic_simulation::DSFullApp::endEnsemble()
+{
+  p_ensemble = false;
+  p_ybusMapped = false;
+  p_ybusSolver.reset();
+  p_ybus.reset();
+  p_ybusMap.reset();
+}
+
+/**
+ * Check whether reload() must be called before the next fault
+ * @return false if the network is in an ensemble and still holds the
+ * values the shared Y-bus was built from
+ */
+bool gridpack::dynamic_simulation::DSFullApp::reloadRequired() const
+{
+  return !(p_ensemble && p_ybusMapped);
+}
+
+/**
+ * Set up a low rank update from the Y-bus to the fault-on Y-bus
+ * @param update low rank update solver built on the Y-bus solver
+ * @param ybus Y-bus
+ * @param ybusMap map used to create Y-bus
+ * @return false if the two matrices differ in too many rows
+ */
+bool gridpack::dynamic_simulation::DSFullApp::setFaultOnUpdate(
+    gridpack::math::LowRankUpdateSolver &update,
+    gridpack::math::Matrix &ybus,
+    gridpack::mapper::FullMatrixMap<DSFullNetwork> &ybusMap)
+{
+  // faults change a few bus diagonals, so this is a generous limit
+  const int maxRank = 16;
+  boost::scoped_ptr<gridpack::math::Matrix> dY(ybus.clone());
+  p_factory->setMode(onFY);
+  // dY is temporary, so don't cache its storage locations in the map
+  ybusMap.overwriteMatrix(*dY);
+  dY->scale(-1.0);
+  dY->add(ybus);
+  dY->scale(-1.0);
+  return update.update(*dY, maxRank);
+}
+
+/**
+ * Apply switching events to the Y-bus and update its solver. Only the
+ * admittance entries of buses and branches marked dirty by the events are
+ * re-evaluated and the Y-bus is refactored at most once. In an ensemble, the fault is not put in
+ * the shared Y-bus but is handled by the low rank update instead
+ * @param events switching events
+ * @param ybusMap map used to create Y-bus
+ * @param ybus Y-bus
+ * @param solver solver for the Y-bus
+ * @param update low rank update of solver used for all network solves
+ * @param faultOn true if fault is currently applied (updated by events)
+ */
+void gridpack::dynamic_simulation::DSFullApp::applySwitchingEvents(
+    const std::vector<SwitchingEvent> &events,
+    gridpack::mapper::FullMatrixMap<DSFullNetwork> &ybusMap,
+    gridpack::math::Matrix &ybus, gridpack::math::LinearSolver &solver,
+    gridpack::math::LowRankUpdateSolver &update, bool &faultOn)
+{
+  bool patched = false;
+  bool faultChanged = false;
+  int i;
+  for (i=0; i<events.size(); i++) {
+    const SwitchingEvent &event = events[i];
+    if (event.type == FAULT_ON) {
+      faultOn = true;
+      faultChanged = true;
+      if (!p_ensemble) {
+        p_factory->setMode(onFY);
+        p_factory->markEventDirty();
+        ybusMap.overwriteDirtyMatrixValues(ybus);
+        patched = true;
+      }
+    } else if (event.type == FAULT_OFF) {
+      faultOn = false;
+      faultChanged = true;
+      if (!p_ensemble) {
+        p_factory->setMode(offFY);
+        p_factory->markEventDirty();
+        ybusMap.overwriteDirtyMatrixValues(ybus);
+        patched = true;
+      }
+    } else if (event.type == BUS_RELAY_TRIP) {
+      printf("DSFull_APP::Solve: bus relay trip at time %f, ybus changed\n",
+          event.time);
+      // tripped buses were marked dirty by DSFullFactory::updateBusRelay
+      p_factory->setMode(bus_relay);
+      ybusMap.overwriteDirtyMatrixValues(ybus);
+      // a trip at the faulted bus must not remove the fault
+      if (faultOn && !p_ensemble) {
+        p_factory->setMode(onFY);
+        p_factory->markEventDirty();
+        ybusMap.overwriteDirtyMatrixValues(ybus);
+      }
+      patched = true;
+    } else if (event.type == BRANCH_RELAY_TRIP) {
+      printf("DSFull_APP::Solve: branch relay trip at time %f, ybus changed\n",
+          event.time);
+      // tripped branches and their buses were marked dirty by
+      // DSFullFactory::updateBranchRelay
+      p_factory->setMode(branch_relay);
+      ybusMap.incrementDirtyMatrixValues(ybus);
+      patched = true;
+    }
+  }
+  p_network->clearDirtyComponents();
+
+  // Events only change matrix values, so the solver just needs a
+  // numeric refactorization
+  if (patched) solver.refactor();
+  if (p_ensemble && (patched || faultChanged)) {
+    if (!faultOn) {
+      update.clear();
+    } else if (!setFaultOnUpdate(update, ybus, ybusMap)) {
+      throw gridpack::Exception("DSFullApp::solve: fault-on Y-bus changes"
+          " are too large for the shared factorization");
+    }
+  }
 }
 
 /**
@@ -269,98 +474,86 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
   timer->stop(t_misc);
 
   int t_mode = timer->createCategory("DS Solve: Set Mode");
-  timer->start(t_mode);
-  p_factory->setMode(YBUS);
-  timer->stop(t_mode);
   int t_ybus = timer->createCategory("DS Solve: Make YBus");
-  timer->start(t_ybus);
-  gridpack::mapper::FullMatrixMap<DSFullNetwork> ybusMap(p_network);
-  boost::shared_ptr<gridpack::math::Matrix> orgYbus = ybusMap.mapToMatrix();
+  // In an ensemble on a network without relays, the buses and branches
+  // still hold the values the shared Y-bus was built from, so it is used
+  // as it is. Otherwise the Y-bus is assembled from the network.
+  boost::shared_ptr<gridpack::mapper::FullMatrixMap<DSFullNetwork> > ybusMapPtr;
+  boost::shared_ptr<gridpack::math::Matrix> ybus;
+  bool ybusShared = p_ensemble && p_ybusMapped && p_ybus;
+  if (ybusShared) {
+    // leave the network in the mode it would be in after assembly
+    timer->start(t_mode);
+    p_factory->setMode(YDYNLOAD);
+    timer->stop(t_mode);
+    ybusMapPtr = p_ybusMap;
+    ybus = p_ybus;
+  } else {
+    timer->start(t_mode);
+    p_factory->setMode(YBUS);
+    timer->stop(t_mode);
+    timer->start(t_ybus);
+    ybusMapPtr.reset(new gridpack::mapper::FullMatrixMap<DSFullNetwork>(p_network));
+    boost::shared_ptr<gridpack::math::Matrix> orgYbus = ybusMapPtr->mapToMatrix();
   
-  //printf("\n=== org ybus: ============\n");
-  //orgYbus->print();
-  //orgYbus->save("ybus_GridPACK_org.m");
-  //exit(0);
-
-  //p_factory->addLoadAdmittance();
-
-  // Form constant impedance load admittance yl for all buses and add it to
-  // system Y matrix: ybus = ybus + yl
-  p_factory->setMode(YL);
-  boost::shared_ptr<gridpack::math::Matrix> ybusyl = ybusMap.mapToMatrix();
-  timer->stop(t_ybus);
-  //branchIO.header("\n=== ybus after added yl: ============\n");
-  //printf("\n=== ybus after added yl: ============\n");
-  //ybusyl->print();
-  //ybusyl->save("ybus_GridPACK_yl.m");
-  //exit(0);
-
-  p_factory->setMode(PG);
-  boost::shared_ptr<gridpack::math::Matrix> ybuspg = ybusMap.mapToMatrix();
-  //printf("\n=== ybus after added pg: ============\n");
-  //ybuspg->print();
-  //exit(0);
-
-  //printf("# of buses in the network: %d\n", p_network->totalBuses());
-
-  // Add j*Xd' to system Y matrix:
-  // Extract appropriate xdprime and xdpprime from machine data
-  timer->start(t_mode);
-  p_factory->setMode(jxd);
-  timer->stop(t_mode);
-  timer->start(t_ybus);
-  boost::shared_ptr<gridpack::math::Matrix> ybus_jxd = ybusMap.mapToMatrix();
-  //branchIO.header("\n=== ybusyl after added j*Xd': =============\n");
-  //printf("\n=== ybusyl after added j*Xd': =============\n");
-  //ybus_jxd->print();
-  //ybus_jxd->save("ybus_GridPACK_jxd.m");
+    //printf("\n=== org ybus: ============\n");
+    //orgYbus->print();
+    //orgYbus->save("ybus_GridPACK_org.m");
+    //exit(0);
+
+    //p_factory->addLoadAdmittance();
+
+    // Form constant impedance load admittance yl for all buses and add it to
+    // system Y matrix: ybus = ybus + yl
+    p_factory->setMode(YL);
+    boost::shared_ptr<gridpack::math::Matrix> ybusyl = ybusMapPtr->mapToMatrix();
+    timer->stop(t_ybus);
+    //branchIO.header("\n=== ybus after added yl: ============\n");
+    //printf("\n=== ybus after added yl: ============\n");
+    //ybusyl->print();
+    //ybusyl->save("ybus_GridPACK_yl.m");
+    //exit(0);
+
+    p_factory->setMode(PG);
+    boost::shared_ptr<gridpack::math::Matrix> ybuspg = ybusMapPtr->mapToMatrix();
+    //printf("\n=== ybus after added pg: ============\n");
+    //ybuspg->print();
+    //exit(0);
+
+    //printf("# of buses in the network: %d\n", p_network->totalBuses());
+
+    // Add j*Xd' to system Y matrix:
+    // Extract appropriate xdprime and xdpprime from machine data
+    timer->start(t_mode);
+    p_factory->setMode(jxd);
+    timer->stop(t_mode);
+    timer->start(t_ybus);
+    boost::shared_ptr<gridpack::math::Matrix> ybus_jxd = ybusMapPtr->mapToMatrix();
+    //branchIO.header("\n=== ybusyl after added j*Xd': =============\n");
+    //printf("\n=== ybusyl after added j*Xd': =============\n");
+    //ybus_jxd->print();
+    //ybus_jxd->save("ybus_GridPACK_jxd.m");
   
   
-  // Add dynamic load impedance to system Y matrix:
-  timer->start(t_mode);
-  p_factory->setMode(YDYNLOAD);
-  timer->stop(t_mode);
-  boost::shared_ptr<gridpack::math::Matrix> ybus = ybusMap.mapToMatrix();
-  //branchIO.header("\n=== ybus_jxd after added dynamic load impedance': =============\n");
-  //printf("\n=== ybus_dynload after added dynamic load impedance': =============\n");
-  //ybus->print();
-  //ybus->save("ybus_GridPACK_dynload.m");
+    // Add dynamic load impedance to system Y matrix:
+    timer->start(t_mode);
+    p_factory->setMode(YDYNLOAD);
+    timer->stop(t_mode);
+    ybus = ybusMapPtr->mapToMatrix();
+    //branchIO.header("\n=== ybus_jxd after added dynamic load impedance': =============\n");
+    //printf("\n=== ybus_dynload after added dynamic load impedance': =============\n");
+    //ybus->print();
+    //ybus->save("ybus_GridPACK_dynload.m");
   
-  //exit(0);
- 
-  // Get fault information from fautlts Event from input.xml
-  int sw2_2 = fault.from_idx - 1;
-  int sw3_2 = fault.to_idx - 1;
+    //exit(0);
+    timer->stop(t_ybus);
+  }
+  gridpack::mapper::FullMatrixMap<DSFullNetwork> &ybusMap = *ybusMapPtr;
 
-  // Compute ybus_fy for fault on stage
-  boost::shared_ptr<gridpack::math::Matrix> ybus_fy(ybus->clone());
-  timer->stop(t_ybus);
+  // The fault is applied to the Y-bus when the simulation reaches it
   timer->start(t_misc);
   p_factory->setEvent(fault);
   timer->stop(t_misc);
-  timer->start(t_mode);
-  p_factory->setMode(onFY);
-  timer->stop(t_mode);
-  timer->start(t_ybus);
-  ybusMap.overwriteMatrix(ybus_fy);
-  //branchIO.header("\n=== ybus_fy: ============\n");
-  //printf("\n=== ybus_fy: ============\n");
-  //ybus_fy->print();
-  //ybus_fy->save("ybus_fy_GridPACK_jxd.m");
-
-  // Compute ybus_posfy for fault clear stage
-  boost::shared_ptr<gridpack::math::Matrix> ybus_posfy(ybus->clone());
-  timer->stop(t_ybus);
-  timer->start(t_mode);
-  p_factory->setMode(posFY);
-  timer->stop(t_mode);
-  timer->start(t_ybus);
-  ybusMap.incrementMatrix(ybus_posfy);
-  //branchIO.header("\n=== ybus_posfy: ============\n");
-  //printf("\n=== ybus_posfy: ============\n");
-  //ybus_posfy->print();
-  //ybus_posfy->save("ybus_posfy_GridPACK_jxd.m");
-  timer->stop(t_ybus);
 
   // Simulation related variables
   int t_init = timer->createCategory("DS Solve: Initialization");
@@ -370,10 +563,14 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
   double t_width[20];
   int S_Steps;
   int last_S_Steps;
-  int steps3, steps2, steps1;
+  int steps2, steps1;
   double h_sol1, h_sol2;
-  int flagP, flagC;
   int I_Steps;
+  // Number of timeStep intervals covered by the current step, and the
+  // index of the last of them
+  int n_Steps = 1;
+  int E_Steps;
+  int stepMultiple = 1;
 
   const double sysFreq = 60.0;
   double pi = 4.0*atan(1.0);
@@ -410,22 +607,58 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
   //p_busIO->header("\n=== volt: ===\n");
   //volt->print();
 
-  gridpack::math::LinearSolver solver(*ybus);
-  solver.configure(cursor);
-  gridpack::math::LinearSolver solver_fy(*ybus_fy);
-  solver_fy.configure(cursor);
-  //gridpack::math::LinearSolver solver_posfy(*ybus_posfy);
-  gridpack::math::LinearSolver solver_posfy(*ybus);
-  solver_posfy.configure(cursor);
+  // In an ensemble, the factored Y-bus from an earlier fault is reused
+  // if it was not assembled again or if the values have not changed
+  boost::scoped_ptr<gridpack::math::LinearSolver> ybusSolver;
+  if (p_ensemble) {
+    bool reuse = ybusShared;
+    if (!reuse && p_ybus) {
+      boost::scoped_ptr<gridpack::math::Matrix> diff(ybus->clone());
+      diff->scale(-1.0);
+      diff->add(*p_ybus);
+      reuse = (diff->norm2() <= 1.0e-12*p_ybus->norm2());
+    }
+    if (reuse) {
+      ybus = p_ybus;
+    } else {
+      p_ybusSolver.reset();
+      p_ybus = ybus;
+      p_ybusSolver.reset(new gridpack::math::LinearSolver(*p_ybus));
+      p_ybusSolver->configure(cursor);
+    }
+    // Relay trips change the values held by the buses and branches, so
+    // the network must then be reloaded and mapped again for each fault
+    p_ybusMap = ybusMapPtr;
+    p_ybusMapped = !p_ensembleRelays;
+  } else {
+    ybusSolver.reset(new gridpack::math::LinearSolver(*ybus));
+    ybusSolver->configure(cursor);
+  }
+  gridpack::math::LinearSolver &solver =
+    (p_ensemble ? *p_ybusSolver : *ybusSolver);
+
+  // All solves go through a low rank update of the Y-bus solver. It is
+  // only used in an ensemble, where the fault is applied as an update
+  // so that the shared factorization is not changed.
+  gridpack::math::LowRankUpdateSolver solver_sw(solver);
 
-  steps3 = t_step[0] + t_step[1] + t_step[2] - 1;
   steps2 = t_step[0] + t_step[1] - 1;
   steps1 = t_step[0] - 1;
   h_sol1 = t_width[0];
   h_sol2 = h_sol1;
-  flagP = 0;
-  flagC = 0;
   S_Steps = 1;
+
+  // Switching events are applied at the end of the step before them.
+  // Relay trips are added to the queue as they happen.
+  SwitchingQueue switching;
+  std::vector<SwitchingEvent> events;
+  bool faultOn = false;
+  p_network->clearDirtyComponents();
+  switching.schedule(steps1+1, fault.start, FAULT_ON);
+  switching.schedule(steps2+1, fault.end, FAULT_OFF);
+  if (switching.pop(0, events) > 0) {
+    applySwitchingEvents(events, ybusMap, *ybus, solver, solver_sw, faultOn);
+  }
   last_S_Steps = -1;
 
   bool flag = true, flag_corrector = true;
@@ -503,7 +736,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 #endif  //end if of HELICS
 
 
-  for (I_Steps = 0; I_Steps < simu_k - 1; I_Steps++) {
+  for (I_Steps = 0; I_Steps < simu_k - 1; I_Steps += n_Steps) {
   //for (I_Steps = 0; I_Steps < 200; I_Steps++) {
     //char step_str[128];
     //sprintf(step_str,"\nIter %d\n", I_Steps);
@@ -516,24 +749,24 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
      ///p_busIO->header(step_str);
     S_Steps = I_Steps;
 
-    if (I_Steps < steps1) {
-      flagP = 0;
-      flagC = 0;
-    } else if (I_Steps == steps1) {
-      flagP = 0;
-      //flagC = 1;
-      flagC = 0;
-    } else if ((I_Steps > steps1) && (I_Steps < steps2)) {
-      flagP = 1;
-      flagC = 1;
-    } else if (I_Steps == steps2) {
-      flagP = 1;
-      //flagC = 2;
-      flagC = 1;
-    } else if (I_Steps > steps2) {
-      flagP = 2;
-      flagC = 2;
+    // A step may cover several timeStep intervals with the adaptive
+    // scheme, but it always ends at the next switching event
+    n_Steps = 1;
+    if (p_adaptiveStep) {
+      int last = simu_k - 2;
+      if (!switching.empty()) {
+        last = std::min(last, switching.nextStep() - 1);
+      }
+      n_Steps = std::max(1, std::min(stepMultiple, last - I_Steps + 1));
     }
+    E_Steps = I_Steps + n_Steps - 1;
+    h_sol1 = static_cast<double>(n_Steps) * t_width[0];
+    h_sol2 = h_sol1;
+
+    // A step that covers more than one timeStep interval may be rejected
+    // below, so keep the state it starts from
+    if (p_adaptiveStep && n_Steps > 1) p_factory->saveState();
+
     timer->stop(t_misc);
     
     if (I_Steps !=0 && last_S_Steps != S_Steps) {
@@ -571,13 +804,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 		
 			volt_full->zero();
 			
-			if (flagP == 0) {
-				solver.solve(*INorton_full, *volt_full);
-			} else if (flagP == 1) {
-				solver_fy.solve(*INorton_full, *volt_full);
-			} else if (flagP == 2) {
-				solver_posfy.solve(*INorton_full, *volt_full);
-			}
+			solver_sw.solve(*INorton_full, *volt_full);
 			
 
 			printf("1: itr test:----previous predictor_INorton_full:\n");
@@ -626,13 +853,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 			}
     }
 #else
-    if (flagP == 0) {
-      solver.solve(*INorton_full, *volt_full);
-    } else if (flagP == 1) {
-      solver_fy.solve(*INorton_full, *volt_full);
-    } else if (flagP == 2) {
-      solver_posfy.solve(*INorton_full, *volt_full);
-    }
+    solver_sw.solve(*INorton_full, *volt_full);
 #endif
     timer->stop(t_psolve);
 
@@ -685,7 +906,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
             // do stuff to tie pub to GridPACK object property
           }
 
-	 helics_requestTime =       double (I_Steps*h_sol1);
+	 helics_requestTime =       double (I_Steps*t_width[0]);
 	 //printf("-------------!!!Helics request time: %12.6f \n", helics_requestTime); 
 	 double helics_grantime;
 	 helics_grantime = fed.requestTime(helics_requestTime);
@@ -729,119 +950,21 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 	// update dynamic load internal relay functions here
 	p_factory->dynamicload_post_process(h_sol1, false);
     
-	// if bus relay trips, modify the corresponding Ymatrix, renke modified
+	// relay trips change the Y-bus right away
     if (flagBus) {
-        printf("DSFull_APP::Solve: updatebusrelay return trigger siganl: TURE!!! \n");
-		
-        //please update the bus contribution to the Y bus matrix here. //Shuangshuang tbd
-	if (flagP == 0) { 
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus);
-        } else if (flagP == 1) {
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus_fy);
-	     printf("DSFull_APP::Solve: bus relay trip during fault, ybus_fy changed:\n");
-	     ybus_fy->print();
-	     char sybus[100];
-             sprintf(sybus, "ybus_fy_%d_relay.m",I_Steps );
-			 
-	     ybus_fy->save(sybus);
-	 
-	     printf("DSFull_APP::Solve: bus relay trip during fault, ybus changed too:\n");
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus);
-	     ybus->print();
-             sprintf(sybus, "ybus_%d_relay.m",I_Steps );
-
-	     ybus->save(sybus);
-        
-             printf("DSFull_APP::Solve: bus relay trip during fault, ybus_posfy changed too:\n");
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus_posfy);
-             ybus_posfy->print();
-             sprintf(sybus, "ybus_posfy_%d_relay.m",I_Steps );
-
-             ybus_posfy->save(sybus);
-
-			 
-        } else if (flagP == 2) {
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus);
-             printf("DSFull_APP::Solve: bus relay trip after fault, ybus changed:\n");
-	     ybus->print();
-	     char sybus[100];
-             sprintf(sybus, "ybus_%d_relay.m",I_Steps );
-
-	     ybus->save(sybus);
-
-             printf("DSFull_APP::Solve: bus relay trip after fault, ybus_posfy changed too:\n");
-             p_factory->setMode(bus_relay);
-             ybusMap.overwriteMatrix(ybus_posfy);
-             ybus_posfy->print();
-             sprintf(sybus, "ybus_posfy_%d_relay.m",I_Steps );
-
-             ybus_posfy->save(sybus);
-
-        }
+      printf("DSFull_APP::Solve: updatebusrelay return trigger siganl: TURE!!! \n");
+      switching.schedule(I_Steps, static_cast<double>(I_Steps)*t_width[0],
+          BUS_RELAY_TRIP);
     }
-	
-	// if branch relay trips, modify the corresponding Ymatrix, renke modified
-	if (flagBranch) {
-        
-        printf("DSFull_APP::Solve: updatebranchrelay return trigger siganl: TURE!!! \n");
-
-        //please update the bus contribution to the Y bus matrix here. //Shuangshuang tbd
-	if (flagP == 0) { 
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus);
-        } else if (flagP == 1) {
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus_fy);
-	     printf("DSFull_APP::Solve: branch relay trip during fault, ybus_fy changed:\n");
-	     ybus_fy->print();
-	     char sybus[100];
-             sprintf(sybus, "ybus_fy_%d_relay.m",I_Steps );
-			 
-	     ybus_fy->save(sybus);
-
-             printf("DSFull_APP::Solve: branch relay trip during fault, ybus changed too:\n");
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus);
-             ybus->print();
-             sprintf(sybus, "ybus_%d_relay.m",I_Steps );
-
-             ybus->save(sybus);
-
-			 
-	     printf("DSFull_APP::Solve: branch relay trip during fault, ybus_posfy changed too:\n");
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus_posfy);
-	     ybus_posfy->print();
-             sprintf(sybus, "ybus_posfy_%d_relay.m",I_Steps );
-
-	     ybus_posfy->save(sybus);
-			 
-        } else if (flagP == 2) {
-             printf("DSFull_APP::Solve: branch relay trip during fault, ybus changed too:\n");
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus);
-             ybus->print();
-             char sybus[100];
-             sprintf(sybus, "ybus_%d_relay.m",I_Steps );
-
-             ybus->save(sybus);
-
-             printf("DSFull_APP::Solve: branch relay trip during fault, ybus_posfy changed too:\n");
-             p_factory->setMode(branch_relay);
-             ybusMap.incrementMatrix(ybus_posfy);
-             ybus_posfy->print();
-             sprintf(sybus, "ybus_posfy_%d_relay.m",I_Steps );
-
-             ybus_posfy->save(sybus);
-
-        }
+    if (flagBranch) {
+      printf("DSFull_APP::Solve: updatebranchrelay return trigger siganl: TURE!!! \n");
+      switching.schedule(I_Steps, static_cast<double>(I_Steps)*t_width[0],
+          BRANCH_RELAY_TRIP);
     }
-	
+    if (switching.pop(I_Steps, events) > 0) {
+      applySwitchingEvents(events, ybusMap, *ybus, solver, solver_sw, faultOn);
+    }
+
     //renke add, update old busvoltage first
     p_factory->updateoldbusvoltage(); //renke add
 	
@@ -890,13 +1013,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 		
 			volt_full->zero();
 			
-			if (flagP == 0) {
-				solver.solve(*INorton_full, *volt_full);
-			} else if (flagP == 1) {
-				solver_fy.solve(*INorton_full, *volt_full);
-			} else if (flagP == 2) {
-				solver_posfy.solve(*INorton_full, *volt_full);
-			}
+			solver_sw.solve(*INorton_full, *volt_full);
 			nbusMap.mapToBus(volt_full);
 			p_factory->setVolt(false);
 			
@@ -931,13 +1048,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 			}
     }
 #else
-    if (flagP == 0) {
-      solver.solve(*INorton_full, *volt_full);
-    } else if (flagP == 1) {
-      solver_fy.solve(*INorton_full, *volt_full);
-    } else if (flagP == 2) {
-      solver_posfy.solve(*INorton_full, *volt_full);
-    }
+    solver_sw.solve(*INorton_full, *volt_full);
 #endif
 
     timer->stop(t_csolve);
@@ -975,23 +1086,47 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
     //if (I_Steps == simu_k - 1) 
       //p_busIO->write();
 
-    if (I_Steps == steps1) {
-      solver_fy.solve(*INorton_full, *volt_full);
+    // Apply switching events that are due at the end of this step and
+    // recompute the network voltages for the new Y-bus
+    bool switched = (switching.pop(E_Steps+1, events) > 0);
+    if (switched) {
+      applySwitchingEvents(events, ybusMap, *ybus, solver, solver_sw, faultOn);
+      solver_sw.solve(*INorton_full, *volt_full);
 //      printf("\n===================Step %d\ttime %5.3f sec:================\n", I_Steps+1, (I_Steps+1) * p_time_step);
 //      printf("\n=== [Corrector] volt_full: ===\n");
 //      volt_full->print();
       nbusMap.mapToBus(volt_full);
-      p_factory->setVolt(false);
-	  p_factory->updateBusFreq(h_sol1);
-    } else if (I_Steps == steps2) {
-      solver_posfy.solve(*INorton_full, *volt_full);
-//      printf("\n===================Step %d\ttime %5.3f sec:================\n", I_Steps+1, (I_Steps+1) * p_time_step);
-//      printf("\n=== [Corrector] volt_full: ===\n");
-//      volt_full->print();
-      nbusMap.mapToBus(volt_full);
-      p_factory->setVolt(true);
+      p_factory->setVolt(!faultOn);
 	  p_factory->updateBusFreq(h_sol1);
     }
+
+    // Choose the length of the next step from the local error estimate.
+    // If the error exceeds the tolerance the step is halved and, unless
+    // it was already a single timeStep interval, rejected: the state
+    // saved at the start of the step is restored and the step is
+    // repeated. Steps that end in a switching event or a relay trip are
+    // always accepted. The step is only lengthened when doubling it
+    // should keep the error below the tolerance. The network admittance
+    // matrix does not depend on the step length, so only discontinuities
+    // require a new factorization; after one the step starts again at
+    // timeStep
+    if (p_adaptiveStep) {
+      double err = p_factory->getStepError(h_sol2);
+      if (switched || flagBus || flagBranch) {
+        stepMultiple = 1;
+      } else if (err > p_stepTolerance) {
+        stepMultiple = std::max(1, n_Steps/2);
+        if (n_Steps > 1) {
+          // last_S_Steps is not updated, so the repeated step copies the
+          // restored states into the predictor states
+          p_factory->restoreState();
+          n_Steps = 0;
+          continue;
+        }
+      } else if (4.0 * err < p_stepTolerance) {
+        stepMultiple = std::min(2*stepMultiple, p_maxStepMultiple);
+      }
+    }
     if (I_Steps == 1) {
 //      printf("\n Dynamic Step 1 [Corrector] volt_full: ===\n");
 //      volt_full->print();
@@ -1000,10 +1135,11 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
     }
     int t_secure = timer->createCategory("DS Solve: Check Security");
     timer->start(t_secure);
-    if (p_generatorWatch && I_Steps%p_generatorWatchFrequency == 0) {
+    if (p_generatorWatch && (E_Steps/p_generatorWatchFrequency)
+        *p_generatorWatchFrequency >= I_Steps) {
       char tbuf[32];
 #ifdef USE_TIMESTAMP
-      sprintf(tbuf,"%8.4f, %20.4f",static_cast<double>(I_Steps)*p_time_step,
+      sprintf(tbuf,"%8.4f, %20.4f",static_cast<double>(E_Steps)*p_time_step,
           timer->currentTime());
       if (p_generatorWatch) p_generatorIO->header(tbuf);
       if (p_generatorWatch) p_generatorIO->write("watch");
@@ -1016,7 +1152,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 //      if (p_generatorWatch) p_generatorIO->write("watch");
 //      if (p_generatorWatch) p_generatorIO->header("\n");
 #else
-      sprintf(tbuf,"%8.4f",static_cast<double>(I_Steps)*p_time_step);
+      sprintf(tbuf,"%8.4f",static_cast<double>(E_Steps)*p_time_step);
       if (p_generatorWatch) p_generatorIO->header(tbuf);
       if (p_generatorWatch) p_generatorIO->write("watch");
       if (p_generatorWatch) p_generatorIO->header("\n");
@@ -1025,16 +1161,17 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
       if (p_generatorWatch) p_generatorIO->dumpChannel();
 #endif
     }
-    if (p_loadWatch && I_Steps%p_loadWatchFrequency == 0) {
+    if (p_loadWatch && (E_Steps/p_loadWatchFrequency)
+        *p_loadWatchFrequency >= I_Steps) {
       char tbuf[32];
 #ifdef USE_TIMESTAMP
-      sprintf(tbuf,"%8.4f, %20.4f",static_cast<double>(I_Steps)*p_time_step,
+      sprintf(tbuf,"%8.4f, %20.4f",static_cast<double>(E_Steps)*p_time_step,
           timer->currentTime());
       if (p_loadWatch) p_loadIO->header(tbuf);
       if (p_loadWatch) p_loadIO->write("load_watch");
       if (p_loadWatch) p_loadIO->header("\n");
 #else
-      sprintf(tbuf,"%8.4f",static_cast<double>(I_Steps)*p_time_step);
+      sprintf(tbuf,"%8.4f",static_cast<double>(E_Steps)*p_time_step);
       if (p_loadWatch) p_loadIO->header(tbuf);
       if (p_loadWatch) p_loadIO->write("load_watch");
       if (p_loadWatch) p_loadIO->header("\n");
@@ -1098,14 +1235,6 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
   ybus->print();
   ybus->save("ybus_aftersimu.m");
   
-  printf("\n=== ybus_fy after simu:============\n");
-  ybus_fy->print();
-  ybus_fy->save("ybus_fy_aftersimu.m");
-  
-  printf("\n=== ybus_posfy after simu: ============\n");
-  ybus_posfy->print();
-  ybus_posfy->save("ybus_posfy_aftersimu.m");
-  
 #endif
 
   //char msg[128];
@@ -21,7 +21,11 @@
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/configuration/configuration.hpp"
 #include "gridpack/serial_io/serial_io.hpp"
+#include "gridpack/math/math.hpp"
+#include "gridpack/math/low_rank_update_solver.hpp"
+#include "gridpack/mapper/full_map.hpp"
 #include "dsf_factory.hpp"
+#include "dsf_switching_queue.hpp"
 
 
 namespace gridpack {
@@ -95,6 +99,40 @@ class DSFullApp
      */
     void solve(gridpack::dynamic_simulation::Event fault);
 
+    /**
+     * Start an ensemble of faults on the same network. Faults are still
+     * simulated one after another by separate calls to solve(); the
+     * scenarios are not advanced in lockstep and each one uses the
+     * network's own model state. What the ensemble shares is the Y-bus.
+     * Until endEnsemble() is called, solve() keeps the assembled Y-bus,
+     * its map and its factorization. The fault-on Y-bus is handled as a
+     * low rank update of the shared factorization, whose columns are
+     * computed with a single multiple right hand side solve.
+     *
+     * If the network has no relays, nothing in a simulation changes the
+     * admittance values held by the buses and branches, and solve()
+     * resets the model state from the bus voltages. The network then only
+     * needs to be loaded once: reloadRequired() returns false after the
+     * first fault and solve() reuses the Y-bus without mapping it again.
+     * On networks with relays, trips change the Y-bus and relay timers
+     * are not reset by solve(), so the network must be reloaded before
+     * each fault and the Y-bus is mapped again and compared with the
+     * shared one.
+     */
+    void beginEnsemble();
+
+    /**
+     * Check whether reload() must be called before the next fault
+     * @return false if the network is in an ensemble and still holds the
+     * values the shared Y-bus was built from
+     */
+    bool reloadRequired() const;
+
+    /**
+     * End an ensemble of faults and release the shared factorization
+     */
+    void endEnsemble();
+
     /**
      * Write out final results of dynamic simulation calculation to standard output
      */
@@ -299,6 +337,31 @@ class DSFullApp
      */
     bool checkFrequency(double limit);
 
+    /**
+     * Set up a low rank update from the Y-bus to the fault-on Y-bus
+     * @param update low rank update solver built on the Y-bus solver
+     * @param ybus Y-bus
+     * @param ybusMap map used to create Y-bus
+     * @return false if the two matrices differ in too many rows
+     */
+    bool setFaultOnUpdate(gridpack::math::LowRankUpdateSolver &update,
+        gridpack::math::Matrix &ybus,
+        gridpack::mapper::FullMatrixMap<DSFullNetwork> &ybusMap);
+
+    /**
+     * Apply switching events to the Y-bus and update its solver
+     * @param events switching events
+     * @param ybusMap map used to create Y-bus
+     * @param ybus Y-bus
+     * @param solver solver for the Y-bus
+     * @param update low rank update of solver used for all network solves
+     * @param faultOn true if fault is currently applied (updated by events)
+     */
+    void applySwitchingEvents(const std::vector<SwitchingEvent> &events,
+        gridpack::mapper::FullMatrixMap<DSFullNetwork> &ybusMap,
+        gridpack::math::Matrix &ybus, gridpack::math::LinearSolver &solver,
+        gridpack::math::LowRankUpdateSolver &update, bool &faultOn);
+
     std::vector<gridpack::dynamic_simulation::Event> p_faults;
 
     // pointer to network
@@ -310,6 +373,24 @@ class DSFullApp
     // pointer to factory
     boost::shared_ptr<DSFullFactory> p_factory;
 
+    // share the factored Y-bus among calls to solve()
+    bool p_ensemble;
+
+    // true if any bus or branch in the ensemble has relays
+    bool p_ensembleRelays;
+
+    // true if the buses and branches still hold the admittance values
+    // that the shared Y-bus was built from
+    bool p_ybusMapped;
+
+    // map used to build the shared Y-bus
+    boost::shared_ptr<gridpack::mapper::FullMatrixMap<DSFullNetwork> >
+      p_ybusMap;
+
+    // Y-bus and its solver shared by an ensemble of faults
+    boost::shared_ptr<gridpack::math::Matrix> p_ybus;
+    boost::shared_ptr<gridpack::math::LinearSolver> p_ybusSolver;
+
     // Simulation time
     double p_sim_time;
 
@@ -363,6 +444,14 @@ class DSFullApp
     bool p_monitorGenerators;
     double p_maximumFrequency;
 
+    // Advance GENROU generators in a GenrouEngine
+    bool p_generatorEngine;
+
+    // Adjust the time step from a local error estimate
+    bool p_adaptiveStep;
+    double p_stepTolerance;
+    int p_maxStepMultiple;
+
     // Frequency deviations for simulation are okay
     bool p_frequencyOK;
 
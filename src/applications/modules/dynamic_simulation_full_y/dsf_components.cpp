@@ -18,6 +18,7 @@
 // -------------------------------------------------------------
 
 #include <vector>
+#include <algorithm>
 #include <iostream>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -79,8 +80,8 @@ gridpack::dynamic_simulation::DSFullBus::~DSFullBus(void)
 bool gridpack::dynamic_simulation::DSFullBus::matrixDiagSize(int *isize, int *jsize) const
 {
   if (YMBus::isIsolated()) return false;
-  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == YDYNLOAD || p_mode == onFY || p_mode == posFY
-  || p_mode == jxd || p_mode == bus_relay || p_mode == branch_relay) {
+  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == YDYNLOAD || p_mode == onFY || p_mode == offFY
+  || p_mode == posFY || p_mode == jxd || p_mode == bus_relay || p_mode == branch_relay) {
     return YMBus::matrixDiagSize(isize,jsize);
   }  else {
     *isize = 1;
@@ -186,6 +187,15 @@ bool gridpack::dynamic_simulation::DSFullBus::matrixDiagValues(ComplexType *valu
       double tmp2 = p_ybusi - 1.0e5;
       gridpack::ComplexType ret(tmp1, tmp2);
 	  
+      values[0] = ret;
+      return true;
+    } else {
+      return false;
+    }
+  } else if (p_mode == offFY) {
+    // remove fault shunt
+    if (p_from_flag) {
+      gridpack::ComplexType ret(p_ybusr, p_ybusi);
       values[0] = ret;
       return true;
     } else {
@@ -338,6 +348,10 @@ void gridpack::dynamic_simulation::DSFullBus::setYBus(void)
  */
 void gridpack::dynamic_simulation::DSFullBus::initDSVect(double ts)
 {
+  // The bus frequency starts from nominal each time the network is
+  // initialized
+  p_busvolfreq = 60.0;
+  pbusvolfreq_old = 60.0;
   if (p_ngen > 0) {
     for (int i = 0; i < p_ngen; i++) {
 #if 0
@@ -610,6 +624,113 @@ void gridpack::dynamic_simulation::DSFullBus::corrector(double t_inc, bool flag)
 #endif
 }
 
+/**
+ * Estimate local error of the last corrector step. Controls of generators
+ * that have been tripped are no longer advanced and are skipped
+ * @param t_inc time step increment
+ * @return largest error estimate of the generators, controls and dynamic
+ * loads on this bus
+ */
+double gridpack::dynamic_simulation::DSFullBus::getStepError(double t_inc)
+{
+  double err = 0.0;
+  int i;
+  for (i = 0; i < p_ngen; i++) {
+    err = std::max(err, p_generators[i]->getStepError(t_inc));
+    if (!p_generators[i]->getGenStatus()) continue;
+    if (p_generators[i]->p_hasExciter) {
+      err = std::max(err, p_generators[i]->getExciter()->getStepError(t_inc));
+    }
+    if (p_generators[i]->p_hasGovernor) {
+      err = std::max(err, p_generators[i]->getGovernor()->getStepError(t_inc));
+    }
+    if (p_generators[i]->p_hasPss) {
+      err = std::max(err, p_generators[i]->getPss()->getStepError(t_inc));
+    }
+  }
+  for (i = 0; i < p_ndyn_load; i++) {
+    err = std::max(err, p_loadmodels[i]->getStepError(t_inc));
+  }
+  return err;
+}
+
+/**
+ * Check for relays on the bus
+ * @return true if the bus has load relays or generators with relays
+ */
+bool gridpack::dynamic_simulation::DSFullBus::hasRelays()
+{
+  if (!p_loadrelays.empty()) return true;
+  int i;
+  for (i = 0; i < p_ngen; i++) {
+    int nrelay = 0;
+    p_generators[i]->getRelayNumber(nrelay);
+    if (nrelay > 0) return true;
+  }
+  return false;
+}
+
+/**
+ * Save the state of the bus and of the generators, controls, dynamic
+ * loads and relays on it at the start of a time step
+ */
+void gridpack::dynamic_simulation::DSFullBus::saveState()
+{
+  int i, irelay, nrelay;
+  p_savedVolt = p_volt_full;
+  p_savedVoltOld = p_volt_full_old;
+  p_savedVoltOldReal = p_volt_full_old_real;
+  p_savedVoltOldImag = p_volt_full_old_imag;
+  p_savedFreq = p_busvolfreq;
+  p_savedFreqOld = pbusvolfreq_old;
+  for (i = 0; i < p_ngen; i++) {
+    p_generators[i]->saveState();
+    if (p_generators[i]->p_hasExciter) p_generators[i]->getExciter()->saveState();
+    if (p_generators[i]->p_hasGovernor) p_generators[i]->getGovernor()->saveState();
+    if (p_generators[i]->p_hasPss) p_generators[i]->getPss()->saveState();
+    p_generators[i]->getRelayNumber(nrelay);
+    for (irelay = 0; irelay < nrelay; irelay++) {
+      p_generators[i]->getRelay(irelay)->saveState();
+    }
+  }
+  for (i = 0; i < p_ndyn_load; i++) {
+    p_loadmodels[i]->saveState();
+  }
+  for (i = 0; i < p_loadrelays.size(); i++) {
+    p_loadrelays[i]->saveState();
+  }
+}
+
+/**
+ * Return the bus and its models to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::DSFullBus::restoreState()
+{
+  int i, irelay, nrelay;
+  p_volt_full = p_savedVolt;
+  p_volt_full_old = p_savedVoltOld;
+  p_volt_full_old_real = p_savedVoltOldReal;
+  p_volt_full_old_imag = p_savedVoltOldImag;
+  p_busvolfreq = p_savedFreq;
+  pbusvolfreq_old = p_savedFreqOld;
+  for (i = 0; i < p_ngen; i++) {
+    p_generators[i]->restoreState();
+    if (p_generators[i]->p_hasExciter) p_generators[i]->getExciter()->restoreState();
+    if (p_generators[i]->p_hasGovernor) p_generators[i]->getGovernor()->restoreState();
+    if (p_generators[i]->p_hasPss) p_generators[i]->getPss()->restoreState();
+    p_generators[i]->getRelayNumber(nrelay);
+    for (irelay = 0; irelay < nrelay; irelay++) {
+      p_generators[i]->getRelay(irelay)->restoreState();
+    }
+  }
+  for (i = 0; i < p_ndyn_load; i++) {
+    p_loadmodels[i]->restoreState();
+  }
+  for (i = 0; i < p_loadrelays.size(); i++) {
+    p_loadrelays[i]->restoreState();
+  }
+}
+
 void gridpack::dynamic_simulation::DSFullBus::setWideAreaFreqforPSS(double freq){
 	
   int i;
@@ -1915,6 +2036,14 @@ void gridpack::dynamic_simulation::DSFullBus::clearEvent()
   p_branch = NULL;
 }
 
+/**
+ * @return true if bus is the "from" or "to" bus of the fault event
+ */
+bool gridpack::dynamic_simulation::DSFullBus::hasEvent() const
+{
+  return p_from_flag || p_to_flag;
+}
+
 void gridpack::dynamic_simulation::DSFullBus::setBranchRelayFromBusStatus(bool sta)
 {
   p_branchrelay_from_flag = sta;
@@ -2463,6 +2592,16 @@ std::vector<std::string> gridpack::dynamic_simulation::DSFullBus::getGenerators(
   return p_genid;
 }
 
+/**
+ * Get generator models on bus
+ * @return vector of generator models
+ */
+std::vector<boost::shared_ptr<gridpack::dynamic_simulation::BaseGeneratorModel> >
+  gridpack::dynamic_simulation::DSFullBus::getGeneratorModels()
+{
+  return p_generators;
+}
+
 /**
  * Get list of load IDs
  * @return vector of generator IDs
@@ -2531,8 +2670,8 @@ gridpack::dynamic_simulation::DSFullBranch::~DSFullBranch(void)
  */
 bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardSize(int *isize, int *jsize) const
 {
-  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == posFY
-  || p_mode == jxd || p_mode == YDYNLOAD ||p_mode == bus_relay || p_mode == branch_relay) { 
+  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == offFY
+  || p_mode == posFY || p_mode == jxd || p_mode == YDYNLOAD ||p_mode == bus_relay || p_mode == branch_relay) { 
     return YMBranch::matrixForwardSize(isize,jsize);
   } else {
     return false;
@@ -2540,8 +2679,8 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardSize(int *isize, i
 }
 bool gridpack::dynamic_simulation::DSFullBranch::matrixReverseSize(int *isize, int *jsize) const
 {
-  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == posFY
-  || p_mode == jxd || p_mode == YDYNLOAD || p_mode == bus_relay || p_mode == branch_relay) { 
+  if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == offFY
+  || p_mode == posFY || p_mode == jxd || p_mode == YDYNLOAD || p_mode == bus_relay || p_mode == branch_relay) { 
     return YMBranch::matrixReverseSize(isize,jsize);
   } else {
     return false;
@@ -2915,6 +3054,37 @@ bool gridpack::dynamic_simulation::DSFullBranch::updateRelay(bool flag, double d
 	return bbranchflag;
 }
 
+/**
+ * Check for relays on the branch
+ * @return true if the branch has line relays
+ */
+bool gridpack::dynamic_simulation::DSFullBranch::hasRelays()
+{
+  return !p_linerelays.empty();
+}
+
+/**
+ * Save the state of the relays on this branch at the start of a time step
+ */
+void gridpack::dynamic_simulation::DSFullBranch::saveState()
+{
+  int i;
+  for (i = 0; i < p_linerelays.size(); i++) {
+    p_linerelays[i]->saveState();
+  }
+}
+
+/**
+ * Return the relays on this branch to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::DSFullBranch::restoreState()
+{
+  int i;
+  for (i = 0; i < p_linerelays.size(); i++) {
+    p_linerelays[i]->restoreState();
+  }
+}
+
 /**
  * Set the mode to control what matrices and vectors are built when using
  * the mapper
@@ -3089,6 +3259,7 @@ gridpack::dynamic_simulation::DSFullBranch::getBranchRelayTripUpdateFactor()
 void gridpack::dynamic_simulation::DSFullBranch::setEvent(
     const gridpack::dynamic_simulation::Event &event)
 {
+  p_event = false;
   int idx1 = getBus1OriginalIndex();
   int idx2 = getBus2OriginalIndex();
   if (event.isGenerator) {
@@ -34,7 +34,7 @@
 namespace gridpack {
 namespace dynamic_simulation {
 
-enum DSMode{YBUS, YL, YDYNLOAD, PG, onFY, posFY, jxd, make_INorton_full, bus_relay, branch_relay};
+enum DSMode{YBUS, YL, YDYNLOAD, PG, onFY, posFY, jxd, make_INorton_full, bus_relay, branch_relay, offFY};
 
 // Small utility structure to encapsulate information about fault events
 struct Event{
@@ -149,6 +149,31 @@ class DSFullBus
      * @param flag initial step if true
      */
     void corrector(double t_inc, bool flag);
+
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return largest error estimate of the generators, controls and
+     * dynamic loads on this bus
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state of the bus and of the generators, controls, dynamic
+     * loads and relays on it at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return the bus and its models to the state saved by saveState
+     */
+    void restoreState();
+
+    /**
+     * Check for relays on the bus
+     * @return true if the bus has load relays or generators with relays
+     */
+    bool hasRelays();
 	
 	/**
      * Update dynamic load internal relays action
@@ -317,6 +342,11 @@ class DSFullBus
      */
     void clearEvent();
 
+    /**
+     * @return true if bus is the "from" or "to" bus of the fault event
+     */
+    bool hasEvent() const;
+
     /**
      * Write output from buses to standard out
      * @param string (output) string with information to be printed out
@@ -452,6 +482,12 @@ class DSFullBus
      */
     std::vector<std::string> getGenerators();
 
+    /**
+     * Get generator models on bus
+     * @return vector of generator models
+     */
+    std::vector<boost::shared_ptr<BaseGeneratorModel> > getGeneratorModels();
+
     /**
      * Get list of load IDs
      * @return vector of load IDs
@@ -558,6 +594,10 @@ class DSFullBus
     gridpack::ComplexType p_volt_full;
 	gridpack::ComplexType p_volt_full_old; //renke add
 	double p_volt_full_old_real, p_volt_full_old_imag; //renke add
+    // voltage and frequency at the start of the current time step
+    gridpack::ComplexType p_savedVolt, p_savedVoltOld;
+    double p_savedVoltOldReal, p_savedVoltOldImag;
+    double p_savedFreq, p_savedFreqOld;
 	bool bcomputefreq; // renke add
 
     gridpack::component::BaseBranchComponent* p_branch;
@@ -740,6 +780,23 @@ class DSFullBranch
      */
 	void updateBranchCurrent(); //RENKE ADD
 	bool updateRelay(bool flag, double delta_t); //renke add
+
+    /**
+     * Save the state of the relays on this branch at the start of a time
+     * step
+     */
+    void saveState();
+
+    /**
+     * Return the relays on this branch to the state saved by saveState
+     */
+    void restoreState();
+
+    /**
+     * Check for relays on the branch
+     * @return true if the branch has line relays
+     */
+    bool hasRelays();
 	
 	/**
      * Set parameters of the transformer branch due to composite load model
@@ -17,8 +17,11 @@
 // -------------------------------------------------------------
 
 #include <vector>
+#include <algorithm>
 #include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/parallel/component_threads.hpp"
 #include "dsf_factory.hpp"
+#include "model_classes/genrou.hpp"
 
 namespace gridpack {
 namespace dynamic_simulation {
@@ -33,6 +36,7 @@ DSFullFactory::DSFullFactory(DSFullFactory::NetworkPtr network)
   : gridpack::factory::BaseFactory<DSFullNetwork>(network)
 {
   p_network = network;
+  p_useGeneratorEngine = false;
 
   int i;
   p_numBus = p_network->numBuses();
@@ -136,6 +140,17 @@ void gridpack::dynamic_simulation::DSFullFactory::setEvent(const
   }
 }
 
+/**
+ * Mark the buses at either end of the fault event as dirty in the network
+ */
+void gridpack::dynamic_simulation::DSFullFactory::markEventDirty(void)
+{
+  int i;
+  for (i=0; i<p_numBus; i++) {
+    if (p_buses[i]->hasEvent()) p_network->markBusDirty(i);
+  }
+}
+
 /**
  * Check network to see if there is a process with no generators
  * @return true if all processors have at least on generator
@@ -159,18 +174,55 @@ bool gridpack::dynamic_simulation::DSFullFactory::checkGen(void)
   return ret;
 }
 
+/**
+ * Advance GENROU generators together in a GenrouEngine instead of
+ * one at a time through their buses. This takes effect at the next
+ * call to initDSVect
+ * @param flag use the engine if true
+ */
+void gridpack::dynamic_simulation::DSFullFactory::setGeneratorEngine(bool flag)
+{
+  p_useGeneratorEngine = flag;
+}
+
+/**
+ * Move data from the network into buses and branches. Buses recreate
+ * their generators, so the generator engine is emptied first
+ */
+void gridpack::dynamic_simulation::DSFullFactory::load(void)
+{
+  p_genrouEngine.reset();
+  gridpack::factory::BaseFactory<DSFullNetwork>::load();
+}
+
 /**
  * Initialize init vectors for integration
  * @param ts time step
  */
 void gridpack::dynamic_simulation::DSFullFactory::initDSVect(double ts)
 {
-  int i;
+  int i, j;
+
+  // Generators must be initialized by their buses before the engine
+  // takes over their state
+  p_genrouEngine.clear();
 
   // Invoke initDSVect method on all bus objects
   for (i=0; i<p_numBus; i++) {
     p_buses[i]->initDSVect(ts);
   }
+
+  if (p_useGeneratorEngine) {
+    for (i=0; i<p_numBus; i++) {
+      std::vector<boost::shared_ptr<BaseGeneratorModel> > gens
+        = p_buses[i]->getGeneratorModels();
+      for (j=0; j<gens.size(); j++) {
+        GenrouGenerator *genrou
+          = dynamic_cast<GenrouGenerator*>(gens[j].get());
+        if (genrou) p_genrouEngine.add(genrou);
+      }
+    }
+  }
 }
 
 /**
@@ -179,8 +231,15 @@ void gridpack::dynamic_simulation::DSFullFactory::initDSVect(double ts)
 void gridpack::dynamic_simulation::DSFullFactory::predictor_currentInjection(bool flag)
 {
   int i;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+
+  p_genrouEngine.predictor_currentInjection(flag);
 
   // Invoke method on all bus objects
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
   for (i=0; i<p_numBus; i++) {
     p_buses[i]->predictor_currentInjection(flag);
   }
@@ -192,8 +251,15 @@ void gridpack::dynamic_simulation::DSFullFactory::predictor_currentInjection(boo
 void gridpack::dynamic_simulation::DSFullFactory::predictor(double t_inc, bool flag)
 {
   int i;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+
+  p_genrouEngine.predictor(t_inc, flag);
 
   // Invoke updateDSVect method on all bus objects
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
   for (i=0; i<p_numBus; i++) {
     p_buses[i]->predictor(t_inc,flag);
   }
@@ -205,8 +271,15 @@ void gridpack::dynamic_simulation::DSFullFactory::predictor(double t_inc, bool f
 void gridpack::dynamic_simulation::DSFullFactory::corrector_currentInjection(bool flag)
 {
   int i;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+
+  p_genrouEngine.corrector_currentInjection(flag);
 
   // Invoke method on all bus objects
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
   for (i=0; i<p_numBus; i++) {
     p_buses[i]->corrector_currentInjection(flag);
   }
@@ -218,13 +291,88 @@ void gridpack::dynamic_simulation::DSFullFactory::corrector_currentInjection(boo
 void gridpack::dynamic_simulation::DSFullFactory::corrector(double t_inc, bool flag)
 {
   int i;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+
+  p_genrouEngine.corrector(t_inc, flag);
 
   // Invoke updateDSVect method on all bus objects
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
   for (i=0; i<p_numBus; i++) {
     p_buses[i]->corrector(t_inc,flag);
   }
 }
 
+/**
+ * Estimate local error of the last corrector step
+ * @param t_inc time step increment
+ * @return largest error estimate of all generators, controls and dynamic
+ * loads in the network
+ */
+double gridpack::dynamic_simulation::DSFullFactory::getStepError(double t_inc)
+{
+  int i;
+  double err = p_genrouEngine.getStepError(t_inc);
+  for (i=0; i<p_numBus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    err = std::max(err, p_buses[i]->getStepError(t_inc));
+  }
+  p_network->communicator().max(&err,1);
+  return err;
+}
+
+/**
+ * Save the state of all buses, branches and models at the start of a
+ * time step so that the step can be repeated
+ */
+void gridpack::dynamic_simulation::DSFullFactory::saveState()
+{
+  int i;
+  p_genrouEngine.saveState();
+  for (i=0; i<p_numBus; i++) {
+    p_buses[i]->saveState();
+  }
+  for (i=0; i<p_numBranch; i++) {
+    p_branches[i]->saveState();
+  }
+}
+
+/**
+ * Return the network to the state saved by saveState. The restored bus
+ * voltages are passed on to the generators and loads
+ */
+void gridpack::dynamic_simulation::DSFullFactory::restoreState()
+{
+  int i;
+  p_genrouEngine.restoreState();
+  for (i=0; i<p_numBus; i++) {
+    p_buses[i]->restoreState();
+    p_buses[i]->setVolt(false);
+  }
+  for (i=0; i<p_numBranch; i++) {
+    p_branches[i]->restoreState();
+  }
+}
+
+/**
+ * Check for relays anywhere in the network
+ * @return true if any bus or branch has relays
+ */
+bool gridpack::dynamic_simulation::DSFullFactory::hasRelays()
+{
+  int i;
+  bool flag = false;
+  for (i=0; i<p_numBus && !flag; i++) {
+    flag = p_buses[i]->hasRelays();
+  }
+  for (i=0; i<p_numBranch && !flag; i++) {
+    flag = p_branches[i]->hasRelays();
+  }
+  return checkTrueSomewhere(flag);
+}
+
 /**
  * Update dynamic load internal relays action
  */
@@ -320,8 +468,11 @@ bool gridpack::dynamic_simulation::DSFullFactory::updateBusRelay(bool flag,doubl
 	bflag = false;
 	
 	for (i=0; i<p_numBus; i++) {
-		bflag = bflag || p_buses[i]->updateRelay(flag,delta_t);
-	
+		// every bus must update its relays, so don't short circuit
+		if (p_buses[i]->updateRelay(flag,delta_t)) {
+			p_network->markBusDirty(i);
+			bflag = true;
+		}
         }
         return checkTrueSomewhere(bflag); 
 	//return bflag;
@@ -335,11 +486,18 @@ bool gridpack::dynamic_simulation::DSFullFactory::updateBranchRelay(bool flag,do
 	
 	bflag = false;
 	
+	int bus1, bus2;
 	for (i=0; i<p_numBranch; i++) {
-		bflag = bflag || p_branches[i]->updateRelay(flag,delta_t);
+		if (p_branches[i]->updateRelay(flag,delta_t)) {
+			p_network->markBranchDirty(i);
+			p_network->getBranchEndpoints(i,&bus1,&bus2);
+			p_network->markBusDirty(bus1);
+			p_network->markBusDirty(bus2);
+			bflag = true;
+		}
 	}
 	
-	return bflag;
+	return checkTrueSomewhere(bflag);
 	
 }
 
@@ -22,6 +22,7 @@
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/factory/base_factory.hpp"
 #include "dsf_components.hpp"
+#include "model_classes/genrou_engine.hpp"
 #include <vector>
 
 namespace gridpack {
@@ -63,12 +64,33 @@ class DSFullFactory
      */
     void setEvent(const Event &event);
 
+    /**
+     * Mark the buses at either end of the fault event as dirty in the
+     * network, so that the fault can be applied to or removed from the
+     * Y-bus by updating only their diagonal entries
+     */
+    void markEventDirty(void);
+
     /**
      * Check network to see if there is a process with no generators
      * @return true if all processors have at least on generator
      */
     bool checkGen(void);
 
+    /**
+     * Advance GENROU generators together in a GenrouEngine instead of
+     * one at a time through their buses. This takes effect at the next
+     * call to initDSVect
+     * @param flag use the engine if true
+     */
+    void setGeneratorEngine(bool flag);
+
+    /**
+     * Move data from the network into buses and branches. Buses recreate
+     * their generators, so the generator engine is emptied first
+     */
+    void load(void);
+
     /**
      * Initialize init vectors for integration
      * @param ts time step
@@ -94,6 +116,32 @@ class DSFullFactory
      * Update vectors in each integration time step (Corrector)
      */
     void corrector(double t_inc, bool flag);
+
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return largest error estimate of all generators, controls and
+     * dynamic loads in the network
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state of all buses, branches and models at the start of a
+     * time step so that the step can be repeated
+     */
+    void saveState();
+
+    /**
+     * Return the network to the state saved by saveState. The restored
+     * bus voltages are passed on to the generators and loads
+     */
+    void restoreState();
+
+    /**
+     * Check for relays anywhere in the network
+     * @return true if any bus or branch has relays
+     */
+    bool hasRelays();
 	
 	/**
      * Update dynamic load internal relays action
@@ -124,12 +172,14 @@ class DSFullFactory
 	void setWideAreaFreqforPSS(double freq); //renke hard coded
 	
    /**
-     * update bus relay status
+     * update bus relay status. Buses with tripped relays are marked dirty in
+     * the network
      */
     bool updateBusRelay(bool flag,double delta_t);
 	
 	/**
-     * update branch relay status
+     * update branch relay status. Tripped branches and the buses at either
+     * end of them are marked dirty in the network
      */
     bool updateBranchRelay(bool flag,double delta_t);
 	
@@ -236,6 +286,10 @@ class DSFullFactory
     int p_numBranch;
 
     DSFullBranch **p_branches;
+
+    bool p_useGeneratorEngine;
+
+    GenrouEngine p_genrouEngine;
 };
 
 } // dynamic_simulation
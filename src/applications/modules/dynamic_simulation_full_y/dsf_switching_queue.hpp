@@ -0,0 +1,130 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   dsf_switching_queue.hpp
+ *
+ * @brief  Time ordered queue of switching events that change the network
+ * admittance matrix during a dynamic simulation
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _dsf_switching_queue_h_
+#define _dsf_switching_queue_h_
+
+#include <map>
+#include <vector>
+
+namespace gridpack {
+namespace dynamic_simulation {
+
+enum SwitchingType{FAULT_ON, FAULT_OFF, BUS_RELAY_TRIP, BRANCH_RELAY_TRIP};
+
+// Switching event. Events are located at the boundaries between time
+// steps, where boundary n is the start of step n
+struct SwitchingEvent{
+  int step;           // time step boundary at which event is applied
+  double time;        // time at which event is applied
+  SwitchingType type; // what happens
+};
+
+// -------------------------------------------------------------
+//  class SwitchingQueue
+// -------------------------------------------------------------
+/**
+ * Scheduled events, like the start and end of a fault, are put in the
+ * queue before the simulation starts. Events that are triggered during
+ * the simulation, like relay trips, are put in the queue at the current
+ * step boundary. The integrator removes all events that are due at a
+ * step boundary and updates the admittance matrix for all of them
+ * together. Events at the same boundary come out in the order they were
+ * put in.
+ */
+class SwitchingQueue
+{
+  public:
+    /**
+     * Basic constructor
+     */
+    SwitchingQueue(void)
+    {
+    }
+
+    /**
+     * Basic destructor
+     */
+    ~SwitchingQueue(void)
+    {
+    }
+
+    /**
+     * Add an event to the queue
+     * @param step time step boundary at which event is applied
+     * @param time time at which event is applied
+     * @param type type of event
+     */
+    void schedule(int step, double time, SwitchingType type)
+    {
+      SwitchingEvent event;
+      event.step = step;
+      event.time = time;
+      event.type = type;
+      p_events.insert(std::pair<const int, SwitchingEvent>(step, event));
+    }
+
+    /**
+     * @return true if there are no events left in the queue
+     */
+    bool empty(void) const
+    {
+      return p_events.empty();
+    }
+
+    /**
+     * @return time step boundary of the next event. The queue must not
+     * be empty
+     */
+    int nextStep(void) const
+    {
+      return p_events.begin()->first;
+    }
+
+    /**
+     * Remove all events that are due at a time step boundary
+     * @param step time step boundary
+     * @param events events at or before step, in time order
+     * @return number of events removed
+     */
+    int pop(int step, std::vector<SwitchingEvent> &events)
+    {
+      events.clear();
+      std::multimap<int, SwitchingEvent>::iterator it = p_events.begin();
+      while (it != p_events.end() && it->first <= step) {
+        events.push_back(it->second);
+        it++;
+      }
+      p_events.erase(p_events.begin(), it);
+      return static_cast<int>(events.size());
+    }
+
+    /**
+     * Remove all events
+     */
+    void clear(void)
+    {
+      p_events.clear();
+    }
+
+  private:
+
+    std::multimap<int, SwitchingEvent> p_events;
+};
+
+}  // dynamic_simulation
+}  // gridpack
+#endif
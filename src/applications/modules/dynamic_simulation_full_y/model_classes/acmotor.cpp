@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
@@ -288,7 +290,13 @@ void gridpack::dynamic_simulation::AcmotorLoad::load(
     printf("Kp1 %f, Np1 %f, Kq1 %f, Nq1 %f, Kp2 %f, Np2 %f, Kq2 %f, Nq2 %f \n", Kp1, Np1, Kq1, Nq1, Kp2, Np2, Kq2, Nq2); 
     printf ("Vbrk %f, Frst %f, Vrst %f, CmpKpf %f, CmpKqf %f, Vc1off %f, Vc2off %f \n", Vbrk, Frst, Vrst, CmpKpf, CmpKqf, Vc1off, Vc2off);
     printf ("Vc1on  %f, Vc2on %f, Tth %f, Th1t %f, Th2t %f, Fuvr %f, Uvtr1 %f, Ttr1 %f, Uvtr2 %f, Ttr2 %f \n", Vc1on, Vc2on, Tth, Th1t, Th2t, Fuvr, Uvtr1, Ttr1, Uvtr2, Ttr2);
-  
+
+  // Adjustments to the parameters are made here rather than in init so
+  // that the model can be initialized again without being reloaded
+  if (CompLF ==0.0)
+    CompLF = 1.0;
+  Vstall = Vstall * (1.0 + LFadj * (CompLF - 1.0));
+  Vbrk = Vbrk * (1.0 + LFadj * (CompLF -1.0));
 }
 
 /**
@@ -307,8 +315,19 @@ void gridpack::dynamic_simulation::AcmotorLoad::init(double mag,
   systemMVABase = 100.0;
   vt = mag;
 
-  if (CompLF ==0.0)
-    CompLF = 1.0;
+  // discrete states of the stalling, thermal, UV relay and contactor
+  // models start from normal running
+  statusA = 1;
+  statusB = 1;
+  stallTimer = 0.0;
+  restartTimer = 0.0;
+  FthA = 1.0;
+  FthB = 1.0;
+  Kuv = 1.0;
+  Kcon = 1.0;
+  fcon_trip = 0.0;
+  UVTimer1 = 0.0;
+  UVTimer2 = 0.0;
 
   // calculate the mva base
   Pinit = PintMW; //SJin: what is PintMW
@@ -344,10 +363,6 @@ void gridpack::dynamic_simulation::AcmotorLoad::init(double mag,
             
   volt_measured = vt;
             
-  // Apply adjustments
-  Vstall = Vstall * (1.0 + LFadj * (CompLF - 1.0));
-  Vbrk = Vbrk * (1.0 + LFadj * (CompLF -1.0));
-  
   //printf("AcmotorLoad::init: Vstall: %12.6f, Vbrk: %12.6f \n", Vstall, Vbrk);
 
   // calculate P0 and Q0 for the algebraic P/Q curve
@@ -584,6 +599,80 @@ void gridpack::dynamic_simulation::AcmotorLoad::corrector(
   temperatureB = temperatureB0 +  0.5 * (dThB_dt0 + dThB_dt) * dt;
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::AcmotorLoad::getStepError(double t_inc)
+{
+  double err = fabs(dv_dt - dv_dt0);
+  err = std::max(err, fabs(dfreq_dt - dfreq_dt0));
+  err = std::max(err, fabs(dThA_dt - dThA_dt0));
+  err = std::max(err, fabs(dThB_dt - dThB_dt0));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::AcmotorLoad::saveState()
+{
+  p_savedState[0] = volt_measured;
+  p_savedState[1] = freq_measured;
+  p_savedState[2] = temperatureA;
+  p_savedState[3] = temperatureB;
+  p_savedState[4] = PA;
+  p_savedState[5] = QA;
+  p_savedState[6] = PB;
+  p_savedState[7] = QB;
+  p_savedState[8] = Pmotor;
+  p_savedState[9] = Qmotor;
+  p_savedState[10] = stallTimer;
+  p_savedState[11] = restartTimer;
+  p_savedState[12] = FthA;
+  p_savedState[13] = FthB;
+  p_savedState[14] = Kuv;
+  p_savedState[15] = Kcon;
+  p_savedState[16] = fcon_trip;
+  p_savedState[17] = UVTimer1;
+  p_savedState[18] = UVTimer2;
+  p_savedCounts[0] = statusA;
+  p_savedCounts[1] = statusB;
+  p_savedPhasors[0] = equivYpq_motorBase;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::AcmotorLoad::restoreState()
+{
+  volt_measured = p_savedState[0];
+  freq_measured = p_savedState[1];
+  temperatureA = p_savedState[2];
+  temperatureB = p_savedState[3];
+  PA = p_savedState[4];
+  QA = p_savedState[5];
+  PB = p_savedState[6];
+  QB = p_savedState[7];
+  Pmotor = p_savedState[8];
+  Qmotor = p_savedState[9];
+  stallTimer = p_savedState[10];
+  restartTimer = p_savedState[11];
+  FthA = p_savedState[12];
+  FthB = p_savedState[13];
+  Kuv = p_savedState[14];
+  Kcon = p_savedState[15];
+  fcon_trip = p_savedState[16];
+  UVTimer1 = p_savedState[17];
+  UVTimer2 = p_savedState[18];
+  statusA = p_savedCounts[0];
+  statusB = p_savedCounts[1];
+  equivYpq_motorBase = p_savedPhasors[0];
+}
+
 /**
  * post process for time step
  * @param t_inc time step increment
@@ -18,6 +18,8 @@
 #include <iostream>
 #include <cstdio>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "base_generator_model.hpp"
@@ -30,6 +32,7 @@
 gridpack::dynamic_simulation::ClassicalGenerator::ClassicalGenerator(void)
 {
   p_PI = 4.0*atan(1.0);
+  p_systemBase = false;
 }
 
 /**
@@ -82,12 +85,17 @@ void gridpack::dynamic_simulation::ClassicalGenerator::load(
 void gridpack::dynamic_simulation::ClassicalGenerator::init(double mag,
     double ang, double ts) 
 { 
-  p_pg *= p_sbase; // p_pg *= p_sbase if ds2 read network from powerflow solution!
-  p_qg *= p_sbase; // p_qg *= p_sbase if ds2 read network from powerflow solution!
-  p_mva = p_sbase / p_mva;
-  p_d0 = p_d0 / p_mva;
-  p_h = p_h / p_mva;
-  p_dtr = p_dtr * p_mva;
+  // The conversion is only done the first time so that the model can be
+  // initialized again without being reloaded
+  if (!p_systemBase) {
+    p_pg *= p_sbase; // p_pg *= p_sbase if ds2 read network from powerflow solution!
+    p_qg *= p_sbase; // p_qg *= p_sbase if ds2 read network from powerflow solution!
+    p_mva = p_sbase / p_mva;
+    p_d0 = p_d0 / p_mva;
+    p_h = p_h / p_mva;
+    p_dtr = p_dtr * p_mva;
+    p_systemBase = true;
+  }
   p_pelect = p_pg;
   double eterm = mag;
   double vi = ang;
@@ -325,6 +333,26 @@ void gridpack::dynamic_simulation::ClassicalGenerator::corrector(
 #endif
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::ClassicalGenerator::saveState()
+{
+  p_savedPhasors[0] = p_mac_ang_s1;
+  p_savedPhasors[1] = p_mac_spd_s1;
+  p_savedPhasors[2] = p_eprime_s1;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::ClassicalGenerator::restoreState()
+{
+  p_mac_ang_s1 = p_savedPhasors[0];
+  p_mac_spd_s1 = p_savedPhasors[1];
+  p_eprime_s1 = p_savedPhasors[2];
+}
+
 /**
  * Set voltage on each generator
  */
@@ -395,6 +423,21 @@ double gridpack::dynamic_simulation::ClassicalGenerator::getAngle()
 {
   return real(p_mac_ang_s1);
 }
+
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is
+ * (dx_s1 - dx_s0)*t_inc/2 for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::ClassicalGenerator::getStepError(
+    double t_inc)
+{
+  double err = abs(p_dmac_ang_s1 - p_dmac_ang_s0);
+  err = std::max(err, abs(p_dmac_spd_s1 - p_dmac_spd_s0));
+  return 0.5 * err * t_inc;
+}
   
 /**
  * return a vector containing any generator values that are being
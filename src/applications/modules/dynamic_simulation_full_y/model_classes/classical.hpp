@@ -90,6 +90,16 @@ class ClassicalGenerator : public BaseGeneratorModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Set voltage on each generator
      */
@@ -117,6 +127,13 @@ class ClassicalGenerator : public BaseGeneratorModel
      */
     double getAngle();
 
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
     /**
      * return a vector containing any generator values that are being
      * watched
@@ -133,6 +150,9 @@ class ClassicalGenerator : public BaseGeneratorModel
     double p_d0, p_h;
     double p_PI;
 
+    // true once the parameters have been converted to system base by init
+    bool p_systemBase;
+
     gridpack::ComplexType p_pelect, p_volt;
     gridpack::ComplexType p_mac_ang_s0, p_mac_spd_s0;
     gridpack::ComplexType p_mac_ang_s1, p_mac_spd_s1;
@@ -170,6 +190,9 @@ class ClassicalGenerator : public BaseGeneratorModel
           & p_bus_id;
       }
 
+    // state at the start of the current time step, see saveState
+    gridpack::ComplexType p_savedPhasors[3];
+
 };
 }  // dynamic_simulation
 }  // gridpack
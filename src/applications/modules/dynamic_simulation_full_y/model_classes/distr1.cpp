@@ -214,6 +214,36 @@ bool gridpack::dynamic_simulation::Distr1Relay::updateRelay(double delta_t)
 	return true;
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Distr1Relay::saveState()
+{
+  p_savedState[0] = dzone1_dis;
+  p_savedState[1] = dzone2_dis;
+  p_savedCounts[0] = iflag;
+  p_savedCounts[1] = icount_zone1t;
+  p_savedCounts[2] = icount_zone2t;
+  p_savedCounts[3] = icount_breaker;
+  p_savedCounts[4] = iline_trip;
+  p_savedCounts[5] = iline_trip_prev;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Distr1Relay::restoreState()
+{
+  dzone1_dis = p_savedState[0];
+  dzone2_dis = p_savedState[1];
+  iflag = p_savedCounts[0];
+  icount_zone1t = p_savedCounts[1];
+  icount_zone2t = p_savedCounts[2];
+  icount_breaker = p_savedCounts[3];
+  iline_trip = p_savedCounts[4];
+  iline_trip_prev = p_savedCounts[5];
+}
+
 /**
  * Return internal status of relay (margin by which threshold has bee
  * exceeded)
@@ -56,6 +56,16 @@ public:
      */
     bool updateRelay(double delta_t);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Return internal status of relay (margin by which threshold has bee
      * exceeded)
@@ -94,8 +104,10 @@ public:
 	// output variables
 	int iline_trip;
 	int iline_trip_prev;
-					
 
+	// state at the start of the current time step, see saveState
+	double p_savedState[2];
+	int p_savedCounts[6];
 
 };
 }  // dynamic_simulation
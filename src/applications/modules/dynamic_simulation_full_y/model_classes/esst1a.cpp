@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/parser/dictionary.hpp"
@@ -344,6 +346,49 @@ void gridpack::dynamic_simulation::Esst1aModel::corrector(double t_inc, bool fla
   //printf("esst1a Efd: %f\n", Efd);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::Esst1aModel::getStepError(double t_inc)
+{
+  double err = fabs(dx1Va_1 - dx1Va);
+  err = std::max(err, fabs(dx2Vcomp_1 - dx2Vcomp));
+  err = std::max(err, fabs(dx3LL1_1 - dx3LL1));
+  err = std::max(err, fabs(dx4LL2_1 - dx4LL2));
+  err = std::max(err, fabs(dx5Deriv_1 - dx5Deriv));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Esst1aModel::saveState()
+{
+  p_savedState[0] = x1Va_1;
+  p_savedState[1] = x2Vcomp_1;
+  p_savedState[2] = x3LL1_1;
+  p_savedState[3] = x4LL2_1;
+  p_savedState[4] = x5Deriv_1;
+  p_savedState[5] = Efd;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Esst1aModel::restoreState()
+{
+  x1Va_1 = p_savedState[0];
+  x2Vcomp_1 = p_savedState[1];
+  x3LL1_1 = p_savedState[2];
+  x4LL2_1 = p_savedState[3];
+  x5Deriv_1 = p_savedState[4];
+  Efd = p_savedState[5];
+}
+
 /**
  * Set the field voltage parameter inside the exciter
  * @param fldv value of the field voltage
@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <stdio.h>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -333,6 +335,46 @@ void gridpack::dynamic_simulation::Esst4bModel::corrector(double t_inc, bool fla
   printf("esst4b Efd: %f\n", Efd);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::Esst4bModel::getStepError(double t_inc)
+{
+  double err = fabs(dx1Vm_1 - dx1Vm);
+  err = std::max(err, fabs(dx2Vcomp_1 - dx2Vcomp));
+  err = std::max(err, fabs(dx3Va_1 - dx3Va));
+  err = std::max(err, fabs(dx4Vr_1 - dx4Vr));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Esst4bModel::saveState()
+{
+  p_savedState[0] = x1Vm_1;
+  p_savedState[1] = x2Vcomp_1;
+  p_savedState[2] = x3Va_1;
+  p_savedState[3] = x4Vr_1;
+  p_savedState[4] = Efd;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Esst4bModel::restoreState()
+{
+  x1Vm_1 = p_savedState[0];
+  x2Vcomp_1 = p_savedState[1];
+  x3Va_1 = p_savedState[2];
+  x4Vr_1 = p_savedState[3];
+  Efd = p_savedState[4];
+}
+
 /**
  * Set the field voltage parameter inside the exciter
  * @param fldv value of the field voltage
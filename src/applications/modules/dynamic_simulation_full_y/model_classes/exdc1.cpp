@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/parser/dictionary.hpp"
@@ -255,6 +257,49 @@ void gridpack::dynamic_simulation::Exdc1Model::corrector(double t_inc, bool flag
   ///printf("exdc1 Efd: %f\n", Efd);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::Exdc1Model::getStepError(double t_inc)
+{
+  double err = fabs(dx1_1 - dx1);
+  err = std::max(err, fabs(dx2_1 - dx2));
+  err = std::max(err, fabs(dx3_1 - dx3));
+  err = std::max(err, fabs(dx4_1 - dx4));
+  err = std::max(err, fabs(dx5_1 - dx5));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Exdc1Model::saveState()
+{
+  p_savedState[0] = x1_1;
+  p_savedState[1] = x2_1;
+  p_savedState[2] = x3_1;
+  p_savedState[3] = x4_1;
+  p_savedState[4] = x5_1;
+  p_savedState[5] = Efd;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Exdc1Model::restoreState()
+{
+  x1_1 = p_savedState[0];
+  x2_1 = p_savedState[1];
+  x3_1 = p_savedState[2];
+  x4_1 = p_savedState[3];
+  x5_1 = p_savedState[4];
+  Efd = p_savedState[5];
+}
+
 /**
  * Set the field voltage parameter inside the exciter
  * @param fldv value of the field voltage
@@ -72,6 +72,23 @@ class Exdc1Model : public BaseExciterModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Set the field voltage parameter inside the exciter
      * @param fldv value of the field voltage
@@ -135,6 +152,10 @@ class Exdc1Model : public BaseExciterModel
     double Vterminal, w; 
 
     //boost::shared_ptr<BaseGeneratorModel> p_generator;
+
+    // state at the start of the current time step, see saveState
+    double p_savedState[6];
+
 };
 }  // dynamic_simulation
 }  // gridpack
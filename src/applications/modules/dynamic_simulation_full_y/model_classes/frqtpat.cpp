@@ -155,6 +155,34 @@ bool gridpack::dynamic_simulation::FrqtpatRelay::updateRelay(double delta_t)
 	return true;
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::FrqtpatRelay::saveState()
+{
+  p_savedState[0] = dvol_freq;
+  p_savedCounts[0] = icount_pickup_lowfreq;
+  p_savedCounts[1] = icount_pickup_upfreq;
+  p_savedCounts[2] = icount_breaker;
+  p_savedCounts[3] = iflag;
+  p_savedCounts[4] = igen_trip;
+  p_savedCounts[5] = igen_trip_prev;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::FrqtpatRelay::restoreState()
+{
+  dvol_freq = p_savedState[0];
+  icount_pickup_lowfreq = p_savedCounts[0];
+  icount_pickup_upfreq = p_savedCounts[1];
+  icount_breaker = p_savedCounts[2];
+  iflag = p_savedCounts[3];
+  igen_trip = p_savedCounts[4];
+  igen_trip_prev = p_savedCounts[5];
+}
+
 /**
  * Return internal status of relay (margin by which threshold has bee
  * exceeded)
@@ -56,6 +56,16 @@ public:
      */
     bool updateRelay(double delta_t);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Return internal status of relay (margin by which threshold has bee
      * exceeded)
@@ -84,7 +94,11 @@ public:
 							
 	// output variables
 	int igen_trip;			//  generator_trip signal: if igen_trip == 1, take action to do load shedding.		
-	int igen_trip_prev;	
+	int igen_trip_prev;
+
+	// state at the start of the current time step, see saveState
+	double p_savedState[1];
+	int p_savedCounts[6];
 
 };
 }  // dynamic_simulation
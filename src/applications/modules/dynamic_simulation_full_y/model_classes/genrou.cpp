@@ -18,11 +18,15 @@
 #include <iostream>
 #include <cstdio>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "base_generator_model.hpp"
 #include "genrou.hpp"
+#include "genrou_engine.hpp"
+#include "machine_kernels.hpp"
 //#include "exdc1.hpp"
 
 /**
@@ -42,6 +46,8 @@ gridpack::dynamic_simulation::GenrouGenerator::GenrouGenerator(void)
     dx4Psidp_1 = 0;
     dx5Psiqp_1 = 0;;
     dx6Edp_1 = 0;;
+    p_engine = NULL;
+    p_engineIdx = -1;
 }
 
 /**
@@ -99,12 +105,9 @@ void gridpack::dynamic_simulation::GenrouGenerator::load(
  */
 double gridpack::dynamic_simulation::GenrouGenerator::Sat(double x)
 {
-    double a_ = S12 / S10 - 1.0 / 1.2;
-    double b_ = -2 * S12 / S10 + 2;
-    double c_ = S12 / S10 - 1.2;
-    double A = (-b_ - sqrt(b_ * b_ - 4 * a_ * c_)) / (2 * a_);
-    double B = S10 / ((1.0 - A) * (1.0 - A));
-    double result = B * (x - A) * (x - A) / x;
+    double A, B;
+    kernels::quadraticSatCoeffs(S10, S12, A, B);
+    double result = kernels::quadraticSat(A, B, x);
     //printf("a = %f, b = %f, c = %f, A = %f, B = %f, S12 = %f, S10 = %f\n", a_, b_, c_, A, B, S12, S10);
     //printf("Sat result = %f\n", result); 
     return result; // Scaled Quadratic with 1.7.1 equations
@@ -175,6 +178,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::init(double mag,
  */
 gridpack::ComplexType gridpack::dynamic_simulation::GenrouGenerator::INorton()
 {
+  if (p_engine) return p_engine->INorton(p_engineIdx);
   return p_INorton;
 }
 
@@ -208,6 +212,7 @@ gridpack::ComplexType gridpack::dynamic_simulation::GenrouGenerator::NortonImped
  */
 void gridpack::dynamic_simulation::GenrouGenerator::predictor_currentInjection(bool flag)
 {
+  if (p_engine) return; // advanced by GenrouEngine
   if (!flag) {
     x1d = x1d_1;
     x2w = x2w_1;
@@ -228,10 +233,10 @@ void gridpack::dynamic_simulation::GenrouGenerator::predictor_currentInjection(b
   double Vq = + Psidpp * (1 + x2w);
   Vterm = presentMag;
   Theta = presentAng;
-  double Vrterm = Vterm * cos(Theta);
-  double Viterm = Vterm * sin(Theta);
-  double Vdterm = Vrterm * sin(x1d) - Viterm * cos(x1d);
-  double Vqterm = Vrterm * cos(x1d) + Viterm * sin(x1d);
+  double Vrterm, Viterm, Vdterm, Vqterm, sinAng, cosAng;
+  kernels::polarToRI(Vterm, Theta, Vrterm, Viterm);
+  kernels::sincos(x1d, sinAng, cosAng);
+  kernels::riToDQ(sinAng, cosAng, Vrterm, Viterm, Vdterm, Vqterm);
   //printf("x2w = %f, Vd = %f, Vq = %f, Vrterm = %f, Viterm = %f, Vdterm = %f, Vqterm = %f, Theta = %f\n", x2w, Vd, Vq, Vrterm, Viterm, Vdterm, Vqterm, Theta);
   //DQ Axis
   Id = (Vd - Vdterm) * G - (Vq - Vqterm) * B;
@@ -239,10 +244,8 @@ void gridpack::dynamic_simulation::GenrouGenerator::predictor_currentInjection(b
   double Idnorton = Vd * G - Vq * B;
   double Iqnorton = Vd * B + Vq * G;
   //Network
-  Ir = + Id * sin(x1d) + Iq * cos(x1d);
-  Ii = - Id * cos(x1d) + Iq * sin(x1d);
-  IrNorton = + Idnorton * sin(x1d) + Iqnorton * cos(x1d);
-  IiNorton = - Idnorton * cos(x1d) + Iqnorton * sin(x1d);
+  kernels::dqToRI(sinAng, cosAng, Id, Iq, Ir, Ii);
+  kernels::dqToRI(sinAng, cosAng, Idnorton, Iqnorton, IrNorton, IiNorton);
   IrNorton = IrNorton * MVABase / p_sbase; 
   IiNorton = IiNorton * MVABase / p_sbase; 
   //gridpack::ComplexType INorton(IrNorton, IiNorton);
@@ -257,6 +260,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::predictor_currentInjection(b
 void gridpack::dynamic_simulation::GenrouGenerator::predictor(
     double t_inc, bool flag)
 {
+  if (p_engine) return; // advanced by GenrouEngine
   printf("\n***** GEN %d Predicator:\n", p_bus_id);
 
   p_exciter = getExciter();
@@ -318,6 +322,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::predictor(
  */
 void gridpack::dynamic_simulation::GenrouGenerator::corrector_currentInjection(bool flag)
 {
+  if (p_engine) return; // advanced by GenrouEngine
   // Calculate INorton_full
   // Admittance
   B = -Xdpp / (Ra * Ra + Xdpp * Xdpp);
@@ -330,20 +335,18 @@ void gridpack::dynamic_simulation::GenrouGenerator::corrector_currentInjection(b
   double Vq = +Psidpp * (1 + x2w_1);
   Vterm = presentMag;
   Theta = presentAng;
-  double Vrterm = Vterm * cos(Theta);
-  double Viterm = Vterm * sin(Theta);
-  double Vdterm = Vrterm * sin(x1d_1) - Viterm * cos(x1d_1);
-  double Vqterm = Vrterm * cos(x1d_1) + Viterm * sin(x1d_1);
+  double Vrterm, Viterm, Vdterm, Vqterm, sinAng, cosAng;
+  kernels::polarToRI(Vterm, Theta, Vrterm, Viterm);
+  kernels::sincos(x1d_1, sinAng, cosAng);
+  kernels::riToDQ(sinAng, cosAng, Vrterm, Viterm, Vdterm, Vqterm);
   //DQ Axis
   Id = (Vd - Vdterm) * G - (Vq - Vqterm) * B;
   Iq = (Vd - Vdterm) * B + (Vq - Vqterm) * G;
   double Idnorton = Vd * G - Vq * B;
   double Iqnorton = Vd * B + Vq * G;
   //Network
-  Ir = + Id * sin(x1d_1) + Iq * cos(x1d_1);
-  Ii = - Id * cos(x1d_1) + Iq * sin(x1d_1);
-  IrNorton = + Idnorton * sin(x1d_1) + Iqnorton * cos(x1d_1);
-  IiNorton = - Idnorton * cos(x1d_1) + Iqnorton * sin(x1d_1); 
+  kernels::dqToRI(sinAng, cosAng, Id, Iq, Ir, Ii);
+  kernels::dqToRI(sinAng, cosAng, Idnorton, Iqnorton, IrNorton, IiNorton); 
   IrNorton = IrNorton * MVABase / p_sbase; 
   IiNorton = IiNorton * MVABase / p_sbase; 
   //gridpack::ComplexType INorton(IrNorton, IiNorton);
@@ -358,6 +361,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::corrector_currentInjection(b
 void gridpack::dynamic_simulation::GenrouGenerator::corrector(
     double t_inc, bool flag)
 {
+  if (p_engine) return; // advanced by GenrouEngine
   printf("\n***** GEN %d Corrector:\n", p_bus_id);
 
   p_exciter = getExciter();
@@ -408,6 +412,34 @@ void gridpack::dynamic_simulation::GenrouGenerator::corrector(
      //     p_bus_id, x1d_1, x2w_1, x3Eqp_1, x4Psidp_1, x5Psiqp_1, x6Edp_1);
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::GenrouGenerator::saveState()
+{
+  if (p_engine) return; // the engine saves the state of its machines
+  p_savedState[0] = x1d_1;
+  p_savedState[1] = x2w_1;
+  p_savedState[2] = x3Eqp_1;
+  p_savedState[3] = x4Psidp_1;
+  p_savedState[4] = x5Psiqp_1;
+  p_savedState[5] = x6Edp_1;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::GenrouGenerator::restoreState()
+{
+  if (p_engine) return;
+  x1d_1 = p_savedState[0];
+  x2w_1 = p_savedState[1];
+  x3Eqp_1 = p_savedState[2];
+  x4Psidp_1 = p_savedState[3];
+  x5Psiqp_1 = p_savedState[4];
+  x6Edp_1 = p_savedState[5];
+}
+
 /**
  * Set voltage on each generator
  */
@@ -416,6 +448,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::setVoltage(
 {
   presentMag = abs(voltage);
   presentAng = atan2(imag(voltage), real(voltage));  
+  if (p_engine) p_engine->setVoltage(p_engineIdx, presentMag, presentAng);
 }
 
 /** 
@@ -424,9 +457,31 @@ void gridpack::dynamic_simulation::GenrouGenerator::setVoltage(
  */
 double gridpack::dynamic_simulation::GenrouGenerator::getFieldVoltage()
 {
+  if (p_engine) p_engine->store(p_engineIdx);
   return Efd;
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is
+ * (dx_1 - dx)*t_inc/2 for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::GenrouGenerator::getStepError(
+    double t_inc)
+{
+  // the engine estimates the error of the machines it owns
+  if (p_engine || !getGenStatus()) return 0.0;
+  double err = fabs(dx1d_1 - dx1d);
+  err = std::max(err, fabs(dx2w_1 - dx2w));
+  err = std::max(err, fabs(dx3Eqp_1 - dx3Eqp));
+  err = std::max(err, fabs(dx4Psidp_1 - dx4Psidp));
+  err = std::max(err, fabs(dx5Psiqp_1 - dx5Psiqp));
+  err = std::max(err, fabs(dx6Edp_1 - dx6Edp));
+  return 0.5 * err * t_inc;
+}
+
 /**
  * Write out generator state
  * @param signal character string used to determine behavior
@@ -435,6 +490,7 @@ double gridpack::dynamic_simulation::GenrouGenerator::getFieldVoltage()
 void gridpack::dynamic_simulation::GenrouGenerator::write(
     const char* signal, char *string)
 {
+  if (p_engine) p_engine->store(p_engineIdx);
   if (!strcmp(signal,"standard")) {
     //sprintf(string,"      %8d            %2s    %12.6f    %12.6f    %12.6f    %12.6f\n",
     //    p_bus_id,p_ckt.c_str(),real(p_mac_ang_s1),real(p_mac_spd_s1),real(p_mech),
@@ -453,6 +509,7 @@ void gridpack::dynamic_simulation::GenrouGenerator::getWatchValues(
     std::vector<double> &vals)
 {
   vals.clear();
+  if (p_engine) p_engine->store(p_engineIdx);
   if (getWatch()) {
     vals.push_back(x1d_1+1.0);
     vals.push_back(x2w_1);
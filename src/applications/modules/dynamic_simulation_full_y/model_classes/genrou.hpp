@@ -22,6 +22,8 @@
 
 namespace gridpack {
 namespace dynamic_simulation {
+class GenrouEngine;
+
 class GenrouGenerator : public BaseGeneratorModel
 {
   public:
@@ -84,6 +86,16 @@ class GenrouGenerator : public BaseGeneratorModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Predict part calculate current injections
      * @param flag initial step if true
@@ -107,6 +119,13 @@ class GenrouGenerator : public BaseGeneratorModel
      */
     double getFieldVoltage();
 
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
     /**
      * Write out generator state
      * @param signal character string used to determine behavior
@@ -159,6 +178,12 @@ class GenrouGenerator : public BaseGeneratorModel
     std::string p_ckt;
     int p_bus_id;
 
+    // Engine that owns the state of this generator, if any
+    GenrouEngine *p_engine;
+    int p_engineIdx;
+
+    friend class GenrouEngine;
+
     friend class boost::serialization::access;
 
     template<class Archive>
@@ -173,6 +198,9 @@ class GenrouGenerator : public BaseGeneratorModel
           & p_bus_id;
       }
 
+    // state at the start of the current time step, see saveState
+    double p_savedState[6];
+
 };
 }  // dynamic_simulation
 }  // gridpack
@@ -0,0 +1,535 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -----------------------------------------------------------
+/**
+ * @file   genrou_engine.cpp
+ *
+ * @brief  Advance all GENROU machines on a process together. The
+ * equations are the same as GenrouGenerator, but each stage is a single
+ * loop over contiguous arrays instead of a virtual call per generator
+ *
+ *
+ */
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "genrou.hpp"
+#include "genrou_engine.hpp"
+#include "machine_kernels.hpp"
+
+/**
+ *  Basic constructor
+ */
+gridpack::dynamic_simulation::GenrouEngine::GenrouEngine(void)
+{
+  p_ngen = 0;
+}
+
+/**
+ *  Basic destructor
+ */
+gridpack::dynamic_simulation::GenrouEngine::~GenrouEngine(void)
+{
+  clear();
+}
+
+/**
+ * Release all generators. They go back to advancing their own state
+ */
+void gridpack::dynamic_simulation::GenrouEngine::clear()
+{
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    store(i);
+    p_gens[i]->p_engine = NULL;
+    p_gens[i]->p_engineIdx = -1;
+  }
+  reset();
+}
+
+/**
+ * Drop all generators without copying their state back or touching
+ * them. Used when the generators may already have been destroyed
+ */
+void gridpack::dynamic_simulation::GenrouEngine::reset()
+{
+  p_ngen = 0;
+  p_gens.clear();
+  p_exciters.clear();
+  p_governors.clear();
+  p_H.clear(); p_D.clear(); p_Ra.clear(); p_Xd.clear(); p_Xq.clear();
+  p_Xdp.clear(); p_Xdpp.clear(); p_Xl.clear(); p_Xqp.clear(); p_Xqpp.clear();
+  p_Tdop.clear(); p_Tdopp.clear(); p_Tqopp.clear();
+  p_MVABase.clear(); p_sbase.clear();
+  p_satA.clear(); p_satB.clear(); p_B.clear(); p_G.clear();
+  p_x1d.clear(); p_x2w.clear(); p_x3Eqp.clear(); p_x4Psidp.clear();
+  p_x5Psiqp.clear(); p_x6Edp.clear();
+  p_x1d_1.clear(); p_x2w_1.clear(); p_x3Eqp_1.clear(); p_x4Psidp_1.clear();
+  p_x5Psiqp_1.clear(); p_x6Edp_1.clear();
+  p_dx1d.clear(); p_dx2w.clear(); p_dx3Eqp.clear(); p_dx4Psidp.clear();
+  p_dx5Psiqp.clear(); p_dx6Edp.clear();
+  p_dx1d_1.clear(); p_dx2w_1.clear(); p_dx3Eqp_1.clear(); p_dx4Psidp_1.clear();
+  p_dx5Psiqp_1.clear(); p_dx6Edp_1.clear();
+  p_saved_x1d.clear(); p_saved_x2w.clear(); p_saved_x3Eqp.clear();
+  p_saved_x4Psidp.clear(); p_saved_x5Psiqp.clear(); p_saved_x6Edp.clear();
+  p_Id.clear(); p_Iq.clear(); p_Efd.clear(); p_LadIfd.clear();
+  p_Pmech.clear();
+  p_mag.clear(); p_ang.clear();
+  p_IrNorton.clear(); p_IiNorton.clear();
+  p_sin.clear(); p_cos.clear(); p_sat.clear();
+  p_Vr.clear(); p_Vi.clear(); p_Vdterm.clear(); p_Vqterm.clear();
+  p_Idn.clear(); p_Iqn.clear();
+}
+
+/**
+ * Copy the parameters and state of an initialized generator into the
+ * engine. From then on the generator state is owned by the engine
+ * @param gen generator that has already been initialized
+ */
+void gridpack::dynamic_simulation::GenrouEngine::add(GenrouGenerator *gen)
+{
+  gen->p_engine = this;
+  gen->p_engineIdx = p_ngen;
+  p_ngen++;
+  p_gens.push_back(gen);
+  p_exciters.push_back(gen->p_exciter.get());
+  p_governors.push_back(gen->p_governor.get());
+
+  p_H.push_back(gen->H);
+  p_D.push_back(gen->D);
+  p_Ra.push_back(gen->Ra);
+  p_Xd.push_back(gen->Xd);
+  p_Xq.push_back(gen->Xq);
+  p_Xdp.push_back(gen->Xdp);
+  p_Xdpp.push_back(gen->Xdpp);
+  p_Xl.push_back(gen->Xl);
+  p_Xqp.push_back(gen->Xqp);
+  p_Xqpp.push_back(gen->Xqpp);
+  p_Tdop.push_back(gen->Tdop);
+  p_Tdopp.push_back(gen->Tdopp);
+  p_Tqopp.push_back(gen->Tqopp);
+
+  p_MVABase.push_back(gen->MVABase);
+  p_sbase.push_back(gen->p_sbase);
+
+  double A, B;
+  kernels::quadraticSatCoeffs(gen->S10, gen->S12, A, B);
+  p_satA.push_back(A);
+  p_satB.push_back(B);
+  double Ra = gen->Ra;
+  double Xdpp = gen->Xdpp;
+  p_B.push_back(-Xdpp / (Ra * Ra + Xdpp * Xdpp));
+  p_G.push_back(Ra / (Ra * Ra + Xdpp * Xdpp));
+
+  p_x1d.push_back(gen->x1d);
+  p_x2w.push_back(gen->x2w);
+  p_x3Eqp.push_back(gen->x3Eqp);
+  p_x4Psidp.push_back(gen->x4Psidp);
+  p_x5Psiqp.push_back(gen->x5Psiqp);
+  p_x6Edp.push_back(gen->x6Edp);
+  p_x1d_1.push_back(gen->x1d_1);
+  p_x2w_1.push_back(gen->x2w_1);
+  p_x3Eqp_1.push_back(gen->x3Eqp_1);
+  p_x4Psidp_1.push_back(gen->x4Psidp_1);
+  p_x5Psiqp_1.push_back(gen->x5Psiqp_1);
+  p_x6Edp_1.push_back(gen->x6Edp_1);
+  p_dx1d.push_back(gen->dx1d);
+  p_dx2w.push_back(gen->dx2w);
+  p_dx3Eqp.push_back(gen->dx3Eqp);
+  p_dx4Psidp.push_back(gen->dx4Psidp);
+  p_dx5Psiqp.push_back(gen->dx5Psiqp);
+  p_dx6Edp.push_back(gen->dx6Edp);
+  p_dx1d_1.push_back(gen->dx1d_1);
+  p_dx2w_1.push_back(gen->dx2w_1);
+  p_dx3Eqp_1.push_back(gen->dx3Eqp_1);
+  p_dx4Psidp_1.push_back(gen->dx4Psidp_1);
+  p_dx5Psiqp_1.push_back(gen->dx5Psiqp_1);
+  p_dx6Edp_1.push_back(gen->dx6Edp_1);
+  p_Id.push_back(gen->Id);
+  p_Iq.push_back(gen->Iq);
+  p_Efd.push_back(gen->Efd);
+  p_LadIfd.push_back(gen->LadIfd);
+  p_Pmech.push_back(gen->Pmech);
+  p_mag.push_back(gen->presentMag);
+  p_ang.push_back(gen->presentAng);
+  p_IrNorton.push_back(real(gen->p_INorton));
+  p_IiNorton.push_back(imag(gen->p_INorton));
+
+  p_sin.resize(p_ngen);
+  p_cos.resize(p_ngen);
+  p_sat.resize(p_ngen);
+  p_Vr.resize(p_ngen);
+  p_Vi.resize(p_ngen);
+  p_Vdterm.resize(p_ngen);
+  p_Vqterm.resize(p_ngen);
+  p_Idn.resize(p_ngen);
+  p_Iqn.resize(p_ngen);
+}
+
+/**
+ * @return number of generators in engine
+ */
+int gridpack::dynamic_simulation::GenrouEngine::size() const
+{
+  return p_ngen;
+}
+
+/**
+ * Get field voltage and mechanical power from the exciters and
+ * governors of all generators
+ */
+void gridpack::dynamic_simulation::GenrouEngine::getControls()
+{
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    if (p_exciters[i]) p_Efd[i] = p_exciters[i]->getFieldVoltage();
+    if (p_governors[i]) p_Pmech[i] = p_governors[i]->getMechanicalPower();
+  }
+}
+
+/**
+ * Evaluate derivatives of all generators. The arguments are the
+ * state arrays to evaluate them at and the arrays to put them in
+ */
+void gridpack::dynamic_simulation::GenrouEngine::derivatives(
+    const double *x1d, const double *x2w, const double *x3Eqp,
+    const double *x4Psidp, const double *x5Psiqp, const double *x6Edp,
+    double *dx1d, double *dx2w, double *dx3Eqp, double *dx4Psidp,
+    double *dx5Psiqp, double *dx6Edp)
+{
+  const double pi = 4.0*atan(1.0);
+  const double *H = &p_H[0];
+  const double *D = &p_D[0];
+  const double *Xd = &p_Xd[0];
+  const double *Xq = &p_Xq[0];
+  const double *Xdp = &p_Xdp[0];
+  const double *Xdpp = &p_Xdpp[0];
+  const double *Xl = &p_Xl[0];
+  const double *Xqp = &p_Xqp[0];
+  const double *Xqpp = &p_Xqpp[0];
+  const double *Tdop = &p_Tdop[0];
+  const double *Tdopp = &p_Tdopp[0];
+  const double *Tqopp = &p_Tqopp[0];
+  const double *satA = &p_satA[0];
+  const double *satB = &p_satB[0];
+  const double *Id = &p_Id[0];
+  const double *Iq = &p_Iq[0];
+  const double *Efd = &p_Efd[0];
+  const double *Pmech = &p_Pmech[0];
+  const double *sat = &p_sat[0];
+  double *LadIfd = &p_LadIfd[0];
+  kernels::quadraticSat(p_ngen, satA, satB, x3Eqp, &p_sat[0]);
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    double Psiqpp = - x6Edp[i] * (Xqpp[i] - Xl[i]) / (Xqp[i] - Xl[i])
+      - x5Psiqp[i] * (Xqp[i] - Xqpp[i]) / (Xqp[i] - Xl[i]);
+    double Psidpp = + x3Eqp[i] * (Xdpp[i] - Xl[i]) / (Xdp[i] - Xl[i])
+      + x4Psidp[i] * (Xdp[i] - Xdpp[i]) / (Xdp[i] - Xl[i]);
+    double Telec = Psidpp * Iq[i] - Psiqpp * Id[i];
+    double TempD = (Xdp[i] - Xdpp[i]) / ((Xdp[i] - Xl[i]) * (Xdp[i] - Xl[i]))
+      * (-x4Psidp[i] - (Xdp[i] - Xl[i]) * Id[i] + x3Eqp[i]);
+    LadIfd[i] = x3Eqp[i] * (1 + sat[i]) + (Xd[i] - Xdp[i]) * (Id[i] + TempD);
+    dx1d[i] = x2w[i] * 2 * pi * 60;
+    dx2w[i] = 1 / (2 * H[i]) * ((Pmech[i] - D[i] * x2w[i]) / (1 + x2w[i])
+      - Telec);
+    dx3Eqp[i] = (Efd[i] - LadIfd[i]) / Tdop[i];
+    dx4Psidp[i] = (-x4Psidp[i] - (Xdp[i] - Xl[i]) * Id[i] + x3Eqp[i])
+      / Tdopp[i];
+    dx5Psiqp[i] = (-x5Psiqp[i] + (Xqp[i] - Xl[i]) * Iq[i] + x6Edp[i])
+      / Tqopp[i];
+    double TempQ = (Xqp[i] - Xqpp[i]) / ((Xqp[i] - Xl[i]) * (Xqp[i] - Xl[i]))
+      * (-x5Psiqp[i] + (Xqp[i] - Xl[i]) * Iq[i] + x6Edp[i]);
+    dx6Edp[i] = (-x6Edp[i] + (Xq[i] - Xqp[i]) * (Iq[i] - TempQ)) / Tqopp[i];
+  }
+}
+
+/**
+ * Evaluate Norton currents of all generators at the given angle,
+ * speed and flux states
+ */
+void gridpack::dynamic_simulation::GenrouEngine::currents(
+    const double *x1d, const double *x2w, const double *x3Eqp,
+    const double *x4Psidp, const double *x5Psiqp, const double *x6Edp)
+{
+  const double *Xdp = &p_Xdp[0];
+  const double *Xdpp = &p_Xdpp[0];
+  const double *Xl = &p_Xl[0];
+  const double *Xqp = &p_Xqp[0];
+  const double *Xqpp = &p_Xqpp[0];
+  const double *B = &p_B[0];
+  const double *G = &p_G[0];
+  const double *MVABase = &p_MVABase[0];
+  const double *sbase = &p_sbase[0];
+  const double *Vdterm = &p_Vdterm[0];
+  const double *Vqterm = &p_Vqterm[0];
+  double *Id = &p_Id[0];
+  double *Iq = &p_Iq[0];
+  double *Idn = &p_Idn[0];
+  double *Iqn = &p_Iqn[0];
+  double *IrNorton = &p_IrNorton[0];
+  double *IiNorton = &p_IiNorton[0];
+
+  // terminal voltage in machine frame
+  kernels::polarToRI(p_ngen, &p_mag[0], &p_ang[0], &p_Vr[0], &p_Vi[0]);
+  kernels::sincos(p_ngen, x1d, &p_sin[0], &p_cos[0]);
+  kernels::riToDQ(p_ngen, &p_sin[0], &p_cos[0], &p_Vr[0], &p_Vi[0],
+      &p_Vdterm[0], &p_Vqterm[0]);
+
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    double Psiqpp = - x6Edp[i] * (Xqpp[i] - Xl[i]) / (Xqp[i] - Xl[i])
+      - x5Psiqp[i] * (Xqp[i] - Xqpp[i]) / (Xqp[i] - Xl[i]);
+    double Psidpp = + x3Eqp[i] * (Xdpp[i] - Xl[i]) / (Xdp[i] - Xl[i])
+      + x4Psidp[i] * (Xdp[i] - Xdpp[i]) / (Xdp[i] - Xl[i]);
+    double Vd = - Psiqpp * (1 + x2w[i]);
+    double Vq = + Psidpp * (1 + x2w[i]);
+    Id[i] = (Vd - Vdterm[i]) * G[i] - (Vq - Vqterm[i]) * B[i];
+    Iq[i] = (Vd - Vdterm[i]) * B[i] + (Vq - Vqterm[i]) * G[i];
+    Idn[i] = Vd * G[i] - Vq * B[i];
+    Iqn[i] = Vd * B[i] + Vq * G[i];
+  }
+
+  // Norton current back in network frame
+  kernels::dqToRI(p_ngen, &p_sin[0], &p_cos[0], Idn, Iqn, IrNorton, IiNorton);
+  for (i=0; i<p_ngen; i++) {
+    IrNorton[i] = IrNorton[i] * MVABase[i] / sbase[i];
+    IiNorton[i] = IiNorton[i] * MVABase[i] / sbase[i];
+  }
+}
+
+/**
+ * Predict part calculate current injections for all generators
+ * @param flag initial step if true
+ */
+void gridpack::dynamic_simulation::GenrouEngine::predictor_currentInjection(
+    bool flag)
+{
+  if (p_ngen == 0) return;
+  if (!flag) {
+    p_x1d = p_x1d_1;
+    p_x2w = p_x2w_1;
+    p_x3Eqp = p_x3Eqp_1;
+    p_x4Psidp = p_x4Psidp_1;
+    p_x5Psiqp = p_x5Psiqp_1;
+    p_x6Edp = p_x6Edp_1;
+  }
+  currents(&p_x1d[0], &p_x2w[0], &p_x3Eqp[0], &p_x4Psidp[0],
+      &p_x5Psiqp[0], &p_x6Edp[0]);
+}
+
+/**
+ * Predict new state variables for time step for all generators
+ * @param t_inc time step increment
+ * @param flag initial step if true
+ */
+void gridpack::dynamic_simulation::GenrouEngine::predictor(
+    double t_inc, bool flag)
+{
+  if (p_ngen == 0) return;
+  getControls();
+  if (!flag) {
+    p_x1d = p_x1d_1;
+    p_x2w = p_x2w_1;
+    p_x3Eqp = p_x3Eqp_1;
+    p_x4Psidp = p_x4Psidp_1;
+    p_x5Psiqp = p_x5Psiqp_1;
+    p_x6Edp = p_x6Edp_1;
+  }
+  derivatives(&p_x1d[0], &p_x2w[0], &p_x3Eqp[0], &p_x4Psidp[0],
+      &p_x5Psiqp[0], &p_x6Edp[0], &p_dx1d[0], &p_dx2w[0], &p_dx3Eqp[0],
+      &p_dx4Psidp[0], &p_dx5Psiqp[0], &p_dx6Edp[0]);
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    p_x1d_1[i] = p_x1d[i] + p_dx1d[i] * t_inc;
+    p_x2w_1[i] = p_x2w[i] + p_dx2w[i] * t_inc;
+    p_x3Eqp_1[i] = p_x3Eqp[i] + p_dx3Eqp[i] * t_inc;
+    p_x4Psidp_1[i] = p_x4Psidp[i] + p_dx4Psidp[i] * t_inc;
+    p_x5Psiqp_1[i] = p_x5Psiqp[i] + p_dx5Psiqp[i] * t_inc;
+    p_x6Edp_1[i] = p_x6Edp[i] + p_dx6Edp[i] * t_inc;
+  }
+
+  // Exciters and governors can be any model, so they are still
+  // advanced one at a time
+  for (i=0; i<p_ngen; i++) {
+    if (p_exciters[i]) {
+      p_exciters[i]->setOmega(p_x2w_1[i]);
+      p_exciters[i]->setVterminal(p_mag[i]);
+      p_exciters[i]->predictor(t_inc, flag);
+    }
+    if (p_governors[i]) {
+      p_governors[i]->setRotorSpeedDeviation(p_x2w[i]);
+      p_governors[i]->predictor(t_inc, flag);
+    }
+  }
+}
+
+/**
+ * Corrector part calculate current injections for all generators
+ * @param flag initial step if true
+ */
+void gridpack::dynamic_simulation::GenrouEngine::corrector_currentInjection(
+    bool flag)
+{
+  if (p_ngen == 0) return;
+  // GenrouGenerator uses the predicted speed and angle with the
+  // present flux states here, so this does the same
+  currents(&p_x1d_1[0], &p_x2w_1[0], &p_x3Eqp[0], &p_x4Psidp[0],
+      &p_x5Psiqp[0], &p_x6Edp[0]);
+}
+
+/**
+ * Correct state variables for time step for all generators
+ * @param t_inc time step increment
+ * @param flag initial step if true
+ */
+void gridpack::dynamic_simulation::GenrouEngine::corrector(
+    double t_inc, bool flag)
+{
+  if (p_ngen == 0) return;
+  getControls();
+  derivatives(&p_x1d_1[0], &p_x2w_1[0], &p_x3Eqp_1[0], &p_x4Psidp_1[0],
+      &p_x5Psiqp_1[0], &p_x6Edp_1[0], &p_dx1d_1[0], &p_dx2w_1[0],
+      &p_dx3Eqp_1[0], &p_dx4Psidp_1[0], &p_dx5Psiqp_1[0], &p_dx6Edp_1[0]);
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    p_x1d_1[i] = p_x1d[i] + (p_dx1d[i] + p_dx1d_1[i]) / 2.0 * t_inc;
+    p_x2w_1[i] = p_x2w[i] + (p_dx2w[i] + p_dx2w_1[i]) / 2.0 * t_inc;
+    p_x3Eqp_1[i] = p_x3Eqp[i] + (p_dx3Eqp[i] + p_dx3Eqp_1[i]) / 2.0 * t_inc;
+    p_x4Psidp_1[i] = p_x4Psidp[i]
+      + (p_dx4Psidp[i] + p_dx4Psidp_1[i]) / 2.0 * t_inc;
+    p_x5Psiqp_1[i] = p_x5Psiqp[i]
+      + (p_dx5Psiqp[i] + p_dx5Psiqp_1[i]) / 2.0 * t_inc;
+    p_x6Edp_1[i] = p_x6Edp[i] + (p_dx6Edp[i] + p_dx6Edp_1[i]) / 2.0 * t_inc;
+  }
+
+  for (i=0; i<p_ngen; i++) {
+    if (p_exciters[i]) {
+      p_exciters[i]->setOmega(p_x2w_1[i]);
+      p_exciters[i]->setVterminal(p_mag[i]);
+      p_exciters[i]->corrector(t_inc, flag);
+    }
+    if (p_governors[i]) {
+      p_governors[i]->setRotorSpeedDeviation(p_x2w[i]);
+      p_governors[i]->corrector(t_inc, flag);
+    }
+  }
+}
+
+/**
+ * Estimate local error of the last corrector step of all generators
+ * @param t_inc time step increment
+ * @return largest error estimate
+ */
+double gridpack::dynamic_simulation::GenrouEngine::getStepError(
+    double t_inc) const
+{
+  double err = 0.0;
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gens[i]->getGenStatus()) continue;
+    err = std::max(err, fabs(p_dx1d_1[i] - p_dx1d[i]));
+    err = std::max(err, fabs(p_dx2w_1[i] - p_dx2w[i]));
+    err = std::max(err, fabs(p_dx3Eqp_1[i] - p_dx3Eqp[i]));
+    err = std::max(err, fabs(p_dx4Psidp_1[i] - p_dx4Psidp[i]));
+    err = std::max(err, fabs(p_dx5Psiqp_1[i] - p_dx5Psiqp[i]));
+    err = std::max(err, fabs(p_dx6Edp_1[i] - p_dx6Edp[i]));
+  }
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state of all generators at the start of a time step
+ */
+void gridpack::dynamic_simulation::GenrouEngine::saveState()
+{
+  p_saved_x1d = p_x1d_1;
+  p_saved_x2w = p_x2w_1;
+  p_saved_x3Eqp = p_x3Eqp_1;
+  p_saved_x4Psidp = p_x4Psidp_1;
+  p_saved_x5Psiqp = p_x5Psiqp_1;
+  p_saved_x6Edp = p_x6Edp_1;
+}
+
+/**
+ * Return all generators to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::GenrouEngine::restoreState()
+{
+  p_x1d_1 = p_saved_x1d;
+  p_x2w_1 = p_saved_x2w;
+  p_x3Eqp_1 = p_saved_x3Eqp;
+  p_x4Psidp_1 = p_saved_x4Psidp;
+  p_x5Psiqp_1 = p_saved_x5Psiqp;
+  p_x6Edp_1 = p_saved_x6Edp;
+}
+
+/**
+ * Set terminal voltage of a generator
+ * @param idx index of generator in engine
+ * @param mag voltage magnitude
+ * @param ang voltage angle
+ */
+void gridpack::dynamic_simulation::GenrouEngine::setVoltage(int idx,
+    double mag, double ang)
+{
+  p_mag[idx] = mag;
+  p_ang[idx] = ang;
+}
+
+/**
+ * Return contribution to Norton current of a generator
+ * @param idx index of generator in engine
+ * @return contribution to Norton vector
+ */
+gridpack::ComplexType gridpack::dynamic_simulation::GenrouEngine::INorton(
+    int idx) const
+{
+  return gridpack::ComplexType(p_IrNorton[idx], p_IiNorton[idx]);
+}
+
+/**
+ * Copy the current state of a generator back to the generator object
+ * so that it can be written out
+ * @param idx index of generator in engine
+ */
+void gridpack::dynamic_simulation::GenrouEngine::store(int idx)
+{
+  GenrouGenerator *gen = p_gens[idx];
+  gen->x1d = p_x1d[idx];
+  gen->x2w = p_x2w[idx];
+  gen->x3Eqp = p_x3Eqp[idx];
+  gen->x4Psidp = p_x4Psidp[idx];
+  gen->x5Psiqp = p_x5Psiqp[idx];
+  gen->x6Edp = p_x6Edp[idx];
+  gen->x1d_1 = p_x1d_1[idx];
+  gen->x2w_1 = p_x2w_1[idx];
+  gen->x3Eqp_1 = p_x3Eqp_1[idx];
+  gen->x4Psidp_1 = p_x4Psidp_1[idx];
+  gen->x5Psiqp_1 = p_x5Psiqp_1[idx];
+  gen->x6Edp_1 = p_x6Edp_1[idx];
+  gen->dx1d = p_dx1d[idx];
+  gen->dx2w = p_dx2w[idx];
+  gen->dx3Eqp = p_dx3Eqp[idx];
+  gen->dx4Psidp = p_dx4Psidp[idx];
+  gen->dx5Psiqp = p_dx5Psiqp[idx];
+  gen->dx6Edp = p_dx6Edp[idx];
+  gen->dx1d_1 = p_dx1d_1[idx];
+  gen->dx2w_1 = p_dx2w_1[idx];
+  gen->dx3Eqp_1 = p_dx3Eqp_1[idx];
+  gen->dx4Psidp_1 = p_dx4Psidp_1[idx];
+  gen->dx5Psiqp_1 = p_dx5Psiqp_1[idx];
+  gen->dx6Edp_1 = p_dx6Edp_1[idx];
+  gen->Id = p_Id[idx];
+  gen->Iq = p_Iq[idx];
+  gen->Efd = p_Efd[idx];
+  gen->LadIfd = p_LadIfd[idx];
+  gen->Pmech = p_Pmech[idx];
+  gen->presentMag = p_mag[idx];
+  gen->presentAng = p_ang[idx];
+  gen->p_INorton = gridpack::ComplexType(p_IrNorton[idx], p_IiNorton[idx]);
+}
@@ -0,0 +1,208 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   genrou_engine.hpp
+ *
+ * @brief  Advance all GENROU machines on a process together, with
+ * their states stored as a structure of arrays
+ *
+ *
+ */
+
+#ifndef _genrou_engine_h_
+#define _genrou_engine_h_
+
+#include <vector>
+#include "gridpack/utilities/complex.hpp"
+#include "base_exciter_model.hpp"
+#include "base_governor_model.hpp"
+
+namespace gridpack {
+namespace dynamic_simulation {
+
+class GenrouGenerator;
+
+/**
+ * Only GENROU machines are grouped. Other models are still advanced one
+ * object at a time:
+ *  - GENSAL drives a power system stabilizer between the machine update
+ *    and the exciter update (speed, then PSS, then Vstab to the exciter)
+ *    and zeroes its states when the generator is off. The GENROU kernels
+ *    have neither path, so GENSAL would need its own engine.
+ *  - GENCLS has two states and no controls, so there is little work per
+ *    machine to gain from grouping.
+ *  - Exciters (ESST1A, ESST4B, EXDC1) and governors (WSIEG1, WSHYGP,
+ *    GGOV1) branch on non-windup limits, deadbands and backlash at every
+ *    step, and WSIEG1, WSHYGP and GGOV1 are built from block objects
+ *    (GainBlockClass, DBIntClass, BackLashClass) that each keep their own
+ *    state. Grouping them means rewriting each model as array kernels.
+ *    The engine calls them per machine for Efd and Pmech, and to advance
+ *    them.
+ */
+class GenrouEngine
+{
+  public:
+    /**
+     * Basic constructor
+     */
+    GenrouEngine();
+
+    /**
+     * Basic destructor. Any generators still in the engine are released
+     */
+    ~GenrouEngine();
+
+    /**
+     * Release all generators. They go back to advancing their own state
+     */
+    void clear();
+
+    /**
+     * Drop all generators without copying their state back or touching
+     * them. Used when the generators may already have been destroyed,
+     * for example when the network is reloaded
+     */
+    void reset();
+
+    /**
+     * Copy the parameters and state of an initialized generator into the
+     * engine. From then on the generator state is owned by the engine
+     * @param gen generator that has already been initialized
+     */
+    void add(GenrouGenerator *gen);
+
+    /**
+     * @return number of generators in engine
+     */
+    int size() const;
+
+    /**
+     * Predict part calculate current injections for all generators
+     * @param flag initial step if true
+     */
+    void predictor_currentInjection(bool flag);
+
+    /**
+     * Predict new state variables for time step for all generators
+     * @param t_inc time step increment
+     * @param flag initial step if true
+     */
+    void predictor(double t_inc, bool flag);
+
+    /**
+     * Corrector part calculate current injections for all generators
+     * @param flag initial step if true
+     */
+    void corrector_currentInjection(bool flag);
+
+    /**
+     * Correct state variables for time step for all generators
+     * @param t_inc time step increment
+     * @param flag initial step if true
+     */
+    void corrector(double t_inc, bool flag);
+
+    /**
+     * Estimate local error of the last corrector step of all generators
+     * @param t_inc time step increment
+     * @return largest error estimate
+     */
+    double getStepError(double t_inc) const;
+
+    /**
+     * Save the state of all generators at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return all generators to the state saved by saveState
+     */
+    void restoreState();
+
+    /**
+     * Set terminal voltage of a generator
+     * @param idx index of generator in engine
+     * @param mag voltage magnitude
+     * @param ang voltage angle
+     */
+    void setVoltage(int idx, double mag, double ang);
+
+    /**
+     * Return contribution to Norton current of a generator
+     * @param idx index of generator in engine
+     * @return contribution to Norton vector
+     */
+    gridpack::ComplexType INorton(int idx) const;
+
+    /**
+     * Copy the current state of a generator back to the generator object
+     * so that it can be written out
+     * @param idx index of generator in engine
+     */
+    void store(int idx);
+
+  private:
+
+    /**
+     * Evaluate derivatives of all generators. The arguments are the
+     * state arrays to evaluate them at and the arrays to put them in
+     */
+    void derivatives(const double *x1d, const double *x2w,
+        const double *x3Eqp, const double *x4Psidp, const double *x5Psiqp,
+        const double *x6Edp, double *dx1d, double *dx2w, double *dx3Eqp,
+        double *dx4Psidp, double *dx5Psiqp, double *dx6Edp);
+
+    /**
+     * Evaluate Norton currents of all generators at the given angle,
+     * speed and flux states
+     */
+    void currents(const double *x1d, const double *x2w,
+        const double *x3Eqp, const double *x4Psidp, const double *x5Psiqp,
+        const double *x6Edp);
+
+    /**
+     * Get field voltage and mechanical power from the exciters and
+     * governors of all generators
+     */
+    void getControls();
+
+    int p_ngen;
+
+    std::vector<GenrouGenerator*> p_gens;
+    std::vector<BaseExciterModel*> p_exciters;
+    std::vector<BaseGovernorModel*> p_governors;
+
+    // parameters
+    std::vector<double> p_H, p_D, p_Ra, p_Xd, p_Xq, p_Xdp, p_Xdpp, p_Xl;
+    std::vector<double> p_Xqp, p_Xqpp, p_Tdop, p_Tdopp, p_Tqopp;
+
+    std::vector<double> p_MVABase, p_sbase;
+
+    // constants derived from the parameters when a generator is added
+    std::vector<double> p_satA, p_satB, p_B, p_G;
+
+    // state
+    std::vector<double> p_x1d, p_x2w, p_x3Eqp, p_x4Psidp, p_x5Psiqp, p_x6Edp;
+    std::vector<double> p_x1d_1, p_x2w_1, p_x3Eqp_1, p_x4Psidp_1,
+      p_x5Psiqp_1, p_x6Edp_1;
+    std::vector<double> p_dx1d, p_dx2w, p_dx3Eqp, p_dx4Psidp, p_dx5Psiqp,
+      p_dx6Edp;
+    std::vector<double> p_dx1d_1, p_dx2w_1, p_dx3Eqp_1, p_dx4Psidp_1,
+      p_dx5Psiqp_1, p_dx6Edp_1;
+    std::vector<double> p_saved_x1d, p_saved_x2w, p_saved_x3Eqp,
+      p_saved_x4Psidp, p_saved_x5Psiqp, p_saved_x6Edp;
+    std::vector<double> p_Id, p_Iq, p_Efd, p_LadIfd, p_Pmech;
+    std::vector<double> p_mag, p_ang;
+    std::vector<double> p_IrNorton, p_IiNorton;
+
+    // work arrays for the machine kernels
+    std::vector<double> p_sin, p_cos, p_sat;
+    std::vector<double> p_Vr, p_Vi, p_Vdterm, p_Vqterm, p_Idn, p_Iqn;
+};
+}  // dynamic_simulation
+}  // gridpack
+#endif
@@ -18,11 +18,14 @@
 #include <iostream>
 #include <cstdio>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "base_generator_model.hpp"
 #include "gensal.hpp"
+#include "machine_kernels.hpp"
 //#include "exdc1.hpp"
 
 /**
@@ -102,12 +105,9 @@ void gridpack::dynamic_simulation::GensalGenerator::load(
  */
 double gridpack::dynamic_simulation::GensalGenerator::Sat(double x)
 {
-    double a_ = S12 / S10 - 1.0 / 1.2;
-    double b_ = -2 * S12 / S10 + 2;
-    double c_ = S12 / S10 - 1.2;
-    double A = (-b_ - sqrt(b_ * b_ - 4 * a_ * c_)) / (2 * a_);
-    double B = S10 / ((1.0 - A) * (1.0 - A));
-    double result = B * (x - A) * (x - A) / x;
+    double A, B;
+    kernels::quadraticSatCoeffs(S10, S12, A, B);
+    double result = kernels::quadraticSat(A, B, x);
     //printf("a = %f, b = %f, c = %f, A = %f, B = %f, S12 = %f, S10 = %f\n", a_, b_, c_, A, B, S12, S10);
     //printf("Sat result = %f\n", result); 
 	
@@ -274,10 +274,10 @@ void gridpack::dynamic_simulation::GensalGenerator::predictor_currentInjection(b
   Vterm = presentMag;
   //printf("Gensal predictor_currentInjection: %d %f\n", p_bus_id, Vterm);
   Theta = presentAng;
-  double Vrterm = Vterm * cos(Theta);
-  double Viterm = Vterm * sin(Theta);
-  double Vdterm = Vrterm * sin(x1d_0) - Viterm * cos(x1d_0);
-  double Vqterm = Vrterm * cos(x1d_0) + Viterm * sin(x1d_0);
+  double Vrterm, Viterm, Vdterm, Vqterm, sinAng, cosAng;
+  kernels::polarToRI(Vterm, Theta, Vrterm, Viterm);
+  kernels::sincos(x1d_0, sinAng, cosAng);
+  kernels::riToDQ(sinAng, cosAng, Vrterm, Viterm, Vdterm, Vqterm);
   //printf("x5Psiqpp_0 = %f, x3Eqp_0 = %f, Xl = %f, Xdp = %f, Psidpp = %f\n", x5Psiqpp_0, x3Eqp_0, Xl, Xdp, Psidpp);
   //printf("x2w_0 = %f, Vd = %f, Vq = %f, Vrterm = %f, Viterm = %f, Vdterm = %f, Vqterm = %f, Theta = %f\n", x2w_0, Vd, Vq, Vrterm, Viterm, Vdterm, Vqterm, Theta);
   //DQ Axis
@@ -286,10 +286,8 @@ void gridpack::dynamic_simulation::GensalGenerator::predictor_currentInjection(b
   double Idnorton = Vd * G - Vq * B;
   double Iqnorton = Vd * B + Vq * G;
   //Network
-  Ir = + Id * sin(x1d_0) + Iq * cos(x1d_0);
-  Ii = - Id * cos(x1d_0) + Iq * sin(x1d_0);
-  IrNorton = + Idnorton * sin(x1d_0) + Iqnorton * cos(x1d_0);
-  IiNorton = - Idnorton * cos(x1d_0) + Iqnorton * sin(x1d_0);
+  kernels::dqToRI(sinAng, cosAng, Id, Iq, Ir, Ii);
+  kernels::dqToRI(sinAng, cosAng, Idnorton, Iqnorton, IrNorton, IiNorton);
   IrNorton = IrNorton * MVABase / p_sbase; 
   IiNorton = IiNorton * MVABase / p_sbase; 
   //gridpack::ComplexType INorton(IrNorton, IiNorton);
@@ -426,20 +424,18 @@ void gridpack::dynamic_simulation::GensalGenerator::corrector_currentInjection(b
   double Vq = +Psidpp * (1 + x2w_1);
   Vterm = presentMag;
   Theta = presentAng;
-  double Vrterm = Vterm * cos(Theta);
-  double Viterm = Vterm * sin(Theta);
-  double Vdterm = Vrterm * sin(x1d_1) - Viterm * cos(x1d_1);
-  double Vqterm = Vrterm * cos(x1d_1) + Viterm * sin(x1d_1);
+  double Vrterm, Viterm, Vdterm, Vqterm, sinAng, cosAng;
+  kernels::polarToRI(Vterm, Theta, Vrterm, Viterm);
+  kernels::sincos(x1d_1, sinAng, cosAng);
+  kernels::riToDQ(sinAng, cosAng, Vrterm, Viterm, Vdterm, Vqterm);
   //DQ Axis
   Id = (Vd - Vdterm) * G - (Vq - Vqterm) * B;
   Iq = (Vd - Vdterm) * B + (Vq - Vqterm) * G;
   double Idnorton = Vd * G - Vq * B;
   double Iqnorton = Vd * B + Vq * G;
   //Network
-  Ir = + Id * sin(x1d_1) + Iq * cos(x1d_1);
-  Ii = - Id * cos(x1d_1) + Iq * sin(x1d_1);
-  IrNorton = + Idnorton * sin(x1d_1) + Iqnorton * cos(x1d_1);
-  IiNorton = - Idnorton * cos(x1d_1) + Iqnorton * sin(x1d_1); 
+  kernels::dqToRI(sinAng, cosAng, Id, Iq, Ir, Ii);
+  kernels::dqToRI(sinAng, cosAng, Idnorton, Iqnorton, IrNorton, IiNorton);
   IrNorton = IrNorton * MVABase / p_sbase; 
   IiNorton = IiNorton * MVABase / p_sbase; 
   //gridpack::ComplexType INorton(IrNorton, IiNorton);
@@ -551,6 +547,30 @@ void gridpack::dynamic_simulation::GensalGenerator::corrector(
   }
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::GensalGenerator::saveState()
+{
+  p_savedState[0] = x1d_1;
+  p_savedState[1] = x2w_1;
+  p_savedState[2] = x3Eqp_1;
+  p_savedState[3] = x4Psidp_1;
+  p_savedState[4] = x5Psiqpp_1;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::GensalGenerator::restoreState()
+{
+  x1d_1 = p_savedState[0];
+  x2w_1 = p_savedState[1];
+  x3Eqp_1 = p_savedState[2];
+  x4Psidp_1 = p_savedState[3];
+  x5Psiqpp_1 = p_savedState[4];
+}
+
 void gridpack::dynamic_simulation::GensalGenerator::setWideAreaFreqforPSS(double freq)
 {
 	p_wideareafreq = freq;
@@ -580,6 +600,25 @@ double gridpack::dynamic_simulation::GensalGenerator::getFieldVoltage()
   return Efd;
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is
+ * (dx_1 - dx_0)*t_inc/2 for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::GensalGenerator::getStepError(
+    double t_inc)
+{
+  if (!getGenStatus()) return 0.0;
+  double err = fabs(dx1d_1 - dx1d_0);
+  err = std::max(err, fabs(dx2w_1 - dx2w_0));
+  err = std::max(err, fabs(dx3Eqp_1 - dx3Eqp_0));
+  err = std::max(err, fabs(dx4Psidp_1 - dx4Psidp_0));
+  err = std::max(err, fabs(dx5Psiqpp_1 - dx5Psiqpp_0));
+  return 0.5 * err * t_inc;
+}
+
 /**
  * Write out generator state
  * @param signal character string used to determine behavior
@@ -84,6 +84,16 @@ class GensalGenerator : public BaseGeneratorModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Predict part calculate current injections
      * @param flag initial step if true
@@ -106,6 +116,13 @@ class GensalGenerator : public BaseGeneratorModel
      * @return value of field voltage
      */
     double getFieldVoltage();
+
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
 	
 	void setWideAreaFreqforPSS(double freq);
 
@@ -184,6 +201,9 @@ class GensalGenerator : public BaseGeneratorModel
           & p_bus_id;
       }
 
+    // state at the start of the current time step, see saveState
+    double p_savedState[5];
+
 };
 }  // dynamic_simulation
 }  // gridpack
@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <stdio.h>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -496,6 +498,72 @@ void gridpack::dynamic_simulation::Ggov1Model::corrector(double t_inc, bool flag
   printf("ggov1 Pmech = %f\n", Pmech);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::Ggov1Model::getStepError(double t_inc)
+{
+  double err = fabs(dx1Pelec_1 - dx1Pelec);
+  err = std::max(err, fabs(dx2GovDer_1 - dx2GovDer));
+  err = std::max(err, fabs(dx3GovInt_1 - dx3GovInt));
+  err = std::max(err, fabs(dx4Act_1 - dx4Act));
+  err = std::max(err, fabs(dx5LL_1 - dx5LL));
+  err = std::max(err, fabs(dx6Fload_1 - dx6Fload));
+  err = std::max(err, fabs(dx7LoadInt_1 - dx7LoadInt));
+  err = std::max(err, fabs(dx8LoadCtrl_1 - dx8LoadCtrl));
+  err = std::max(err, fabs(dx9Accel_1 - dx9Accel));
+  err = std::max(err, fabs(dx10TempLL_1 - dx10TempLL));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Ggov1Model::saveState()
+{
+  p_savedState[0] = x1Pelec_1;
+  p_savedState[1] = x2GovDer_1;
+  p_savedState[2] = x3GovInt_1;
+  p_savedState[3] = x4Act_1;
+  p_savedState[4] = x5LL_1;
+  p_savedState[5] = x6Fload_1;
+  p_savedState[6] = x7LoadInt_1;
+  p_savedState[7] = x8LoadCtrl_1;
+  p_savedState[8] = x9Accel_1;
+  p_savedState[9] = x10TempLL_1;
+  p_savedState[10] = Pmech;
+  p_savedState[11] = LastLowValueSelect;
+  p_savedState[12] = LeadLagOut;
+  p_savedBackLash = BackLash;
+  p_savedDBInt = DBInt;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Ggov1Model::restoreState()
+{
+  x1Pelec_1 = p_savedState[0];
+  x2GovDer_1 = p_savedState[1];
+  x3GovInt_1 = p_savedState[2];
+  x4Act_1 = p_savedState[3];
+  x5LL_1 = p_savedState[4];
+  x6Fload_1 = p_savedState[5];
+  x7LoadInt_1 = p_savedState[6];
+  x8LoadCtrl_1 = p_savedState[7];
+  x9Accel_1 = p_savedState[8];
+  x10TempLL_1 = p_savedState[9];
+  Pmech = p_savedState[10];
+  LastLowValueSelect = p_savedState[11];
+  LeadLagOut = p_savedState[12];
+  BackLash = p_savedBackLash;
+  DBInt = p_savedDBInt;
+}
+
 /**
  * Set the mechanical power parameter inside the governor
  * @param pmech value of the mechanical power
@@ -128,34 +128,9 @@ void gridpack::dynamic_simulation::IeelLoad::load(
     
   printf("IeelLoad::load(): a1: %f, a2: %f, a3: %f, a4: %f, a5: %f, a6: %f, a7: %f, a8: %f, \n", a1, a2, a3, a4, a5, a6, a7, a8);
   printf("IeelLoad::load(): n1: %f, n2: %f, n3: %f, n4: %f, n5: %f, n6: %f,  \n", n1, n2, n3, n4, n5, n6);
-  
-}
-
-/**
- * Initialize load model before calculation
- * @param mag voltage magnitude
- * @param ang voltage angle
- */
-void gridpack::dynamic_simulation::IeelLoad::init(double mag,
-    double ang, double ts)
-{
-  double vt_mag = mag;
-  //SJin: What are parameters Pinit_pu, Qinit_pu, and vt? From where to get them?
-  //Fake declaration; 
-  double Pinit_pu, Qinit_pu, sysMVA;
-  sysMVA = 100.0;
-  Pinit_pu = p_pl/sysMVA;
-  Qinit_pu = p_ql/sysMVA;
-
-  P0 = Pinit_pu;
-  Q0 = Qinit_pu;
-  P = Pinit_pu;
-  Q = Qinit_pu;
-
-  vt_init = vt_mag;
-  gridpack::ComplexType tmp (Pinit_pu, -Qinit_pu); 
-  nortonY = tmp / vt_mag / vt_mag;
 
+  // The coefficients are checked here rather than in init so that the
+  // model can be initialized again without being reloaded
   // check the data to make sure a1+a2+a3 = 1 
   if (a1 + a2 + a3  > 0.0) {
     if (abs(a1 + a2 + a3 -1.0) >1.0E-6) {
@@ -183,6 +158,32 @@ void gridpack::dynamic_simulation::IeelLoad::init(double mag,
   }
 }
 
+/**
+ * Initialize load model before calculation
+ * @param mag voltage magnitude
+ * @param ang voltage angle
+ */
+void gridpack::dynamic_simulation::IeelLoad::init(double mag,
+    double ang, double ts)
+{
+  double vt_mag = mag;
+  //SJin: What are parameters Pinit_pu, Qinit_pu, and vt? From where to get them?
+  //Fake declaration; 
+  double Pinit_pu, Qinit_pu, sysMVA;
+  sysMVA = 100.0;
+  Pinit_pu = p_pl/sysMVA;
+  Qinit_pu = p_ql/sysMVA;
+
+  P0 = Pinit_pu;
+  Q0 = Qinit_pu;
+  P = Pinit_pu;
+  Q = Qinit_pu;
+
+  vt_init = vt_mag;
+  gridpack::ComplexType tmp (Pinit_pu, -Qinit_pu); 
+  nortonY = tmp / vt_mag / vt_mag;
+}
+
 /**
  * Return contribution to Norton current
  * @return contribution to Norton vector
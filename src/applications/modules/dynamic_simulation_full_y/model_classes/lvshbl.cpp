@@ -160,6 +160,32 @@ bool gridpack::dynamic_simulation::LvshblRelay::updateRelay(double delta_t)
 	
 }
 
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::LvshblRelay::saveState()
+{
+  p_savedState[0] = dvol_mag;
+  p_savedCounts[0] = icount_pickup;
+  p_savedCounts[1] = icount_breaker;
+  p_savedCounts[2] = iflag;
+  p_savedCounts[3] = iload_shed;
+  p_savedCounts[4] = iload_shed_prev;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::LvshblRelay::restoreState()
+{
+  dvol_mag = p_savedState[0];
+  icount_pickup = p_savedCounts[0];
+  icount_breaker = p_savedCounts[1];
+  iflag = p_savedCounts[2];
+  iload_shed = p_savedCounts[3];
+  iload_shed_prev = p_savedCounts[4];
+}
+
 /**
  * Return internal status of relay (margin by which threshold has bee
  * exceeded)
@@ -56,6 +56,16 @@ public:
      */
     bool updateRelay(double delta_t);
 
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Return internal status of relay (margin by which threshold has bee
      * exceeded)
@@ -97,8 +107,11 @@ public:
 							
 	// output variables
 	int iload_shed;			//  Load_shedding signal: if iload_shed == 1, take action to do load shedding.		
-	int iload_shed_prev;	//  Load_shedding signal of the previous time steps.			
+	int iload_shed_prev;	//  Load_shedding signal of the previous time steps.
 
+	// state at the start of the current time step, see saveState
+	double p_savedState[1];
+	int p_savedCounts[5];
 
 };
 }  // dynamic_simulation
@@ -0,0 +1,263 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   machine_kernels.hpp
+ *
+ * @brief  Reference frame rotations and saturation curves shared by the
+ * machine models
+ *
+ * Each kernel has a single machine version, used by the model classes,
+ * and a batched version that works on arrays of machines. The batched
+ * versions evaluate exactly the same expressions as the single machine
+ * versions. If OpenMP is enabled they are marked for vectorization, in
+ * which case the compiler may use vector math routines for sin and cos
+ * that differ from the scalar ones in the last bit. Define
+ * GRIDPACK_SCALAR_MACHINE_KERNELS to turn this off when results must be
+ * bitwise identical to the one machine at a time models.
+ */
+
+#ifndef _machine_kernels_h_
+#define _machine_kernels_h_
+
+#include <cmath>
+
+#if defined(_OPENMP) && !defined(GRIDPACK_SCALAR_MACHINE_KERNELS)
+#define GRIDPACK_MACHINE_SIMD _Pragma("omp simd")
+#else
+#define GRIDPACK_MACHINE_SIMD
+#endif
+
+namespace gridpack {
+namespace dynamic_simulation {
+namespace kernels {
+
+/**
+ * Sine and cosine of an angle
+ * @param x angle
+ * @param s sin(x)
+ * @param c cos(x)
+ */
+inline void sincos(double x, double &s, double &c)
+{
+  s = sin(x);
+  c = cos(x);
+}
+
+/**
+ * Rotate a quantity from the network (real, imaginary) frame to the
+ * machine (d, q) frame
+ * @param s sine of rotor angle
+ * @param c cosine of rotor angle
+ * @param r real component
+ * @param i imaginary component
+ * @param d d axis component
+ * @param q q axis component
+ */
+inline void riToDQ(double s, double c, double r, double i,
+    double &d, double &q)
+{
+  d = r * s - i * c;
+  q = r * c + i * s;
+}
+
+/**
+ * Rotate a quantity from the machine (d, q) frame to the network
+ * (real, imaginary) frame
+ * @param s sine of rotor angle
+ * @param c cosine of rotor angle
+ * @param d d axis component
+ * @param q q axis component
+ * @param r real component
+ * @param i imaginary component
+ */
+inline void dqToRI(double s, double c, double d, double q,
+    double &r, double &i)
+{
+  r = + d * s + q * c;
+  i = - d * c + q * s;
+}
+
+/**
+ * Convert magnitude and angle to real and imaginary components
+ * @param mag magnitude
+ * @param ang angle
+ * @param r real component
+ * @param i imaginary component
+ */
+inline void polarToRI(double mag, double ang, double &r, double &i)
+{
+  r = mag * cos(ang);
+  i = mag * sin(ang);
+}
+
+/**
+ * Coefficients of the scaled quadratic saturation curve
+ * Sat(x) = B*(x-A)^2/x through S(1.0) = S10 and S(1.2) = S12
+ * @param S10 saturation at 1.0 pu
+ * @param S12 saturation at 1.2 pu
+ * @param A curve offset
+ * @param B curve scale
+ */
+inline void quadraticSatCoeffs(double S10, double S12, double &A, double &B)
+{
+  double a_ = S12 / S10 - 1.0 / 1.2;
+  double b_ = -2 * S12 / S10 + 2;
+  double c_ = S12 / S10 - 1.2;
+  A = (-b_ - sqrt(b_ * b_ - 4 * a_ * c_)) / (2 * a_);
+  B = S10 / ((1.0 - A) * (1.0 - A));
+}
+
+/**
+ * Evaluate scaled quadratic saturation curve
+ * @param A curve offset from quadraticSatCoeffs
+ * @param B curve scale from quadraticSatCoeffs
+ * @param x flux or voltage
+ * @return saturation
+ */
+inline double quadraticSat(double A, double B, double x)
+{
+  return B * (x - A) * (x - A) / x;
+}
+
+/**
+ * Coefficients of the exponential saturation curve Sat(x) = B*x^E
+ * through S(1.0) = S10 and S(1.2) = S12
+ * @param S10 saturation at 1.0 pu
+ * @param S12 saturation at 1.2 pu
+ * @param B curve scale
+ * @param E curve exponent
+ */
+inline void exponentialSatCoeffs(double S10, double S12, double &B, double &E)
+{
+  B = S10;
+  E = log(S12 / S10) / log(1.2);
+}
+
+/**
+ * Evaluate exponential saturation curve
+ * @param B curve scale from exponentialSatCoeffs
+ * @param E curve exponent from exponentialSatCoeffs
+ * @param x flux or voltage
+ * @return saturation
+ */
+inline double exponentialSat(double B, double E, double x)
+{
+  return B * pow(x, E);
+}
+
+/**
+ * Sine and cosine of n angles
+ * @param n number of machines
+ * @param x angles
+ * @param s sin(x)
+ * @param c cos(x)
+ */
+inline void sincos(int n, const double *x, double *s, double *c)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    s[k] = sin(x[k]);
+    c[k] = cos(x[k]);
+  }
+}
+
+/**
+ * Rotate n quantities from the network frame to the machine frame
+ * @param n number of machines
+ * @param s sines of rotor angles
+ * @param c cosines of rotor angles
+ * @param r real components
+ * @param i imaginary components
+ * @param d d axis components
+ * @param q q axis components
+ */
+inline void riToDQ(int n, const double *s, const double *c,
+    const double *r, const double *i, double *d, double *q)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    d[k] = r[k] * s[k] - i[k] * c[k];
+    q[k] = r[k] * c[k] + i[k] * s[k];
+  }
+}
+
+/**
+ * Rotate n quantities from the machine frame to the network frame
+ * @param n number of machines
+ * @param s sines of rotor angles
+ * @param c cosines of rotor angles
+ * @param d d axis components
+ * @param q q axis components
+ * @param r real components
+ * @param i imaginary components
+ */
+inline void dqToRI(int n, const double *s, const double *c,
+    const double *d, const double *q, double *r, double *i)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    r[k] = + d[k] * s[k] + q[k] * c[k];
+    i[k] = - d[k] * c[k] + q[k] * s[k];
+  }
+}
+
+/**
+ * Convert n magnitudes and angles to real and imaginary components
+ * @param n number of machines
+ * @param mag magnitudes
+ * @param ang angles
+ * @param r real components
+ * @param i imaginary components
+ */
+inline void polarToRI(int n, const double *mag, const double *ang,
+    double *r, double *i)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    r[k] = mag[k] * cos(ang[k]);
+    i[k] = mag[k] * sin(ang[k]);
+  }
+}
+
+/**
+ * Evaluate scaled quadratic saturation curves of n machines
+ * @param n number of machines
+ * @param A curve offsets
+ * @param B curve scales
+ * @param x fluxes or voltages
+ * @param sat saturations
+ */
+inline void quadraticSat(int n, const double *A, const double *B,
+    const double *x, double *sat)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    sat[k] = B[k] * (x[k] - A[k]) * (x[k] - A[k]) / x[k];
+  }
+}
+
+/**
+ * Evaluate exponential saturation curves of n machines
+ * @param n number of machines
+ * @param B curve scales
+ * @param E curve exponents
+ * @param x fluxes or voltages
+ * @param sat saturations
+ */
+inline void exponentialSat(int n, const double *B, const double *E,
+    const double *x, double *sat)
+{
+  GRIDPACK_MACHINE_SIMD
+  for (int k = 0; k < n; k++) {
+    sat[k] = B[k] * pow(x[k], E[k]);
+  }
+}
+
+}  // kernels
+}  // dynamic_simulation
+}  // gridpack
+#endif
@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <stdio.h>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -811,6 +813,47 @@ void gridpack::dynamic_simulation::MotorwLoad::corrector(
     
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::MotorwLoad::getStepError(double t_inc)
+{
+  double err = fabs(depq_dt - depq_dt0);
+  err = std::max(err, fabs(depd_dt - depd_dt0));
+  err = std::max(err, fabs(deppq_dt - deppq_dt0));
+  err = std::max(err, fabs(deppd_dt - deppd_dt0));
+  err = std::max(err, fabs(dslip_dt - dslip_dt0));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::MotorwLoad::saveState()
+{
+  p_savedState[0] = epq;
+  p_savedState[1] = epd;
+  p_savedState[2] = eppq;
+  p_savedState[3] = eppd;
+  p_savedState[4] = slip;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::MotorwLoad::restoreState()
+{
+  epq = p_savedState[0];
+  epd = p_savedState[1];
+  eppq = p_savedState[2];
+  eppd = p_savedState[3];
+  slip = p_savedState[4];
+}
+
 /**
  * Set voltage on each load
  */
@@ -89,6 +89,23 @@ class MotorwLoad : public BaseLoadModel
      * @param flag initial step if true
      */
     void corrector(double t_inc, bool flag);
+
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
 	
 	/**
 	* Set voltage on each load
@@ -166,6 +183,9 @@ class MotorwLoad : public BaseLoadModel
           & p_bus_id;
       }
 
+    // state at the start of the current time step, see saveState
+    double p_savedState[5];
+
 };
 }  // dynamic_simulation
 }  // gridpack
@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <stdio.h>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -213,6 +215,43 @@ void gridpack::dynamic_simulation::PsssimModel::corrector(double t_inc, bool fla
   //printf("psssim pssout_vstab: %f\n", pssout_vstab);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::PsssimModel::getStepError(double t_inc)
+{
+  double err = fabs(dx1pss_1 - dx1pss);
+  err = std::max(err, fabs(dx2pss_1 - dx2pss));
+  err = std::max(err, fabs(dx3pss_1 - dx3pss));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::PsssimModel::saveState()
+{
+  p_savedState[0] = x1pss_1;
+  p_savedState[1] = x2pss_1;
+  p_savedState[2] = x3pss_1;
+  p_savedState[3] = pssout_vstab;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::PsssimModel::restoreState()
+{
+  x1pss_1 = p_savedState[0];
+  x2pss_1 = p_savedState[1];
+  x3pss_1 = p_savedState[2];
+  pssout_vstab = p_savedState[3];
+}
+
 double gridpack::dynamic_simulation::PsssimModel::getVstab( )
 {
 	if (inputtype == -1){
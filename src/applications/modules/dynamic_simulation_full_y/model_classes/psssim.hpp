@@ -66,6 +66,23 @@ class PsssimModel : public BasePssModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     double getVstab();
 	 
     void setOmega(double omega);
@@ -99,6 +116,9 @@ class PsssimModel : public BasePssModel
     // Keep around 
     double psscon1, psscon2;
 
+    // state at the start of the current time step, see saveState
+    double p_savedState[4];
+
 };
 }  // dynamic_simulation
 }  // gridpack
@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include <stdio.h>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
@@ -337,6 +339,60 @@ void gridpack::dynamic_simulation::WshygpModel::corrector(double t_inc, bool fla
  // printf("wshygp Pmech = %f\n", Pmech);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state. The
+ * corrector overwrites the predictor derivatives of the valve and gate
+ * states instead of computing dx6Valve_1 and dx7Gate_1, so those two
+ * states are left out
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::WshygpModel::getStepError(double t_inc)
+{
+  double err = fabs(dx1Pmech_1 - dx1Pmech);
+  err = std::max(err, fabs(dx2Td_1 - dx2Td));
+  err = std::max(err, fabs(dx3Int_1 - dx3Int));
+  err = std::max(err, fabs(dx4Der_1 - dx4Der));
+  err = std::max(err, fabs(dx5Pelec_1 - dx5Pelec));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::WshygpModel::saveState()
+{
+  p_savedState[0] = x1Pmech_1;
+  p_savedState[1] = x2Td_1;
+  p_savedState[2] = x3Int_1;
+  p_savedState[3] = x4Der_1;
+  p_savedState[4] = x5Pelec_1;
+  p_savedState[5] = x6Valve_1;
+  p_savedState[6] = x7Gate_1;
+  p_savedState[7] = Pmech;
+  p_savedBackLash = BackLash;
+  p_savedDBInt = DBInt;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::WshygpModel::restoreState()
+{
+  x1Pmech_1 = p_savedState[0];
+  x2Td_1 = p_savedState[1];
+  x3Int_1 = p_savedState[2];
+  x4Der_1 = p_savedState[3];
+  x5Pelec_1 = p_savedState[4];
+  x6Valve_1 = p_savedState[5];
+  x7Gate_1 = p_savedState[6];
+  Pmech = p_savedState[7];
+  BackLash = p_savedBackLash;
+  DBInt = p_savedDBInt;
+}
+
 /**
  * Set the mechanical power parameter inside the governor
  * @param pmech value of the mechanical power
@@ -69,6 +69,23 @@ class WshygpModel : public BaseGovernorModel
      */
     void corrector(double t_inc, bool flag);
 
+    /**
+     * Estimate local error of the last corrector step
+     * @param t_inc time step increment
+     * @return error estimate
+     */
+    double getStepError(double t_inc);
+
+    /**
+     * Save the state at the start of a time step
+     */
+    void saveState();
+
+    /**
+     * Return to the state saved by saveState
+     */
+    void restoreState();
+
     /**
      * Set the mechanical power parameter inside the governor
      * @param pmech value of the mechanical power
@@ -123,6 +140,11 @@ class WshygpModel : public BaseGovernorModel
     double w;
     double GenMVABase, GenPelec;
 
+    // state at the start of the current time step, see saveState
+    double p_savedState[8];
+    BackLashClass p_savedBackLash;
+    DBIntClass p_savedDBInt;
+
 };
 }  // dynamic_simulation
 }  // gridpack
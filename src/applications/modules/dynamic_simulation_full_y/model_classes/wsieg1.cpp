@@ -16,6 +16,8 @@
 
 #include <vector>
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/parser/dictionary.hpp"
@@ -303,6 +305,58 @@ void gridpack::dynamic_simulation::Wsieg1Model::corrector(double t_inc, bool fla
   ///printf("wsieg1 Pmech1 = %f, Pmech2 = %f\n", Pmech1, Pmech2);
 }
 
+/**
+ * Estimate local error of the last corrector step. The difference
+ * between the modified Euler corrector and the Euler predictor is half
+ * the change in the derivative times the time step for each state
+ * @param t_inc time step increment
+ * @return error estimate
+ */
+double gridpack::dynamic_simulation::Wsieg1Model::getStepError(double t_inc)
+{
+  double err = fabs(dx1LL_1 - dx1LL);
+  err = std::max(err, fabs(dx2GovOut_1 - dx2GovOut));
+  err = std::max(err, fabs(dx3Turb1_1 - dx3Turb1));
+  err = std::max(err, fabs(dx4Turb2_1 - dx4Turb2));
+  err = std::max(err, fabs(dx5Turb3_1 - dx5Turb3));
+  err = std::max(err, fabs(dx6Turb4_1 - dx6Turb4));
+  return 0.5 * err * t_inc;
+}
+
+/**
+ * Save the state at the start of a time step
+ */
+void gridpack::dynamic_simulation::Wsieg1Model::saveState()
+{
+  p_savedState[0] = x1LL_1;
+  p_savedState[1] = x2GovOut_1;
+  p_savedState[2] = x3Turb1_1;
+  p_savedState[3] = x4Turb2_1;
+  p_savedState[4] = x5Turb3_1;
+  p_savedState[5] = x6Turb4_1;
+  p_savedState[6] = Pmech1;
+  p_savedState[7] = Pmech2;
+  p_savedBackLash = BackLash;
+  p_savedDBInt = DBInt;
+}
+
+/**
+ * Return to the state saved by saveState
+ */
+void gridpack::dynamic_simulation::Wsieg1Model::restoreState()
+{
+  x1LL_1 = p_savedState[0];
+  x2GovOut_1 = p_savedState[1];
+  x3Turb1_1 = p_savedState[2];
+  x4Turb2_1 = p_savedState[3];
+  x5Turb3_1 = p_savedState[4];
+  x6Turb4_1 = p_savedState[5];
+  Pmech1 = p_savedState[6];
+  Pmech2 = p_savedState[7];
+  BackLash = p_savedBackLash;
+  DBInt = p_savedDBInt;
+}
+
 /**
  * Set the mechanical power parameter inside the governor
  * @param pmech value of the mechanical power
@@ -15,6 +15,7 @@
  */
 // -------------------------------------------------------------
 
+#include <algorithm>
 #include "pf_app_module.hpp"
 #include "pf_factory_module.hpp"
 #include "gridpack/mapper/full_map.hpp"
@@ -25,17 +26,19 @@
 #include "gridpack/export/PSSE33Export.hpp"
 #include "gridpack/export/PSSE23Export.hpp"
 #include "gridpack/parser/GOSS_parser.hpp"
+#include "gridpack/parser/network_snapshot.hpp"
 #include "gridpack/math/math.hpp"
+#include "gridpack/parallel/component_threads.hpp"
 #include "pf_helper.hpp"
 
-#define USE_REAL_VALUES
-
 /**
  * Basic constructor
  */
 gridpack::powerflow::PFAppModule::PFAppModule(void)
 {
   p_no_print = false;
+  p_maxRank = 0;
+  p_savedVoltages = false;
 }
 
 /**
@@ -95,14 +98,46 @@ void gridpack::powerflow::PFAppModule::readNetwork(
   p_tolerance = cursor->get("tolerance",1.0e-6);
   p_qlim = cursor->get("qlim",0);
   p_max_iteration = cursor->get("maxIteration",50);
+  // Threads used for loops over buses and branches on each process
+  gridpack::parallel::ComponentThreads::setNumThreads(
+      cursor->get("threadsPerProcess",1));
+  gridpack::parallel::ComponentThreads::setChunkSize(
+      cursor->get("threadChunkSize",16));
   ComplexType tol;
   // Phase shift sign
   double phaseShiftSign = cursor->get("phaseShiftSign",1.0);
+  // Method used to update ghost buses (GA or P2P)
+  std::string ghostExchange = cursor->get("ghostExchange","GA");
+  if (ghostExchange == "P2P") {
+    network->setGhostExchange(gridpack::network::P2PExchange);
+  }
+
+  // Binary snapshot of the network. If the snapshot exists and is up to
+  // date with the network configuration file it is loaded instead of the
+  // file, otherwise it is written after the network has been partitioned
+  std::string snapshot = cursor->get("networkSnapshot","");
+  int useSnapshot = 0;
+  if (snapshot.size() > 0) {
+    useSnapshot = gridpack::parser::NetworkSnapshot<PFNetwork>::isCurrent(
+        snapshot,filename,p_comm.size());
+    p_comm.min(&useSnapshot,1);
+  }
+
+  // Send data read on process 0 to all processors before the network is
+  // created. The buffer size (in MB) limits the memory used on process 0
+  bool distributeData = cursor->get("distributeData",false);
+  size_t distributionBuffer =
+    static_cast<size_t>(cursor->get("distributionBuffer",64))*1024*1024;
 
   int t_pti = timer->createCategory("Powerflow: Network Parser");
   timer->start(t_pti);
-  if (filetype == PTI23) {
+  if (useSnapshot) {
+    // Phase shift sign has already been applied to the stored data
+    gridpack::parser::NetworkSnapshot<PFNetwork> parser(network);
+    parser.parse(snapshot);
+  } else if (filetype == PTI23) {
     gridpack::parser::PTI23_parser<PFNetwork> parser(network);
+    parser.setDistributeData(distributeData,distributionBuffer);
 #ifdef USE_GOSS
     char sbuf[256], sbuf2[256];
     sprintf(sbuf,"{ \"simulation_id\": \"%s\"}",simID.c_str());
@@ -118,6 +153,11 @@ void gridpack::powerflow::PFAppModule::readNetwork(
     }
   } else if (filetype == PTI33) {
     gridpack::parser::PTI33_parser<PFNetwork> parser(network);
+    // Read the network file on all processors
+    bool parallelParse = false;
+    cursor->get("parallelParse",&parallelParse);
+    parser.setParallelParse(parallelParse);
+    parser.setDistributeData(distributeData,distributionBuffer);
 #ifdef USE_GOSS
     char sbuf[256], sbuf2[256];
     sprintf(sbuf,"{ \"simulation_id\": \"%s\"}",simID.c_str());
@@ -133,6 +173,7 @@ void gridpack::powerflow::PFAppModule::readNetwork(
     }
   } else if (filetype == MAT_POWER) {
     gridpack::parser::MAT_parser<PFNetwork> parser(network);
+    parser.setDistributeData(distributeData,distributionBuffer);
 #ifdef USE_GOSS
     char sbuf[256], sbuf2[256];
     sprintf(sbuf,"{ \"simulation_id\": \"%s\"}",simID.c_str());
@@ -168,6 +209,10 @@ void gridpack::powerflow::PFAppModule::readNetwork(
   timer->start(t_part);
   network->partition();
   timer->stop(t_part);
+  if (snapshot.size() > 0 && !useSnapshot) {
+    gridpack::parser::NetworkSnapshot<PFNetwork> writer(network);
+    writer.write(snapshot,true,filename);
+  }
   timer->stop(t_total);
 }
 
@@ -462,6 +507,178 @@ bool gridpack::powerflow::PFAppModule::solve()
   return ret;
 
 }
+/**
+ * Factor the Jacobian of the current network state so that
+ * solveLowRank() can reuse it
+ * @param maxRank largest number of changed Jacobian rows that
+ * solveLowRank() will handle without a full factorization
+ */
+void gridpack::powerflow::PFAppModule::initLowRankSolver(int maxRank)
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_lrank = timer->createCategory("Powerflow: Low Rank Update");
+  timer->start(t_lrank);
+  p_lowRank.reset();
+  p_J0solver.reset();
+  p_J0.reset();
+  p_maxRank = maxRank;
+
+  p_factory->setYBus();
+  p_factory->setMode(S_Cal);
+  p_factory->setSBus();
+  p_factory->setMode(Jacobian);
+  gridpack::mapper::FullMatrixMap<PFNetwork> jMap(p_network);
+#ifdef USE_REAL_VALUES
+  p_J0 = jMap.mapToRealMatrix();
+  p_J0solver.reset(new gridpack::math::RealLinearSolver(*p_J0));
+#else
+  p_J0 = jMap.mapToMatrix();
+  p_J0solver.reset(new gridpack::math::LinearSolver(*p_J0));
+#endif
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = p_config->getCursor("Configuration.Powerflow");
+  p_J0solver->configure(cursor);
+
+  // do one solve so the factorization exists before the first contingency
+  p_factory->setMode(RHS);
+  gridpack::mapper::BusVectorMap<PFNetwork> vMap(p_network);
+#ifdef USE_REAL_VALUES
+  boost::shared_ptr<gridpack::math::RealVector> PQ = vMap.mapToRealVector();
+  boost::shared_ptr<gridpack::math::RealVector> X(PQ->clone());
+  X->zero();
+  p_J0solver->solve(*PQ, *X);
+  p_lowRank.reset(new gridpack::math::RealLowRankUpdateSolver(*p_J0solver));
+#else
+  boost::shared_ptr<gridpack::math::Vector> PQ = vMap.mapToVector();
+  boost::shared_ptr<gridpack::math::Vector> X(PQ->clone());
+  X->zero();
+  p_J0solver->solve(*PQ, *X);
+  p_lowRank.reset(new gridpack::math::LowRankUpdateSolver(*p_J0solver));
+#endif
+  timer->stop(t_lrank);
+}
+
+/**
+ * Execute the iterative solve portion of the application for a
+ * contingency using the Jacobian factored by initLowRankSolver()
+ * @return false if an error was caught in the solution algorithm
+ */
+bool gridpack::powerflow::PFAppModule::solveLowRank()
+{
+  if (!p_lowRank || p_qlim != 0) return solve();
+
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_total = timer->createCategory("Powerflow: Total Application");
+  int t_lrank = timer->createCategory("Powerflow: Low Rank Update");
+  timer->start(t_total);
+  timer->start(t_lrank);
+  p_factory->clearViolations();
+
+  // Only components changed by setContingency and unSetContingency since
+  // the last Y-bus evaluation need to be updated
+  p_factory->updateYBus();
+  p_factory->setMode(S_Cal);
+  p_factory->setSBus();
+  p_factory->setMode(RHS);
+  gridpack::mapper::BusVectorMap<PFNetwork> vMap(p_network);
+  p_factory->setMode(Jacobian);
+  gridpack::mapper::FullMatrixMap<PFNetwork> jMap(p_network);
+#ifdef USE_REAL_VALUES
+  boost::shared_ptr<gridpack::math::RealMatrix> dJ = jMap.mapToRealMatrix();
+#else
+  boost::shared_ptr<gridpack::math::Matrix> dJ = jMap.mapToMatrix();
+#endif
+
+  // The change in the Jacobian is only usable if the contingency did not
+  // change its layout
+  bool ok = (dJ->rows() == p_J0->rows() && dJ->cols() == p_J0->cols() &&
+      dJ->localRows() == p_J0->localRows() &&
+      dJ->localCols() == p_J0->localCols());
+  ok = p_network->communicator().all(ok);
+  if (ok) {
+    dJ->scale(-1.0);
+    dJ->add(*p_J0);
+    dJ->scale(-1.0);
+    // A contingency that islands part of the network makes the updated
+    // Jacobian singular. Leave it to the full solve to deal with
+    try {
+      ok = p_lowRank->update(*dJ, p_maxRank);
+    } catch (const gridpack::Exception &e) {
+      ok = false;
+    }
+  }
+  timer->stop(t_lrank);
+  if (!ok) {
+    if (!p_no_print) {
+      printf("Low rank update not possible, using full Jacobian\n");
+    }
+    timer->stop(t_total);
+    return solve();
+  }
+
+  // Newton iterations with the Jacobian fixed at the starting voltages
+  p_factory->setMode(RHS);
+#ifdef USE_REAL_VALUES
+  boost::shared_ptr<gridpack::math::RealVector> PQ = vMap.mapToRealVector();
+  boost::shared_ptr<gridpack::math::RealVector> X(PQ->clone());
+#else
+  boost::shared_ptr<gridpack::math::Vector> PQ = vMap.mapToVector();
+  boost::shared_ptr<gridpack::math::Vector> X(PQ->clone());
+#endif
+  int t_lsolv = timer->createCategory("Powerflow: Solve Linear Equation");
+  double tol = PQ->normInfinity();
+  int iter = 0;
+  int max_iter = 2*p_max_iteration;
+  char ioBuf[128];
+  while (tol > p_tolerance && iter < max_iter) {
+    timer->start(t_lsolv);
+    X->zero();
+    try {
+      p_lowRank->solve(*PQ, *X);
+    } catch (const gridpack::Exception e) {
+      std::string w(e.what());
+      if (!p_no_print) {
+        printf("p[%d] hit exception: %s\n",
+            p_network->communicator().rank(),
+            w.c_str());
+      }
+      timer->stop(t_lsolv);
+      break;
+    }
+    timer->stop(t_lsolv);
+    vMap.mapToBus(X);
+    p_network->updateBuses();
+#ifdef USE_REAL_VALUES
+    vMap.mapToRealVector(PQ);
+#else
+    vMap.mapToVector(PQ);
+#endif
+    tol = PQ->normInfinity();
+    if (!p_no_print) {
+      sprintf(ioBuf,"\nIteration %d Tol: %12.6e\n",iter+1,tol);
+      p_busIO->header(ioBuf);
+    }
+    iter++;
+  }
+  p_lowRank->clear();
+  timer->stop(t_total);
+
+  if (!(tol <= p_tolerance)) {
+    if (!p_no_print) {
+      printf("Low rank update did not converge, using full Jacobian\n");
+    }
+    if (p_savedVoltages) {
+      restoreVoltages();
+    } else {
+      resetVoltages();
+    }
+    return solve();
+  }
+  return true;
+}
+
 /**
  * Execute the iterative solve portion of the application using a library
  * non-linear solver
@@ -711,6 +928,19 @@ void gridpack::powerflow::PFAppModule::saveData()
   p_factory->saveData();
 }
 
+/**
+ * Mark a branch and the buses at either end of it as dirty in the network
+ * @param idx local index of branch
+ */
+void gridpack::powerflow::PFAppModule::markBranchDirty(int idx)
+{
+  int bus1, bus2;
+  p_network->markBranchDirty(idx);
+  p_network->getBranchEndpoints(idx, &bus1, &bus2);
+  p_network->markBusDirty(bus1);
+  p_network->markBusDirty(bus2);
+}
+
 /**
  * Set a contingency
  * @param event data describing location and type of contingency
@@ -736,6 +966,7 @@ bool gridpack::powerflow::PFAppModule::setContingency(
             p_network->getBus(jdx).get());
         event.p_saveGenStatus[i] = bus->getGenStatus(tag);
         bus->setGenStatus(tag, false);
+        p_network->markBusDirty(jdx);
       }
     }
   } else if (event.p_type == Branch) {
@@ -755,6 +986,7 @@ bool gridpack::powerflow::PFAppModule::setContingency(
             p_network->getBranch(jdx).get());
         event.p_saveLineStatus[i] = branch->getBranchStatus(tag);
         branch->setBranchStatus(tag, false);
+        markBranchDirty(jdx);
       }
     }
   } else {
@@ -793,6 +1025,7 @@ bool gridpack::powerflow::PFAppModule::unSetContingency(
         bus = dynamic_cast<gridpack::powerflow::PFBus*>(
             p_network->getBus(jdx).get());
         bus->setGenStatus(tag, event.p_saveGenStatus[i]);
+        p_network->markBusDirty(jdx);
       }
     }
   } else if (event.p_type == Branch) {
@@ -811,14 +1044,148 @@ bool gridpack::powerflow::PFAppModule::unSetContingency(
         branch = dynamic_cast<gridpack::powerflow::PFBranch*>(
             p_network->getBranch(jdx).get());
         branch->setBranchStatus(tag,event.p_saveLineStatus[i]);
+        markBranchDirty(jdx);
+      }
+    }
+  } else {
+    ret = false;
+  }
+  return ret;
+}
+
+/**
+ * Find the local buses and branches changed by a contingency
+ * @param event data describing location and type of contingency
+ * @param delta local components changed by contingency
+ * @return false if location of contingency is not found in network
+ */
+bool gridpack::powerflow::PFAppModule::getContingencyDelta(
+    const gridpack::powerflow::Contingency &event,
+    gridpack::powerflow::ContingencyDelta &delta)
+{
+  bool ret = true;
+  delta.p_name = event.p_name;
+  delta.p_branches.clear();
+  delta.p_ckt.clear();
+  delta.p_saveLineStatus.clear();
+  delta.p_buses.clear();
+  delta.p_genid.clear();
+  delta.p_saveGenStatus.clear();
+  delta.p_loneBuses.clear();
+  delta.p_saveIsolatedStatus.clear();
+  int i, j;
+  if (event.p_type == Generator) {
+    int ngen = event.p_busid.size();
+    for (i=0; i<ngen; i++) {
+      std::vector<int> lids = p_network->getLocalBusIndices(event.p_busid[i]);
+      if (lids.size() == 0) ret = false;
+      for (j=0; j<lids.size(); j++) {
+        delta.p_buses.push_back(lids[j]);
+        delta.p_genid.push_back(event.p_genid[i]);
+      }
+    }
+  } else if (event.p_type == Branch) {
+    int nline = event.p_to.size();
+    for (i=0; i<nline; i++) {
+      std::vector<int> lids = p_network->getLocalBranchIndices(
+          event.p_from[i],event.p_to[i]);
+      if (lids.size() == 0) ret = false;
+      for (j=0; j<lids.size(); j++) {
+        delta.p_branches.push_back(lids[j]);
+        delta.p_ckt.push_back(event.p_ckt[i]);
       }
     }
   } else {
     ret = false;
   }
+  delta.p_saveLineStatus.resize(delta.p_branches.size());
+  delta.p_saveGenStatus.resize(delta.p_buses.size());
   return ret;
 }
 
+/**
+ * Apply a contingency
+ * @param delta local components changed by contingency
+ */
+void gridpack::powerflow::PFAppModule::applyContingency(
+    gridpack::powerflow::ContingencyDelta &delta)
+{
+  int i;
+  for (i=0; i<delta.p_buses.size(); i++) {
+    gridpack::powerflow::PFBus *bus =
+      dynamic_cast<gridpack::powerflow::PFBus*>(
+          p_network->getBus(delta.p_buses[i]).get());
+    delta.p_saveGenStatus[i] = bus->getGenStatus(delta.p_genid[i]);
+    bus->setGenStatus(delta.p_genid[i], false);
+    p_network->markBusDirty(delta.p_buses[i]);
+  }
+  for (i=0; i<delta.p_branches.size(); i++) {
+    gridpack::powerflow::PFBranch *branch =
+      dynamic_cast<gridpack::powerflow::PFBranch*>(
+          p_network->getBranch(delta.p_branches[i]).get());
+    delta.p_saveLineStatus[i] = branch->getBranchStatus(delta.p_ckt[i]);
+    branch->setBranchStatus(delta.p_ckt[i], false);
+    markBranchDirty(delta.p_branches[i]);
+  }
+  // Only buses at the ends of switched lines can have become lone buses
+  delta.p_loneBuses.clear();
+  delta.p_saveIsolatedStatus.clear();
+  int bus1, bus2;
+  for (i=0; i<delta.p_branches.size(); i++) {
+    p_network->getBranchEndpoints(delta.p_branches[i], &bus1, &bus2);
+    int ends[2] = {bus1, bus2};
+    for (int j=0; j<2; j++) {
+      int idx = ends[j];
+      if (!p_network->getActiveBus(idx)) continue;
+      if (std::find(delta.p_loneBuses.begin(), delta.p_loneBuses.end(), idx)
+          != delta.p_loneBuses.end()) continue;
+      if (!p_factory->isLoneBus(idx)) continue;
+      gridpack::powerflow::PFBus *bus =
+        dynamic_cast<gridpack::powerflow::PFBus*>(
+            p_network->getBus(idx).get());
+      printf("\nLone bus %d found\n",bus->getOriginalIndex());
+      delta.p_loneBuses.push_back(idx);
+      delta.p_saveIsolatedStatus.push_back(bus->isIsolated());
+      bus->setIsolated(true);
+    }
+  }
+  p_contingency_name = delta.p_name;
+}
+
+/**
+ * Return system to the state before a contingency was applied
+ * @param delta local components changed by contingency
+ */
+void gridpack::powerflow::PFAppModule::revertContingency(
+    gridpack::powerflow::ContingencyDelta &delta)
+{
+  int i;
+  // Undo changes in reverse order so that components listed more than once
+  // end up in their original state
+  for (i=delta.p_loneBuses.size()-1; i>=0; i--) {
+    gridpack::powerflow::PFBus *bus =
+      dynamic_cast<gridpack::powerflow::PFBus*>(
+          p_network->getBus(delta.p_loneBuses[i]).get());
+    bus->setIsolated(delta.p_saveIsolatedStatus[i]);
+  }
+  for (i=delta.p_branches.size()-1; i>=0; i--) {
+    gridpack::powerflow::PFBranch *branch =
+      dynamic_cast<gridpack::powerflow::PFBranch*>(
+          p_network->getBranch(delta.p_branches[i]).get());
+    branch->setBranchStatus(delta.p_ckt[i], delta.p_saveLineStatus[i]);
+    markBranchDirty(delta.p_branches[i]);
+  }
+  for (i=delta.p_buses.size()-1; i>=0; i--) {
+    gridpack::powerflow::PFBus *bus =
+      dynamic_cast<gridpack::powerflow::PFBus*>(
+          p_network->getBus(delta.p_buses[i]).get());
+    bus->setGenStatus(delta.p_genid[i], delta.p_saveGenStatus[i]);
+    p_network->markBusDirty(delta.p_buses[i]);
+  }
+  delta.p_loneBuses.clear();
+  delta.p_saveIsolatedStatus.clear();
+}
+
 /**
  * Set voltage limits on all buses
  * @param Vmin lower bound on voltages
@@ -919,6 +1286,23 @@ void gridpack::powerflow::PFAppModule::resetVoltages()
   p_factory->resetVoltages();
 }
 
+/**
+ * Save current voltages
+ */
+void gridpack::powerflow::PFAppModule::saveVoltages()
+{
+  p_factory->saveVoltages();
+  p_savedVoltages = true;
+}
+
+/**
+ * Set voltages back to the values saved by saveVoltages()
+ */
+void gridpack::powerflow::PFAppModule::restoreVoltages()
+{
+  p_factory->restoreVoltages();
+}
+
 /**
  * Scale generator real power. If zone less than 1 then scale all
  * generators in the area.
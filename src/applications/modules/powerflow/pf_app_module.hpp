@@ -21,8 +21,13 @@
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/serial_io/serial_io.hpp"
 #include "gridpack/configuration/configuration.hpp"
+#include "gridpack/math/math.hpp"
+#include "gridpack/math/low_rank_update_solver.hpp"
 #include "pf_factory_module.hpp"
 
+// Newton-Raphson iterations use real (split complex) Jacobians
+#define USE_REAL_VALUES
+
 namespace gridpack {
 namespace powerflow {
 
@@ -69,6 +74,27 @@ struct Contingency
   std::vector<bool> p_saveGenStatus;
 };
 
+// Local buses and branches changed by a contingency and their state before
+// the contingency was applied. This is evaluated once for each contingency,
+// after which the contingency can be applied and removed without searching
+// the network or visiting components that it does not change
+struct ContingencyDelta
+{
+  std::string p_name;
+  // Line contingencies: local branch index and circuit of each line
+  std::vector<int> p_branches;
+  std::vector<std::string> p_ckt;
+  std::vector<bool> p_saveLineStatus;
+  // Generator contingencies: local bus index and ID of each generator
+  std::vector<int> p_buses;
+  std::vector<std::string> p_genid;
+  std::vector<bool> p_saveGenStatus;
+  // Buses left with no branches by the contingency and their isolated
+  // status before it
+  std::vector<int> p_loneBuses;
+  std::vector<bool> p_saveIsolatedStatus;
+};
+
 // Calling program for powerflow application
 
 class PFAppModule
@@ -120,6 +146,29 @@ class PFAppModule
      */
     bool nl_solve();
 
+    /**
+     * Factor the Jacobian of the current network state so that
+     * solveLowRank() can reuse it. This should be called with no
+     * contingency set and the voltages that each contingency
+     * calculation will start from (e.g. after resetVoltages() or
+     * restoreVoltages())
+     * @param maxRank largest number of changed Jacobian rows that
+     * solveLowRank() will handle without a full factorization
+     */
+    void initLowRankSolver(int maxRank);
+
+    /**
+     * Execute the iterative solve portion of the application for a
+     * network that differs from the one used in initLowRankSolver()
+     * by a few branches or generators (a contingency). The Jacobian
+     * factored by initLowRankSolver() is corrected for the change with
+     * a low rank update and used for all iterations. If there is no
+     * factored Jacobian, Q limits are enforced, the change is too large
+     * or the iterations do not converge, this falls back to solve()
+     * @return false if an error was caught in the solution algorithm
+     */
+    bool solveLowRank();
+
     /**
      * Write out results of powerflow calculation to standard output
      * Separate calls for writing only data from buses or branches
@@ -166,7 +215,8 @@ class PFAppModule
     void exportPSSE23(std::string &filename);
     
     /**
-     * Set a contingency
+     * Set a contingency. Changed buses and branches are marked dirty in the
+     * network
      * @param event data describing location and type of contingency
      * @return false if location of contingency is not found in network
      */
@@ -179,6 +229,29 @@ class PFAppModule
      */
     bool unSetContingency(Contingency &event);
 
+    /**
+     * Find the local buses and branches changed by a contingency
+     * @param event data describing location and type of contingency
+     * @param delta local components changed by contingency
+     * @return false if location of contingency is not found in network
+     */
+    bool getContingencyDelta(const Contingency &event,
+        ContingencyDelta &delta);
+
+    /**
+     * Apply a contingency. Only the components in the delta are visited
+     * and they are marked dirty in the network
+     * @param delta local components changed by contingency
+     */
+    void applyContingency(ContingencyDelta &delta);
+
+    /**
+     * Return system to the state before a contingency was applied by
+     * applyContingency
+     * @param delta local components changed by contingency
+     */
+    void revertContingency(ContingencyDelta &delta);
+
     /**
      * Set voltage limits on all buses
      * @param Vmin lower bound on voltages
@@ -251,6 +324,21 @@ class PFAppModule
      */
     void resetVoltages();
 
+    /**
+     * Save current voltages, usually the base case solution. After this is
+     * called, solveLowRank() restarts from the saved voltages instead of
+     * the values in the network configuration file if it has to fall back
+     * to solve()
+     */
+    void saveVoltages();
+
+    /**
+     * Set voltages back to the values saved by saveVoltages(). This can be
+     * used to warm start contingency calculations from the base case
+     * solution
+     */
+    void restoreVoltages();
+
     /**
      * Scale generator real power. If zone less than 1 then scale all
      * generators in the area.
@@ -337,6 +425,13 @@ class PFAppModule
 #endif
   private:
 
+    /**
+     * Mark a branch and the buses at either end of it as dirty in the
+     * network, so that updateYBus only re-evaluates changed components
+     * @param idx local index of branch
+     */
+    void markBranchDirty(int idx);
+
     // pointer to network
     boost::shared_ptr<PFNetwork> p_network;
 
@@ -370,6 +465,23 @@ class PFAppModule
     // Flag to suppress all printing to standard out
     bool p_no_print;
 
+    // factored Jacobian for contingencies (see initLowRankSolver)
+#ifdef USE_REAL_VALUES
+    boost::shared_ptr<gridpack::math::RealMatrix> p_J0;
+    boost::shared_ptr<gridpack::math::RealLinearSolver> p_J0solver;
+    boost::shared_ptr<gridpack::math::RealLowRankUpdateSolver> p_lowRank;
+#else
+    boost::shared_ptr<gridpack::math::Matrix> p_J0;
+    boost::shared_ptr<gridpack::math::LinearSolver> p_J0solver;
+    boost::shared_ptr<gridpack::math::LowRankUpdateSolver> p_lowRank;
+#endif
+
+    // largest change in the Jacobian handled by p_lowRank
+    int p_maxRank;
+
+    // voltages have been saved by saveVoltages
+    bool p_savedVoltages;
+
 #ifdef USE_GOSS
     gridpack::goss::GOSSClient p_goss_client;
 
@@ -63,7 +63,27 @@ void gridpack::powerflow::PFFactoryModule::setYBus(void)
   for (i=0; i<numBus; i++) {
     dynamic_cast<PFBus*>(p_network->getBus(i).get())->setYBus();
   }
+  p_network->clearDirtyComponents();
+}
 
+/**
+ * Update the admittance (Y-Bus) matrix for dirty components only
+ */
+void gridpack::powerflow::PFFactoryModule::updateYBus(void)
+{
+  const std::vector<int> &branches = p_network->dirtyBranches();
+  const std::vector<int> &buses = p_network->dirtyBuses();
+  int i;
+
+  // Branches first, since bus values are built from branch values
+  for (i=0; i<branches.size(); i++) {
+    dynamic_cast<PFBranch*>(p_network->getBranch(branches[i]).get())
+      ->setYBus();
+  }
+  for (i=0; i<buses.size(); i++) {
+    dynamic_cast<PFBus*>(p_network->getBus(buses[i]).get())->setYBus();
+  }
+  p_network->clearDirtyComponents();
 }
 
 /**
@@ -139,7 +159,7 @@ void gridpack::powerflow::PFFactoryModule::updateQg(int busID, std::string genID
 bool gridpack::powerflow::PFFactoryModule::checkLoneBus(std::ofstream *stream)
 {
   int numBus = p_network->numBuses();
-  int i, j, k;
+  int i;
   bool bus_ok = true;
   char buf[128];
   p_saveIsolatedStatus.clear();
@@ -148,27 +168,7 @@ bool gridpack::powerflow::PFFactoryModule::checkLoneBus(std::ofstream *stream)
     gridpack::powerflow::PFBus *bus =
       dynamic_cast<gridpack::powerflow::PFBus*>
       (p_network->getBus(i).get());
-    std::vector<boost::shared_ptr<gridpack::component::BaseComponent> > branches;
-    bus->getNeighborBranches(branches);
-    int size = branches.size();
-    bool ok = true;
-    if (size == 0) {
-      ok = false;
-    }
-    if (ok) {
-      ok = false;
-      for (j=0; j<size; j++) {
-        bool branch_ok = false;
-        std::vector<bool> status =
-          dynamic_cast<gridpack::powerflow::PFBranch*>
-          (branches[j].get())->getLineStatus();
-        int nlines = status.size();
-        for (k=0; k<nlines; k++) {
-          if (status[k]) branch_ok = true;
-        }
-        if (branch_ok) ok = true;
-      }
-    }
+    bool ok = !isLoneBus(i);
     if (!ok) {
       sprintf(buf,"\nLone bus %d found\n",bus->getOriginalIndex());
       p_saveIsolatedStatus.push_back(bus->isIsolated());
@@ -189,34 +189,14 @@ void gridpack::powerflow::PFFactoryModule::clearLoneBus()
 {
   if (p_saveIsolatedStatus.size() == 0) return;
   int numBus = p_network->numBuses();
-  int i, j, k;
+  int i;
   int ncount = 0;
   for (i=0; i<numBus; i++) {
     if (!p_network->getActiveBus(i)) continue;
     gridpack::powerflow::PFBus *bus =
       dynamic_cast<gridpack::powerflow::PFBus*>
       (p_network->getBus(i).get());
-    std::vector<boost::shared_ptr<gridpack::component::BaseComponent> > branches;
-    bus->getNeighborBranches(branches);
-    int size = branches.size();
-    bool ok = true;
-    if (size == 0) {
-      ok = false;
-    }
-    if (ok) {
-      ok = false;
-      for (j=0; j<size; j++) {
-        bool branch_ok = false;
-        std::vector<bool> status =
-          dynamic_cast<gridpack::powerflow::PFBranch*>
-          (branches[j].get())->getLineStatus();
-        int nlines = status.size();
-        for (k=0; k<nlines; k++) {
-          if (status[k]) branch_ok = true;
-        }
-        if (branch_ok) ok = true;
-      }
-    }
+    bool ok = !isLoneBus(i);
     if (!ok) {
       printf("\nLone bus %d reset\n",bus->getOriginalIndex());
       bus->setIsolated(p_saveIsolatedStatus[ncount]);
@@ -225,6 +205,32 @@ void gridpack::powerflow::PFFactoryModule::clearLoneBus()
   }
 }
 
+/**
+ * Check if a single bus is a lone bus
+ * @param idx local index of bus
+ * @return true if bus is a lone bus
+ */
+bool gridpack::powerflow::PFFactoryModule::isLoneBus(int idx)
+{
+  int j, k;
+  gridpack::powerflow::PFBus *bus =
+    dynamic_cast<gridpack::powerflow::PFBus*>
+    (p_network->getBus(idx).get());
+  std::vector<boost::shared_ptr<gridpack::component::BaseComponent> > branches;
+  bus->getNeighborBranches(branches);
+  int size = branches.size();
+  for (j=0; j<size; j++) {
+    std::vector<bool> status =
+      dynamic_cast<gridpack::powerflow::PFBranch*>
+      (branches[j].get())->getLineStatus();
+    int nlines = status.size();
+    for (k=0; k<nlines; k++) {
+      if (status[k]) return false;
+    }
+  }
+  return true;
+}
+
 /**
  * Set voltage limits on all buses
  * @param Vmin lower bound on voltages
@@ -699,6 +705,40 @@ void gridpack::powerflow::PFFactoryModule::resetVoltages()
   }
 }
 
+/**
+ * Save current voltages
+ */
+void gridpack::powerflow::PFFactoryModule::saveVoltages()
+{
+  int numBus = p_network->numBuses();
+  int i;
+  for (i=0; i<numBus; i++) {
+    if (p_network->getActiveBus(i)) {
+      gridpack::powerflow::PFBus *bus =
+        dynamic_cast<gridpack::powerflow::PFBus*>
+        (p_network->getBus(i).get());
+      bus->saveVoltage();
+    }
+  }
+}
+
+/**
+ * Set voltages back to the values saved by saveVoltages
+ */
+void gridpack::powerflow::PFFactoryModule::restoreVoltages()
+{
+  int numBus = p_network->numBuses();
+  int i;
+  for (i=0; i<numBus; i++) {
+    if (p_network->getActiveBus(i)) {
+      gridpack::powerflow::PFBus *bus =
+        dynamic_cast<gridpack::powerflow::PFBus*>
+        (p_network->getBus(i).get());
+      bus->restoreVoltage();
+    }
+  }
+}
+
 /**
  * Scale generator real power. If zone less than 1 then scale all
  * generators in the area.
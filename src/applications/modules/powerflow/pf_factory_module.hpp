@@ -54,10 +54,18 @@ class PFFactoryModule
     ~PFFactoryModule();
 
     /**
-     * Create the admittance (Y-Bus) matrix
+     * Create the admittance (Y-Bus) matrix. Dirty marks on the network are
+     * cleared, since all components are up to date afterwards
      */
     void setYBus(void);
 
+    /**
+     * Update the admittance (Y-Bus) matrix contributions of buses and
+     * branches that have been marked dirty in the network, for example by
+     * PFAppModule::setContingency, and clear the dirty marks
+     */
+    void updateYBus(void);
+
     /**
      * Make SBus vector 
      */
@@ -96,6 +104,14 @@ class PFFactoryModule
      */
     void clearLoneBus();
 
+    /**
+     * Check if a single bus is a lone bus (all branches connected to it are
+     * off)
+     * @param idx local index of bus
+     * @return true if bus is a lone bus
+     */
+    bool isLoneBus(int idx);
+
     /**
      * Set voltage limits on all buses
      * @param Vmin lower bound on voltages
@@ -167,6 +183,17 @@ class PFFactoryModule
      */
     void resetVoltages();
 
+    /**
+     * Save current voltages, usually the base case solution, so that
+     * contingency calculations can start from them
+     */
+    void saveVoltages();
+
+    /**
+     * Set voltages back to the values saved by saveVoltages
+     */
+    void restoreVoltages();
+
     /**
      * Scale generator real power. If zone less than 1 then scale all
      * generators in the area
@@ -833,6 +833,9 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
   p_monitorGenerators = cursor->get("monitorGenerators",true);
   p_maximumFrequency = cursor->get("frequencyMaximum",61.8);
 
+  // Share the factored Y-bus among dynamic contingencies
+  p_dsEnsemble = cursor->get("shareDSFactorization",false);
+
   // Use branch rating B parameter
   p_useRateB = cursor->get("useBranchRatingB",false);
   if (p_useRateB && p_world.rank() == 0) {
@@ -1234,7 +1237,13 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   if (ntasks == 0) {
     return chkSolve;
   }
-  taskmgr.set(ntasks);
+  // Run the contingencies that took longest in the previous rating
+  // iteration first
+  if (p_pfTaskCosts.size() == ntasks) {
+    taskmgr.set(ntasks,p_pfTaskCosts);
+  } else {
+    taskmgr.set(ntasks);
+  }
 #ifdef USE_STATBLOCK
   gridpack::utility::StringUtils util;
   std::vector<std::string> v_vals = p_pf_app.writeBranchString("flow_str");
@@ -1473,6 +1482,7 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   // Print statistics from task manager describing the number of tasks performed
   // per processor
   taskmgr.printStats();
+  taskmgr.getTaskTimes(p_pfTaskCosts);
 
   // Gather stats on successful contingency calculations
 #ifdef USE_SUCCESS
@@ -1612,7 +1622,11 @@ bool gridpack::rtpr::RTPRDriver::runDSContingencies()
   // equal to the number of contingencies
   gridpack::parallel::TaskManager taskmgr(p_world);
   int ntasks = p_eventsDS.size();
-  taskmgr.set(ntasks);
+  if (p_dsTaskCosts.size() == ntasks) {
+    taskmgr.set(ntasks,p_dsTaskCosts);
+  } else {
+    taskmgr.set(ntasks);
+  }
 
   // Evaluate contingencies using the task manager
   int task_id;
@@ -1631,6 +1645,7 @@ bool gridpack::rtpr::RTPRDriver::runDSContingencies()
     chkSolve = p_pf_app.solve();
   }
   p_pf_app.saveData();
+  if (p_dsEnsemble) p_ds_app.beginEnsemble();
 #if 0
   sprintf(file,"pf3_diagnostic_%f_%d.dat",p_rating,p_world.rank());
   p_pf_app.writeRTPRDiagnostics(p_srcArea,p_srcZone,p_dstArea,p_dstZone,
@@ -1652,9 +1667,11 @@ bool gridpack::rtpr::RTPRDriver::runDSContingencies()
     // Print out results of power flow calculation
     printf("Executing dynamic simulation task %d on process %d\n",
         task_id,p_world.rank());
-    // reinitialize dynamic simulation from powerflow calculation
+    // reinitialize dynamic simulation from powerflow calculation. In an
+    // ensemble the network only needs to be reloaded if a relay may have
+    // changed it
     transferPFtoDS(p_pf_network,p_ds_network);
-    p_ds_app.reload();
+    if (p_ds_app.reloadRequired()) p_ds_app.reload();
     p_ds_app.setGeneratorWatch(p_watch_busIDs,p_watch_genIDs,false);
     try {
       p_ds_app.solve(p_eventsDS[task_id]);
@@ -1686,6 +1703,8 @@ bool gridpack::rtpr::RTPRDriver::runDSContingencies()
 #endif
   
   }
+  taskmgr.getTaskTimes(p_dsTaskCosts);
+  if (p_dsEnsemble) p_ds_app.endEnsemble();
   int iret = static_cast<int>(ret);
   p_world.sum(&iret,1);
   if (iret == p_world.size()) {
@@ -186,6 +186,11 @@ class RTPRDriver
     std::vector<gridpack::powerflow::Contingency> p_events;
     std::vector<gridpack::dynamic_simulation::Event> p_eventsDS;
 
+    // time spent on each contingency in the previous rating iteration, used
+    // as cost estimates by the task manager
+    std::vector<double> p_pfTaskCosts;
+    std::vector<double> p_dsTaskCosts;
+
     int p_srcArea, p_dstArea, p_srcZone, p_dstZone;
 
     double p_rating;
@@ -211,6 +216,8 @@ class RTPRDriver
 
     bool p_useRateB;
 
+    bool p_dsEnsemble;
+
     std::vector<int> p_watch_busIDs;
     std::vector<std::string> p_watch_genIDs;
 
@@ -70,6 +70,33 @@ bool MatVecInterface::matrixDiagValues(RealType *values)
   return false;
 }
 
+/**
+ * Return the values of the diagonal blocks of several components of the
+ * same type as this one
+ * @param n number of components
+ * @param comps components
+ * @param offsets location in values of the block of each component
+ * @param values array that receives the blocks
+ * @param ok returns 1 for each component that contributes a block and 0
+ *        for each component that does not
+ */
+void MatVecInterface::matrixDiagValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, ComplexType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixDiagValues(values+offsets[i]);
+  }
+}
+void MatVecInterface::matrixDiagValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, RealType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixDiagValues(values+offsets[i]);
+  }
+}
+
 
 /**
  * Return size of off-diagonal matrix block contributed by component. The
@@ -103,6 +130,33 @@ bool MatVecInterface::matrixForwardValues(RealType *values)
   return false;
 }
 
+/**
+ * Return the values of the forward blocks of several components of the
+ * same type as this one
+ * @param n number of components
+ * @param comps components
+ * @param offsets location in values of the block of each component
+ * @param values array that receives the blocks
+ * @param ok returns 1 for each component that contributes a block and 0
+ *        for each component that does not
+ */
+void MatVecInterface::matrixForwardValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, ComplexType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixForwardValues(values+offsets[i]);
+  }
+}
+void MatVecInterface::matrixForwardValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, RealType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixForwardValues(values+offsets[i]);
+  }
+}
+
 /**
  * Return size of off-diagonal matrix block contributed by component. The
  * values are for the reverse direction.
@@ -135,6 +189,33 @@ bool MatVecInterface::matrixReverseValues(RealType *values)
   return false;
 }
 
+/**
+ * Return the values of the reverse blocks of several components of the
+ * same type as this one
+ * @param n number of components
+ * @param comps components
+ * @param offsets location in values of the block of each component
+ * @param values array that receives the blocks
+ * @param ok returns 1 for each component that contributes a block and 0
+ *        for each component that does not
+ */
+void MatVecInterface::matrixReverseValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, ComplexType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixReverseValues(values+offsets[i]);
+  }
+}
+void MatVecInterface::matrixReverseValuesBlock(int n,
+    MatVecInterface *const *comps, const int *offsets, RealType *values,
+    int *ok)
+{
+  for (int i=0; i<n; i++) {
+    ok[i] = comps[i]->matrixReverseValues(values+offsets[i]);
+  }
+}
+
 /**
  * Return size of vector block contributed by component
  * @param isize number of vector elements
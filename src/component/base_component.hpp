@@ -66,6 +66,24 @@ class MatVecInterface {
     virtual bool matrixDiagValues(ComplexType *values);
     virtual bool matrixDiagValues(RealType *values);
 
+    /**
+     * Return the values of the diagonal blocks of several components of the
+     * same type as this one. This is called on one of the components for
+     * all of them, so a component type can override it with a loop that
+     * does not make a virtual call for each component. The default calls
+     * matrixDiagValues on each component.
+     * @param n number of components
+     * @param comps components
+     * @param offsets location in values of the block of each component
+     * @param values array that receives the blocks
+     * @param ok returns 1 for each component that contributes a block and 0
+     *        for each component that does not
+     */
+    virtual void matrixDiagValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    virtual void matrixDiagValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+
     /**
      * Return size of off-diagonal matrix block contributed by component. The
      * values are for the forward direction.
@@ -86,6 +104,24 @@ class MatVecInterface {
     virtual bool matrixForwardValues(ComplexType *values);
     virtual bool matrixForwardValues(RealType *values);
 
+    /**
+     * Return the values of the forward blocks of several components of the
+     * same type as this one. This is called on one of the components for
+     * all of them, so a component type can override it with a loop that
+     * does not make a virtual call for each component. The default calls
+     * matrixForwardValues on each component.
+     * @param n number of components
+     * @param comps components
+     * @param offsets location in values of the block of each component
+     * @param values array that receives the blocks
+     * @param ok returns 1 for each component that contributes a block and 0
+     *        for each component that does not
+     */
+    virtual void matrixForwardValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    virtual void matrixForwardValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+
     /**
      * Return size of off-diagonal matrix block contributed by component. The
      * values are for the reverse direction.
@@ -106,6 +142,24 @@ class MatVecInterface {
     virtual bool matrixReverseValues(ComplexType *values);
     virtual bool matrixReverseValues(RealType *values);
 
+    /**
+     * Return the values of the reverse blocks of several components of the
+     * same type as this one. This is called on one of the components for
+     * all of them, so a component type can override it with a loop that
+     * does not make a virtual call for each component. The default calls
+     * matrixReverseValues on each component.
+     * @param n number of components
+     * @param comps components
+     * @param offsets location in values of the block of each component
+     * @param values array that receives the blocks
+     * @param ok returns 1 for each component that contributes a block and 0
+     *        for each component that does not
+     */
+    virtual void matrixReverseValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, ComplexType *values, int *ok);
+    virtual void matrixReverseValuesBlock(int n, MatVecInterface *const *comps,
+        const int *offsets, RealType *values, int *ok);
+
     /**
      * Return size of vector block contributed by component
      * @param isize number of vector elements
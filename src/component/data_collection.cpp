@@ -6,6 +6,223 @@
 #include "gridpack/component/data_collection.hpp"
 #include <iostream>
 #include <cstdio>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Type codes of values. These are also used in binary copies of data
+// collections
+#define DC_INT     0
+#define DC_LONG    1
+#define DC_BOOL    2
+#define DC_STRING  3
+#define DC_FLOAT   4
+#define DC_DOUBLE  5
+#define DC_COMPLEX 6
+
+// Index of values that were added without an index
+#define DC_NO_INDEX INT_MIN
+
+namespace {
+
+// -------------------------------------------------------------
+//  class KeyTable
+// -------------------------------------------------------------
+// Table of all names used in data collections on this processor. Each name
+// is assigned an integer key the first time it is added to a data
+// collection. The names come from a small fixed set (dictionary.hpp), so the
+// table is never cleared
+class KeyTable {
+public:
+  KeyTable(void) : p_slots(1024,-1)
+  {
+  }
+
+  /**
+   * Find the key of a name
+   * @param name start of name
+   * @param len number of characters in name
+   * @param insert assign a new key if name is not in table
+   * @return key or -1 if name is not in table and insert is false
+   */
+  int find(const char *name, int len, bool insert)
+  {
+    size_t mask = p_slots.size()-1;
+    size_t slot = hash(name,len)&mask;
+    while (p_slots[slot] >= 0) {
+      const std::string &str = p_names[p_slots[slot]];
+      if (static_cast<int>(str.size()) == len &&
+          memcmp(str.data(),name,len) == 0) {
+        return p_slots[slot];
+      }
+      slot = (slot+1)&mask;
+    }
+    if (!insert) return -1;
+    int key = static_cast<int>(p_names.size());
+    p_names.push_back(std::string(name,len));
+    p_slots[slot] = key;
+    if (2*p_names.size() > p_slots.size()) grow();
+    return key;
+  }
+
+  /**
+   * @param key key of name
+   * @return name
+   */
+  const std::string& name(int key) const
+  {
+    return p_names[key];
+  }
+
+private:
+  // FNV-1a hash
+  static size_t hash(const char *name, int len)
+  {
+    unsigned int ret = 2166136261u;
+    int i;
+    for (i=0; i<len; i++) {
+      ret ^= static_cast<unsigned char>(name[i]);
+      ret *= 16777619u;
+    }
+    return static_cast<size_t>(ret);
+  }
+
+  // Double the number of slots and reinsert all names
+  void grow(void)
+  {
+    p_slots.assign(2*p_slots.size(),-1);
+    size_t mask = p_slots.size()-1;
+    int i;
+    for (i=0; i<static_cast<int>(p_names.size()); i++) {
+      size_t slot = hash(p_names[i].data(),p_names[i].size())&mask;
+      while (p_slots[slot] >= 0) slot = (slot+1)&mask;
+      p_slots[slot] = i;
+    }
+  }
+
+  std::vector<std::string> p_names;
+  std::vector<int> p_slots;
+};
+
+KeyTable& keyTable(void)
+{
+  static KeyTable table;
+  return table;
+}
+
+// Find the key of a name. If idx is DC_NO_INDEX and the name ends in ":n",
+// the name is split into its base name and index n, so values added as
+// "name:n" and values added as name with index n are the same
+int findKey(const char *name, int *idx, bool insert)
+{
+  int len = static_cast<int>(strlen(name));
+  if (*idx == DC_NO_INDEX) {
+    const char *colon = strrchr(name,':');
+    if (colon != NULL) {
+      const char *ptr = colon+1;
+      bool neg = (*ptr == '-');
+      if (neg) ptr++;
+      int ndigits = static_cast<int>(strlen(ptr));
+      // Only accept indices in the form written by sprintf("%d"). INT_MIN
+      // is DC_NO_INDEX, so it can not be an index
+      bool ok = (ndigits > 0 && ndigits <= 10 && (*ptr != '0' ||
+            (ndigits == 1 && !neg)));
+      long long val = 0;
+      int i;
+      for (i=0; ok && i<ndigits; i++) {
+        if (ptr[i] < '0' || ptr[i] > '9') {
+          ok = false;
+        } else {
+          val = 10*val + (ptr[i]-'0');
+        }
+      }
+      if (ok && val > static_cast<long long>(INT_MAX)) ok = false;
+      if (ok) {
+        *idx = static_cast<int>(neg ? -val : val);
+        len = static_cast<int>(colon-name);
+      }
+    }
+  }
+  int key;
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+#pragma omp critical(gridpack_data_collection_keys)
+    key = keyTable().find(name,len,insert);
+    return key;
+  }
+#endif
+  key = keyTable().find(name,len,insert);
+  return key;
+}
+
+// Append bytes to buffer
+void packBytes(std::vector<char> &buffer, const void *ptr, size_t len)
+{
+  size_t size = buffer.size();
+  buffer.resize(size+len);
+  if (len > 0) memcpy(&buffer[size],ptr,len);
+}
+
+// Append a string, preceded by its length
+void packString(std::vector<char> &buffer, const std::string &str)
+{
+  int len = static_cast<int>(str.size());
+  packBytes(buffer,&len,sizeof(int));
+  packBytes(buffer,str.data(),str.size());
+}
+
+// Append the full name of a value ("name" or "name:idx"), preceded by its
+// length
+void packKey(std::vector<char> &buffer, int key, int idx)
+{
+  const std::string &name = keyTable().name(key);
+  // Write index backwards from the end of buf
+  char buf[16];
+  int nbuf = 0;
+  if (idx != DC_NO_INDEX) {
+    long val = idx < 0 ? -static_cast<long>(idx) : static_cast<long>(idx);
+    do {
+      nbuf++;
+      buf[16-nbuf] = static_cast<char>('0'+val%10);
+      val /= 10;
+    } while (val > 0);
+    if (idx < 0) buf[16-(++nbuf)] = '-';
+    buf[16-(++nbuf)] = ':';
+  }
+  int len = static_cast<int>(name.size())+nbuf;
+  size_t size = buffer.size();
+  buffer.resize(size+sizeof(int)+len);
+  char *ptr = &buffer[size];
+  memcpy(ptr,&len,sizeof(int));
+  memcpy(ptr+sizeof(int),name.data(),name.size());
+  if (nbuf > 0) memcpy(ptr+sizeof(int)+name.size(),buf+16-nbuf,nbuf);
+}
+
+// Read bytes from a buffer, checking that they are available
+bool unpackBytes(const char *buffer, size_t len, size_t *pos, void *ptr,
+    size_t nbytes)
+{
+  if (*pos+nbytes > len) return false;
+  if (nbytes > 0) memcpy(ptr,buffer+*pos,nbytes);
+  *pos += nbytes;
+  return true;
+}
+
+bool unpackString(const char *buffer, size_t len, size_t *pos,
+    std::string &str)
+{
+  int slen;
+  if (!unpackBytes(buffer,len,pos,&slen,sizeof(int))) return false;
+  if (slen < 0 || *pos+slen > len) return false;
+  str.assign(buffer+*pos,slen);
+  *pos += slen;
+  return true;
+}
+
+}
 
 /**
  * Simple constructor
@@ -28,13 +245,8 @@ gridpack::component::DataCollection & gridpack::component::DataCollection::opera
   (const gridpack::component::DataCollection &rhs)
 {
   if (this == &rhs) return *this;
-  p_ints = rhs.p_ints;
-  p_longs = rhs.p_longs;
-  p_bools = rhs.p_bools;
+  p_values = rhs.p_values;
   p_strings = rhs.p_strings;
-  p_floats = rhs.p_floats;
-  p_doubles = rhs.p_doubles;
-  p_complexType = rhs.p_complexType;
   return *this;
 }
 
@@ -45,45 +257,60 @@ gridpack::component::DataCollection & gridpack::component::DataCollection::opera
  */
 void gridpack::component::DataCollection::addValue(const char *name, const int value)
 {
-  std::string str = name;
-  p_ints.insert(std::pair<std::string, int>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_INT);
+  if (entry != NULL) {
+    entry->v.ival = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const long value)
 {
-  std::string str = name;
-  p_longs.insert(std::pair<std::string, long>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_LONG);
+  if (entry != NULL) {
+    entry->v.lval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const bool value)
 {
-  std::string str = name;
-  p_bools.insert(std::pair<std::string, bool>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_BOOL);
+  if (entry != NULL) {
+    entry->v.bval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const char *value)
 {
-  std::string str = name;
-  std::string val = value;
-  p_strings.insert(std::pair<std::string, std::string>(str,val));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_STRING);
+  if (entry != NULL) {
+    entry->v.sval = static_cast<int>(p_strings.size());
+    p_strings.push_back(std::string(value));
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const float value)
 {
-  std::string str = name;
-  p_floats.insert(std::pair<std::string, float>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_FLOAT);
+  if (entry != NULL) {
+    entry->v.fval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const double value)
 {
-  std::string str = name;
-  p_doubles.insert(std::pair<std::string, double>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_DOUBLE);
+  if (entry != NULL) {
+    entry->v.dval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const gridpack::ComplexType value)
 {
-  std::string str = name;
-  p_complexType.insert(std::pair<std::string, gridpack::ComplexType>(str,value));
+  Entry *entry = addEntry(name,DC_NO_INDEX,DC_COMPLEX);
+  if (entry != NULL) {
+    entry->v.cval[0] = real(value);
+    entry->v.cval[1] = imag(value);
+  }
 }
 
 /**
@@ -97,79 +324,66 @@ void gridpack::component::DataCollection::addValue(const char *name, const gridp
 void gridpack::component::DataCollection::addValue(const char *name, const int value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_ints.insert(std::pair<std::string, int>(str,value));
+  Entry *entry = addEntry(name,idx,DC_INT);
+  if (entry != NULL) {
+    entry->v.ival = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const long value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_longs.insert(std::pair<std::string, long>(str,value));
+  Entry *entry = addEntry(name,idx,DC_LONG);
+  if (entry != NULL) {
+    entry->v.lval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const bool value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_bools.insert(std::pair<std::string, bool>(str,value));
+  Entry *entry = addEntry(name,idx,DC_BOOL);
+  if (entry != NULL) {
+    entry->v.bval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const char *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  std::string val = value;
-  p_strings.insert(std::pair<std::string, std::string>(str,val));
+  Entry *entry = addEntry(name,idx,DC_STRING);
+  if (entry != NULL) {
+    entry->v.sval = static_cast<int>(p_strings.size());
+    p_strings.push_back(std::string(value));
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const float value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_floats.insert(std::pair<std::string, float>(str,value));
+  Entry *entry = addEntry(name,idx,DC_FLOAT);
+  if (entry != NULL) {
+    entry->v.fval = value;
+  }
 }
 
 void gridpack::component::DataCollection::addValue(const char *name, const double value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_doubles.insert(std::pair<std::string, double>(str,value));
+  Entry *entry = addEntry(name,idx,DC_DOUBLE);
+  if (entry != NULL) {
+    entry->v.dval = value;
+  }
 }
 
-void gridpack::component::DataCollection::addValue(const char *name,
-    const gridpack::ComplexType value, const int idx)
+void gridpack::component::DataCollection::addValue(const char *name, const gridpack::ComplexType value,
+    const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  p_complexType.insert(std::pair<std::string, gridpack::ComplexType>(str,value));
+  Entry *entry = addEntry(name,idx,DC_COMPLEX);
+  if (entry != NULL) {
+    entry->v.cval[0] = real(value);
+    entry->v.cval[1] = imag(value);
+  }
 }
 
 /**
@@ -182,122 +396,59 @@ void gridpack::component::DataCollection::addValue(const char *name,
  */
 bool gridpack::component::DataCollection::setValue(const char *name, const int value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, int>::iterator it;
-#else
-  boost::unordered_map<std::string, int>::iterator it;
-#endif
-  it = p_ints.find(str);
-  if (it != p_ints.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_INT);
+  if (entry == NULL) return false;
+  entry->v.ival = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const long value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, long>::iterator it;
-#else
-  boost::unordered_map<std::string, long>::iterator it;
-#endif
-  it = p_longs.find(str);
-  if (it != p_longs.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_LONG);
+  if (entry == NULL) return false;
+  entry->v.lval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const bool value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, bool>::iterator it;
-#else
-  boost::unordered_map<std::string, bool>::iterator it;
-#endif
-  it = p_bools.find(str);
-  if (it != p_bools.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_BOOL);
+  if (entry == NULL) return false;
+  entry->v.bval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const char *value)
 {
-  std::string str = name;
-  std::string val = value;
-#ifdef OLD_MAP
-  std::map<std::string, std::string>::iterator it;
-#else
-  boost::unordered_map<std::string, std::string>::iterator it;
-#endif
-  it = p_strings.find(str);
-  if (it != p_strings.end()) {
-    it->second = val;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_STRING);
+  if (entry == NULL) return false;
+  p_strings[entry->v.sval] = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const float value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, float>::iterator it;
-#else
-  boost::unordered_map<std::string, float>::iterator it;
-#endif
-  it = p_floats.find(str);
-  if (it != p_floats.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_FLOAT);
+  if (entry == NULL) return false;
+  entry->v.fval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const double value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, double>::iterator it;
-#else
-  boost::unordered_map<std::string, double>::iterator it;
-#endif
-  it = p_doubles.find(str);
-  if (it != p_doubles.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_DOUBLE);
+  if (entry == NULL) return false;
+  entry->v.dval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const gridpack::ComplexType value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, gridpack::ComplexType>::iterator it;
-#else
-  boost::unordered_map<std::string, gridpack::ComplexType>::iterator it;
-#endif
-  it = p_complexType.find(str);
-  if (it != p_complexType.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_COMPLEX);
+  if (entry == NULL) return false;
+  entry->v.cval[0] = real(value);
+  entry->v.cval[1] = imag(value);
+  return true;
 }
 
 /**
@@ -313,156 +464,65 @@ bool gridpack::component::DataCollection::setValue(const char *name, const gridp
 bool gridpack::component::DataCollection::setValue(const char *name, const int value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, int>::iterator it;
-#else
-  boost::unordered_map<std::string, int>::iterator it;
-#endif
-  it = p_ints.find(str);
-  if (it != p_ints.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_INT);
+  if (entry == NULL) return false;
+  entry->v.ival = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const long value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, long>::iterator it;
-#else
-  boost::unordered_map<std::string, long>::iterator it;
-#endif
-  it = p_longs.find(str);
-  if (it != p_longs.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_LONG);
+  if (entry == NULL) return false;
+  entry->v.lval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const bool value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, bool>::iterator it;
-#else
-  boost::unordered_map<std::string, bool>::iterator it;
-#endif
-  it = p_bools.find(str);
-  if (it != p_bools.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_BOOL);
+  if (entry == NULL) return false;
+  entry->v.bval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const char *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-  std::string val = value;
-#ifdef OLD_MAP
-  std::map<std::string, std::string>::iterator it;
-#else
-  boost::unordered_map<std::string, std::string>::iterator it;
-#endif
-  it = p_strings.find(str);
-  if (it != p_strings.end()) {
-    it->second = val;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_STRING);
+  if (entry == NULL) return false;
+  p_strings[entry->v.sval] = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const float value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, float>::iterator it;
-#else
-  boost::unordered_map<std::string, float>::iterator it;
-#endif
-  it = p_floats.find(str);
-  if (it != p_floats.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_FLOAT);
+  if (entry == NULL) return false;
+  entry->v.fval = value;
+  return true;
 }
 
 bool gridpack::component::DataCollection::setValue(const char *name, const double value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, double>::iterator it;
-#else
-  boost::unordered_map<std::string, double>::iterator it;
-#endif
-  it = p_doubles.find(str);
-  if (it != p_doubles.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_DOUBLE);
+  if (entry == NULL) return false;
+  entry->v.dval = value;
+  return true;
 }
 
-bool gridpack::component::DataCollection::setValue(const char *name,
-    const gridpack::ComplexType value, const int idx)
+bool gridpack::component::DataCollection::setValue(const char *name, const gridpack::ComplexType value,
+    const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, gridpack::ComplexType>::iterator it;
-#else
-  boost::unordered_map<std::string, gridpack::ComplexType>::iterator it;
-#endif
-  it = p_complexType.find(str);
-  if (it != p_complexType.end()) {
-    it->second = value;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_COMPLEX);
+  if (entry == NULL) return false;
+  entry->v.cval[0] = real(value);
+  entry->v.cval[1] = imag(value);
+  return true;
 }
 
 /**
@@ -475,121 +535,58 @@ bool gridpack::component::DataCollection::setValue(const char *name,
  */
 bool gridpack::component::DataCollection::getValue(const char *name, int *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, int>::iterator it;
-#else
-  boost::unordered_map<std::string, int>::iterator it;
-#endif
-  it = p_ints.find(str);
-  if (it != p_ints.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_INT);
+  if (entry == NULL) return false;
+  *value = entry->v.ival;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, long *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, long>::iterator it;
-#else
-  boost::unordered_map<std::string, long>::iterator it;
-#endif
-  it = p_longs.find(str);
-  if (it != p_longs.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_LONG);
+  if (entry == NULL) return false;
+  *value = static_cast<long>(entry->v.lval);
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, bool *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, bool>::iterator it;
-#else
-  boost::unordered_map<std::string, bool>::iterator it;
-#endif
-  it = p_bools.find(str);
-  if (it != p_bools.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_BOOL);
+  if (entry == NULL) return false;
+  *value = entry->v.bval;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, std::string *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, std::string>::iterator it;
-#else
-  boost::unordered_map<std::string, std::string>::iterator it;
-#endif
-  it = p_strings.find(str);
-  if (it != p_strings.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_STRING);
+  if (entry == NULL) return false;
+  *value = p_strings[entry->v.sval];
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, float *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, float>::iterator it;
-#else
-  boost::unordered_map<std::string, float>::iterator it;
-#endif
-  it = p_floats.find(str);
-  if (it != p_floats.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_FLOAT);
+  if (entry == NULL) return false;
+  *value = entry->v.fval;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, double *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, double>::iterator it;
-#else
-  boost::unordered_map<std::string, double>::iterator it;
-#endif
-  it = p_doubles.find(str);
-  if (it != p_doubles.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_DOUBLE);
+  if (entry == NULL) return false;
+  *value = entry->v.dval;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, gridpack::ComplexType *value)
 {
-  std::string str = name;
-#ifdef OLD_MAP
-  std::map<std::string, gridpack::ComplexType>::iterator it;
-#else
-  boost::unordered_map<std::string, gridpack::ComplexType>::iterator it;
-#endif
-  it = p_complexType.find(str);
-  if (it != p_complexType.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,DC_NO_INDEX,DC_COMPLEX);
+  if (entry == NULL) return false;
+  *value = gridpack::ComplexType(entry->v.cval[0],entry->v.cval[1]);
+  return true;
 }
 
 /**
@@ -605,155 +602,107 @@ bool gridpack::component::DataCollection::getValue(const char *name, gridpack::C
 bool gridpack::component::DataCollection::getValue(const char *name, int *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, int>::iterator it;
-#else
-  boost::unordered_map<std::string, int>::iterator it;
-#endif
-  it = p_ints.find(str);
-  if (it != p_ints.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_INT);
+  if (entry == NULL) return false;
+  *value = entry->v.ival;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, long *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, long>::iterator it;
-#else
-  boost::unordered_map<std::string, long>::iterator it;
-#endif
-  it = p_longs.find(str);
-  if (it != p_longs.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_LONG);
+  if (entry == NULL) return false;
+  *value = static_cast<long>(entry->v.lval);
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, bool *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, bool>::iterator it;
-  it = p_bools.find(str);
-#else
-  boost::unordered_map<std::string, bool>::iterator it;
-#endif
-  if (it != p_bools.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_BOOL);
+  if (entry == NULL) return false;
+  *value = entry->v.bval;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, std::string *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, std::string>::iterator it;
-#else
-  boost::unordered_map<std::string, std::string>::iterator it;
-#endif
-  it = p_strings.find(str);
-  if (it != p_strings.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_STRING);
+  if (entry == NULL) return false;
+  *value = p_strings[entry->v.sval];
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, float *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, float>::iterator it;
-#else
-  boost::unordered_map<std::string, float>::iterator it;
-#endif
-  it = p_floats.find(str);
-  if (it != p_floats.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_FLOAT);
+  if (entry == NULL) return false;
+  *value = entry->v.fval;
+  return true;
 }
 
 bool gridpack::component::DataCollection::getValue(const char *name, double *value,
     const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, double>::iterator it;
-#else
-  boost::unordered_map<std::string, double>::iterator it;
-#endif
-  it = p_doubles.find(str);
-  if (it != p_doubles.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_DOUBLE);
+  if (entry == NULL) return false;
+  *value = entry->v.dval;
+  return true;
 }
 
-bool gridpack::component::DataCollection::getValue(const char *name,
-    gridpack::ComplexType *value, const int idx)
+bool gridpack::component::DataCollection::getValue(const char *name, gridpack::ComplexType *value,
+    const int idx)
 {
-  std::string str = name;
-  str.append(":");
-  char buf[8];
-  sprintf(buf,"%d",idx);
-  str.append(buf);
-#ifdef OLD_MAP
-  std::map<std::string, gridpack::ComplexType>::iterator it;
-#else
-  boost::unordered_map<std::string, gridpack::ComplexType>::iterator it;
-#endif
-  it = p_complexType.find(str);
-  if (it != p_complexType.end()) {
-    *value = it->second;
-    return true;
-  } else {
-    return false;
-  }
+  Entry *entry = findEntry(name,idx,DC_COMPLEX);
+  if (entry == NULL) return false;
+  *value = gridpack::ComplexType(entry->v.cval[0],entry->v.cval[1]);
+  return true;
+}
+/**
+ * Find an existing entry
+ * @param name name of data element
+ * @param idx index of data element
+ * @param type type of data element
+ * @return pointer to entry or NULL if it does not exist
+ */
+gridpack::component::DataCollection::Entry*
+  gridpack::component::DataCollection::findEntry(const char *name, int idx,
+    int type)
+{
+  Entry entry;
+  entry.idx = idx;
+  entry.type = type;
+  entry.key = findKey(name,&entry.idx,false);
+  if (entry.key < 0) return NULL;
+  std::vector<Entry>::iterator it;
+  it = std::lower_bound(p_values.begin(),p_values.end(),entry);
+  if (it == p_values.end() || entry < *it) return NULL;
+  return &(*it);
+}
+
+/**
+ * Add a new entry
+ * @param name name of data element
+ * @param idx index of data element
+ * @param type type of data element
+ * @return pointer to new entry or NULL if entry already exists
+ */
+gridpack::component::DataCollection::Entry*
+  gridpack::component::DataCollection::addEntry(const char *name, int idx,
+    int type)
+{
+  Entry entry;
+  entry.idx = idx;
+  entry.type = type;
+  entry.key = findKey(name,&entry.idx,true);
+  std::vector<Entry>::iterator it;
+  it = std::lower_bound(p_values.begin(),p_values.end(),entry);
+  if (it != p_values.end() && !(entry < *it)) return NULL;
+  it = p_values.insert(it,entry);
+  return &(*it);
 }
 
 /**
@@ -761,96 +710,138 @@ bool gridpack::component::DataCollection::getValue(const char *name,
  */
 void gridpack::component::DataCollection::dump(void)
 {
-  // print out integers
-#ifdef OLD_MAP
-  std::map<std::string, int>::iterator int_it;
-#else
-  boost::unordered_map<std::string, int>::iterator int_it;
-#endif
-  int_it = p_ints.begin();
-  int i = 0;
-  while (int_it != p_ints.end()) {
-    std::string key = int_it->first;
-    int ival = int_it->second;
-    std::cout << "  (INTEGER) key: "<<key<<" value: "<<ival<<std::endl;
-    int_it++;
-  }
-  // print out longs
-#ifdef OLD_MAP
-  std::map<std::string, long>::iterator long_it;
-#else
-  boost::unordered_map<std::string, long>::iterator long_it;
-#endif
-  long_it = p_longs.begin();
-  while (long_it != p_longs.end()) {
-    std::string key = long_it->first;
-    long lval = long_it->second;
-    std::cout << "  (LONG) key: "<<key<<" value: "<<lval<<std::endl;
-    long_it++;
-  }
-  // print out bools
-#ifdef OLD_MAP
-  std::map<std::string, bool>::iterator bool_it;
-#else
-  boost::unordered_map<std::string, bool>::iterator bool_it;
-#endif
-  bool_it = p_bools.begin();
-  while (bool_it != p_bools.end()) {
-    std::string key = bool_it->first;
-    bool bval = bool_it->second;
-    std::cout << "  (BOOL) key: "<<key<<" value: "<<bval<<std::endl;
-    bool_it++;
-  }
-  // print out strings
-#ifdef OLD_MAP
-  std::map<std::string, std::string>::iterator str_it;
-#else
-  boost::unordered_map<std::string, std::string>::iterator str_it;
-#endif
-  str_it = p_strings.begin();
-  while (str_it != p_strings.end()) {
-    std::string key = str_it->first;
-    std::string sval = str_it->second;
-    std::cout << "  (STRING) key: "<<key<<" value: "<<sval<<std::endl;
-    str_it++;
+  const char *labels[] = {"INTEGER", "LONG", "BOOL", "STRING", "FLOAT",
+    "DOUBLE", "COMPLEX"};
+  int type;
+  for (type=DC_INT; type<=DC_COMPLEX; type++) {
+    std::vector<Entry>::iterator it;
+    for (it = p_values.begin(); it != p_values.end(); it++) {
+      if (it->type != type) continue;
+      std::cout << "  (" << labels[type] << ") key: "
+        << keyTable().name(it->key);
+      if (it->idx != DC_NO_INDEX) std::cout << ":" << it->idx;
+      std::cout << " value: ";
+      if (type == DC_INT) {
+        std::cout << it->v.ival;
+      } else if (type == DC_LONG) {
+        std::cout << static_cast<long>(it->v.lval);
+      } else if (type == DC_BOOL) {
+        std::cout << it->v.bval;
+      } else if (type == DC_STRING) {
+        std::cout << p_strings[it->v.sval];
+      } else if (type == DC_FLOAT) {
+        std::cout << it->v.fval;
+      } else if (type == DC_DOUBLE) {
+        std::cout << it->v.dval;
+      } else {
+        std::cout << gridpack::ComplexType(it->v.cval[0],it->v.cval[1]);
+      }
+      std::cout << std::endl;
+    }
   }
-  // print out floats
-#ifdef OLD_MAP
-  std::map<std::string, float>::iterator flt_it;
-#else
-  boost::unordered_map<std::string, float>::iterator flt_it;
-#endif
-  flt_it = p_floats.begin();
-  while (flt_it != p_floats.end()) {
-    std::string key = flt_it->first;
-    float fval = flt_it->second;
-    std::cout << "  (FLOAT) key: "<<key<<" value: "<<fval<<std::endl;
-    flt_it++;
-  }
-  // print out doubles
-#ifdef OLD_MAP
-  std::map<std::string, double>::iterator dbl_it;
-#else
-  boost::unordered_map<std::string, double>::iterator dbl_it;
-#endif
-  dbl_it = p_doubles.begin();
-  while (dbl_it != p_doubles.end()) {
-    std::string key = dbl_it->first;
-    double dval = dbl_it->second;
-    std::cout << "  (DOUBLE) key: "<<key<<" value: "<<dval<<std::endl;
-    dbl_it++;
-  }
-  // print out complex
-#ifdef OLD_MAP
-  std::map<std::string, gridpack::ComplexType>::iterator cmplx_it;
-#else
-  boost::unordered_map<std::string, gridpack::ComplexType>::iterator cmplx_it;
-#endif
-  cmplx_it = p_complexType.begin();
-  while (cmplx_it != p_complexType.end()) {
-    std::string key = cmplx_it->first;
-    ComplexType cval = cmplx_it->second;
-    std::cout << "  (COMPLEX) key: "<<key<<" value: "<<cval<<std::endl;
-    cmplx_it++;
+}
+
+/**
+ * Append a binary copy of all values in the data collection to a buffer
+ * @param buffer buffer that binary copy is appended to
+ */
+void gridpack::component::DataCollection::pack(std::vector<char> &buffer) const
+{
+  int nvals = static_cast<int>(p_values.size());
+  packBytes(buffer,&nvals,sizeof(int));
+  std::vector<Entry>::const_iterator it;
+  for (it = p_values.begin(); it != p_values.end(); it++) {
+    char type = static_cast<char>(it->type);
+    packBytes(buffer,&type,1);
+    packKey(buffer,it->key,it->idx);
+    if (type == DC_INT) {
+      packBytes(buffer,&it->v.ival,sizeof(int));
+    } else if (type == DC_LONG) {
+      packBytes(buffer,&it->v.lval,sizeof(long long));
+    } else if (type == DC_BOOL) {
+      char cval = it->v.bval ? 1 : 0;
+      packBytes(buffer,&cval,1);
+    } else if (type == DC_STRING) {
+      packString(buffer,p_strings[it->v.sval]);
+    } else if (type == DC_FLOAT) {
+      packBytes(buffer,&it->v.fval,sizeof(float));
+    } else if (type == DC_DOUBLE) {
+      packBytes(buffer,&it->v.dval,sizeof(double));
+    } else {
+      packBytes(buffer,it->v.cval,2*sizeof(double));
+    }
   }
 }
+
+/**
+ * Add values from a binary copy created by pack
+ * @param buffer start of binary copy
+ * @param len number of bytes available in buffer
+ * @return number of bytes read from buffer or 0 if buffer does not
+ * contain a complete binary copy
+ */
+size_t gridpack::component::DataCollection::unpack(const char *buffer,
+    size_t len)
+{
+  size_t pos = 0;
+  int nvals;
+  if (!unpackBytes(buffer,len,&pos,&nvals,sizeof(int)) || nvals < 0) return 0;
+  // Keys are assigned in a different order on each processor, so the new
+  // entries are appended and the table is sorted afterwards
+  size_t nold = p_values.size();
+  size_t nstr = p_strings.size();
+  p_values.reserve(nold+nvals);
+  std::string key;
+  int i;
+  bool ok = true;
+  for (i=0; ok && i<nvals; i++) {
+    char type;
+    ok = unpackBytes(buffer,len,&pos,&type,1) &&
+      unpackString(buffer,len,&pos,key);
+    if (!ok) break;
+    Entry entry;
+    entry.type = type;
+    entry.idx = DC_NO_INDEX;
+    entry.key = findKey(key.c_str(),&entry.idx,true);
+    if (type == DC_INT) {
+      ok = unpackBytes(buffer,len,&pos,&entry.v.ival,sizeof(int));
+    } else if (type == DC_LONG) {
+      ok = unpackBytes(buffer,len,&pos,&entry.v.lval,sizeof(long long));
+    } else if (type == DC_BOOL) {
+      char cval;
+      ok = unpackBytes(buffer,len,&pos,&cval,1);
+      entry.v.bval = (cval != 0);
+    } else if (type == DC_STRING) {
+      std::string sval;
+      ok = unpackString(buffer,len,&pos,sval);
+      entry.v.sval = static_cast<int>(p_strings.size());
+      p_strings.push_back(sval);
+    } else if (type == DC_FLOAT) {
+      ok = unpackBytes(buffer,len,&pos,&entry.v.fval,sizeof(float));
+    } else if (type == DC_DOUBLE) {
+      ok = unpackBytes(buffer,len,&pos,&entry.v.dval,sizeof(double));
+    } else if (type == DC_COMPLEX) {
+      ok = unpackBytes(buffer,len,&pos,entry.v.cval,2*sizeof(double));
+    } else {
+      ok = false;
+    }
+    p_values.push_back(entry);
+  }
+  if (!ok) {
+    p_values.resize(nold);
+    p_strings.resize(nstr);
+    return 0;
+  }
+  // Existing entries come first after a stable sort, so they are kept if
+  // the binary copy contains the same values
+  std::stable_sort(p_values.begin(),p_values.end());
+  size_t n = 0;
+  size_t j;
+  for (j=0; j<p_values.size(); j++) {
+    if (n > 0 && !(p_values[n-1] < p_values[j])) continue;
+    p_values[n] = p_values[j];
+    n++;
+  }
+  p_values.resize(n);
+  return pos;
+}
@@ -6,15 +6,13 @@
 #ifndef _data_collection_h
 #define _data_collection_h
 
-#define OLD_MAP
-
-#ifndef OLD_MAP
-#include <boost/unordered_map.hpp>
-#endif
 #include <map>
 #include <string>
+#include <vector>
 #include <boost/serialization/map.hpp>
 #include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/split_member.hpp>
 
 #include "gridpack/utilities/complex.hpp"
 
@@ -143,40 +141,94 @@ public:
    * Dump contents of data collection to standard out
    */
   void dump(void);
+
+  /**
+   * Append a binary copy of all values in the data collection to a buffer.
+   * The copy can be read back with unpack on a machine with the same byte
+   * order
+   * @param buffer buffer that binary copy is appended to
+   */
+  void pack(std::vector<char> &buffer) const;
+
+  /**
+   * Add values from a binary copy created by pack. Values that already
+   * exist in the data collection are not overwritten
+   * @param buffer start of binary copy
+   * @param len number of bytes available in buffer
+   * @return number of bytes read from buffer or 0 if buffer does not
+   * contain a complete binary copy
+   */
+  size_t unpack(const char *buffer, size_t len);
 private:
-#ifdef OLD_MAP
-  std::map<std::string, int> p_ints; 
-  std::map<std::string, long> p_longs; 
-  std::map<std::string, bool> p_bools; 
-  std::map<std::string, std::string> p_strings; 
-  std::map<std::string, float> p_floats; 
-  std::map<std::string, double> p_doubles; 
-  std::map<std::string, gridpack::ComplexType> p_complexType; 
-#else
-  boost::unordered_map<std::string, int> p_ints; 
-  boost::unordered_map<std::string, long> p_longs; 
-  boost::unordered_map<std::string, bool> p_bools; 
-  boost::unordered_map<std::string, std::string> p_strings; 
-  boost::unordered_map<std::string, float> p_floats; 
-  boost::unordered_map<std::string, double> p_doubles; 
-  boost::unordered_map<std::string, gridpack::ComplexType> p_complexType; 
-#endif
+  // A single value. Values are identified by the interned key of their name,
+  // an optional index and their type. Strings are stored separately and the
+  // entry holds their position in p_strings
+  struct Entry {
+    int key;
+    int idx;
+    int type;
+    union {
+      int ival;
+      long long lval;
+      bool bval;
+      int sval;
+      float fval;
+      double dval;
+      double cval[2];
+    } v;
+
+    bool operator<(const Entry &entry) const
+    {
+      if (key != entry.key) return key < entry.key;
+      if (idx != entry.idx) return idx < entry.idx;
+      return type < entry.type;
+    }
+  };
+
+  /**
+   * Find an existing entry
+   * @param name name of data element
+   * @param idx index of data element
+   * @param type type of data element
+   * @return pointer to entry or NULL if it does not exist
+   */
+  Entry* findEntry(const char *name, int idx, int type);
+
+  /**
+   * Add a new entry
+   * @param name name of data element
+   * @param idx index of data element
+   * @param type type of data element
+   * @return pointer to new entry or NULL if entry already exists
+   */
+  Entry* addEntry(const char *name, int idx, int type);
+
+  // Entries ordered by key, index and type
+  std::vector<Entry> p_values;
+  std::vector<std::string> p_strings;
 
 private:
   friend class boost::serialization::access;
 
-  /// Serialization method
-  template<class Archive> void serialize(Archive &ar, const unsigned int)
+  /// Serialization methods. The values are sent as a single binary copy
+  template<class Archive> void save(Archive &ar, const unsigned int) const
   {
-    ar & p_ints
-      & p_longs
-      & p_bools
-      & p_strings
-      & p_floats
-      & p_doubles
-      & p_complexType;
+    std::vector<char> buffer;
+    pack(buffer);
+    ar & buffer;
   }
 
+  template<class Archive> void load(Archive &ar, const unsigned int)
+  {
+    std::vector<char> buffer;
+    ar & buffer;
+    p_values.clear();
+    p_strings.clear();
+    if (buffer.size() > 0) unpack(&buffer[0],buffer.size());
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER()
+
 };
 
 
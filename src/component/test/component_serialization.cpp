@@ -277,6 +277,62 @@ BOOST_AUTO_TEST_CASE( DataCollection_bin )
   check_data_collection(key, *dcin, *dcout);
 }
 
+BOOST_AUTO_TEST_CASE( DataCollection_pack )
+{
+  char key[] = "key name";
+  boost::scoped_ptr<gridpack::component::DataCollection> 
+    dcin(make_a_data_collection(key, 14, "A string value")),
+    dcout(new gridpack::component::DataCollection());
+
+  std::vector<char> buf;
+  dcin->pack(buf);
+  BOOST_CHECK_EQUAL(dcout->unpack(&buf[0], buf.size()), buf.size());
+  BOOST_CHECK_EQUAL(dcout->unpack(&buf[0], buf.size()-1), 0);
+
+  check_data_collection(key, *dcin, *dcout);
+}
+
+BOOST_AUTO_TEST_CASE( DataCollection_keys )
+{
+  gridpack::component::DataCollection dc;
+  int ival;
+  double dval;
+
+  // indexed values can be found by either form of their name
+  dc.addValue("GENERATOR_PG", 1.5, 2);
+  dc.addValue("GENERATOR_ID:10", 7);
+  BOOST_CHECK(dc.getValue("GENERATOR_PG:2", &dval));
+  BOOST_CHECK_EQUAL(dval, 1.5);
+  BOOST_CHECK(dc.getValue("GENERATOR_ID", &ival, 10));
+  BOOST_CHECK_EQUAL(ival, 7);
+  BOOST_CHECK(!dc.getValue("GENERATOR_PG", &dval));
+  BOOST_CHECK(!dc.getValue("GENERATOR_PG", &ival, 2));
+
+  // existing values are not overwritten by addValue
+  dc.addValue("GENERATOR_PG:2", 2.5);
+  dc.getValue("GENERATOR_PG", &dval, 2);
+  BOOST_CHECK_EQUAL(dval, 1.5);
+  BOOST_CHECK(dc.setValue("GENERATOR_PG", 2.5, 2));
+  dc.getValue("GENERATOR_PG", &dval, 2);
+  BOOST_CHECK_EQUAL(dval, 2.5);
+  BOOST_CHECK(!dc.setValue("GENERATOR_QG", 2.5, 2));
+
+  // indices with 10 digits survive packing, larger ones stay in the name
+  dc.addValue("LOAD_ID", 3, 2000000000);
+  dc.addValue("LOAD_ID", 4, -2147483647);
+  dc.addValue("LOAD_PL:2147483648", 5.5);
+  std::vector<char> buf;
+  dc.pack(buf);
+  gridpack::component::DataCollection dcout;
+  BOOST_CHECK_EQUAL(dcout.unpack(&buf[0], buf.size()), buf.size());
+  BOOST_CHECK(dcout.getValue("LOAD_ID", &ival, 2000000000));
+  BOOST_CHECK_EQUAL(ival, 3);
+  BOOST_CHECK(dcout.getValue("LOAD_ID", &ival, -2147483647));
+  BOOST_CHECK_EQUAL(ival, 4);
+  BOOST_CHECK(dcout.getValue("LOAD_PL:2147483648", &dval));
+  BOOST_CHECK_EQUAL(dval, 5.5);
+}
+
 BOOST_AUTO_TEST_CASE( DataCollection_mpi )
 {
   gridpack::parallel::Communicator comm;
@@ -23,6 +23,7 @@
 #include "gridpack/timer/coarse_timer.hpp"
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/component/base_component.hpp"
+#include "gridpack/parallel/component_threads.hpp"
 
 // Base factory class that contains functions that are generic to all
 // applications.
@@ -367,13 +368,8 @@ class BaseFactory {
      */
     virtual void setMode(int mode)
     {
-      int i;
-      for (i=0; i<p_numBuses; i++) {
-        p_buses[i]->setMode(mode);
-      }
-      for (i=0; i<p_numBranches; i++) {
-        p_branches[i]->setMode(mode);
-      }
+      setBusMode(mode);
+      setBranchMode(mode);
     }
 
     /**
@@ -383,6 +379,11 @@ class BaseFactory {
     virtual void setBusMode(int mode)
     {
       int i;
+      int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+      int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
       for (i=0; i<p_numBuses; i++) {
         p_buses[i]->setMode(mode);
       }
@@ -395,6 +396,11 @@ class BaseFactory {
     virtual void setBranchMode(int mode)
     {
       int i;
+      int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+      int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads) if(nthreads > 1)
+#endif
       for (i=0; i<p_numBranches; i++) {
         p_branches[i]->setMode(mode);
       }
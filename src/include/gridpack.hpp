@@ -13,6 +13,7 @@
 #include "gridpack/component/optimization_ifc.hpp"
 #include "gridpack/stream/input_stream.hpp"
 #include "gridpack/analysis/stat_block.hpp"
+#include "gridpack/analysis/result_store.hpp"
 #include "gridpack/configuration/configurable.hpp"
 #include "gridpack/configuration/configuration.hpp"
 #include "gridpack/factory/base_factory.hpp"
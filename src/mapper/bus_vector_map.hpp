@@ -21,6 +21,7 @@
 #include <ga.h>
 #include "gridpack/parallel/parallel.hpp"
 #include <gridpack/parallel/distributed.hpp>
+#include <gridpack/parallel/component_threads.hpp>
 #include <gridpack/component/base_component.hpp>
 #include <gridpack/network/base_network.hpp>
 #include <gridpack/math/vector.hpp>
@@ -300,31 +301,17 @@ private:
  */
 void loadBusData(gridpack::math::Vector &vector, bool flag)
 {
-  int i,idx,isize,icnt;
   // Add vector elements
   boost::shared_ptr<gridpack::component::BaseBusComponent> bus;
   int t_bus(0);
   if (p_timer) t_bus = p_timer->createCategory("loadBusData: Add Vector Elements");
   if (p_timer) p_timer->start(t_bus);
-  int j;
   int t_pack, t_add;
   if (p_timer) t_pack = p_timer->createCategory("loadBusData: Fill Buffer");
   if (p_timer) p_timer->start(t_pack);
   ComplexType *vbuf = new ComplexType[p_numValues];
-  ComplexType *vptr = vbuf;
   int *ibuf = new int[p_numValues];
-  icnt = 0;
-  for (i=0; i<p_busContribution; i++) {
-    p_contributingBuses[i]->vectorValues(vptr);
-    isize = p_ISize[i];
-    idx = p_Offsets[i];
-    for (j=0; j<isize; j++) {
-      ibuf[icnt] = idx;
-      idx++;
-      icnt++;
-    }
-    vptr += isize;
-  }
+  fillBusBuffers(vbuf, ibuf);
   if (p_timer) p_timer->stop(t_pack);
   if (p_timer) t_add = p_timer->createCategory("loadBusData: Add Elements");
   if (p_timer) p_timer->start(t_add);
@@ -342,31 +329,17 @@ void loadBusData(gridpack::math::Vector &vector, bool flag)
  */
 void loadRealBusData(gridpack::math::RealVector &vector, bool flag)
 {
-  int i,idx,isize,icnt;
   // Add vector elements
   boost::shared_ptr<gridpack::component::BaseBusComponent> bus;
   int t_bus(0);
   if (p_timer) t_bus = p_timer->createCategory("loadBusData: Add Vector Elements");
   if (p_timer) p_timer->start(t_bus);
-  int j;
   int t_pack, t_add;
   if (p_timer) t_pack = p_timer->createCategory("loadBusData: Fill Buffer");
   if (p_timer) p_timer->start(t_pack);
   RealType *vbuf = new RealType[p_numValues];
-  RealType *vptr = vbuf;
   int *ibuf = new int[p_numValues];
-  icnt = 0;
-  for (i=0; i<p_busContribution; i++) {
-    p_contributingBuses[i]->vectorValues(vptr);
-    isize = p_ISize[i];
-    idx = p_Offsets[i];
-    for (j=0; j<isize; j++) {
-      ibuf[icnt] = idx;
-      idx++;
-      icnt++;
-    }
-    vptr += isize;
-  }
+  fillBusBuffers(vbuf, ibuf);
   if (p_timer) p_timer->stop(t_pack);
   if (p_timer) t_add = p_timer->createCategory("loadBusData: Add Elements");
   if (p_timer) p_timer->start(t_add);
@@ -397,6 +370,49 @@ void loadRealBusData(boost::shared_ptr<gridpack::math::RealVector> &vector, bool
   loadRealBusData(*vector, flag);
 }
 
+/**
+ * Gather values and indices from all contributing buses into buffers. If
+ * component threads are used, each bus writes directly to its own
+ * section of the buffers
+ * @param vbuf buffer for values
+ * @param ibuf buffer for indices
+ */
+template <typename _type>
+void fillBusBuffers(_type *vbuf, int *ibuf)
+{
+  int i,j,idx,isize,icnt;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  if (nthreads > 1 && p_busContribution > 1) {
+    int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+    std::vector<int> start(p_busContribution+1);
+    start[0] = 0;
+    for (i=0; i<p_busContribution; i++) start[i+1] = start[i] + p_ISize[i];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,chunk) num_threads(nthreads)
+#endif
+    for (i=0; i<p_busContribution; i++) {
+      p_contributingBuses[i]->vectorValues(vbuf+start[i]);
+      for (int l=0; l<p_ISize[i]; l++) {
+        ibuf[start[i]+l] = p_Offsets[i]+l;
+      }
+    }
+    return;
+  }
+  _type *vptr = vbuf;
+  icnt = 0;
+  for (i=0; i<p_busContribution; i++) {
+    p_contributingBuses[i]->vectorValues(vptr);
+    isize = p_ISize[i];
+    idx = p_Offsets[i];
+    for (j=0; j<isize; j++) {
+      ibuf[icnt] = idx;
+      idx++;
+      icnt++;
+    }
+    vptr += isize;
+  }
+}
+
 /**
  * Calculate how many buses contribute to vector
  */
@@ -19,10 +19,15 @@
 
 //#define NZ_PER_ROW
 
+#include <list>
+#include <map>
+#include <vector>
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/weak_ptr.hpp>
 #include <ga.h>
 #include "gridpack/parallel/parallel.hpp"
 #include <gridpack/parallel/distributed.hpp>
+#include <gridpack/parallel/component_threads.hpp>
 #include <gridpack/component/base_component.hpp>
 #include <gridpack/network/base_network.hpp>
 #include <gridpack/math/matrix.hpp>
@@ -33,6 +38,80 @@
 namespace gridpack {
 namespace mapper {
 
+// Maximum number of layouts that are cached for each network
+#define FULL_MAP_MAX_PLANS 8
+
+// -------------------------------------------------------------
+// A simple data class that holds the layout of a matrix generated
+// by FullMatrixMap. Plans are created the first time a mapper is
+// constructed for a particular network configuration and can then
+// be reused by subsequent mappers on the same network, as long as
+// the network topology and the matrix block sizes returned by the
+// network components are unchanged.
+// -------------------------------------------------------------
+class FullMatrixMapPlan {
+public:
+
+/**
+ *  Default constructor
+ */
+FullMatrixMapPlan(void)
+  : p_id(-1), p_totalBuses(0), p_minRowIndex(0), p_maxRowIndex(0),
+    p_rowBlockSize(0), p_colBlockSize(0), p_busContribution(0),
+    p_branchContribution(0), p_maxIBlock(0), p_maxJBlock(0), p_maxcol(0),
+    p_arenaReady(false)
+{
+}
+
+/**
+ * Data elements of plan
+ * p_id: ID of plan, consistent across all processors
+ * p_signature: local block sizes and indices that plan was generated from
+ * p_nz_per_row: number of non-zeros in each local row
+ * p_i_busOffsets, p_j_busOffsets: row and column offsets of bus blocks
+ * p_i_branchOffsets, p_j_branchOffsets: row and column offsets of branch
+ *      blocks
+ * p_arenaReady: arena indices below have been evaluated
+ * p_busBlocks: local index of the bus generating each bus block
+ * p_busArena: offset of each bus block in the bus arena, plus total size
+ * p_busRows, p_busCols: row and column index of each element in bus arena
+ * p_branchBlocks: twice the local index of the branch generating each
+ *      branch block, plus one if the block is a reverse block
+ * p_branchArena: offset of each branch block in the branch arena, plus
+ *      total size
+ * p_branchRows, p_branchCols: row and column index of each element in branch
+ *      arena
+ * Remaining parameters are copies of the corresponding FullMatrixMap
+ * parameters
+ */
+  int                                                    p_id;
+  int                                                    p_totalBuses;
+  int                                                    p_minRowIndex;
+  int                                                    p_maxRowIndex;
+  int                                                    p_rowBlockSize;
+  int                                                    p_colBlockSize;
+  int                                                    p_busContribution;
+  int                                                    p_branchContribution;
+  int                                                    p_maxIBlock;
+  int                                                    p_maxJBlock;
+  int                                                    p_maxcol;
+  std::vector<int>                                       p_signature;
+  std::vector<int>                                       p_nz_per_row;
+  std::vector<int>                                       p_i_busOffsets;
+  std::vector<int>                                       p_j_busOffsets;
+  std::vector<int>                                       p_i_branchOffsets;
+  std::vector<int>                                       p_j_branchOffsets;
+  bool                                                   p_arenaReady;
+  std::vector<int>                                       p_busBlocks;
+  std::vector<int>                                       p_busArena;
+  std::vector<int>                                       p_busRows;
+  std::vector<int>                                       p_busCols;
+  std::vector<int>                                       p_branchBlocks;
+  std::vector<int>                                       p_branchArena;
+  std::vector<int>                                       p_branchRows;
+  std::vector<int>                                       p_branchCols;
+};
+
 template <class _network>
 class FullMatrixMap {
   public: 
@@ -57,6 +136,7 @@ FullMatrixMap(boost::shared_ptr<_network> network)
 
   p_timer = NULL;
   //p_timer = gridpack::utility::CoarseTimer::instance();
+  p_arenaReady = false;
 
   p_GAgrp = network->communicator().getGroup();
   p_me = GA_Pgroup_nodeid(p_GAgrp);
@@ -67,33 +147,79 @@ FullMatrixMap(boost::shared_ptr<_network> network)
 
   p_activeBuses         = getActiveBuses();
 
-  setupGlobalArrays(p_activeBuses);  // allocate globalIndex arrays
+  // Check to see if the layout of the matrix has already been evaluated by
+  // another mapper on the same network. If it has, the offsets can be copied
+  // from the cached plan and no global arrays need to be created
+  std::vector<int> signature;
+  if (planCaching()) {
+    getSignature(signature);
+    p_plan = findPlan(signature);
+  }
 
-  setupIndexingArrays();
+  if (!p_plan) {
+    p_plan.reset(new FullMatrixMapPlan);
 
-  setupOffsetArrays();
+    setupGlobalArrays(p_activeBuses);  // allocate globalIndex arrays
 
-  contributions();
-  GA_Pgroup_sync(p_GAgrp);
-  setBusOffsets();
-  setBranchOffsets();
+    setupIndexingArrays();
+
+    setupOffsetArrays();
 
+    contributions();
+    GA_Pgroup_sync(p_GAgrp);
+    setBusOffsets();
+    setBranchOffsets();
+
+    // Offset arrays are no longer needed once the bus and branch offsets have
+    // been gathered
+    GA_Destroy(gaOffsetI);
+    GA_Destroy(gaOffsetJ);
+
+    savePlan(signature);
+  } else {
+    loadPlan();
+  }
 }
 
 ~FullMatrixMap()
 {
-  if (p_i_busOffsets != NULL) delete [] p_i_busOffsets;
-  if (p_j_busOffsets != NULL) delete [] p_j_busOffsets;
-  if (p_i_branchOffsets != NULL) delete [] p_i_branchOffsets;
-  if (p_j_branchOffsets != NULL) delete [] p_j_branchOffsets;
-#ifdef NZ_PER_ROW
-  if (p_nz_per_row != NULL) delete [] p_nz_per_row;
-#endif
-  GA_Destroy(gaOffsetI);
-  GA_Destroy(gaOffsetJ);
+  // Offset arrays are owned by p_plan, which may be shared with other mappers
   GA_Pgroup_sync(p_GAgrp);
 }
 
+/**
+ * Enable or disable reuse of matrix layouts between mappers created on the
+ * same network. If caching is enabled (the default), a mapper created on a
+ * network whose topology version, component modes and matrix block sizes
+ * are unchanged since a previous mapper was created will reuse the offsets
+ * calculated by the previous mapper. This setting must be the same on all
+ * processors.
+ * @param flag true if layouts should be cached
+ */
+static void setPlanCaching(bool flag)
+{
+  planCachingFlag() = flag;
+  if (!flag) planCache().clear();
+}
+
+/**
+ * Return whether or not matrix layouts are being cached
+ * @return true if caching is enabled
+ */
+static bool planCaching(void)
+{
+  return planCachingFlag();
+}
+
+/**
+ * Check whether the layout for this mapper was taken from the cache
+ * @return true if the matrix layout was copied from a previous mapper
+ */
+bool reusedPlan(void) const
+{
+  return p_reusedPlan;
+}
+
 /**
  * Generate matrix from current component state on network
  * @param isDense set to true if creating a dense matrix
@@ -344,6 +470,133 @@ void incrementMatrix(boost::shared_ptr<gridpack::math::Matrix> &matrix)
   incrementMatrix(*matrix);
 }
 
+/**
+ * Overwrite elements of existing matrix by writing values directly into the
+ * local storage of the matrix. The storage locations of the matrix elements
+ * are evaluated the first time this function is called for a matrix and are
+ * reused on subsequent calls, so no index lookups or matrix assembly are
+ * required. The locations are evaluated again if the matrix has been
+ * replaced or its size or number of stored values has changed. If the matrix implementation does not support direct access to
+ * its storage or any elements are not local, this falls back to
+ * overwriteMatrix.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were written directly to matrix storage, false if
+ *         overwriteMatrix was used instead
+ */
+bool overwriteMatrixValues(gridpack::math::Matrix &matrix)
+{
+  return loadStorageValues(matrix,false);
+}
+
+/**
+ * Overwrite elements of existing matrix by writing values directly into the
+ * local storage of the matrix
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were written directly to matrix storage
+ */
+bool overwriteMatrixValues(boost::shared_ptr<gridpack::math::Matrix> &matrix)
+{
+  return overwriteMatrixValues(*matrix);
+}
+
+/**
+ * Increment elements of existing matrix by adding values directly into the
+ * local storage of the matrix. Falls back to incrementMatrix under the
+ * same conditions as overwriteMatrixValues.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were added directly to matrix storage, false if
+ *         incrementMatrix was used instead
+ */
+bool incrementMatrixValues(gridpack::math::Matrix &matrix)
+{
+  return loadStorageValues(matrix,true);
+}
+
+/**
+ * Increment elements of existing matrix by adding values directly into the
+ * local storage of the matrix
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were added directly to matrix storage
+ */
+bool incrementMatrixValues(boost::shared_ptr<gridpack::math::Matrix> &matrix)
+{
+  return incrementMatrixValues(*matrix);
+}
+
+/**
+ * Discard the storage locations cached for a matrix by
+ * overwriteMatrixValues, incrementMatrixValues and the dirty value
+ * functions. This should be called before a matrix that has been used with
+ * these functions is destroyed if the mapper is still in use. Stale
+ * locations are also detected when they are used, but this releases the
+ * memory immediately. This is not collective
+ * @param matrix matrix that is no longer used with this mapper
+ */
+void forgetMatrix(gridpack::math::Matrix &matrix)
+{
+  p_storage.erase(&matrix);
+}
+
+/**
+ * Discard the storage locations cached for a matrix
+ * @param matrix matrix that is no longer used with this mapper
+ */
+void forgetMatrix(boost::shared_ptr<gridpack::math::Matrix> &matrix)
+{
+  forgetMatrix(*matrix);
+}
+
+/**
+ * Overwrite only the elements of an existing matrix that are generated by
+ * buses and branches marked dirty in the network (see
+ * BaseNetwork::markBusDirty and BaseNetwork::markBranchDirty). The cost is
+ * proportional to the number of dirty components. Values are written
+ * directly into matrix storage if possible, as in overwriteMatrixValues.
+ * The diagonal block of a bus often depends on the branches attached to it,
+ * so the caller should mark the buses at either end of a changed branch as
+ * well. Dirty marks are not cleared by this function.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were written directly to matrix storage
+ */
+bool overwriteDirtyMatrixValues(gridpack::math::Matrix &matrix)
+{
+  return loadDirtyValues(matrix,false);
+}
+
+/**
+ * Overwrite elements of existing matrix generated by dirty components
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were written directly to matrix storage
+ */
+bool overwriteDirtyMatrixValues(
+    boost::shared_ptr<gridpack::math::Matrix> &matrix)
+{
+  return overwriteDirtyMatrixValues(*matrix);
+}
+
+/**
+ * Increment only the elements of an existing matrix that are generated by
+ * buses and branches marked dirty in the network. Dirty marks are not
+ * cleared by this function.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were added directly to matrix storage
+ */
+bool incrementDirtyMatrixValues(gridpack::math::Matrix &matrix)
+{
+  return loadDirtyValues(matrix,true);
+}
+
+/**
+ * Increment elements of existing matrix generated by dirty components
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return true if values were added directly to matrix storage
+ */
+bool incrementDirtyMatrixValues(
+    boost::shared_ptr<gridpack::math::Matrix> &matrix)
+{
+  return incrementDirtyMatrixValues(*matrix);
+}
+
 /**
  * Check to see if matrix looks well formed. This method runs through all
  * branches and verifies that the dimensions of the branch contributions match
@@ -612,10 +865,9 @@ void loadBusArrays(int * iSizeArray, int * jSizeArray,
   }
 
 #ifdef NZ_PER_ROW
-  int size = nz_per_row.size();
-  p_nz_per_row = new int[size];
-  for (int i = 0; i<size; i++) {
-    p_nz_per_row[i] = nz_per_row[i];
+  p_plan->p_nz_per_row = nz_per_row;
+  if (p_plan->p_nz_per_row.size() > 0) {
+    p_nz_per_row = &(p_plan->p_nz_per_row[0]);
   }
 #endif
 }
@@ -912,8 +1164,10 @@ void setBusOffsets(void)
 
   // Gather matrix offsets
   if (p_busContribution > 0) {
-    p_i_busOffsets = new int[p_busContribution];
-    p_j_busOffsets = new int[p_busContribution];
+    p_plan->p_i_busOffsets.resize(p_busContribution);
+    p_plan->p_j_busOffsets.resize(p_busContribution);
+    p_i_busOffsets = &(p_plan->p_i_busOffsets[0]);
+    p_j_busOffsets = &(p_plan->p_j_busOffsets[0]);
     NGA_Gather(gaOffsetI,p_i_busOffsets,indices,p_busContribution);
     NGA_Gather(gaOffsetJ,p_j_busOffsets,indices,p_busContribution);
   }
@@ -930,42 +1184,7 @@ void setBusOffsets(void)
  */
 void loadBusData(gridpack::math::Matrix &matrix, bool flag)
 {
-  int i,idx,jdx,isize,jsize,icnt;
-  boost::shared_ptr<gridpack::component::BaseBusComponent> bus;
-  // Add matrix elements
-  ComplexType *values = new ComplexType[p_maxIBlock*p_maxJBlock];
-  int j,k;
-  int jcnt = 0;
-  for (i=0; i<p_nBuses; i++) {
-    if (p_network->getActiveBus(i)) {
-      bus = p_network->getBus(i);
-      if (bus->matrixDiagSize(&isize,&jsize)) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (bus->matrixDiagValues(values)) {
-          icnt = 0;
-          for (k=0; k<jsize; k++) {
-            jdx = p_j_busOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              idx = p_i_busOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(idx, jdx, values[icnt]);
-              } else {
-                matrix.setElement(idx, jdx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-  }
-
-  // Clean up arrays
-  delete [] values;
+  loadArenaData(matrix, p_arenaValues, false, flag);
 }
 
 /**
@@ -975,42 +1194,7 @@ void loadBusData(gridpack::math::Matrix &matrix, bool flag)
  */
 void loadRealBusData(gridpack::math::RealMatrix &matrix, bool flag)
 {
-  int i,idx,jdx,isize,jsize,icnt;
-  boost::shared_ptr<gridpack::component::BaseBusComponent> bus;
-  // Add matrix elements
-  RealType *values = new RealType[p_maxIBlock*p_maxJBlock];
-  int j,k;
-  int jcnt = 0;
-  for (i=0; i<p_nBuses; i++) {
-    if (p_network->getActiveBus(i)) {
-      bus = p_network->getBus(i);
-      if (bus->matrixDiagSize(&isize,&jsize)) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (bus->matrixDiagValues(values)) {
-          icnt = 0;
-          for (k=0; k<jsize; k++) {
-            jdx = p_j_busOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              idx = p_i_busOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(idx, jdx, values[icnt]);
-              } else {
-                matrix.setElement(idx, jdx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-  }
-
-  // Clean up arrays
-  delete [] values;
+  loadArenaData(matrix, p_arenaRealValues, false, flag);
 }
 
 /**
@@ -1091,9 +1275,11 @@ void setBranchOffsets(void)
   int t_gat(0);
   if (p_timer) t_gat = p_timer->createCategory("setBranchOffsets: Gather Offsets");
   if (p_timer) p_timer->start(t_gat);
-  p_i_branchOffsets = new int[p_branchContribution];
-  p_j_branchOffsets = new int[p_branchContribution];
   if (p_branchContribution > 0) {
+    p_plan->p_i_branchOffsets.resize(p_branchContribution);
+    p_plan->p_j_branchOffsets.resize(p_branchContribution);
+    p_i_branchOffsets = &(p_plan->p_i_branchOffsets[0]);
+    p_j_branchOffsets = &(p_plan->p_j_branchOffsets[0]);
     NGA_Gather(gaOffsetI,p_i_branchOffsets,i_indices,p_branchContribution);
     NGA_Gather(gaOffsetJ,p_j_branchOffsets,j_indices,p_branchContribution);
   }
@@ -1113,74 +1299,11 @@ void setBranchOffsets(void)
  */
 void loadBranchData(gridpack::math::Matrix &matrix, bool flag)
 {
-  int i,idx,jdx,isize,jsize,icnt;
-  // Add matrix elements
   int t_add(0);
   if (p_timer) t_add = p_timer->createCategory("loadBranchData: Add Matrix Elements");
   if (p_timer) p_timer->start(t_add);
-  boost::shared_ptr<gridpack::component::BaseBranchComponent> branch;
-  ComplexType *values = new ComplexType[p_maxIBlock*p_maxJBlock];
-  int j,k;
-  int jcnt = 0;
-  for (i=0; i<p_nBranches; i++) {
-    branch = p_network->getBranch(i);
-    if (branch->matrixForwardSize(&isize,&jsize)) {
-      branch->getMatVecIndices(&idx, &jdx);
-      if (idx >= p_minRowIndex && idx <= p_maxRowIndex) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (branch->matrixForwardValues(values)) {
-          icnt = 0;
-          for (k=0; k<jsize; k++) {
-            jdx = p_j_branchOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              idx = p_i_branchOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(idx, jdx, values[icnt]);
-              } else {
-                matrix.setElement(idx, jdx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-    if (branch->matrixReverseSize(&isize,&jsize)) {
-      branch->getMatVecIndices(&idx, &jdx);
-      if (jdx >= p_minRowIndex && jdx <= p_maxRowIndex) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (branch->matrixReverseValues(values)) {
-          icnt = 0;
-          // Note that because the indices have been reversed, we need to switch
-          // the ordering of the offsets as well
-          for (k=0; k<jsize; k++) {
-            idx = p_j_branchOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              jdx = p_i_branchOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(jdx, idx, values[icnt]);
-              } else {
-                matrix.setElement(jdx, idx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-  }
+  loadArenaData(matrix, p_arenaValues, true, flag);
   if (p_timer) p_timer->stop(t_add);
-
-  // Clean up array
-  delete [] values;
 }
 
 /**
@@ -1190,74 +1313,11 @@ void loadBranchData(gridpack::math::Matrix &matrix, bool flag)
  */
 void loadRealBranchData(gridpack::math::RealMatrix &matrix, bool flag)
 {
-  int i,idx,jdx,isize,jsize,icnt;
-  // Add matrix elements
   int t_add(0);
   if (p_timer) t_add = p_timer->createCategory("loadBranchData: Add Matrix Elements");
   if (p_timer) p_timer->start(t_add);
-  boost::shared_ptr<gridpack::component::BaseBranchComponent> branch;
-  RealType *values = new RealType[p_maxIBlock*p_maxJBlock];
-  int j,k;
-  int jcnt = 0;
-  for (i=0; i<p_nBranches; i++) {
-    branch = p_network->getBranch(i);
-    if (branch->matrixForwardSize(&isize,&jsize)) {
-      branch->getMatVecIndices(&idx, &jdx);
-      if (idx >= p_minRowIndex && idx <= p_maxRowIndex) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (branch->matrixForwardValues(values)) {
-          icnt = 0;
-          for (k=0; k<jsize; k++) {
-            jdx = p_j_branchOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              idx = p_i_branchOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(idx, jdx, values[icnt]);
-              } else {
-                matrix.setElement(idx, jdx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-    if (branch->matrixReverseSize(&isize,&jsize)) {
-      branch->getMatVecIndices(&idx, &jdx);
-      if (jdx >= p_minRowIndex && jdx <= p_maxRowIndex) {
-#ifdef DBG_CHECK
-        int ijsize = isize*jsize;
-        for (k=0; k<ijsize; k++) values[k] = 0.0;
-#endif
-        if (branch->matrixReverseValues(values)) {
-          icnt = 0;
-          // Note that because the indices have been reversed, we need to switch
-          // the ordering of the offsets as well
-          for (k=0; k<jsize; k++) {
-            idx = p_j_branchOffsets[jcnt] + k;
-            for (j=0; j<isize; j++) {
-              jdx = p_i_branchOffsets[jcnt] + j;
-              if (flag) {
-                matrix.addElement(jdx, idx, values[icnt]);
-              } else {
-                matrix.setElement(jdx, idx, values[icnt]);
-              }
-              icnt++;
-            }
-          }
-        }
-        jcnt++;
-      }
-    }
-  }
+  loadArenaData(matrix, p_arenaRealValues, true, flag);
   if (p_timer) p_timer->stop(t_add);
-
-  // Clean up array
-  delete [] values;
 }
 
 /**
@@ -1314,6 +1374,876 @@ void contributions(void)
   }
 }
 
+/**
+ * Evaluate a list of integers that describes the local layout of the matrix
+ * blocks generated by buses and branches on this processor. Two mappers
+ * whose signatures are the same on all processors produce identical
+ * matrix layouts.
+ * @param signature list of block sizes, status flags and indices
+ */
+void getSignature(std::vector<int> &signature)
+{
+  int i, isize, jsize, idx, jdx;
+  bool status;
+  signature.clear();
+  signature.reserve(4*p_nBuses+8*p_nBranches);
+  for (i=0; i<p_nBuses; i++) {
+    boost::shared_ptr<gridpack::component::BaseBusComponent> bus
+      = p_network->getBus(i);
+    isize = 0;
+    jsize = 0;
+    status = bus->matrixDiagSize(&isize, &jsize);
+    if (!status) {
+      isize = 0;
+      jsize = 0;
+    }
+    bus->getMatVecIndex(&idx);
+    signature.push_back((p_network->getActiveBus(i) ? 2 : 0) + (status ? 1 : 0));
+    signature.push_back(idx);
+    signature.push_back(isize);
+    signature.push_back(jsize);
+  }
+  for (i=0; i<p_nBranches; i++) {
+    boost::shared_ptr<gridpack::component::BaseBranchComponent> branch
+      = p_network->getBranch(i);
+    branch->getMatVecIndices(&idx, &jdx);
+    signature.push_back(idx);
+    signature.push_back(jdx);
+    isize = 0;
+    jsize = 0;
+    status = branch->matrixForwardSize(&isize, &jsize);
+    if (!status) {
+      isize = 0;
+      jsize = 0;
+    }
+    signature.push_back(status ? 1 : 0);
+    signature.push_back(isize);
+    signature.push_back(jsize);
+    isize = 0;
+    jsize = 0;
+    status = branch->matrixReverseSize(&isize, &jsize);
+    if (!status) {
+      isize = 0;
+      jsize = 0;
+    }
+    signature.push_back(status ? 1 : 0);
+    signature.push_back(isize);
+    signature.push_back(jsize);
+  }
+}
+
+/**
+ * Look for a cached plan that matches the current layout of the network on
+ * all processors. Plans for networks that have been deleted or whose
+ * topology version has changed are removed from the cache.
+ * @param signature signature of local matrix layout
+ * @return matching plan or an empty pointer if no plan is found
+ */
+boost::shared_ptr<FullMatrixMapPlan> findPlan(const std::vector<int> &signature)
+{
+  boost::shared_ptr<FullMatrixMapPlan> ret;
+  std::list<PlanRecord> &cache = planCache();
+  int version = p_network->topologyVersion();
+  int id = -1;
+  typename std::list<PlanRecord>::iterator it = cache.begin();
+  while (it != cache.end()) {
+    boost::shared_ptr<_network> network = it->p_network.lock();
+    if (!network) {
+      it = cache.erase(it);
+      continue;
+    }
+    if (network == p_network) {
+      if (it->p_version != version) {
+        it->p_plans.clear();
+        it->p_version = version;
+      }
+      typename std::list<boost::shared_ptr<FullMatrixMapPlan> >::iterator
+        pit = it->p_plans.begin();
+      for (; pit != it->p_plans.end(); ++pit) {
+        if ((*pit)->p_signature == signature) {
+          ret = *pit;
+          id = ret->p_id;
+          break;
+        }
+      }
+    }
+    ++it;
+  }
+  // Plan can only be used if the same plan is found on all processors
+  int ids[2];
+  ids[0] = id;
+  ids[1] = -id;
+  char cmax[4];
+  strcpy(cmax,"max");
+  GA_Pgroup_igop(p_GAgrp,ids,2,cmax);
+  if (id < 0 || ids[0] != id || -ids[1] != id) {
+    ret.reset();
+  }
+  return ret;
+}
+
+/**
+ * Store the layout evaluated by this mapper in the current plan and, if
+ * caching is enabled, add the plan to the cache
+ * @param signature signature of local matrix layout
+ */
+void savePlan(const std::vector<int> &signature)
+{
+  p_reusedPlan = false;
+  p_plan->p_totalBuses = p_totalBuses;
+  p_plan->p_minRowIndex = p_minRowIndex;
+  p_plan->p_maxRowIndex = p_maxRowIndex;
+  p_plan->p_rowBlockSize = p_rowBlockSize;
+  p_plan->p_colBlockSize = p_colBlockSize;
+  p_plan->p_busContribution = p_busContribution;
+  p_plan->p_branchContribution = p_branchContribution;
+  p_plan->p_maxIBlock = p_maxIBlock;
+  p_plan->p_maxJBlock = p_maxJBlock;
+  p_plan->p_maxcol = p_maxcol;
+  if (!planCaching()) return;
+  p_plan->p_signature = signature;
+
+  std::list<PlanRecord> &cache = planCache();
+  int version = p_network->topologyVersion();
+  typename std::list<PlanRecord>::iterator it = cache.begin();
+  for (; it != cache.end(); ++it) {
+    if (it->p_network.lock() == p_network) break;
+  }
+  if (it == cache.end()) {
+    PlanRecord record;
+    record.p_network = p_network;
+    record.p_version = version;
+    record.p_nextId = 0;
+    it = cache.insert(cache.end(), record);
+  } else if (it->p_version != version) {
+    it->p_plans.clear();
+    it->p_version = version;
+  }
+  // All processors create mappers on a network in the same order so plan
+  // IDs and evictions are consistent across the network communicator
+  p_plan->p_id = it->p_nextId;
+  it->p_nextId++;
+  it->p_plans.push_back(p_plan);
+  if (it->p_plans.size() > FULL_MAP_MAX_PLANS) {
+    it->p_plans.pop_front();
+  }
+}
+
+/**
+ * Copy layout parameters from a cached plan into this mapper
+ */
+void loadPlan(void)
+{
+  p_reusedPlan = true;
+  p_totalBuses = p_plan->p_totalBuses;
+  p_minRowIndex = p_plan->p_minRowIndex;
+  p_maxRowIndex = p_plan->p_maxRowIndex;
+  p_rowBlockSize = p_plan->p_rowBlockSize;
+  p_colBlockSize = p_plan->p_colBlockSize;
+  p_busContribution = p_plan->p_busContribution;
+  p_branchContribution = p_plan->p_branchContribution;
+  p_maxIBlock = p_plan->p_maxIBlock;
+  p_maxJBlock = p_plan->p_maxJBlock;
+  p_maxcol = p_plan->p_maxcol;
+  if (p_plan->p_i_busOffsets.size() > 0) {
+    p_i_busOffsets = &(p_plan->p_i_busOffsets[0]);
+    p_j_busOffsets = &(p_plan->p_j_busOffsets[0]);
+  }
+  if (p_plan->p_i_branchOffsets.size() > 0) {
+    p_i_branchOffsets = &(p_plan->p_i_branchOffsets[0]);
+    p_j_branchOffsets = &(p_plan->p_j_branchOffsets[0]);
+  }
+#ifdef NZ_PER_ROW
+  if (p_plan->p_nz_per_row.size() > 0) {
+    p_nz_per_row = &(p_plan->p_nz_per_row[0]);
+  }
+#endif
+}
+
+/**
+ * Set up the arena used to gather block contributions from buses and
+ * branches. The arena lists, for each bus and branch block contributed by
+ * this processor, the component that generates it and the row and column
+ * indices of its elements. Indices are stored in the plan so they can be
+ * shared with other mappers using the same layout. Component pointers are
+ * stored in this mapper.
+ */
+void setupArena(void)
+{
+  if (p_arenaReady) return;
+  int i,j,k,idx,jdx,isize,jsize,jcnt;
+  if (!p_plan->p_arenaReady) {
+    std::vector<int> &busBlocks = p_plan->p_busBlocks;
+    std::vector<int> &busArena = p_plan->p_busArena;
+    std::vector<int> &busRows = p_plan->p_busRows;
+    std::vector<int> &busCols = p_plan->p_busCols;
+    busBlocks.clear();
+    busArena.clear();
+    busRows.clear();
+    busCols.clear();
+    busArena.push_back(0);
+    jcnt = 0;
+    for (i=0; i<p_nBuses; i++) {
+      if (p_network->getActiveBus(i)) {
+        if (p_network->getBus(i)->matrixDiagSize(&isize,&jsize)) {
+          for (k=0; k<jsize; k++) {
+            for (j=0; j<isize; j++) {
+              busRows.push_back(p_i_busOffsets[jcnt] + j);
+              busCols.push_back(p_j_busOffsets[jcnt] + k);
+            }
+          }
+          busBlocks.push_back(i);
+          busArena.push_back(busRows.size());
+          jcnt++;
+        }
+      }
+    }
+
+    std::vector<int> &branchBlocks = p_plan->p_branchBlocks;
+    std::vector<int> &branchArena = p_plan->p_branchArena;
+    std::vector<int> &branchRows = p_plan->p_branchRows;
+    std::vector<int> &branchCols = p_plan->p_branchCols;
+    branchBlocks.clear();
+    branchArena.clear();
+    branchRows.clear();
+    branchCols.clear();
+    branchArena.push_back(0);
+    jcnt = 0;
+    for (i=0; i<p_nBranches; i++) {
+      boost::shared_ptr<gridpack::component::BaseBranchComponent> branch
+        = p_network->getBranch(i);
+      branch->getMatVecIndices(&idx, &jdx);
+      if (branch->matrixForwardSize(&isize,&jsize)) {
+        if (idx >= p_minRowIndex && idx <= p_maxRowIndex) {
+          for (k=0; k<jsize; k++) {
+            for (j=0; j<isize; j++) {
+              branchRows.push_back(p_i_branchOffsets[jcnt] + j);
+              branchCols.push_back(p_j_branchOffsets[jcnt] + k);
+            }
+          }
+          branchBlocks.push_back(2*i);
+          branchArena.push_back(branchRows.size());
+          jcnt++;
+        }
+      }
+      if (branch->matrixReverseSize(&isize,&jsize)) {
+        if (jdx >= p_minRowIndex && jdx <= p_maxRowIndex) {
+          // Offsets for reverse blocks have already been switched, so row
+          // offsets still come from p_i_branchOffsets
+          for (k=0; k<jsize; k++) {
+            for (j=0; j<isize; j++) {
+              branchRows.push_back(p_i_branchOffsets[jcnt] + j);
+              branchCols.push_back(p_j_branchOffsets[jcnt] + k);
+            }
+          }
+          branchBlocks.push_back(2*i+1);
+          branchArena.push_back(branchRows.size());
+          jcnt++;
+        }
+      }
+    }
+    p_plan->p_arenaReady = true;
+  }
+
+  int nblk = p_plan->p_busBlocks.size();
+  p_arenaBuses.resize(nblk);
+  p_busBlockIndex.assign(p_nBuses,-1);
+  for (i=0; i<nblk; i++) {
+    p_arenaBuses[i] = p_network->getBus(p_plan->p_busBlocks[i]).get();
+    p_busBlockIndex[p_plan->p_busBlocks[i]] = i;
+  }
+  nblk = p_plan->p_branchBlocks.size();
+  p_arenaBranches.resize(nblk);
+  p_branchBlockIndex.assign(2*p_nBranches,-1);
+  for (i=0; i<nblk; i++) {
+    p_arenaBranches[i] = p_network->getBranch(p_plan->p_branchBlocks[i]/2).get();
+    p_branchBlockIndex[p_plan->p_branchBlocks[i]] = i;
+  }
+
+  // Block sizes are part of the matrix layout and are fixed once the
+  // arena has been set up. Check them here, against the components of this
+  // mapper, so that gathering values does not need to query them again
+  for (i=0; i<p_arenaBuses.size(); i++) {
+    if (!checkArenaBlock(i, false)) arenaSizeError(i, false);
+  }
+  for (i=0; i<p_arenaBranches.size(); i++) {
+    if (!checkArenaBlock(i, true)) arenaSizeError(i, true);
+  }
+
+  // Split branch blocks into forward and reverse lists so that each list
+  // can be passed to a single batch call. Forward and reverse blocks of a
+  // branch are consecutive in the arena, so group them so that both are
+  // evaluated by the same thread
+  p_forwardBlocks.clear();
+  p_reverseBlocks.clear();
+  p_forwardComps.clear();
+  p_reverseComps.clear();
+  p_forwardOffsets.clear();
+  p_reverseOffsets.clear();
+  p_branchGroups.clear();
+  p_forwardStart.clear();
+  p_reverseStart.clear();
+  const std::vector<int> &branchArena = p_plan->p_branchArena;
+  for (i=0; i<nblk; i++) {
+    if (i == 0 || p_plan->p_branchBlocks[i]/2
+        != p_plan->p_branchBlocks[i-1]/2) {
+      p_branchGroups.push_back(i);
+      p_forwardStart.push_back(p_forwardBlocks.size());
+      p_reverseStart.push_back(p_reverseBlocks.size());
+    }
+    if (p_plan->p_branchBlocks[i]%2 == 0) {
+      p_forwardBlocks.push_back(i);
+      p_forwardComps.push_back(p_arenaBranches[i]);
+      p_forwardOffsets.push_back(branchArena[i]);
+    } else {
+      p_reverseBlocks.push_back(i);
+      p_reverseComps.push_back(p_arenaBranches[i]);
+      p_reverseOffsets.push_back(branchArena[i]);
+    }
+  }
+  p_branchGroups.push_back(nblk);
+  p_forwardStart.push_back(p_forwardBlocks.size());
+  p_reverseStart.push_back(p_reverseBlocks.size());
+  // Location of the status of each branch block in the status array, which
+  // holds the forward list followed by the reverse list
+  p_branchOK.resize(nblk);
+  for (i=0; i<p_forwardBlocks.size(); i++) {
+    p_branchOK[p_forwardBlocks[i]] = i;
+  }
+  for (i=0; i<p_reverseBlocks.size(); i++) {
+    p_branchOK[p_reverseBlocks[i]] = p_forwardBlocks.size() + i;
+  }
+  p_arenaReady = true;
+}
+
+/**
+ * Check that the block generated by a component has the size that was used
+ * to set up the arena. Block sizes are part of the matrix layout, so a
+ * component that changes its block size invalidates the mapper.
+ * @param blk block index in the bus or branch arena
+ * @param branches block is a branch block (true) or bus block (false)
+ * @return true if block size matches the arena
+ */
+bool checkArenaBlock(int blk, bool branches)
+{
+  const std::vector<int> &offset = branches ? p_plan->p_branchArena
+    : p_plan->p_busArena;
+  int isize, jsize;
+  bool ok;
+  if (branches) {
+    if (p_plan->p_branchBlocks[blk]%2 == 0) {
+      ok = p_arenaBranches[blk]->matrixForwardSize(&isize,&jsize);
+    } else {
+      ok = p_arenaBranches[blk]->matrixReverseSize(&isize,&jsize);
+    }
+  } else {
+    ok = p_arenaBuses[blk]->matrixDiagSize(&isize,&jsize);
+  }
+  return ok && isize*jsize == offset[blk+1] - offset[blk];
+}
+
+/**
+ * Throw an exception reporting a block whose size no longer matches the
+ * arena
+ * @param blk block index in the bus or branch arena
+ * @param branches block is a branch block (true) or bus block (false)
+ */
+void arenaSizeError(int blk, bool branches)
+{
+  char buf[256];
+  if (branches) {
+    sprintf(buf,"FullMatrixMap: size of block for branch %d on process %d"
+        " does not match matrix layout\n",p_plan->p_branchBlocks[blk]/2,p_me);
+  } else {
+    sprintf(buf,"FullMatrixMap: size of block for bus %d on process %d"
+        " does not match matrix layout\n",p_plan->p_busBlocks[blk],p_me);
+  }
+  printf("%s",buf);
+  throw gridpack::Exception(buf);
+}
+
+/**
+ * Evaluate a list of blocks of the same kind with a single batch call to the
+ * components
+ * @param kind diagonal (0), forward (1) or reverse (2) blocks
+ * @param first first entry in comps and offsets
+ * @param n number of blocks
+ * @param comps component generating each block
+ * @param offsets location of each block in values
+ * @param values array that receives block values
+ * @param ok returns 1 for each block that has values and 0 otherwise
+ */
+template <typename _type>
+void evaluateBlocks(int kind, int first, int n,
+    const std::vector<gridpack::component::MatVecInterface*> &comps,
+    const std::vector<int> &offsets, _type *values, int *ok)
+{
+  if (n == 0) return;
+  gridpack::component::MatVecInterface *const *c = &comps[first];
+  const int *off = &offsets[first];
+  if (kind == 0) {
+    c[0]->matrixDiagValuesBlock(n, c, off, values, ok);
+  } else if (kind == 1) {
+    c[0]->matrixForwardValuesBlock(n, c, off, values, ok);
+  } else {
+    c[0]->matrixReverseValuesBlock(n, c, off, values, ok);
+  }
+}
+
+/**
+ * Gather values from all bus blocks or all branch blocks into a single
+ * contiguous array. Blocks are written directly into the arena. Buses, and
+ * the forward and reverse blocks of branches, are each evaluated with one
+ * batch call, so component types that override the batch methods avoid a
+ * virtual call for each block. Block sizes are checked once, when the arena
+ * is set up. Blocks are evaluated by several threads only if more than one
+ * thread has been requested through gridpack::parallel::ComponentThreads
+ * (the default is one). In that case the matrix value methods of buses and
+ * branches must be safe to call concurrently on different components; both
+ * blocks of a branch are always evaluated by the same thread. If a
+ * component does not return values for its block, the block is dropped and
+ * the remaining blocks are packed.
+ * @param values array that holds gathered values
+ * @param branches gather branch blocks (true) or bus blocks (false)
+ * @param map if blocks were dropped, returns the location in the full arena
+ *        of each gathered value, otherwise returns NULL
+ * @return number of gathered values
+ */
+template <typename _type>
+int gatherArenaValues(std::vector<_type> &values, bool branches,
+    const int **map)
+{
+  int b,k,size;
+  setupArena();
+  const std::vector<int> &offset = branches ? p_plan->p_branchArena
+    : p_plan->p_busArena;
+  int nblk = offset.size()-1;
+  // Pad the arena by the largest block size so a component can never write
+  // past the end of it
+  values.resize(offset[nblk] + p_maxIBlock*p_maxJBlock);
+  if (nblk == 0) {
+    *map = NULL;
+    return 0;
+  }
+#ifdef DBG_CHECK
+  for (b=0; b<nblk; b++) {
+    if (!checkArenaBlock(b, branches)) arenaSizeError(b, branches);
+  }
+  for (k=0; k<offset[nblk]; k++) values[k] = 0.0;
+#endif
+  p_arenaOK.resize(nblk);
+  // Status of each block. Branch blocks are listed as the forward blocks
+  // followed by the reverse blocks
+  int nfwd = p_forwardBlocks.size();
+  int *fwdOK = &p_arenaOK[0];
+  int *revOK = fwdOK + nfwd;
+  int ngrp = branches ? p_branchGroups.size()-1 : nblk;
+  int nthreads = gridpack::parallel::ComponentThreads::numThreads();
+  if (nthreads > 1 && ngrp > 1) {
+    // Each thread evaluates a contiguous range of buses or branches with
+    // one batch call for each kind of block. Both blocks of a branch are in
+    // the same range, so a component is only ever called from one thread at
+    // a time
+    int chunk = gridpack::parallel::ComponentThreads::chunkSize();
+    int nchunk = (ngrp + chunk - 1)/chunk;
+    int c;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+#endif
+    for (c=0; c<nchunk; c++) {
+      int first = c*chunk;
+      int last = first + chunk < ngrp ? first + chunk : ngrp;
+      if (branches) {
+        int f0 = p_forwardStart[first];
+        int r0 = p_reverseStart[first];
+        evaluateBlocks(1, f0, p_forwardStart[last]-f0, p_forwardComps,
+            p_forwardOffsets, &values[0], fwdOK+f0);
+        evaluateBlocks(2, r0, p_reverseStart[last]-r0, p_reverseComps,
+            p_reverseOffsets, &values[0], revOK+r0);
+      } else {
+        evaluateBlocks(0, first, last-first, p_arenaBuses, offset,
+            &values[0], fwdOK+first);
+      }
+    }
+  } else {
+    if (branches) {
+      evaluateBlocks(1, 0, nfwd, p_forwardComps, p_forwardOffsets,
+          &values[0], fwdOK);
+      evaluateBlocks(2, 0, p_reverseBlocks.size(), p_reverseComps,
+          p_reverseOffsets, &values[0], revOK);
+    } else {
+      evaluateBlocks(0, 0, nblk, p_arenaBuses, offset, &values[0], fwdOK);
+    }
+  }
+
+  // Squeeze out blocks without values
+  bool compact = false;
+  int n = 0;
+  for (b=0; b<nblk; b++) {
+    size = offset[b+1] - offset[b];
+    if (p_arenaOK[branches ? p_branchOK[b] : b]) {
+      if (compact) {
+        for (k=0; k<size; k++) {
+          values[n+k] = values[offset[b]+k];
+          p_arenaMap.push_back(offset[b]+k);
+        }
+      }
+      n += size;
+    } else if (!compact) {
+      compact = true;
+      p_arenaMap.clear();
+      for (k=0; k<n; k++) p_arenaMap.push_back(k);
+    }
+  }
+  *map = NULL;
+  if (compact && n > 0) *map = &p_arenaMap[0];
+  return n;
+}
+
+/**
+ * Gather contributions from all bus blocks or all branch blocks and pass
+ * them to the matrix in a single call
+ * @param matrix matrix to which contributions are added
+ * @param values array, of the same type as matrix, that holds gathered values
+ * @param branches load branch blocks (true) or bus blocks (false)
+ * @param flag flag to distinguish new matrix (true) from old (false)
+ */
+template <class _matrix, typename _type>
+void loadArenaData(_matrix &matrix, std::vector<_type> &values,
+    bool branches, bool flag)
+{
+  const int *map;
+  int n = gatherArenaValues(values, branches, &map);
+  if (n == 0) return;
+  const int *rows = branches ? &(p_plan->p_branchRows[0])
+    : &(p_plan->p_busRows[0]);
+  const int *cols = branches ? &(p_plan->p_branchCols[0])
+    : &(p_plan->p_busCols[0]);
+  if (map) {
+    p_arenaRows.resize(n);
+    p_arenaCols.resize(n);
+    for (int k=0; k<n; k++) {
+      p_arenaRows[k] = rows[map[k]];
+      p_arenaCols[k] = cols[map[k]];
+    }
+    rows = &p_arenaRows[0];
+    cols = &p_arenaCols[0];
+  }
+  if (flag) {
+    matrix.addElements(n, rows, cols, &values[0]);
+  } else {
+    matrix.setElements(n, rows, cols, &values[0]);
+  }
+}
+
+/**
+ * Storage locations of the elements of a single matrix
+ * p_ok: storage locations could be evaluated on all processors
+ * p_instanceId: instance number of matrix when locations were evaluated
+ * p_storageSize: number of values in local storage of matrix
+ * p_rows: number of rows in matrix
+ * p_cols: number of columns in matrix
+ * p_busLocations: storage location of each element in the bus arena
+ * p_branchLocations: storage location of each element in the branch arena
+ */
+struct StorageRecord {
+  bool                                                  p_ok;
+  long                                                  p_instanceId;
+  int                                                   p_storageSize;
+  int                                                   p_rows;
+  int                                                   p_cols;
+  std::vector<int>                                      p_busLocations;
+  std::vector<int>                                      p_branchLocations;
+};
+
+/**
+ * Evaluate storage locations for a list of matrix elements
+ * @param matrix existing matrix
+ * @param rows row indices of elements
+ * @param cols column indices of elements
+ * @param locations storage location of each element
+ * @return false if storage locations are not available
+ */
+bool getStorageLocations(gridpack::math::Matrix &matrix,
+    const std::vector<int> &rows, const std::vector<int> &cols,
+    std::vector<int> &locations)
+{
+  int nvals = rows.size();
+  locations.resize(nvals);
+  if (nvals > 0) {
+    return matrix.storageLocations(nvals, &rows[0], &cols[0], &locations[0]);
+  }
+  // Still check that the matrix supports direct storage access
+  int idum;
+  return matrix.storageLocations(0, &idum, &idum, &idum);
+}
+
+/**
+ * Gather contributions from all bus blocks or all branch blocks and write
+ * them directly into matrix storage
+ * @param matrix existing matrix
+ * @param locations storage locations of the bus or branch arena
+ * @param branches load branch blocks (true) or bus blocks (false)
+ * @param flag add values (true) or overwrite values (false)
+ */
+void storeArenaValues(gridpack::math::Matrix &matrix,
+    const std::vector<int> &locations, bool branches, bool flag)
+{
+  const int *map;
+  int n = gatherArenaValues(p_arenaValues, branches, &map);
+  if (n == 0) return;
+  const int *loc = &locations[0];
+  if (map) {
+    p_storageIndex.resize(n);
+    for (int k=0; k<n; k++) p_storageIndex[k] = locations[map[k]];
+    loc = &p_storageIndex[0];
+  }
+  if (!matrix.setStorageValues(n, loc, &p_arenaValues[0], flag)) {
+    char buf[256];
+    sprintf(buf,"FullMatrixMap::storeArenaValues: unable to write"
+        " values to matrix storage on process %d\n",p_me);
+    printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+}
+
+/**
+ * Return the storage locations of the elements of a matrix, evaluating them
+ * if this is the first time the matrix has been seen by this mapper or if
+ * the cached locations are stale. Locations are stale if the matrix is a
+ * different instance (a matrix was destroyed and another one created at
+ * the same address), or its size or number of stored values has changed.
+ * This must be called on all processors.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @return storage record for matrix
+ */
+const StorageRecord& getStorageRecord(gridpack::math::Matrix &matrix)
+{
+  typename std::map<gridpack::math::Matrix*, StorageRecord>::iterator
+    it = p_storage.find(&matrix);
+  int stale = 0;
+  if (it == p_storage.end()) {
+    stale = 1;
+  } else {
+    const StorageRecord &record = it->second;
+    if (record.p_instanceId != matrix.instanceId() ||
+        record.p_storageSize != matrix.storageSize() ||
+        record.p_rows != matrix.rows() || record.p_cols != matrix.cols()) {
+      stale = 1;
+    }
+  }
+  // All processors must evaluate locations if any of them needs to
+  char cmax[4];
+  strcpy(cmax,"max");
+  GA_Pgroup_igop(p_GAgrp,&stale,1,cmax);
+  if (stale == 0) return it->second;
+
+  if (it != p_storage.end()) p_storage.erase(it);
+  StorageRecord record;
+  record.p_instanceId = matrix.instanceId();
+  record.p_storageSize = matrix.storageSize();
+  record.p_rows = matrix.rows();
+  record.p_cols = matrix.cols();
+  setupArena();
+  bool ok = getStorageLocations(matrix, p_plan->p_busRows,
+      p_plan->p_busCols, record.p_busLocations);
+  ok = ok && getStorageLocations(matrix, p_plan->p_branchRows,
+      p_plan->p_branchCols, record.p_branchLocations);
+  int iok = ok ? 1 : 0;
+  char cmin[4];
+  strcpy(cmin,"min");
+  GA_Pgroup_igop(p_GAgrp,&iok,1,cmin);
+  record.p_ok = (iok == 1);
+  if (!record.p_ok) {
+    record.p_busLocations.clear();
+    record.p_branchLocations.clear();
+  }
+  it = p_storage.insert(std::make_pair(&matrix, record)).first;
+  return it->second;
+}
+
+/**
+ * Append the values of a list of bus or branch blocks to the list of dirty
+ * values, along with their indices and, if available, storage locations.
+ * The blocks are evaluated with a single batch call.
+ * @param kind diagonal (0), forward (1) or reverse (2) blocks
+ * @param blks block indices in the bus or branch arena
+ * @param locations storage locations of the bus or branch arena (empty if
+ *        not available)
+ * @param n number of values in list, updated on return
+ */
+void appendDirtyBlocks(int kind, const std::vector<int> &blks,
+    const std::vector<int> &locations, int &n)
+{
+  int nb = blks.size();
+  if (nb == 0) return;
+  bool branches = (kind != 0);
+  const std::vector<int> &offset = branches ? p_plan->p_branchArena
+    : p_plan->p_busArena;
+  const std::vector<int> &rows = branches ? p_plan->p_branchRows
+    : p_plan->p_busRows;
+  const std::vector<int> &cols = branches ? p_plan->p_branchCols
+    : p_plan->p_busCols;
+  int i, k, blk, size;
+  p_dirtyComps.resize(nb);
+  p_dirtyOffsets.resize(nb);
+  p_arenaOK.resize(nb);
+  int m = 0;
+  for (i=0; i<nb; i++) {
+    blk = blks[i];
+#ifdef DBG_CHECK
+    if (!checkArenaBlock(blk, branches)) arenaSizeError(blk, branches);
+#endif
+    p_dirtyComps[i] = branches ? p_arenaBranches[blk] : p_arenaBuses[blk];
+    p_dirtyOffsets[i] = m;
+    m += offset[blk+1] - offset[blk];
+  }
+  if (p_arenaValues.size() < n + m + p_maxIBlock*p_maxJBlock) {
+    p_arenaValues.resize(n + m + p_maxIBlock*p_maxJBlock);
+  }
+  evaluateBlocks(kind, 0, nb, p_dirtyComps, p_dirtyOffsets,
+      &p_arenaValues[n], &p_arenaOK[0]);
+  int base = n;
+  for (i=0; i<nb; i++) {
+    if (!p_arenaOK[i]) continue;
+    blk = blks[i];
+    size = offset[blk+1] - offset[blk];
+    for (k=0; k<size; k++) {
+      p_arenaValues[n+k] = p_arenaValues[base+p_dirtyOffsets[i]+k];
+      p_arenaRows.push_back(rows[offset[blk]+k]);
+      p_arenaCols.push_back(cols[offset[blk]+k]);
+      if (!locations.empty()) {
+        p_storageIndex.push_back(locations[offset[blk]+k]);
+      }
+    }
+    n += size;
+  }
+}
+
+/**
+ * Write values of blocks generated by dirty buses and branches into a
+ * matrix. Values go directly into matrix storage if storage locations are
+ * available on all processors, otherwise they are loaded through the matrix
+ * interface.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param flag add values (true) or overwrite values (false)
+ * @return true if values were written directly to matrix storage
+ */
+bool loadDirtyValues(gridpack::math::Matrix &matrix, bool flag)
+{
+  GA_Pgroup_sync(p_GAgrp);
+  const StorageRecord &record = getStorageRecord(matrix);
+  setupArena();
+  int i, b, dir;
+  int n = 0;
+  p_arenaRows.clear();
+  p_arenaCols.clear();
+  p_storageIndex.clear();
+  std::vector<int> &blks = p_dirtyBlocks;
+  const std::vector<int> &buses = p_network->dirtyBuses();
+  blks.clear();
+  for (i=0; i<buses.size(); i++) {
+    b = p_busBlockIndex[buses[i]];
+    if (b >= 0) blks.push_back(b);
+  }
+  appendDirtyBlocks(0, blks, record.p_busLocations, n);
+  const std::vector<int> &branches = p_network->dirtyBranches();
+  for (dir=0; dir<2; dir++) {
+    blks.clear();
+    for (i=0; i<branches.size(); i++) {
+      b = p_branchBlockIndex[2*branches[i]+dir];
+      if (b >= 0) blks.push_back(b);
+    }
+    appendDirtyBlocks(dir+1, blks, record.p_branchLocations, n);
+  }
+
+  if (record.p_ok) {
+    if (n > 0 && !matrix.setStorageValues(n, &p_storageIndex[0],
+          &p_arenaValues[0], flag)) {
+      char buf[256];
+      sprintf(buf,"FullMatrixMap::loadDirtyValues: unable to write"
+          " values to matrix storage on process %d\n",p_me);
+      printf("%s",buf);
+      throw gridpack::Exception(buf);
+    }
+    GA_Pgroup_sync(p_GAgrp);
+    return true;
+  }
+
+  if (n > 0) {
+    if (flag) {
+      matrix.addElements(n, &p_arenaRows[0], &p_arenaCols[0],
+          &p_arenaValues[0]);
+    } else {
+      matrix.setElements(n, &p_arenaRows[0], &p_arenaCols[0],
+          &p_arenaValues[0]);
+    }
+  }
+  GA_Pgroup_sync(p_GAgrp);
+  matrix.ready();
+  return false;
+}
+
+/**
+ * Write block values directly into the storage of a matrix, evaluating the
+ * storage locations first if this is the first time the matrix has been
+ * seen by this mapper. Falls back to loading values through the matrix
+ * interface if direct access is not possible on all processors.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param flag add values (true) or overwrite values (false)
+ * @return true if values were written directly to matrix storage
+ */
+bool loadStorageValues(gridpack::math::Matrix &matrix, bool flag)
+{
+  GA_Pgroup_sync(p_GAgrp);
+  const StorageRecord &record = getStorageRecord(matrix);
+
+  if (record.p_ok) {
+    storeArenaValues(matrix, record.p_busLocations, false, flag);
+    storeArenaValues(matrix, record.p_branchLocations, true, flag);
+    GA_Pgroup_sync(p_GAgrp);
+    return true;
+  }
+
+  loadBusData(matrix,flag);
+  loadBranchData(matrix,flag);
+  GA_Pgroup_sync(p_GAgrp);
+  matrix.ready();
+  return false;
+}
+
+/**
+ * Cached plans for a single network
+ * p_network: network that plans were generated from
+ * p_version: topology version of network when plans were generated
+ * p_nextId: ID to assign to the next plan created for this network
+ * p_plans: list of plans, oldest first
+ */
+struct PlanRecord {
+  boost::weak_ptr<_network>                             p_network;
+  int                                                   p_version;
+  int                                                   p_nextId;
+  std::list<boost::shared_ptr<FullMatrixMapPlan> >      p_plans;
+};
+
+/**
+ * Return cache of plans for all networks of this type
+ */
+static std::list<PlanRecord>& planCache(void)
+{
+  static std::list<PlanRecord> cache;
+  return cache;
+}
+
+/**
+ * Return flag that controls caching of plans
+ */
+static bool& planCachingFlag(void)
+{
+  static bool flag = true;
+  return flag;
+}
+
     // GA information
 int                         p_me;
 int                         p_nNodes;
@@ -1351,6 +2281,60 @@ int                         gaOffsetI; // g_ioff
 int                         gaOffsetJ; // g_joff
 int                         p_GAgrp;
 
+    // layout of matrix, possibly shared with other mappers
+boost::shared_ptr<FullMatrixMapPlan> p_plan;
+bool                        p_reusedPlan;
+
+    // arena used to gather block contributions: component that generates
+    // each block, gathered values and work arrays used when blocks are
+    // dropped
+bool                        p_arenaReady;
+std::vector<gridpack::component::MatVecInterface*> p_arenaBuses;
+std::vector<gridpack::component::MatVecInterface*> p_arenaBranches;
+std::vector<ComplexType>    p_arenaValues;
+std::vector<RealType>       p_arenaRealValues;
+std::vector<int>            p_arenaMap;
+std::vector<int>            p_arenaRows;
+std::vector<int>            p_arenaCols;
+std::vector<int>            p_arenaOK;
+
+    // arena block generated by each local bus and by each branch direction
+    // (2*branch for forward, 2*branch+1 for reverse), -1 if none. Used to
+    // update blocks of dirty components
+std::vector<int>            p_busBlockIndex;
+std::vector<int>            p_branchBlockIndex;
+
+    // first arena block of each branch that contributes blocks, followed
+    // by the total number of branch blocks. Used to keep both blocks of a
+    // branch in the same thread
+std::vector<int>            p_branchGroups;
+
+    // forward and reverse branch blocks, listed separately so that each
+    // list can be evaluated with one batch call: arena block, component and
+    // arena offset of each block, and the first entry in each list for each
+    // branch group (plus the list size). p_branchOK is the location of the
+    // status of each arena block in p_arenaOK
+std::vector<int>            p_forwardBlocks;
+std::vector<int>            p_reverseBlocks;
+std::vector<gridpack::component::MatVecInterface*> p_forwardComps;
+std::vector<gridpack::component::MatVecInterface*> p_reverseComps;
+std::vector<int>            p_forwardOffsets;
+std::vector<int>            p_reverseOffsets;
+std::vector<int>            p_forwardStart;
+std::vector<int>            p_reverseStart;
+std::vector<int>            p_branchOK;
+
+    // dirty blocks, and the component and offset of each, used by
+    // loadDirtyValues
+std::vector<int>            p_dirtyBlocks;
+std::vector<gridpack::component::MatVecInterface*> p_dirtyComps;
+std::vector<int>            p_dirtyOffsets;
+
+    // storage locations used by overwriteMatrixValues and
+    // incrementMatrixValues
+std::map<gridpack::math::Matrix*, StorageRecord> p_storage;
+std::vector<int>            p_storageIndex;
+
     // pointer to timer
 gridpack::utility::CoarseTimer *p_timer;
 
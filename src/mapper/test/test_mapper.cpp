@@ -696,6 +696,9 @@ void run (const int &me, const int &nprocs)
   if (me == 0) {
     printf("\nTesting FullMatrixMap\n");
   }
+  // Matrices whose storage locations are cached by the mapper are declared
+  // before it, so that they outlive the mapper
+  boost::shared_ptr<gridpack::math::Matrix> M4, M5;
   gridpack::mapper::FullMatrixMap<TestNetwork> mMap(network); 
   boost::shared_ptr<gridpack::math::Matrix> M = mMap.mapToMatrix();
   mMap.mapToMatrix(M);
@@ -766,6 +769,118 @@ void run (const int &me, const int &nprocs)
     }
   }
 
+  if (me == 0) {
+    printf("\nTesting reuse of FullMatrixMap layout\n");
+  }
+  // A second mapper on an unchanged network should reuse the layout
+  // evaluated by the first mapper and produce an identical matrix
+  chk = 0;
+  {
+    gridpack::mapper::FullMatrixMap<TestNetwork> mMap2(network); 
+    if (!mMap2.reusedPlan()) chk = 1;
+    boost::shared_ptr<gridpack::math::Matrix> M2 = mMap2.mapToMatrix();
+    M2->scale(-1.0);
+    M2->add(*M);
+    if (M2->norm2() != 0.0) chk = 1;
+  }
+  GA_Igop(&chk,one,"+");
+  if (me == 0) {
+    if (chk == 0) {
+      printf("\nMatrix layout was reused\n");
+    } else {
+      printf("\nError found reusing matrix layout\n");
+    }
+  }
+
+  if (me == 0) {
+    printf("\nTesting direct overwrite of matrix values\n");
+  }
+  // Overwriting the values of a zeroed matrix directly in matrix storage
+  // should recover the original matrix
+  chk = 0;
+  {
+    boost::shared_ptr<gridpack::math::Matrix> M3 = mMap.mapToMatrix();
+    M3->zero();
+    bool direct = mMap.overwriteMatrixValues(M3);
+    // Second call uses storage locations evaluated by the first call
+    direct = mMap.overwriteMatrixValues(M3) && direct;
+    if (me == 0 && !direct) {
+      printf("\nMatrix values were loaded using fallback\n");
+    }
+    M3->scale(-1.0);
+    M3->add(*M);
+    if (M3->norm2() != 0.0) chk = 1;
+    mMap.forgetMatrix(M3);
+  }
+  GA_Igop(&chk,one,"+");
+  if (me == 0) {
+    if (chk == 0) {
+      printf("\nDirect overwrite of matrix values is ok\n");
+    } else {
+      printf("\nError found in direct overwrite of matrix values\n");
+    }
+  }
+
+  if (me == 0) {
+    printf("\nTesting direct overwrite of re-created matrix\n");
+  }
+  // Destroy a matrix whose storage locations are cached by the mapper and
+  // create a new one, which is likely to have the same address. Stale
+  // locations must not be used to overwrite the new matrix
+  chk = 0;
+  {
+    M5 = mMap.mapToMatrix();
+    mMap.overwriteMatrixValues(M5);
+    M5.reset();
+    M5 = mMap.mapToMatrix();
+    M5->zero();
+    mMap.overwriteMatrixValues(M5);
+    M5->scale(-1.0);
+    M5->add(*M);
+    if (M5->norm2() != 0.0) chk = 1;
+  }
+  GA_Igop(&chk,one,"+");
+  if (me == 0) {
+    if (chk == 0) {
+      printf("\nDirect overwrite of re-created matrix is ok\n");
+    } else {
+      printf("\nError found in direct overwrite of re-created matrix\n");
+    }
+  }
+
+  if (me == 0) {
+    printf("\nTesting overwrite of dirty matrix values\n");
+  }
+  // Nothing should be written if no components are dirty. Marking all
+  // components as dirty should recover the original matrix
+  chk = 0;
+  {
+    M4 = mMap.mapToMatrix();
+    M4->zero();
+    network->clearDirtyComponents();
+    mMap.overwriteDirtyMatrixValues(M4);
+    if (M4->norm2() != 0.0) chk = 1;
+    for (i=0; i<nbus; i++) network->markBusDirty(i);
+    for (i=0; i<nbranch; i++) network->markBranchDirty(i);
+    // Marking a component twice should have no effect
+    if (nbus > 0) network->markBusDirty(0);
+    if (network->dirtyBuses().size() != nbus) chk = 1;
+    mMap.overwriteDirtyMatrixValues(M4);
+    network->clearDirtyComponents();
+    if (network->dirtyBuses().size() != 0) chk = 1;
+    M4->scale(-1.0);
+    M4->add(*M);
+    if (M4->norm2() != 0.0) chk = 1;
+  }
+  GA_Igop(&chk,one,"+");
+  if (me == 0) {
+    if (chk == 0) {
+      printf("\nOverwrite of dirty matrix values is ok\n");
+    } else {
+      printf("\nError found in overwrite of dirty matrix values\n");
+    }
+  }
+
   if (me == 0) {
     printf("\nTesting BusVectorMap\n");
   }
@@ -823,6 +938,34 @@ void run (const int &me, const int &nprocs)
     }
   }
 
+  if (me == 0) {
+    printf("\nTesting mappers with component threads\n");
+  }
+  // Gathering values with several threads should give the same matrix
+  // and vector as the serial gather
+  chk = 0;
+  gridpack::parallel::ComponentThreads::setNumThreads(4);
+  gridpack::parallel::ComponentThreads::setChunkSize(3);
+  {
+    boost::shared_ptr<gridpack::math::Matrix> M4 = mMap.mapToMatrix();
+    M4->scale(-1.0);
+    M4->add(*M);
+    if (M4->norm2() != 0.0) chk = 1;
+    boost::shared_ptr<gridpack::math::Vector> V4 = vMap.mapToVector();
+    V4->scale(-1.0);
+    V4->add(*V);
+    if (V4->norm2() != 0.0) chk = 1;
+  }
+  gridpack::parallel::ComponentThreads::setNumThreads(1);
+  GA_Igop(&chk,one,"+");
+  if (me == 0) {
+    if (chk == 0) {
+      printf("\nThreaded mapping is ok\n");
+    } else {
+      printf("\nError found in threaded mapping\n");
+    }
+  }
+
   if (me == 0) {
     printf("\nTesting mapToBus\n");
   }
@@ -20,6 +20,7 @@
 #ifndef _basic_linear_matrix_solver_implementation_hpp_
 #define _basic_linear_matrix_solver_implementation_hpp_
 
+#include <boost/scoped_ptr.hpp>
 #include "linear_solver.hpp"
 #include "linear_matrix_solver_implementation.hpp"
 
@@ -41,7 +42,7 @@ public:
   /// Default constructor.
   BasicLinearMatrixSolverImplementation(MatrixType& A)
     : LinearMatrixSolverImplementation<T, I>(A),
-      p_solver(A)
+      p_solver(new LinearSolverT<T, I>(A))
   {
   }
 
@@ -53,18 +54,34 @@ public:
 protected:
 
   /// The linear solver instance used for this
-  LinearSolverT<T, I> p_solver;
+  boost::scoped_ptr< LinearSolverT<T, I> > p_solver;
 
   /// Solve w/ the specified RHS Matrix (specialized)
   MatrixType *p_solve(const MatrixType& B) const
   {
-    return p_solver.solve(B);
+    return p_solver->solve(B);
+  }
+
+  /// Use a new coefficient matrix with the same nonzero pattern (specialized)
+  /**
+   * The linear solver is bound to its coefficient matrix, so a new
+   * one is made for the (copied) new matrix
+   * 
+   * @param A new coefficient matrix
+   */
+  void p_refactor(const MatrixType& A)
+  {
+    this->p_A.reset(A.clone());
+    p_solver.reset(new LinearSolverT<T, I>(*(this->p_A)));
+    if (this->isConfigured()) {
+      p_solver->configure(this->p_configCursor);
+    }
   }
 
   /// Specialized way to configure from property tree
   void p_configure(utility::Configuration::CursorPtr props)
   {
-    p_solver.configure(props);
+    p_solver->configure(props);
   }
 
 };
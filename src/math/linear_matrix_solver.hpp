@@ -87,6 +87,12 @@ protected:
     return p_impl->solve(B);
   }
 
+  /// Use a new coefficient matrix with the same nonzero pattern (specialized)
+  void p_refactor(const MatrixType& A)
+  {
+    p_impl->refactor(A);
+  }
+
 };
 
 typedef LinearMatrixSolverT<ComplexType> ComplexLinearMatrixSolver;
@@ -55,11 +55,31 @@ public:
     return this->p_solve(B);
   }
 
+  /// Use a new coefficient matrix with the same nonzero pattern
+  /** 
+   * @e Collective.
+   *
+   * Replace the coefficient matrix with @c A. If @c A has the same
+   * nonzero pattern as the current coefficient matrix, only the
+   * numeric factorization is recomputed; the ordering and symbolic
+   * factorization are reused. Otherwise, @c A is factored from
+   * scratch.
+   * 
+   * @param A new coefficient matrix
+   */
+  void refactor(const MatrixType& A)
+  {
+    this->p_refactor(A);
+  }
+
 protected:
 
   /// Solve w/ the specified RHS Matrix (specialized)
   virtual MatrixType *p_solve(const MatrixType& B) const = 0;
 
+  /// Use a new coefficient matrix with the same nonzero pattern (specialized)
+  virtual void p_refactor(const MatrixType& A) = 0;
+
 };
 
 
@@ -202,6 +202,18 @@ protected:
     return p_solver->solve(B);
   }
 
+  /// Solve several systems w/ the same coefficient matrix (specialized)
+  void p_solve(const std::vector<VectorType *>& b, 
+               const std::vector<VectorType *>& x) const
+  {
+    p_solver->solve(b, x);
+  }
+
+  /// Update the solver after coefficient matrix values have changed (specialized)
+  void p_refactor(void)
+  {
+    p_solver->refactor();
+  }
 
 };
 
@@ -63,7 +63,8 @@ public:
       p_doSerial(false),
       p_constSerialMatrix(),
       p_guessZero(false),
-      p_serialSolution()
+      p_serialSolution(),
+      p_reuseFactor(false)
   {
   }
 
@@ -137,6 +138,16 @@ protected:
   /// A buffer to use for value transfer
   mutable std::vector<TheType> p_valueBuffer;
 
+  /// Keep the factorization until refactor() is called
+  /**
+   * Normally, the underlying library checks whether the coefficient
+   * matrix has changed before each solve and, if so, recomputes the
+   * numeric factorization or preconditioner.  If this flag is true,
+   * the existing factorization is used until refactor() is called.
+   * 
+   */
+  bool p_reuseFactor;
+
   /// Specialized way to configure from property tree
   void p_configure(utility::Configuration::CursorPtr props)
   {
@@ -152,6 +163,8 @@ protected:
       p_doSerial = (p_doSerial && (this->processor_size() > 1));
 
       p_guessZero = props->get("InitialGuessZero", p_guessZero);
+
+      p_reuseFactor = props->get("ReuseFactorization", p_reuseFactor);
     }
   }
 
@@ -185,6 +198,52 @@ protected:
   /// Solve the system again w/ RHS and estimate (implementation)
   virtual void p_resolveImpl(const VectorType& b, VectorType& x) const = 0;
 
+  /// Recompute the factorization of the specified matrix (implementation)
+  virtual void p_refactorImpl(MatrixType& A) = 0;
+
+  /// Solve the specified system w/ each column of @c B a RHS (implementation)
+  /** 
+   * This default solves one column at a time.  An implementation
+   * should override this if the underlying library can apply the
+   * factorization to several RHS in one pass.
+   * 
+   * @param A coefficient matrix
+   * @param B @e dense RHS matrix
+   * @param X @e dense solution matrix, same size as @c B
+   */
+  virtual void p_solveMultipleImpl(MatrixType& A, const MatrixType& B, 
+                                   MatrixType& X) const
+  {
+    VectorType b(B.communicator(), B.localRows());
+    VectorType x(B.communicator(), B.localRows());
+
+    IdxType ilo, ihi;
+    x.localIndexRange(ilo, ihi);
+    int nloc(x.localSize());
+    std::vector<IdxType> iidx;
+    iidx.reserve(nloc);
+    for (IdxType i = ilo; i < ihi; ++i) { iidx.push_back(i); }
+    std::vector<IdxType> jidx(nloc);
+    std::vector<TheType> locX(nloc);
+
+    for (int j = 0; j < B.cols(); ++j) {
+      column(B, j, b);
+      x.zero();
+      x.ready();
+      if (j == 0) {
+        this->p_solveImpl(A, b, x);
+      } else {
+        this->p_resolveImpl(b, x);
+      }
+      std::fill(jidx.begin(), jidx.end(), j);
+      if (nloc > 0) {
+        x.getElements(nloc, &iidx[0], &locX[0]);
+        X.setElements(nloc, &iidx[0], &jidx[0], &locX[0]);
+      }
+    }
+    X.ready();
+  }
+
   /// Gather the RHS and initial estimate vectors
   void p_serialSolvePrep(const VectorType& b, VectorType& x) const
   {
@@ -237,7 +296,7 @@ protected:
 
       if (!p_serialMatrix ) {
           p_serialMatrix.reset(p_matrix.localClone());
-      } else if (!p_constSerialMatrix) {
+      } else if (!p_constSerialMatrix && !p_reuseFactor) {
           p_serialMatrix.reset(p_matrix.localClone());
       }
       
@@ -283,38 +342,116 @@ protected:
     }
   }
 
+  /// Update the solver after coefficient matrix values have changed (specialized)
+  void p_refactor(void)
+  {
+    if (p_doSerial) {
+
+      // the serial matrix is out of date, even if it's constant
+
+      p_serialMatrix.reset(p_matrix.localClone());
+      this->p_refactorImpl(*p_serialMatrix);
+
+    } else {
+
+      this->p_refactorImpl(p_matrix);
+
+    }
+  }
+
   /// Solve multiple systems w/ each column of the Matrix a single RHS
   MatrixType *p_solve(const MatrixType& B) const
   {
-    VectorType b(B.communicator(), B.localRows());
-    VectorType X(B.communicator(), B.localRows());
     MatrixType *result(new MatrixType(B.communicator(), B.localRows(), B.localCols(), Dense));
 
-    int ilo, ihi;
-    X.localIndexRange(ilo, ihi);
-    int nloc(X.localSize());
+    if (p_doSerial) {
+
+      // the serial solve is done one column at a time
+
+      VectorType b(B.communicator(), B.localRows());
+      VectorType X(B.communicator(), B.localRows());
+
+      int ilo, ihi;
+      X.localIndexRange(ilo, ihi);
+      int nloc(X.localSize());
+      std::vector<IdxType> iidx;
+      iidx.reserve(nloc);
+      for (IdxType i = ilo; i < ihi; ++i) { iidx.push_back(i); }
+      std::vector<IdxType> jidx(nloc);
+      std::vector<TheType> locX(nloc);
+
+      for (int j = 0; j < B.cols(); ++j) {
+        column(B, j, b);
+        X.zero();
+        X.ready();
+        if (j == 0) {
+          this->solve(b, X);
+        } else {
+          this->resolve(b, X);
+        }
+        std::fill(jidx.begin(), jidx.end(), j);
+        X.getElements(nloc, &iidx[0], &locX[0]);
+        result->setElements(nloc, &iidx[0], &jidx[0], &locX[0]);
+      }
+      result->ready();
+
+    } else {
+
+      this->p_solveMultipleImpl(p_matrix, B, *result);
+
+    }
+    return result;
+  }
+
+  /// Solve several systems w/ the same coefficient matrix (specialized)
+  void p_solve(const std::vector<VectorType *>& b, 
+               const std::vector<VectorType *>& x) const
+  {
+    if (b.size() != x.size()) {
+      throw Exception("LinearSolver::solve: RHS and solution blocks differ in size");
+    }
+    if (b.empty()) return;
+
+    int nrhs(b.size());
+    if (p_doSerial || nrhs == 1) {
+      for (int j = 0; j < nrhs; ++j) {
+        x[j]->zero();
+        x[j]->ready();
+        this->solve(*b[j], *x[j]);
+      }
+      return;
+    }
+
+    // pack the RHS vectors into the columns of a dense matrix; all
+    // columns are assigned to the first process
+
+    const parallel::Communicator& comm(b[0]->communicator());
+    int nloc(b[0]->localSize());
+    int ncol(comm.rank() == 0 ? nrhs : 0);
+    MatrixType B(comm, nloc, ncol, Dense);
+    MatrixType X(comm, nloc, ncol, Dense);
+
+    IdxType ilo, ihi;
+    b[0]->localIndexRange(ilo, ihi);
     std::vector<IdxType> iidx;
     iidx.reserve(nloc);
     for (IdxType i = ilo; i < ihi; ++i) { iidx.push_back(i); }
     std::vector<IdxType> jidx(nloc);
-    std::vector<TheType> locX(nloc);
-
-    for (int j = 0; j < B.cols(); ++j) {
-      column(B, j, b);
-      X.zero();
-      X.ready();
-      if (j == 0) {
-        this->solve(b, X);
-      } else {
-        this->resolve(b, X);
+    std::vector<TheType> locB(nloc);
+    for (int j = 0; j < nrhs; ++j) {
+      if (nloc > 0) {
+        b[j]->getElementRange(ilo, ihi, &locB[0]);
+        std::fill(jidx.begin(), jidx.end(), j);
+        B.setElements(nloc, &iidx[0], &jidx[0], &locB[0]);
       }
-      std::fill(jidx.begin(), jidx.end(), j);
-      X.getElements(nloc, &iidx[0], &locX[0]);
-      result->setElements(nloc, &iidx[0], &jidx[0], &locX[0]);
     }
-  
-    result->ready();
-    return result;
+    B.ready();
+
+    this->p_solveMultipleImpl(p_matrix, B, X);
+
+    for (int j = 0; j < nrhs; ++j) {
+      column(X, j, *x[j]);
+    }
   }
 
 };
@@ -22,6 +22,7 @@
 #ifndef _linear_solver_interface_hpp_
 #define _linear_solver_interface_hpp_
 
+#include <vector>
 #include "gridpack/math/matrix.hpp"
 
 namespace gridpack {
@@ -156,6 +157,46 @@ public:
     return this->p_solve(B);
   }
 
+  /// Solve several systems w/ the same coefficient matrix
+  /** 
+   * @e Collective.
+   *
+   * Each Vector in @c b is a separate RHS. The corresponding solution
+   * is put in the same position in @c x. All RHS are solved
+   * together, so the factorization (or preconditioner) is applied to
+   * the whole block at once, if the underlying library can do that.
+   * Any initial solution estimate in @c x is ignored.
+   *
+   * All Vectors must meet the requirements of solve(). @c b and @c x
+   * must be the same length.
+   * 
+   * @param b Vectors containing right hand sides of linear systems
+   * @param x solution Vectors
+   */
+  void solve(const std::vector<VectorType *>& b, 
+             const std::vector<VectorType *>& x) const
+  {
+    this->p_solve(b, x);
+  }
+
+  /// Update the solver after coefficient matrix values have changed
+  /** 
+   * @e Collective.
+   *
+   * Recompute the numeric factorization (or preconditioner) for the
+   * coefficient matrix used for construction. The nonzero pattern of
+   * the coefficient matrix must not have changed, so any symbolic
+   * factorization and ordering is reused. This is required before
+   * solve() if the solver is configured to reuse its factorization
+   * ("ReuseFactorization"), otherwise changes are picked up
+   * automatically.
+   * 
+   */
+  void refactor(void)
+  {
+    this->p_refactor();
+  }
+
 
 protected:
 
@@ -195,6 +236,13 @@ protected:
   /// Solve multiple systems w/ each column of the Matrix a single RHS
   virtual MatrixType *p_solve(const MatrixType& B) const = 0;
 
+  /// Solve several systems w/ the same coefficient matrix
+  virtual void p_solve(const std::vector<VectorType *>& b, 
+                       const std::vector<VectorType *>& x) const = 0;
+
+  /// Update the solver after coefficient matrix values have changed (specialized)
+  virtual void p_refactor(void) = 0;
+
 };
 
 
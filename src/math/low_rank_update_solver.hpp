@@ -0,0 +1,343 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+// -------------------------------------------------------------
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   low_rank_update_solver.hpp
+ *
+ * @brief Solve a linear system after a low rank change to an already
+ * factored coefficient matrix
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _low_rank_update_solver_hpp_
+#define _low_rank_update_solver_hpp_
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <gridpack/utilities/uncopyable.hpp>
+#include <gridpack/utilities/exception.hpp>
+#include <gridpack/math/linear_solver.hpp>
+
+namespace gridpack {
+namespace math {
+
+// -------------------------------------------------------------
+//  class LowRankUpdateSolverT
+// -------------------------------------------------------------
+/// Solve a linear system with a modified coefficient matrix
+/**
+ * This solves \f$(\mathbf{A}_0 + \Delta\mathbf{A})\mathbf{x} =
+ * \mathbf{b}\f$, using an existing LinearSolver for
+ * \f$\mathbf{A}_0\f$, without refactoring the modified matrix.  If
+ * \f$\Delta\mathbf{A}\f$ is nonzero in only \f$k\f$ rows it can be
+ * written as \f$\mathbf{U}\mathbf{R}\f$, where \f$\mathbf{U}\f$ is
+ * made of the \f$k\f$ unit vectors selecting those rows and
+ * \f$\mathbf{R}\f$ holds the rows themselves.  The
+ * Sherman-Morrison-Woodbury formula then gives
+ *
+ * \f[
+ * \mathbf{x} = \mathbf{y} - \mathbf{Z}(\mathbf{I} + \mathbf{R}\mathbf{Z})^{-1}\mathbf{R}\mathbf{y}
+ * \f]
+ *
+ * with \f$\mathbf{y} = \mathbf{A}_0^{-1}\mathbf{b}\f$ and
+ * \f$\mathbf{Z} = \mathbf{A}_0^{-1}\mathbf{U}\f$. The \f$k\f$ columns
+ * of \f$\mathbf{Z}\f$ are computed once by update(), in a single
+ * multiple right hand side solve with the existing solver. Each solve()
+ * then needs one solve with \f$\mathbf{A}_0\f$ and a dense \f$k
+ * \times k\f$ solve, which is replicated on all processes.
+ *
+ * This is only worthwhile if \f$k\f$ is small, like the change in a
+ * network Jacobian or admittance matrix caused by a single branch or
+ * generator outage.
+ */
+template <typename T, typename I = int>
+class LowRankUpdateSolverT
+  : private utility::Uncopyable
+{
+public:
+
+  typedef T TheType;
+  typedef I IdxType;
+  typedef MatrixT<T, I> MatrixType;
+  typedef VectorT<T, I> VectorType;
+  typedef LinearSolverT<T, I> SolverType;
+
+  /// Default constructor.
+  /**
+   * @e Collective.
+   *
+   * The coefficient matrix used by @c solver and @c solver itself
+   * must exist for the life of this instance.  @c solver should be
+   * set up so that repeated solves do not refactor the coefficient
+   * matrix (e.g., a direct solver).
+   *
+   * @param solver existing solver for the unmodified coefficient matrix
+   */
+  LowRankUpdateSolverT(SolverType& solver)
+    : p_solver(solver), p_rank(0)
+  {}
+
+  /// Destructor
+  ~LowRankUpdateSolverT(void)
+  {}
+
+  /// Set the change in the coefficient matrix
+  /**
+   * @e Collective.
+   *
+   * @c dA must have the same size and distribution as the
+   * coefficient matrix. If @c dA has more than @c maxRank nonzero
+   * rows, or the nonzero rows cannot be found, nothing is changed
+   * and @c false is returned. The caller should then factor the
+   * modified matrix directly. If the modified matrix is singular an
+   * Exception is thrown and the change is forgotten.
+   *
+   * @param dA change in the coefficient matrix
+   * @param maxRank largest number of nonzero rows allowed in @c dA
+   *
+   * @return true if the update can be used by solve()
+   */
+  bool update(const MatrixType& dA, const int& maxRank)
+  {
+    const parallel::Communicator& comm(dA.communicator());
+    int nprocs(comm.size());
+    int me(comm.rank());
+
+    // find all nonzero rows in dA, everywhere
+    std::vector<IdxType> lrows;
+    int ok(dA.nonzeroRows(lrows) ? 1 : 0);
+    comm.min(&ok, 1);
+    if (!ok) return false;
+
+    std::vector<int> counts(nprocs, 0);
+    counts[me] = lrows.size();
+    comm.sum(&counts[0], nprocs);
+    int k(0), offset(0);
+    for (int p = 0; p < nprocs; ++p) {
+      if (p < me) offset += counts[p];
+      k += counts[p];
+    }
+    if (k > maxRank) return false;
+
+    std::vector<int> rows(k, 0);
+    for (int i = 0; i < static_cast<int>(lrows.size()); ++i) {
+      rows[offset + i] = lrows[i];
+    }
+    if (k > 0) comm.sum(&rows[0], k);
+
+    p_rank = k;
+    p_rows.assign(rows.begin(), rows.end());
+    p_Z.clear();
+    p_R.clear();
+    p_S.clear();
+    p_pivot.clear();
+    if (k == 0) return true;
+
+    // the k rows of dA, replicated on all processes
+    IdxType ncols(dA.cols());
+    p_R.resize(k*ncols);
+    dA.getRowBlock(k, &p_rows[0], &p_R[0]);
+
+    // Z = inv(A0)*U, with all k columns solved together as a block
+    IdxType lo, hi;
+    dA.localRowRange(lo, hi);
+    std::vector< boost::shared_ptr<VectorType> > units;
+    std::vector<VectorType *> eb, zb;
+    for (int j = 0; j < k; ++j) {
+      boost::shared_ptr<VectorType> e(new VectorType(comm, dA.localRows()));
+      e->zero();
+      if (p_rows[j] >= lo && p_rows[j] < hi) {
+        e->setElement(p_rows[j], 1.0);
+      }
+      e->ready();
+      boost::shared_ptr<VectorType> z(e->clone());
+      z->zero();
+      units.push_back(e);
+      p_Z.push_back(z);
+      eb.push_back(e.get());
+      zb.push_back(z.get());
+    }
+    p_solver.solve(eb, zb);
+
+    // S = I + R*Z, which is small and replicated
+    p_S.resize(k*k);
+    std::vector<TheType> zloc(hi - lo);
+    for (int j = 0; j < k; ++j) {
+      if (hi > lo) p_Z[j]->getElementRange(lo, hi, &zloc[0]);
+      for (int i = 0; i < k; ++i) {
+        TheType s(0.0);
+        const TheType *r(&p_R[i*ncols]);
+        for (IdxType l = lo; l < hi; ++l) {
+          s += r[l]*zloc[l - lo];
+        }
+        p_S[i*k + j] = s;
+      }
+    }
+    comm.sum(&p_S[0], k*k);
+    for (int i = 0; i < k; ++i) {
+      p_S[i*k + i] += 1.0;
+    }
+    try {
+      p_factorSmall();
+    } catch (const Exception& e) {
+      clear();
+      throw;
+    }
+    return true;
+  }
+
+  /// Forget any change in the coefficient matrix
+  void clear(void)
+  {
+    p_rank = 0;
+    p_rows.clear();
+    p_Z.clear();
+    p_R.clear();
+    p_S.clear();
+    p_pivot.clear();
+  }
+
+  /// Get the rank of the current change in the coefficient matrix
+  int rank(void) const
+  {
+    return p_rank;
+  }
+
+  /// Solve the modified system w/ the specified RHS
+  /**
+   * @e Collective.
+   *
+   * If update() has not been called, or clear() has been called
+   * since, this is the same as a solve with the original coefficient
+   * matrix.
+   *
+   * @param b Vector containing right hand side of linear system
+   * @param x solution Vector
+   */
+  void solve(const VectorType& b, VectorType& x) const
+  {
+    p_solver.solve(b, x);
+    if (p_rank == 0) return;
+
+    int k(p_rank);
+    IdxType ncols(b.size());
+    IdxType lo, hi;
+    x.localIndexRange(lo, hi);
+    std::vector<TheType> yloc(hi - lo);
+    if (hi > lo) x.getElementRange(lo, hi, &yloc[0]);
+
+    // c = inv(S)*R*y
+    std::vector<TheType> c(k);
+    for (int i = 0; i < k; ++i) {
+      TheType s(0.0);
+      const TheType *r(&p_R[i*ncols]);
+      for (IdxType l = lo; l < hi; ++l) {
+        s += r[l]*yloc[l - lo];
+      }
+      c[i] = s;
+    }
+    x.communicator().sum(&c[0], k);
+    p_solveSmall(c);
+
+    // x = y - Z*c
+    for (int j = 0; j < k; ++j) {
+      x.add(*p_Z[j], -c[j]);
+    }
+    x.ready();
+  }
+
+protected:
+
+  /// Solver for the unmodified coefficient matrix
+  SolverType& p_solver;
+
+  /// Number of rows changed
+  int p_rank;
+
+  /// Global indexes of the changed rows
+  std::vector<IdxType> p_rows;
+
+  /// Changed rows, dense and replicated (rank x columns)
+  std::vector<TheType> p_R;
+
+  /// Columns of inv(A0)*U
+  std::vector< boost::shared_ptr<VectorType> > p_Z;
+
+  /// LU factors of I + R*Z (rank x rank)
+  std::vector<TheType> p_S;
+
+  /// Row pivots of the factored I + R*Z
+  std::vector<int> p_pivot;
+
+  /// Factor the small dense matrix in place with partial pivoting
+  /**
+   * The matrix is treated as singular if a pivot is tiny compared to
+   * its largest entry (or the identity it was built from). Z comes
+   * from a solver that may be iterative, so an exactly singular
+   * update, like an outage that islands part of the network, only
+   * gives a pivot near round-off of the solver tolerance.
+   */
+  void p_factorSmall(void)
+  {
+    int k(p_rank);
+    p_pivot.resize(k);
+    double scale(1.0);
+    for (int i = 0; i < k*k; ++i) {
+      scale = std::max(scale, static_cast<double>(std::abs(p_S[i])));
+    }
+    for (int j = 0; j < k; ++j) {
+      int pr(j);
+      for (int i = j + 1; i < k; ++i) {
+        if (std::abs(p_S[i*k + j]) > std::abs(p_S[pr*k + j])) pr = i;
+      }
+      p_pivot[j] = pr;
+      if (std::abs(p_S[pr*k + j]) <= 1.0e-8*scale) {
+        throw Exception("LowRankUpdateSolver: updated matrix is singular");
+      }
+      if (pr != j) {
+        for (int l = 0; l < k; ++l) std::swap(p_S[j*k + l], p_S[pr*k + l]);
+      }
+      for (int i = j + 1; i < k; ++i) {
+        TheType f(p_S[i*k + j]/p_S[j*k + j]);
+        p_S[i*k + j] = f;
+        for (int l = j + 1; l < k; ++l) p_S[i*k + l] -= f*p_S[j*k + l];
+      }
+    }
+  }
+
+  /// Solve with the factored small dense matrix in place
+  void p_solveSmall(std::vector<TheType>& c) const
+  {
+    int k(p_rank);
+    for (int j = 0; j < k; ++j) {
+      if (p_pivot[j] != j) std::swap(c[j], c[p_pivot[j]]);
+    }
+    for (int i = 1; i < k; ++i) {
+      for (int l = 0; l < i; ++l) c[i] -= p_S[i*k + l]*c[l];
+    }
+    for (int i = k - 1; i >= 0; --i) {
+      for (int l = i + 1; l < k; ++l) c[i] -= p_S[i*k + l]*c[l];
+      c[i] /= p_S[i*k + i];
+    }
+  }
+
+};
+
+typedef LowRankUpdateSolverT<ComplexType> ComplexLowRankUpdateSolver;
+typedef LowRankUpdateSolverT<RealType> RealLowRankUpdateSolver;
+
+typedef ComplexLowRankUpdateSolver LowRankUpdateSolver;
+
+} // namespace math
+} // namespace gridpack
+
+#endif
@@ -366,6 +366,32 @@ protected:
     p_matrix_impl->getRow(row, x);
   }
 
+  /// Find the local storage locations of several elements (specialized)
+  bool p_storageLocations(const IdxType& n, const IdxType *i, 
+                          const IdxType *j, IdxType *loc) const
+  {
+    return p_matrix_impl->storageLocations(n, i, j, loc);
+  }
+
+  /// Set or add several elements using storage locations (specialized)
+  bool p_setStorageValues(const IdxType& n, const IdxType *loc, 
+                          const TheType *x, const bool& add)
+  {
+    return p_matrix_impl->setStorageValues(n, loc, x, add);
+  }
+
+  /// Get the number of values in local storage (specialized)
+  IdxType p_storageSize(void) const
+  {
+    return p_matrix_impl->storageSize();
+  }
+
+  /// Find the locally owned rows that contain nonzero values (specialized)
+  bool p_nonzeroRows(std::vector<IdxType>& rows) const
+  {
+    return p_matrix_impl->nonzeroRows(rows);
+  }
+
   /// Get some rows and put them in a local array (specialized)
   void p_getRowBlock(const IdxType& nrow, const IdxType *rows, TheType *x) const
   {
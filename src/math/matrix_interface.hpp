@@ -25,6 +25,7 @@
 #ifndef _matrix_interface_hpp_
 #define _matrix_interface_hpp_
 
+#include <vector>
 #include "gridpack/math/implementation_visitable.hpp"
 
 namespace gridpack {
@@ -45,7 +46,7 @@ public:
 
   /// Default constructor.
   BaseMatrixInterface(void)
-    : ImplementationVisitable()
+    : ImplementationVisitable(), p_instanceId(p_nextInstanceId())
   {}
 
   /// Destructor
@@ -171,6 +172,105 @@ public:
     this->p_addElements(n, i, j, x);
   }
 
+  /// Find the local storage locations of several elements
+  /** 
+   * @e Local.
+   *
+   * Some implementations store local rows in a compressed format
+   * whose value array can be written directly once the nonzero
+   * pattern is fixed.  This finds the position in that storage of
+   * each specified element.  All elements must be in locally owned
+   * rows and already be part of the assembled nonzero pattern.  If
+   * the implementation does not support direct storage access, or
+   * any element cannot be found, @c false is returned and the
+   * contents of @c loc are undefined.
+   * 
+   * @param n number of elements to locate
+   * @param i array of @c n global, 0-based row indexes
+   * @param j array of @c n global, 0-based column indexes
+   * @param loc array of @c n storage locations 
+   * 
+   * @return true if all elements were located
+   */
+  bool storageLocations(const IdxType& n, const IdxType *i, const IdxType *j,
+                        IdxType *loc) const
+  {
+    return this->p_storageLocations(n, i, j, loc);
+  }
+
+  /// Set or add several elements using storage locations
+  /** 
+   * @e Local.
+   *
+   * Values are written directly to the local storage at locations
+   * obtained from storageLocations().  No assembly is required, or
+   * done, after this call. The nonzero pattern of the matrix must not
+   * have changed since the locations were obtained.
+   * 
+   * @param n number of elements to update
+   * @param loc array of @c n storage locations from storageLocations()
+   * @param x array of @c n values 
+   * @param add if true, values are added to existing elements,
+   * otherwise existing elements are overwritten
+   * 
+   * @return true if the values were placed in the matrix
+   */
+  bool setStorageValues(const IdxType& n, const IdxType *loc, const TheType *x,
+                        const bool& add = false)
+  {
+    return this->p_setStorageValues(n, loc, x, add);
+  }
+
+  /// Get the number of values in local storage
+  /** 
+   * @e Local.
+   *
+   * This is the number of locally stored elements in the nonzero
+   * pattern. It can be compared with an earlier value to check that
+   * locations from storageLocations() are still valid.
+   * 
+   * @return number of locally stored values, or -1 if the
+   * implementation does not support direct storage access
+   */
+  IdxType storageSize(void) const
+  {
+    return this->p_storageSize();
+  }
+
+  /// Get a number that identifies this instance
+  /** 
+   * @e Local.
+   *
+   * Each instance gets a different number when it is created, so
+   * information cached for a matrix can be recognized as stale if
+   * the matrix is destroyed and another one is created at the same
+   * address.
+   * 
+   * @return instance number
+   */
+  long instanceId(void) const
+  {
+    return p_instanceId;
+  }
+
+  /// Find the locally owned rows that contain nonzero values
+  /** 
+   * @e Local.
+   *
+   * Rows that are in the nonzero pattern but only contain explicit
+   * zeros are not included.  If the implementation does not support
+   * this, @c false is returned and @c rows is empty.
+   * 
+   * @param rows ascending global, 0-based indexes of the local rows
+   * with at least one nonzero value
+   * 
+   * @return true if the rows could be found
+   */
+  bool nonzeroRows(std::vector<IdxType>& rows) const
+  {
+    return this->p_nonzeroRows(rows);
+  }
+
   /// Get an individual element
   /** 
    * @c Local.
@@ -434,6 +534,33 @@ protected:
   /// Get some rows and put them in a local array (specialized)
   virtual void p_getRowBlock(const IdxType& nrow, const IdxType *rows, TheType *x) const = 0;
 
+  /// Find the local storage locations of several elements (specialized)
+  virtual bool p_storageLocations(const IdxType& n, const IdxType *i, 
+                                  const IdxType *j, IdxType *loc) const
+  {
+    return false;
+  }
+
+  /// Set or add several elements using storage locations (specialized)
+  virtual bool p_setStorageValues(const IdxType& n, const IdxType *loc, 
+                                  const TheType *x, const bool& add)
+  {
+    return false;
+  }
+
+  /// Get the number of values in local storage (specialized)
+  virtual IdxType p_storageSize(void) const
+  {
+    return -1;
+  }
+
+  /// Find the locally owned rows that contain nonzero values (specialized)
+  virtual bool p_nonzeroRows(std::vector<IdxType>& rows) const
+  {
+    rows.clear();
+    return false;
+  }
+
 
   /// Replace all elements with their real parts (specialized)
   virtual void p_real(void) = 0;
@@ -464,6 +591,18 @@ protected:
 
   /// Save to named file in whatever binary format the math library uses
   virtual void p_saveBinary(const char *filename) const = 0;
+
+private:
+
+  /// Number that identifies this instance
+  long p_instanceId;
+
+  /// Get the next instance number
+  static long p_nextInstanceId(void)
+  {
+    static long next(0);
+    return ++next;
+  }
 };
 
 
@@ -23,6 +23,8 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <algorithm>
 #include <petscconf.h>
 #include <petscmat.h>
 #include "linear_matrix_solver_implementation.hpp"
@@ -222,6 +224,82 @@ protected:
     this->build(props);
   }
 
+  /// Do two matrices have the same nonzero pattern?
+  /**
+   * @e Collective.
+   *
+   * Compares the column indices of each locally owned row.
+   * 
+   * @param A first matrix
+   * @param B second matrix
+   * 
+   * @return true if patterns are the same on all processes
+   */
+  bool p_samePattern(const Mat& A, const Mat& B) const
+  {
+    PetscErrorCode ierr(0);
+    bool same(true);
+    try {
+      PetscInt alo, ahi, blo, bhi;
+      ierr = MatGetOwnershipRange(A, &alo, &ahi); CHKERRXX(ierr);
+      ierr = MatGetOwnershipRange(B, &blo, &bhi); CHKERRXX(ierr);
+      same = (alo == blo && ahi == bhi);
+      for (PetscInt i = alo; same && i < ahi; ++i) {
+        PetscInt na, nb;
+        const PetscInt *acols, *bcols;
+        ierr = MatGetRow(A, i, &na, &acols, NULL); CHKERRXX(ierr);
+        ierr = MatGetRow(B, i, &nb, &bcols, NULL); CHKERRXX(ierr);
+        same = (na == nb && std::equal(acols, acols + na, bcols));
+        ierr = MatRestoreRow(B, i, &nb, &bcols, NULL); CHKERRXX(ierr);
+        ierr = MatRestoreRow(A, i, &na, &acols, NULL); CHKERRXX(ierr);
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return this->communicator().all(same);
+  }
+
+  /// Use a new coefficient matrix with the same nonzero pattern (specialized)
+  /**
+   * The new matrix is copied. If the coefficient matrix has already
+   * been factored and the nonzero pattern is unchanged, only the
+   * numeric factorization is redone, reusing the ordering and
+   * symbolic factorization. Otherwise, factorization is done from
+   * scratch at the next solve.
+   * 
+   * @param A new coefficient matrix
+   */
+  void p_refactor(const MatrixType& A)
+  {
+    PetscErrorCode ierr(0);
+    boost::scoped_ptr<MatrixType>& 
+      Aold(LinearMatrixSolverImplementation<T, I>::p_A);
+    const Mat *Anew(PETScMatrix(A));
+    bool same(false);
+
+    if (p_factored) {
+      same = p_samePattern(*PETScMatrix(*Aold), *Anew);
+    }
+
+    Aold.reset(A.clone());
+
+    try {
+      if (same) {
+        Mat *Amat(PETScMatrix(*Aold));
+        MatFactorInfo info;
+        ierr = MatFactorInfoInitialize(&info); CHKERRXX(ierr);
+        info.fill = p_fill;
+        info.dtcol = (p_pivot ? 1 : 0);
+        ierr = MatLUFactorNumeric(p_Fmat, *Amat, &info); CHKERRXX(ierr);
+      } else if (p_factored) {
+        ierr = MatDestroy(&p_Fmat); CHKERRXX(ierr);
+        p_factored = false;
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+  }
+
   /// Factor the coefficient matrix
   void p_factor(void) const
   {
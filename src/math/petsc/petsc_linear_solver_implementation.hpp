@@ -21,6 +21,7 @@
 #define _petsc_linear_solver_implementation_hpp_
 
 #include <boost/format.hpp>
+#include <boost/scoped_ptr.hpp>
 
 #include <petscksp.h>
 #include "petsc/petsc_exception.hpp"
@@ -102,6 +103,11 @@ protected:
                               LinearSolverImplementation<T, I>::p_maxIterations); CHKERRXX(ierr);
 
       ierr = KSPSetFromOptions(p_KSP);CHKERRXX(ierr);
+#if !PETSC_VERSION_LT(3,5,0)
+      if (this->p_reuseFactor) {
+        ierr = KSPSetReusePreconditioner(p_KSP, PETSC_TRUE); CHKERRXX(ierr);
+      }
+#endif
     } catch (const PETSC_EXCEPTION_TYPE& e) {
       throw PETScException(ierr, e);
     }
@@ -109,6 +115,13 @@ protected:
 
   /// Solve w/ the specified RHS and estimate (result in x)
   void p_solveImpl(MatrixType& A, const VectorType& b, VectorType& x) const
+  {
+    this->p_setOperators(A);
+    this->p_resolveImpl(b, x);
+  }
+
+  /// Give the coefficient matrix to the KSP, if necessary
+  void p_setOperators(MatrixType& A) const
   {
     PetscErrorCode ierr(0);
     try {
@@ -116,6 +129,8 @@ protected:
 
       if (p_matrixSet && this->p_constSerialMatrix) {
         // KSPSetOperators can be skipped
+      } else if (p_matrixSet && this->p_reuseFactor) {
+        // factorization is only updated by refactor()
       } else {
 #if PETSC_VERSION_LT(3,5,0)
         ierr = KSPSetOperators(p_KSP, *Amat, *Amat, SAME_NONZERO_PATTERN); CHKERRXX(ierr);
@@ -124,13 +139,81 @@ protected:
 #endif
         p_matrixSet = true;
       }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+  }
+
+  /// Solve the specified system w/ each column of @c B a RHS (specialized)
+  /**
+   * KSPMatSolve() lets a direct solver do the triangular solves for
+   * all columns in one pass (MatMatSolve()) and iterative solvers use
+   * a block method, if one is configured.
+   */
+  void p_solveMultipleImpl(MatrixType& A, const MatrixType& B, 
+                           MatrixType& X) const
+  {
+#if PETSC_VERSION_LT(3,14,0)
+    LinearSolverImplementation<T, I>::p_solveMultipleImpl(A, B, X);
+#else
+    this->p_setOperators(A);
 
-      this->p_resolveImpl(b, x);
-          
+    // KSPMatSolve() requires dense RHS and solution matrices
+    boost::scoped_ptr<MatrixType> Bdense;
+    const MatrixType *Bp(&B);
+    if (B.storageType() != Dense) {
+      Bdense.reset(storageType(B, Dense));
+      Bp = Bdense.get();
+    }
+    X.ready();
+
+    PetscErrorCode ierr(0);
+    int me(this->processor_rank());
+    try {
+      const Mat *Bmat(PETScMatrix(*Bp));
+      Mat *Xmat(PETScMatrix(X));
+      ierr = KSPMatSolve(p_KSP, *Bmat, *Xmat); CHKERRXX(ierr);
+      KSPConvergedReason reason;
+      ierr = KSPGetConvergedReason(p_KSP, &reason); CHKERRXX(ierr);
+      if (reason < 0) {
+        std::string msg = 
+          boost::str(boost::format("%d: PETSc KSP block solve diverged, reason: %d") % 
+                     me % reason);
+        throw Exception(msg);
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+#endif
+  }
+
+  /// Recompute the factorization of the specified matrix
+  /**
+   * The nonzero pattern of @c A has not changed, so PETSc will only
+   * redo the numeric part of a direct factorization
+   * 
+   * @param A coefficient matrix, with new values
+   */
+  void p_refactorImpl(MatrixType& A)
+  {
+    PetscErrorCode ierr(0);
+    try {
+      Mat *Amat(PETScMatrix(A));
+#if PETSC_VERSION_LT(3,5,0)
+      ierr = KSPSetOperators(p_KSP, *Amat, *Amat, SAME_NONZERO_PATTERN); CHKERRXX(ierr);
+#else
+      ierr = KSPSetReusePreconditioner(p_KSP, PETSC_FALSE); CHKERRXX(ierr);
+      ierr = KSPSetOperators(p_KSP, *Amat, *Amat); CHKERRXX(ierr);
+#endif
+      ierr = KSPSetUp(p_KSP); CHKERRXX(ierr);
+#if !PETSC_VERSION_LT(3,5,0)
+      if (this->p_reuseFactor) {
+        ierr = KSPSetReusePreconditioner(p_KSP, PETSC_TRUE); CHKERRXX(ierr);
+      }
+#endif
+      p_matrixSet = true;
     } catch (const PETSC_EXCEPTION_TYPE& e) {
       throw PETScException(ierr, e);
-    } catch (const Exception& e) {
-      throw e;
     }
   }
 
@@ -20,6 +20,8 @@
 #ifndef _petsc_matrix_implementation_h_
 #define _petsc_matrix_implementation_h_
 
+#include <algorithm>
+#include <vector>
 #include <petscmat.h>
 #include <boost/scoped_ptr.hpp>
 #include <boost/format.hpp>
@@ -362,13 +364,85 @@ protected:
     p_setElement(i, j, x, INSERT_VALUES);
   }
 
+  /// Orders element indices by row
+  struct RowOrder {
+    const IdxType *rows;
+    bool operator()(const IdxType& a, const IdxType& b) const
+    {
+      return rows[a] < rows[b];
+    }
+  };
+
+  /// Set or add several elements
+  /**
+   * Elements are grouped by row and each row is passed to the library
+   * in a single call. Elements of the same row keep their order, so
+   * repeated elements are treated as if they were set one at a time.
+   */
+  void p_setElements(const IdxType& n, const IdxType *i, const IdxType *j, 
+                     const TheType *x, InsertMode mode)
+  {
+    if (n <= 0) return;
+    std::vector<IdxType> order(n);
+    for (IdxType k = 0; k < n; k++) order[k] = k;
+    bool sorted(true);
+    for (IdxType k = 1; k < n && sorted; k++) sorted = (i[k-1] <= i[k]);
+    if (!sorted) {
+      RowOrder cmp;
+      cmp.rows = i;
+      std::stable_sort(order.begin(), order.end(), cmp);
+    }
+
+    PetscErrorCode ierr(0);
+    try {
+      Mat *mat = p_mwrap->getMatrix();
+      std::vector<PetscInt> iidx(elementSize), jidx;
+      std::vector<PetscScalar> px;
+      PetscScalar bx[elementSize*elementSize];
+      IdxType first(0);
+      while (first < n) {
+        IdxType row(i[order[first]]);
+        IdxType last(first+1);
+        while (last < n && i[order[last]] == row) last++;
+        int ncols((last - first)*elementSize);
+        jidx.resize(ncols);
+        px.resize(elementSize*ncols);
+        for (IdxType k = first; k < last; k++) {
+          IdxType e(order[k]);
+          int c((k - first)*elementSize);
+          if (elementSize == 1) {
+            jidx[c] = j[e];
+            px[c] = gridpack::math::equate<PetscScalar, TheType>(x[e]);
+            continue;
+          }
+          TheType tmp(x[e]);
+          MatrixValueTransferToLibrary<TheType, PetscScalar> trans(1, &tmp, &bx[0]);
+          trans.go();
+          for (int jj = 0; jj < elementSize; ++jj) {
+            jidx[c + jj] = j[e]*elementSize + jj;
+          }
+          for (int ii = 0; ii < elementSize; ++ii) {
+            for (int jj = 0; jj < elementSize; ++jj) {
+              px[ii*ncols + c + jj] = bx[ii*elementSize + jj];
+            }
+          }
+        }
+        for (int ii = 0; ii < elementSize; ++ii) {
+          iidx[ii] = row*elementSize + ii;
+        }
+        ierr = MatSetValues(*mat, elementSize, &iidx[0], ncols, &jidx[0],
+                            &px[0], mode); CHKERRXX(ierr);
+        first = last;
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+  }
+
   /// Set an several element
   void p_setElements(const IdxType& n, const IdxType *i, const IdxType *j, const TheType *x)
   {
-    // FIXME: There's probably a better way
-    for (IdxType k = 0; k < n; k++) {
-      this->p_setElement(i[k], j[k], x[k]);
-    }
+    p_setElements(n, i, j, x, INSERT_VALUES);
   }
 
   /// Add to  an individual element
@@ -380,10 +454,7 @@ protected:
   /// Add to  an several element
   void p_addElements(const IdxType& n, const IdxType *i, const IdxType *j, const TheType *x)
   {
-    // FIXME: There's probably a better way
-    for (IdxType k = 0; k < n; k++) {
-      this->p_addElement(i[k], j[k], x[k]);
-    }
+    p_setElements(n, i, j, x, ADD_VALUES);
   }
 
   /// Get an individual element
@@ -418,6 +489,227 @@ protected:
     }
   }
 
+
+  /// Get the local (sequential) AIJ blocks of the matrix, if possible
+  /** 
+   * For a sequential AIJ matrix, the matrix itself is the diagonal
+   * block and there is no off-diagonal block.  For a parallel AIJ
+   * matrix, the diagonal and off-diagonal blocks are returned along
+   * with the map from off-diagonal block column to global column.
+   * 
+   * @param Ad diagonal block
+   * @param Ao off-diagonal block, or NULL if there is none
+   * @param colmap map from @c Ao column to global column
+   * 
+   * @return false if the matrix is not assembled or is not AIJ 
+   */
+  bool p_localAIJBlocks(Mat *Ad, Mat *Ao, const PetscInt **colmap) const
+  {
+    PetscErrorCode ierr(0);
+    bool result(false);
+    try {
+      const Mat *mat = p_mwrap->getMatrix();
+      PetscBool assembled, isseq, ismpi;
+      ierr = MatAssembled(*mat, &assembled); CHKERRXX(ierr);
+      if (!assembled) return false;
+      ierr = PetscObjectTypeCompare((PetscObject)(*mat), MATSEQAIJ, &isseq); CHKERRXX(ierr);
+      ierr = PetscObjectTypeCompare((PetscObject)(*mat), MATMPIAIJ, &ismpi); CHKERRXX(ierr);
+      if (isseq) {
+        *Ad = *mat;
+        *Ao = NULL;
+        *colmap = NULL;
+        result = true;
+      } else if (ismpi) {
+        ierr = MatMPIAIJGetSeqAIJ(*mat, Ad, Ao, colmap); CHKERRXX(ierr);
+        result = true;
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return result;
+  }
+
+  /// Find the local storage locations of several elements (specialized)
+  /**
+   * Locations index the value array of the diagonal block, followed
+   * by the value array of the off-diagonal block (if any).
+   */
+  bool p_storageLocations(const IdxType& n, const IdxType *i, 
+                          const IdxType *j, IdxType *loc) const
+  {
+    if (elementSize > 1) return false;
+    Mat Ad, Ao;
+    const PetscInt *colmap;
+    if (!p_localAIJBlocks(&Ad, &Ao, &colmap)) return false;
+
+    PetscErrorCode ierr(0);
+    bool result(true);
+    try {
+      const Mat *mat = p_mwrap->getMatrix();
+      PetscInt rlo, rhi, clo, chi;
+      ierr = MatGetOwnershipRange(*mat, &rlo, &rhi); CHKERRXX(ierr);
+      ierr = MatGetOwnershipRangeColumn(*mat, &clo, &chi); CHKERRXX(ierr);
+
+      PetscInt nd, no(0);
+      const PetscInt *iad, *jad, *iao(NULL), *jao(NULL);
+      PetscBool done;
+      ierr = MatGetRowIJ(Ad, 0, PETSC_FALSE, PETSC_FALSE, 
+                         &nd, &iad, &jad, &done); CHKERRXX(ierr);
+      if (!done) return false;
+      if (Ao != NULL) {
+        ierr = MatGetRowIJ(Ao, 0, PETSC_FALSE, PETSC_FALSE, 
+                           &no, &iao, &jao, &done); CHKERRXX(ierr);
+        if (!done) {
+          ierr = MatRestoreRowIJ(Ad, 0, PETSC_FALSE, PETSC_FALSE, 
+                                 &nd, &iad, &jad, &done); CHKERRXX(ierr);
+          return false;
+        }
+      }
+      PetscInt nnzd(iad[nd]);
+
+      for (IdxType k = 0; k < n && result; ++k) {
+        PetscInt row(i[k]), col(j[k]);
+        if (row < rlo || row >= rhi) {
+          result = false;
+          break;
+        }
+        row -= rlo;
+        if (col >= clo && col < chi) {
+          const PetscInt *first(jad + iad[row]), *last(jad + iad[row+1]);
+          const PetscInt *p(std::lower_bound(first, last, col - clo));
+          if (p != last && *p == col - clo) {
+            loc[k] = static_cast<IdxType>(p - jad);
+          } else {
+            result = false;
+          }
+        } else if (Ao != NULL) {
+          result = false;
+          for (PetscInt p = iao[row]; p < iao[row+1]; ++p) {
+            if (colmap[jao[p]] == col) {
+              loc[k] = static_cast<IdxType>(nnzd + p);
+              result = true;
+              break;
+            }
+          }
+        } else {
+          result = false;
+        }
+      }
+
+      ierr = MatRestoreRowIJ(Ad, 0, PETSC_FALSE, PETSC_FALSE, 
+                             &nd, &iad, &jad, &done); CHKERRXX(ierr);
+      if (Ao != NULL) {
+        ierr = MatRestoreRowIJ(Ao, 0, PETSC_FALSE, PETSC_FALSE, 
+                               &no, &iao, &jao, &done); CHKERRXX(ierr);
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return result;
+  }
+
+  /// Set or add several elements using storage locations (specialized)
+  bool p_setStorageValues(const IdxType& n, const IdxType *loc, 
+                          const TheType *x, const bool& add)
+  {
+    if (elementSize > 1) return false;
+    Mat Ad, Ao;
+    const PetscInt *colmap;
+    if (!p_localAIJBlocks(&Ad, &Ao, &colmap)) return false;
+
+    PetscErrorCode ierr(0);
+    try {
+      Mat *mat = p_mwrap->getMatrix();
+      PetscInt nrow, nnzd;
+      const PetscInt *iad, *jad;
+      PetscBool done;
+      ierr = MatGetRowIJ(Ad, 0, PETSC_FALSE, PETSC_FALSE, 
+                         &nrow, &iad, &jad, &done); CHKERRXX(ierr);
+      nnzd = iad[nrow];
+      ierr = MatRestoreRowIJ(Ad, 0, PETSC_FALSE, PETSC_FALSE, 
+                             &nrow, &iad, &jad, &done); CHKERRXX(ierr);
+
+      PetscScalar *ad, *ao(NULL);
+      ierr = MatSeqAIJGetArray(Ad, &ad); CHKERRXX(ierr);
+      if (Ao != NULL) {
+        ierr = MatSeqAIJGetArray(Ao, &ao); CHKERRXX(ierr);
+      }
+      for (IdxType k = 0; k < n; ++k) {
+        PetscScalar v(gridpack::math::equate<PetscScalar, TheType>(x[k]));
+        PetscScalar *p(loc[k] < nnzd ? &ad[loc[k]] : &ao[loc[k] - nnzd]);
+        if (add) {
+          *p += v;
+        } else {
+          *p = v;
+        }
+      }
+      ierr = MatSeqAIJRestoreArray(Ad, &ad); CHKERRXX(ierr);
+      if (Ao != NULL) {
+        ierr = MatSeqAIJRestoreArray(Ao, &ao); CHKERRXX(ierr);
+      }
+
+      // let solvers and preconditioners know the values have changed
+      ierr = PetscObjectStateIncrease((PetscObject)(*mat)); CHKERRXX(ierr);
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return true;
+  }
+
+  /// Get the number of values in local storage (specialized)
+  IdxType p_storageSize(void) const
+  {
+    if (elementSize > 1) return -1;
+    Mat Ad, Ao;
+    const PetscInt *colmap;
+    if (!p_localAIJBlocks(&Ad, &Ao, &colmap)) return -1;
+
+    PetscErrorCode ierr(0);
+    IdxType result(0);
+    try {
+      MatInfo info;
+      ierr = MatGetInfo(Ad, MAT_LOCAL, &info); CHKERRXX(ierr);
+      result += static_cast<IdxType>(info.nz_used);
+      if (Ao != NULL) {
+        ierr = MatGetInfo(Ao, MAT_LOCAL, &info); CHKERRXX(ierr);
+        result += static_cast<IdxType>(info.nz_used);
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return result;
+  }
+
+  /// Find the locally owned rows that contain nonzero values (specialized)
+  bool p_nonzeroRows(std::vector<IdxType>& rows) const
+  {
+    rows.clear();
+    PetscErrorCode ierr(0);
+    try {
+      const Mat *mat = p_mwrap->getMatrix();
+      PetscInt lo, hi;
+      ierr = MatGetOwnershipRange(*mat, &lo, &hi); CHKERRXX(ierr);
+      for (PetscInt r = lo; r < hi; ++r) {
+        PetscInt ncols;
+        const PetscScalar *vals;
+        ierr = MatGetRow(*mat, r, &ncols, NULL, &vals); CHKERRXX(ierr);
+        bool nonzero(false);
+        for (PetscInt c = 0; c < ncols && !nonzero; ++c) {
+          nonzero = (vals[c] != 0.0);
+        }
+        ierr = MatRestoreRow(*mat, r, &ncols, NULL, &vals); CHKERRXX(ierr);
+
+        // with real PETSc, a complex row spans elementSize rows
+        IdxType row(r/elementSize);
+        if (nonzero && (rows.empty() || rows.back() != row)) {
+          rows.push_back(row);
+        }
+      }
+    } catch (const PETSC_EXCEPTION_TYPE& e) {
+      throw PETScException(ierr, e);
+    }
+    return true;
+  }
           
 
   /// Scale this entire MatrixT by the given value (specialized)
@@ -21,6 +21,7 @@
 #include <boost/format.hpp>
 #include "linear_solver.hpp"
 #include "linear_matrix_solver.hpp"
+#include "low_rank_update_solver.hpp"
 
 #include "test_main.cpp"
 
@@ -129,5 +130,159 @@ BOOST_AUTO_TEST_CASE(HelmboltzInverse)
   BOOST_CHECK(x->norm2() < 1.0E-04);
 }
 
+// -------------------------------------------------------------
+// Change the coefficient values, but not the pattern, and make sure
+// the solvers pick up the new values after refactor()
+// -------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(HelmboltzRefactor)
+{
+  parallel::Communicator world;
+  boost::shared_ptr<math::ComplexMatrix> A, A2, I, Ainv;
+  boost::shared_ptr<math::ComplexVector> u, b, x;
+  assemble_helmboltz(world, A, u, b);
+
+  x.reset(u->clone()),
+  x->fill(0.0);
+  x->ready();
+
+  boost::scoped_ptr<math::LinearSolver> 
+    solver(new math::LinearSolver(*A));
+  BOOST_REQUIRE(test_config);
+  solver->configure(test_config);
+  solver->solve(*b, *x);
+
+  // doubling A should halve the solution
+  A->scale(2.0);
+  solver->refactor();
+  x->fill(0.0);
+  x->ready();
+  solver->solve(*b, *x);
+  x->scale(2.0);
+  x->add(*u, -1.0);
+  BOOST_CHECK(x->norm2() < 1.0E-04);
+
+  I.reset(new math::ComplexMatrix(A->communicator(),
+                                  A->localRows(),
+                                  A->localCols(),
+                                  math::Dense));
+  I->identity();
+
+  boost::scoped_ptr<math::LinearMatrixSolver> 
+    msolver(new math::LinearMatrixSolver(*A));
+  msolver->configure(test_config);
+  Ainv.reset(msolver->solve(*I));
+
+  // a copy of A scaled back has the same pattern 
+  A2.reset(A->clone());
+  A2->scale(0.5);
+  msolver->refactor(*A2);
+  Ainv.reset(msolver->solve(*I));
+
+  x.reset(math::multiply(*Ainv, *b));
+  x->add(*u, -1.0);
+  BOOST_CHECK(x->norm2() < 1.0E-04);
+}
+
+BOOST_AUTO_TEST_CASE(HelmboltzBlock)
+{
+  parallel::Communicator world;
+  boost::shared_ptr<math::ComplexMatrix> A;
+  boost::shared_ptr<math::ComplexVector> u, b;
+  assemble_helmboltz(world, A, u, b);
+
+  // several RHS, each a multiple of the original
+  const int nrhs(3);
+  const ComplexType factor[nrhs] = 
+    { ComplexType(1.0, 0.0), ComplexType(2.0, 0.0), ComplexType(0.0, 1.0) };
+  std::vector< boost::shared_ptr<math::ComplexVector> > bs, xs;
+  std::vector<math::ComplexVector *> bp, xp;
+  for (int j = 0; j < nrhs; ++j) {
+    bs.push_back(boost::shared_ptr<math::ComplexVector>(b->clone()));
+    bs.back()->scale(factor[j]);
+    xs.push_back(boost::shared_ptr<math::ComplexVector>(u->clone()));
+    bp.push_back(bs.back().get());
+    xp.push_back(xs.back().get());
+  }
+
+  boost::scoped_ptr<math::LinearSolver> 
+    solver(new math::LinearSolver(*A));
+  BOOST_REQUIRE(test_config);
+  solver->configure(test_config);
+  solver->solve(bp, xp);
+
+  for (int j = 0; j < nrhs; ++j) {
+    xs[j]->add(*u, -factor[j]);
+    BOOST_CHECK(xs[j]->norm2() < 1.0E-04);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HelmboltzLowRank)
+{
+  parallel::Communicator world;
+  boost::shared_ptr<math::ComplexMatrix> A, A1, dA;
+  boost::shared_ptr<math::ComplexVector> u, b, x;
+  assemble_helmboltz(world, A, u, b);
+
+  x.reset(u->clone()),
+  x->fill(0.0);
+  x->ready();
+
+  boost::scoped_ptr<math::LinearSolver> 
+    solver(new math::LinearSolver(*A));
+  BOOST_REQUIRE(test_config);
+  solver->configure(test_config);
+  solver->solve(*b, *x);
+
+  // change the first and last rows, within the nonzero pattern
+  int lo, hi, n(A->rows());
+  A->localRowRange(lo, hi);
+  dA.reset(new math::ComplexMatrix(A->communicator(),
+                                   A->localRows(),
+                                   A->localCols(), 2));
+  if (lo <= 0 && 0 < hi) {
+    dA->addElement(0, 0, ComplexType(1.0, 0.5));
+    dA->addElement(0, 1, ComplexType(-0.5, 0.0));
+  }
+  if (lo <= n-1 && n-1 < hi) {
+    dA->addElement(n-1, n-1, ComplexType(2.0, 0.0));
+  }
+  dA->ready();
+
+  A1.reset(A->clone());
+  A1->add(*dA);
+  math::multiply(*A1, *u, *b);
+
+  math::LowRankUpdateSolver lrsolver(*solver);
+  BOOST_REQUIRE(!lrsolver.update(*dA, 1));
+  BOOST_REQUIRE(lrsolver.update(*dA, 4));
+  BOOST_CHECK_EQUAL(lrsolver.rank(), 2);
+
+  x->fill(0.0);
+  x->ready();
+  lrsolver.solve(*b, *x);
+  x->add(*u, -1.0);
+  BOOST_CHECK(x->norm2() < 1.0E-04);
+
+  // removing the first row makes the modified matrix singular, which
+  // should be reported and leave the solver without an update
+  std::vector<ComplexType> row(n);
+  int r0(0), nz(0);
+  A->getRowBlock(1, &r0, &row[0]);
+  for (int j = 0; j < n; ++j) {
+    if (std::abs(row[j]) > 0.0) nz++;
+  }
+  dA.reset(new math::ComplexMatrix(A->communicator(),
+                                   A->localRows(),
+                                   A->localCols(), nz));
+  if (lo <= 0 && 0 < hi) {
+    for (int j = 0; j < n; ++j) {
+      if (std::abs(row[j]) > 0.0) dA->addElement(0, j, -row[j]);
+    }
+  }
+  dA->ready();
+  BOOST_CHECK_THROW(lrsolver.update(*dA, 4), gridpack::Exception);
+  BOOST_CHECK_EQUAL(lrsolver.rank(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -39,6 +39,7 @@
 #include "gridpack/utilities/exception.hpp"
 #include "gridpack/environment/environment.hpp"
 #include "gridpack/environment/no_print.hpp"
+#include "gridpack/network/ghost_exchange.hpp"
 
 namespace gridpack {
 namespace network {
@@ -309,7 +310,21 @@ explicit BaseNetwork(const parallel::Communicator& comm)
   p_external_branch = false;
   p_allocatedBus = false;
   p_allocatedBranch = false;
+  p_busXCArena = NULL;
+  p_branchXCArena = NULL;
+  p_busXCBase = NULL;
+  p_branchXCBase = NULL;
+  p_busXCStride = 0;
+  p_branchXCStride = 0;
+  p_busXCVersion = -1;
+  p_branchXCVersion = -1;
+  p_busDirectXC = false;
+  p_branchDirectXC = false;
   p_network_data.reset(new gridpack::component::DataCollection);
+  p_topologyVersion = 0;
+  p_ghostExchange = GAExchange;
+  p_interiorVersion = -1;
+  p_dirtyVersion = -1;
 
   gridpack::NoPrint *noprint = gridpack::NoPrint::instance();
   p_no_print = noprint->status();
@@ -321,15 +336,17 @@ explicit BaseNetwork(const parallel::Communicator& comm)
 virtual ~BaseNetwork(void)
 {
   int i, size;
+  // Make sure no exchanges are in progress before buffers are removed
+  p_busExchange.reset();
+  p_branchExchange.reset();
   // Clean up exchange buffers if they have been allocated
   if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
     int size = p_buses.size();
     int i;
     if (p_allocatedBus) {
       if (!p_external_bus) {
-        for(i=0; i<size; i++) {
-          delete [] static_cast<char*>(p_busXCBuffers[i]);
-        }
+        delete [] p_busXCArena;
+        p_busXCArena = NULL;
       }
       p_allocatedBus = false;
     }
@@ -340,9 +357,8 @@ virtual ~BaseNetwork(void)
     int i;
     if (p_allocatedBranch) {
       if (!p_external_branch) {
-        for(i=0; i<size; i++) {
-          delete [] static_cast<char*>(p_branchXCBuffers[i]);
-        }
+        delete [] p_branchXCArena;
+        p_branchXCArena = NULL;
       }
       p_allocatedBranch = false;
     }
@@ -1015,6 +1031,31 @@ void getBranchEndpoints(int idx, int *bus1, int *bus2) const
   }
 }
 
+/**
+ * Return list of active buses that are not connected to any ghost buses
+ * or ghost branches. Calculations on these buses only require locally owned
+ * data and can be overlapped with ghost updates started by
+ * beginUpdateBuses.
+ * @return vector of local bus indices
+ */
+const std::vector<int>& getInteriorBuses(void)
+{
+  if (p_interiorVersion != p_topologyVersion) setInteriorBuses();
+  return p_interiorBuses;
+}
+
+/**
+ * Return list of active buses that are connected to at least one ghost bus
+ * or ghost branch. Calculations on these buses should be performed after
+ * endUpdateBuses has been called.
+ * @return vector of local bus indices
+ */
+const std::vector<int>& getBoundaryBuses(void)
+{
+  if (p_interiorVersion != p_topologyVersion) setInteriorBuses();
+  return p_boundaryBuses;
+}
+
 /// Assemble local part of network
 void assemble(void) 
 {
@@ -1239,6 +1280,8 @@ void clean(void)
   std::map<int, int>::iterator p;
   int i, j;
   // remove all exchange buffers
+  p_busExchange.reset();
+  p_branchExchange.reset();
   freeXCBus();
   freeXCBranch();
   if (p_activeBusIndices) {
@@ -1351,6 +1394,7 @@ void clean(void)
   if (p_refBus != -1) {
     p_refBus = buses[p_refBus];
   }
+  p_topologyVersion++;
 }
 
 /**
@@ -1580,15 +1624,16 @@ void resetGlobalIndices(bool flag)
 void clear(void)
 {
   int i, size;
+  p_busExchange.reset();
+  p_branchExchange.reset();
   // Clean up exchange buffers if they have been allocated
   if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
     int size = p_buses.size();
     int i;
     if (p_allocatedBus) {
       if (!p_external_bus) {
-        for(i=0; i<size; i++) {
-          delete [] static_cast<char*>(p_busXCBuffers[i]);
-        }
+        delete [] p_busXCArena;
+        p_busXCArena = NULL;
       }
       p_allocatedBus = false;
     }
@@ -1599,9 +1644,8 @@ void clear(void)
     int i;
     if (p_allocatedBranch) {
       if (!p_external_branch) {
-        for(i=0; i<size; i++) {
-          delete [] static_cast<char*>(p_branchXCBuffers[i]);
-        }
+        delete [] p_branchXCArena;
+        p_branchXCArena = NULL;
       }
       p_allocatedBranch = false;
     }
@@ -1677,6 +1721,125 @@ void clear(void)
   p_external_branch = false;
   p_allocatedBus = false;
   p_allocatedBranch = false;
+  p_busXCArena = NULL;
+  p_branchXCArena = NULL;
+  p_busDirectXC = false;
+  p_branchDirectXC = false;
+  p_topologyVersion++;
+}
+
+/**
+ * Return a counter that identifies the current topology of the network. The
+ * counter is incremented whenever the internal bus and branch maps are
+ * rebuilt (partitioning, cloning, setting components) or buses and branches
+ * are removed from the network. Objects that cache information derived from
+ * the network layout, such as the mappers, can use this value to determine
+ * if the cached information is still valid.
+ * @return current topology version
+ */
+int topologyVersion(void) const
+{
+  return p_topologyVersion;
+}
+
+/**
+ * Increment the topology version of the network. This can be called by
+ * applications that modify the network in a way that changes the layout of
+ * matrices and vectors generated from it, so that any cached structures
+ * associated with the network are discarded.
+ */
+void incrementTopologyVersion(void)
+{
+  p_topologyVersion++;
+}
+
+/**
+ * Mark a bus as dirty. This is used to record that the contribution of the
+ * bus to matrices or vectors generated from the network has changed since
+ * they were last built, so that only changed components need to be
+ * re-evaluated. Marking a bus more than once has no effect.
+ * @param idx local bus index
+ */
+void markBusDirty(int idx)
+{
+  if (idx<0 || idx >= p_buses.size()) {
+    char buf[256];
+    sprintf(buf,"BaseNetwork::markBusDirty: illegal index: %d size: %d\n",
+        idx, static_cast<int>(p_buses.size()));
+    if (!p_no_print) {
+      printf("%s",buf);
+    }
+    throw gridpack::Exception(buf);
+  }
+  checkDirtyVersion();
+  if (p_busDirty.size() != p_buses.size()) p_busDirty.resize(p_buses.size(),0);
+  if (!p_busDirty[idx]) {
+    p_busDirty[idx] = 1;
+    p_dirtyBuses.push_back(idx);
+  }
+}
+
+/**
+ * Mark a branch as dirty. Marking a branch more than once has no effect.
+ * @param idx local branch index
+ */
+void markBranchDirty(int idx)
+{
+  if (idx<0 || idx >= p_branches.size()) {
+    char buf[256];
+    sprintf(buf,"BaseNetwork::markBranchDirty: illegal index: %d size: %d\n",
+        idx, static_cast<int>(p_branches.size()));
+    if (!p_no_print) {
+      printf("%s",buf);
+    }
+    throw gridpack::Exception(buf);
+  }
+  checkDirtyVersion();
+  if (p_branchDirty.size() != p_branches.size())
+    p_branchDirty.resize(p_branches.size(),0);
+  if (!p_branchDirty[idx]) {
+    p_branchDirty[idx] = 1;
+    p_dirtyBranches.push_back(idx);
+  }
+}
+
+/**
+ * Return local indices of buses that have been marked dirty since the last
+ * call to clearDirtyComponents, in the order in which they were marked.
+ * Dirty marks are discarded if the network topology changes.
+ * @return list of dirty buses
+ */
+const std::vector<int>& dirtyBuses(void)
+{
+  checkDirtyVersion();
+  return p_dirtyBuses;
+}
+
+/**
+ * Return local indices of branches that have been marked dirty since the
+ * last call to clearDirtyComponents
+ * @return list of dirty branches
+ */
+const std::vector<int>& dirtyBranches(void)
+{
+  checkDirtyVersion();
+  return p_dirtyBranches;
+}
+
+/**
+ * Clear all dirty marks on buses and branches. This is usually called after
+ * the matrices and vectors that depend on the dirty components have been
+ * updated.
+ */
+void clearDirtyComponents(void)
+{
+  int i;
+  for (i=0; i<p_dirtyBuses.size(); i++) p_busDirty[p_dirtyBuses[i]] = 0;
+  for (i=0; i<p_dirtyBranches.size(); i++)
+    p_branchDirty[p_dirtyBranches[i]] = 0;
+  p_dirtyBuses.clear();
+  p_dirtyBranches.clear();
+  p_dirtyVersion = p_topologyVersion;
 }
 
 /**
@@ -1700,9 +1863,8 @@ void allocXCBus(int size)
   if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
     if (p_allocatedBus) {
       if (!p_external_bus) {
-        for(i=0; i<nsize; i++) {
-          delete [] static_cast<char*>(p_busXCBuffers[i]);
-        }
+        delete [] p_busXCArena;
+        p_busXCArena = NULL;
       }
       p_allocatedBus = false;
     }
@@ -1712,9 +1874,12 @@ void allocXCBus(int size)
   // Allocate new buffers if size is greater than zero
   if (size > 0 && nsize > 0) {
     p_busXCBuffers = new void*[nsize];
-    for (i=0; i<nsize; i++) {
-      p_busXCBuffers[i] = static_cast<void*>(new char[size]);
-    }
+    std::vector<bool> active(nsize);
+    for (i=0; i<nsize; i++) active[i] = getActiveBus(i);
+    p_busXCStride = xcStride(size);
+    p_busXCArena = allocXCArena(p_busXCBuffers, active, p_busXCStride,
+        &p_busXCBase);
+    p_busXCVersion = p_topologyVersion;
     p_busXCBufSize = size;
     p_allocatedBus = true;
     p_external_bus = false;
@@ -1732,9 +1897,8 @@ void freeXCBus(void)
     int nsize = p_buses.size();
     if (p_allocatedBus) {
       if (!p_external_bus) {
-        for(i=0; i<nsize; i++) {
-          delete [] static_cast<char*>(p_busXCBuffers[i]);
-        }
+        delete [] p_busXCArena;
+        p_busXCArena = NULL;
       }
       p_allocatedBus = false;
     }
@@ -1756,9 +1920,8 @@ void allocXCBusPointers(int size)
   if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
     if (p_allocatedBus) {
       if (!p_external_bus) {
-        for(i=0; i<nsize; i++) {
-          delete [] static_cast<char*>(p_busXCBuffers[i]);
-        }
+        delete [] p_busXCArena;
+        p_busXCArena = NULL;
       }
       p_allocatedBus = false;
     }
@@ -1839,9 +2002,8 @@ void allocXCBranch(int size)
   if (p_branchXCBufSize != 0 && p_branchXCBuffers != NULL) {
     if (p_allocatedBranch) {
       if (!p_external_branch) {
-        for(i=0; i<nsize; i++) {
-          delete [] static_cast<char*>(p_branchXCBuffers[i]);
-        }
+        delete [] p_branchXCArena;
+        p_branchXCArena = NULL;
       }
       p_allocatedBranch = false;
     }
@@ -1852,9 +2014,12 @@ void allocXCBranch(int size)
   // Allocate new buffers if size is greater than zero
   if (size > 0 && nsize > 0) {
     p_branchXCBuffers = new void*[nsize];
-    for (i=0; i<nsize; i++) {
-      p_branchXCBuffers[i] = static_cast<void*>(new char[size]);
-    }
+    std::vector<bool> active(nsize);
+    for (i=0; i<nsize; i++) active[i] = getActiveBranch(i);
+    p_branchXCStride = xcStride(size);
+    p_branchXCArena = allocXCArena(p_branchXCBuffers, active,
+        p_branchXCStride, &p_branchXCBase);
+    p_branchXCVersion = p_topologyVersion;
     p_allocatedBranch = true;
     p_branchXCBufSize = size;
   }
@@ -1871,9 +2036,8 @@ void freeXCBranch(void)
     int i;
     if (p_allocatedBranch) {
       if (!p_external_branch) {
-        for(i=0; i<size; i++) {
-          delete [] static_cast<char*>(p_branchXCBuffers[i]);
-        }
+        delete [] p_branchXCArena;
+        p_branchXCArena = NULL;
       }
       p_allocatedBranch = false;
     }
@@ -1916,9 +2080,8 @@ void allocXCBranchPointers(int size)
   if (p_branchXCBufSize != 0 && p_branchXCBuffers != NULL) {
     if (p_allocatedBranch) {
       if (!p_external_branch) {
-        for(i=0; i<nsize; i++) {
-          delete [] static_cast<char*>(p_branchXCBuffers[i]);
-        }
+        delete [] p_branchXCArena;
+        p_branchXCArena = NULL;
       }
       p_allocatedBranch = false;
     }
@@ -1957,6 +2120,27 @@ void setXCBranchBuffer(int idx, void* ptr)
   }
 }
 
+/**
+ * Set the method used to update ghost buses and branches. This must be
+ * called with the same value on all processors before initBusUpdate and
+ * initBranchUpdate.
+ * @param type GAExchange (default) uses a global array to exchange data,
+ *        P2PExchange sends data directly between neighboring processors
+ */
+void setGhostExchange(GhostExchangeType type)
+{
+  p_ghostExchange = type;
+}
+
+/**
+ * Get the method used to update ghost buses and branches
+ * @return exchange method
+ */
+GhostExchangeType getGhostExchange(void) const
+{
+  return p_ghostExchange;
+}
+
 /**
  * This function must be called before calling the update bus routine.
  * It initializes data structures for the bus update
@@ -1995,6 +2179,32 @@ void initBusUpdate(void)
       delete [] ((char*)p_busRcvBuf);
       p_busRcvBuf = NULL;
     }
+    p_busGASet = false;
+    p_numActiveBuses = 0;
+    p_numInactiveBuses = 0;
+    p_busExchange.reset();
+    // Exchange directly from arena if buffers are still in active-first order
+    p_busDirectXC = (p_allocatedBus && !p_external_bus &&
+        p_busXCArena != NULL && p_busXCVersion == p_topologyVersion);
+    // Set up point-to-point exchange between neighboring processors
+    if (p_ghostExchange == P2PExchange) {
+      std::vector<int> ownedGlobal, ownedLocal, ghostGlobal, ghostLocal;
+      size = p_buses.size();
+      for (i=0; i<size; i++) {
+        if (getActiveBus(i)) {
+          ownedGlobal.push_back(getGlobalBusIndex(i));
+          ownedLocal.push_back(i);
+        } else {
+          ghostGlobal.push_back(getGlobalBusIndex(i));
+          ghostLocal.push_back(i);
+        }
+      }
+      p_busExchange.reset(new GhostExchange(
+            static_cast<MPI_Comm>(this->communicator())));
+      p_busExchange->setup(ownedGlobal,ownedLocal,ghostGlobal,ghostLocal);
+      GA_Pgroup_sync(grp);
+      return;
+    }
     // Find out how many active buses exist
     size = p_buses.size();
     numBuses = 0;
@@ -2030,7 +2240,11 @@ void initBusUpdate(void)
     }
     p_busGA = GA_Create_handle();
     int one = 1;
-    p_busXCBufType = NGA_Register_type(p_busXCBufSize);
+    if (p_busDirectXC) {
+      p_busXCBufType = NGA_Register_type(p_busXCStride);
+    } else {
+      p_busXCBufType = NGA_Register_type(p_busXCBufSize);
+    }
     GA_Set_data(p_busGA, one, &p_busTotal, p_busXCBufType);
     GA_Set_irreg_distr(p_busGA, distr, &nprocs);
     GA_Set_pgroup(p_busGA, grp);
@@ -2044,7 +2258,7 @@ void initBusUpdate(void)
       p_activeBusIndices[i] = new int;
     }
     p_numActiveBuses = lcnt;
-    if (lcnt > 0) {
+    if (lcnt > 0 && !p_busDirectXC) {
       p_busSndBuf = new char[lcnt*p_busXCBufSize];
     }
 
@@ -2055,7 +2269,7 @@ void initBusUpdate(void)
     for (i=0; i<icnt; i++) {
       p_inactiveBusIndices[i] = new int;
     }
-    if (icnt > 0) {
+    if (icnt > 0 && !p_busDirectXC) {
       p_busRcvBuf = new char[icnt*p_busXCBufSize];
     }
     lcnt = 0;
@@ -2101,9 +2315,36 @@ void initBusUpdate(void)
  */
 void updateBuses(void)
 {
+  beginUpdateBuses();
+  endUpdateBuses();
+}
+
+/**
+ * Start updating the bus ghost values. This is a collective operation
+ * across all processors. Calculations that only involve active buses that
+ * have no ghost neighbors (see getInteriorBuses) can be performed before
+ * calling endUpdateBuses. The exchange buffers of active buses should not
+ * be modified and the exchange buffers of ghost buses should not be read
+ * until endUpdateBuses is called.
+ */
+void beginUpdateBuses(void)
+{
+  if (p_busExchange) {
+    p_busExchange->begin(p_busXCBuffers, p_busXCBufSize);
+    return;
+  }
   int grp = this->communicator().getGroup();
-  // Copy data from XC buffer to send buffer
   GA_Pgroup_sync(grp);
+  if (p_busDirectXC) {
+    // Buffers for active buses are already contiguous in the arena
+    checkDirectXC(p_busXCArena, p_busXCVersion, "beginUpdateBuses");
+    if (p_numActiveBuses > 0) {
+      NGA_Scatter(p_busGA,p_busXCBase,p_activeBusIndices,p_numActiveBuses);
+    }
+    GA_Pgroup_sync(grp);
+    return;
+  }
+  // Copy data from XC buffer to send buffer
   int i, j, xc_off, rs_off, icnt, nbus;
   char *rs_ptr, *xc_ptr;
   nbus = numBuses();
@@ -2122,11 +2363,38 @@ void updateBuses(void)
     }
   }
 
-  // Scatter data to exchange GA and then gather it back to local buffers
+  // Scatter data to exchange GA
   if (p_numActiveBuses > 0) {
     NGA_Scatter(p_busGA,p_busSndBuf,p_activeBusIndices,p_numActiveBuses);
   }
   GA_Pgroup_sync(grp);
+}
+
+/**
+ * Complete update of bus ghost values started by beginUpdateBuses. This is
+ * a collective operation across all processors.
+ */
+void endUpdateBuses(void)
+{
+  if (p_busExchange) {
+    p_busExchange->end();
+    return;
+  }
+  int grp = this->communicator().getGroup();
+  if (p_busDirectXC) {
+    // Gather ghost data directly into the arena behind the active buses
+    checkDirectXC(p_busXCArena, p_busXCVersion, "endUpdateBuses");
+    if (p_numInactiveBuses > 0) {
+      NGA_Gather(p_busGA,p_busXCBase+p_numActiveBuses*p_busXCStride,
+          p_inactiveBusIndices,p_numInactiveBuses);
+    }
+    GA_Pgroup_sync(grp);
+    return;
+  }
+  int i, xc_off, rs_off, icnt, nbus;
+  char *rs_ptr, *xc_ptr;
+  nbus = numBuses();
+  // Gather data from exchange GA back to local buffers
   if (p_numInactiveBuses > 0) {
     NGA_Gather(p_busGA,p_busRcvBuf,p_inactiveBusIndices,p_numInactiveBuses);
   }
@@ -2188,6 +2456,32 @@ void initBranchUpdate(void)
         p_branchRcvBuf = NULL;
       }
     }
+    p_branchGASet = false;
+    p_numActiveBranches = 0;
+    p_numInactiveBranches = 0;
+    p_branchExchange.reset();
+    // Exchange directly from arena if buffers are still in active-first order
+    p_branchDirectXC = (p_allocatedBranch && !p_external_branch &&
+        p_branchXCArena != NULL && p_branchXCVersion == p_topologyVersion);
+    // Set up point-to-point exchange between neighboring processors
+    if (p_ghostExchange == P2PExchange) {
+      std::vector<int> ownedGlobal, ownedLocal, ghostGlobal, ghostLocal;
+      size = p_branches.size();
+      for (i=0; i<size; i++) {
+        if (getActiveBranch(i)) {
+          ownedGlobal.push_back(getGlobalBranchIndex(i));
+          ownedLocal.push_back(i);
+        } else {
+          ghostGlobal.push_back(getGlobalBranchIndex(i));
+          ghostLocal.push_back(i);
+        }
+      }
+      p_branchExchange.reset(new GhostExchange(
+            static_cast<MPI_Comm>(this->communicator())));
+      p_branchExchange->setup(ownedGlobal,ownedLocal,ghostGlobal,ghostLocal);
+      GA_Pgroup_sync(grp);
+      return;
+    }
     // Find out how many active branches exist
     size = p_branches.size();
     numBranches = 0;
@@ -2199,8 +2493,8 @@ void initBranchUpdate(void)
     // Construct GA that can hold exchange data for all active branches
     int nprocs = GA_Pgroup_nnodes(grp);
     int me = GA_Pgroup_nodeid(grp);
-    int *totBranches = new int(nprocs);
-    int *distr = new int(nprocs);
+    int *totBranches = new int[nprocs];
+    int *distr = new int[nprocs];
     for (i=0; i<nprocs; i++) {
       if (me == i) {
         totBranches[i] = numBranches;
@@ -2219,7 +2513,11 @@ void initBranchUpdate(void)
     }
     p_branchGA = GA_Create_handle();
     int one = 1;
-    p_branchXCBufType = NGA_Register_type(p_branchXCBufSize);
+    if (p_branchDirectXC) {
+      p_branchXCBufType = NGA_Register_type(p_branchXCStride);
+    } else {
+      p_branchXCBufType = NGA_Register_type(p_branchXCBufSize);
+    }
     GA_Set_data(p_branchGA, one, &p_branchTotal, p_branchXCBufType);
     GA_Set_irreg_distr(p_branchGA, distr, &nprocs);
     GA_Set_pgroup(p_branchGA, grp);
@@ -2236,10 +2534,14 @@ void initBranchUpdate(void)
     }
     p_numActiveBranches = lcnt;
     p_activeBranchIndices = new int*[lcnt];
-    p_branchSndBuf = new char[lcnt*p_branchXCBufSize];
+    if (!p_branchDirectXC) {
+      p_branchSndBuf = new char[lcnt*p_branchXCBufSize];
+    }
     p_numInactiveBranches = icnt;
     p_inactiveBranchIndices = new int*[icnt];
-    p_branchRcvBuf = new char[icnt*p_branchXCBufSize];
+    if (!p_branchDirectXC) {
+      p_branchRcvBuf = new char[icnt*p_branchXCBufSize];
+    }
     lcnt = 0;
     icnt = 0;
     for (i=0; i<size; i++) {
@@ -2271,8 +2573,8 @@ void initBranchUpdate(void)
         icnt++;
       }
     }
-    delete totBranches;
-    delete distr;
+    delete [] totBranches;
+    delete [] distr;
   }
   GA_Pgroup_sync(grp);
 }
@@ -2283,9 +2585,35 @@ void initBranchUpdate(void)
  */
 void updateBranches(void)
 {
-  // Copy data from XC buffer to send buffer
+  beginUpdateBranches();
+  endUpdateBranches();
+}
+
+/**
+ * Start updating the branch ghost values. This is a collective operation
+ * across all processors. The exchange buffers of active branches should not
+ * be modified and the exchange buffers of ghost branches should not be read
+ * until endUpdateBranches is called.
+ */
+void beginUpdateBranches(void)
+{
+  if (p_branchExchange) {
+    p_branchExchange->begin(p_branchXCBuffers, p_branchXCBufSize);
+    return;
+  }
   int grp = this->communicator().getGroup();
   GA_Pgroup_sync(grp);
+  if (p_branchDirectXC) {
+    // Buffers for active branches are already contiguous in the arena
+    checkDirectXC(p_branchXCArena, p_branchXCVersion, "beginUpdateBranches");
+    if (p_numActiveBranches > 0) {
+      NGA_Scatter(p_branchGA,p_branchXCBase,p_activeBranchIndices,
+          p_numActiveBranches);
+    }
+    GA_Pgroup_sync(grp);
+    return;
+  }
+  // Copy data from XC buffer to send buffer
   int i, j, xc_off, rs_off, icnt, nbranch;
   char *rs_ptr, *xc_ptr;
   nbranch = numBranches();
@@ -2304,11 +2632,38 @@ void updateBranches(void)
     }
   }
 
-  // Scatter data to exchange GA and then gather it back to local buffers
+  // Scatter data to exchange GA
   if (p_numActiveBranches > 0) {
     NGA_Scatter(p_branchGA,p_branchSndBuf,p_activeBranchIndices,p_numActiveBranches);
   }
   GA_Pgroup_sync(grp);
+}
+
+/**
+ * Complete update of branch ghost values started by beginUpdateBranches.
+ * This is a collective operation across all processors.
+ */
+void endUpdateBranches(void)
+{
+  if (p_branchExchange) {
+    p_branchExchange->end();
+    return;
+  }
+  int grp = this->communicator().getGroup();
+  if (p_branchDirectXC) {
+    // Gather ghost data directly into the arena behind the active branches
+    checkDirectXC(p_branchXCArena, p_branchXCVersion, "endUpdateBranches");
+    if (p_numInactiveBranches > 0) {
+      NGA_Gather(p_branchGA,p_branchXCBase+p_numActiveBranches*p_branchXCStride,
+          p_inactiveBranchIndices,p_numInactiveBranches);
+    }
+    GA_Pgroup_sync(grp);
+    return;
+  }
+  int i, xc_off, rs_off, icnt, nbranch;
+  char *rs_ptr, *xc_ptr;
+  nbranch = numBranches();
+  // Gather data from exchange GA back to local buffers
   if (p_numInactiveBranches > 0) {
     NGA_Gather(p_branchGA,p_branchRcvBuf,p_inactiveBranchIndices,p_numInactiveBranches);
   }
@@ -2458,6 +2813,7 @@ void setMap(void)
     getOriginalBranchEndpoints(i, &idx1, &idx2);
     p_branchMap.insert(std::pair<std::pair<int,int>,int>(std::pair<int,int>(idx1,idx2),i));
   }
+  p_topologyVersion++;
 }
 
 /**
@@ -2552,6 +2908,126 @@ private:
   typedef std::vector< BranchData<BranchType> > BranchDataVector;
   typedef typename BranchDataVector::iterator BranchIterator;
 
+  /**
+   * Alignment (in bytes) of exchange buffer arenas and of individual
+   * buffers within an arena
+   */
+  static const int XC_ARENA_ALIGN = 64;
+  static const int XC_BUFFER_ALIGN = 16;
+
+  /**
+   * Return distance between buffers in an exchange buffer arena
+   * @param size size (in bytes) of buffer
+   * @return size rounded up to buffer alignment
+   */
+  static int xcStride(int size)
+  {
+    return ((size+XC_BUFFER_ALIGN-1)/XC_BUFFER_ALIGN)*XC_BUFFER_ALIGN;
+  }
+
+  /**
+   * Allocate a single block of memory for all exchange buffers and assign
+   * buffer pointers. Buffers for active components are placed first, in
+   * local index order, followed by buffers for ghost components, so that the
+   * data sent and received in ghost updates are each contiguous.
+   * @param buffers array of buffer pointers that is filled in
+   * @param active flags indicating which components are active
+   * @param stride distance (in bytes) between buffers
+   * @param base returns aligned location of first buffer
+   * @return allocated memory, which must be released with delete []
+   */
+  static char* allocXCArena(void **buffers, const std::vector<bool> &active,
+      int stride, char **base)
+  {
+    int i, icnt;
+    int nsize = active.size();
+    char *arena = new char[nsize*stride+XC_ARENA_ALIGN];
+    size_t offset = reinterpret_cast<size_t>(arena)%XC_ARENA_ALIGN;
+    *base = arena;
+    if (offset > 0) *base += XC_ARENA_ALIGN-offset;
+    icnt = 0;
+    for (i=0; i<nsize; i++) {
+      if (active[i]) {
+        buffers[i] = static_cast<void*>(*base+icnt*stride);
+        icnt++;
+      }
+    }
+    for (i=0; i<nsize; i++) {
+      if (!active[i]) {
+        buffers[i] = static_cast<void*>(*base+icnt*stride);
+        icnt++;
+      }
+    }
+    return arena;
+  }
+
+  /**
+   * Check that an exchange buffer arena used for ghost updates has not been
+   * removed or invalidated since the update was initialized
+   * @param arena exchange buffer arena
+   * @param version topology version when arena was allocated
+   * @param name name of calling function
+   */
+  void checkDirectXC(const char *arena, int version, const char *name)
+  {
+    if (arena == NULL || version != p_topologyVersion) {
+      char buf[256];
+      sprintf(buf,"BaseNetwork::%s: exchange buffers have changed since"
+          " update was initialized\n",name);
+      if (!p_no_print) {
+        printf("%s",buf);
+      }
+      throw gridpack::Exception(buf);
+    }
+  }
+
+  /**
+   * Discard dirty marks if they were made before the last change in the
+   * network topology, since the local indices may no longer be valid
+   */
+  void checkDirtyVersion(void)
+  {
+    if (p_dirtyVersion == p_topologyVersion) return;
+    p_dirtyBuses.clear();
+    p_dirtyBranches.clear();
+    p_busDirty.clear();
+    p_branchDirty.clear();
+    p_dirtyVersion = p_topologyVersion;
+  }
+
+  /**
+   * Sort active buses into interior buses, which have no ghost neighbors,
+   * and boundary buses
+   */
+  void setInteriorBuses(void)
+  {
+    int i, j, nbus, nbr;
+    p_interiorBuses.clear();
+    p_boundaryBuses.clear();
+    nbus = p_buses.size();
+    for (i=0; i<nbus; i++) {
+      if (!getActiveBus(i)) continue;
+      bool interior = true;
+      const std::vector<int> &branches = p_buses[i].p_branchNeighbors;
+      nbr = branches.size();
+      for (j=0; j<nbr; j++) {
+        const BranchData<BranchType> &branch = p_branches[branches[j]];
+        if (!branch.p_activeBranch
+            || !getActiveBus(branch.p_localBusIndex1)
+            || !getActiveBus(branch.p_localBusIndex2)) {
+          interior = false;
+          break;
+        }
+      }
+      if (interior) {
+        p_interiorBuses.push_back(i);
+      } else {
+        p_boundaryBuses.push_back(i);
+      }
+    }
+    p_interiorVersion = p_topologyVersion;
+  }
+
   /**
    * Vector of bus data and objects
    */
@@ -2575,6 +3051,22 @@ private:
   bool p_allocatedBus;
   bool p_external_bus;
 
+  /**
+   * Contiguous storage for bus exchange buffers allocated by allocXCBus.
+   * Buffers for active buses are stored first, followed by buffers for ghost
+   * buses.
+   * p_busXCArena: allocated block of memory
+   * p_busXCBase: aligned location of first buffer
+   * p_busXCStride: distance (in bytes) between buffers
+   * p_busXCVersion: topology version when arena was allocated
+   * p_busDirectXC: ghost updates use arena directly
+   */
+  char *p_busXCArena;
+  char *p_busXCBase;
+  int p_busXCStride;
+  int p_busXCVersion;
+  bool p_busDirectXC;
+
   /**
    * Vector of buffers for exchange of branch data to ghost branches
    */
@@ -2583,6 +3075,16 @@ private:
   bool p_allocatedBranch;
   bool p_external_branch;
 
+  /**
+   * Contiguous storage for branch exchange buffers allocated by
+   * allocXCBranch. Layout is the same as for buses.
+   */
+  char *p_branchXCArena;
+  char *p_branchXCBase;
+  int p_branchXCStride;
+  int p_branchXCVersion;
+  bool p_branchDirectXC;
+
   /**
    * Global array handle and other parameters used for bus exchanges
    * Note that p_(in)activeBusIndices must be a int** pointer to match syntax of GA
@@ -2615,6 +3117,22 @@ private:
   void *p_branchSndBuf;
   void *p_branchRcvBuf;
 
+  /**
+   * Method used to update ghost buses and branches and point-to-point
+   * exchange schedules, if that method is used
+   */
+  GhostExchangeType p_ghostExchange;
+  boost::shared_ptr<GhostExchange> p_busExchange;
+  boost::shared_ptr<GhostExchange> p_branchExchange;
+
+  /**
+   * Active buses with and without ghost neighbors and the topology version
+   * that they were evaluated for
+   */
+  std::vector<int> p_interiorBuses;
+  std::vector<int> p_boundaryBuses;
+  int p_interiorVersion;
+
   /**
    * Map structures that can map between Original and local indices
    */
@@ -2626,6 +3144,21 @@ private:
    */
   boost::shared_ptr<gridpack::component::DataCollection> p_network_data;
 
+  /**
+   * Counter that is incremented each time the network topology changes
+   */
+  int p_topologyVersion;
+
+  /**
+   * Local indices of buses and branches marked dirty, flags to avoid adding
+   * them to the lists more than once and topology version the lists refer to
+   */
+  std::vector<int> p_dirtyBuses;
+  std::vector<int> p_dirtyBranches;
+  std::vector<char> p_busDirty;
+  std::vector<char> p_branchDirty;
+  int p_dirtyVersion;
+
   /**
    * suppress printing in network
    */
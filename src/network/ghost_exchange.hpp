@@ -0,0 +1,439 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ghost_exchange.hpp
+ * @author Bruce Palmer
+ *
+ * @brief  Point-to-point exchange of data between active network
+ * components and their ghost copies on other processors
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _ghost_exchange_h_
+#define _ghost_exchange_h_
+
+#include <vector>
+#include <map>
+#include <mpi.h>
+#include "gridpack/utilities/exception.hpp"
+
+namespace gridpack {
+namespace network {
+
+/**
+ * Methods that can be used to update ghost buses and branches
+ */
+enum GhostExchangeType {
+  GAExchange,                 /**< scatter/gather through a global array */
+  P2PExchange                 /**< point-to-point messages between neighbors */
+};
+
+// -------------------------------------------------------------
+// A class that exchanges fixed size buffers between locally owned
+// network components and their ghost copies on other processors
+// using nonblocking point-to-point messages. A schedule of the
+// processors that each processor needs to talk to, and which
+// buffers go to each of them, is set up once. Data is sent and
+// received directly from the exchange buffers of individual
+// components using MPI derived datatypes, so no intermediate copies
+// are needed.
+// -------------------------------------------------------------
+class GhostExchange {
+public:
+
+/**
+ * Constructor
+ * @param comm communicator that the network is defined on
+ */
+GhostExchange(MPI_Comm comm)
+  : p_buffers(NULL), p_bufSize(0), p_active(false)
+{
+  MPI_Comm_dup(comm, &p_comm);
+  MPI_Comm_rank(p_comm, &p_me);
+  MPI_Comm_size(p_comm, &p_nprocs);
+}
+
+/**
+ * Destructor
+ */
+~GhostExchange(void)
+{
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (finalized) return;
+  if (p_active) end();
+  freeTypes();
+  MPI_Comm_free(&p_comm);
+}
+
+/**
+ * Evaluate the communication schedule. This is a collective operation.
+ * Each global index must be owned by exactly one processor.
+ * @param ownedGlobal global indices of locally owned elements
+ * @param ownedLocal local indices of locally owned elements
+ * @param ghostGlobal global indices of ghost elements
+ * @param ghostLocal local indices of ghost elements
+ */
+void setup(const std::vector<int> &ownedGlobal,
+    const std::vector<int> &ownedLocal,
+    const std::vector<int> &ghostGlobal,
+    const std::vector<int> &ghostLocal)
+{
+  int i, j, n;
+  freeTypes();
+  p_sendProcs.clear();
+  p_sendIndices.clear();
+  p_recvProcs.clear();
+  p_recvIndices.clear();
+  p_buffers = NULL;
+  p_bufSize = 0;
+
+  // Register owners of global indices with a directory that is distributed
+  // over all processors using the global index modulo the number of
+  // processors
+  std::vector<std::vector<int> > regList(p_nprocs);
+  n = ownedGlobal.size();
+  for (i=0; i<n; i++) {
+    regList[ownedGlobal[i]%p_nprocs].push_back(ownedGlobal[i]);
+  }
+  std::vector<int> regSrc;
+  std::vector<int> regRecv;
+  exchangeLists(regList, regRecv, regSrc);
+  std::map<int,int> directory;
+  n = regRecv.size();
+  for (i=0; i<n; i++) {
+    directory.insert(std::pair<int,int>(regRecv[i], regSrc[i]));
+  }
+
+  // Ask the directory for the owners of ghost elements
+  std::vector<std::vector<int> > queryList(p_nprocs);
+  n = ghostGlobal.size();
+  for (i=0; i<n; i++) {
+    queryList[ghostGlobal[i]%p_nprocs].push_back(ghostGlobal[i]);
+  }
+  std::vector<int> querySrc;
+  std::vector<int> queryRecv;
+  exchangeLists(queryList, queryRecv, querySrc);
+  std::vector<std::vector<int> > replyList(p_nprocs);
+  n = queryRecv.size();
+  std::map<int,int>::iterator it;
+  for (i=0; i<n; i++) {
+    it = directory.find(queryRecv[i]);
+    if (it == directory.end()) {
+      char buf[256];
+      sprintf(buf,"GhostExchange::setup: no owner found for global"
+          " index: %d\n",queryRecv[i]);
+      throw gridpack::Exception(buf);
+    }
+    replyList[querySrc[i]].push_back(it->second);
+  }
+  // Replies come back in the same order that queries were sent, so
+  // owners can be matched with ghost elements by walking through the
+  // query lists
+  std::vector<int> replySrc;
+  std::vector<int> replyRecv;
+  exchangeLists(replyList, replyRecv, replySrc);
+  std::map<int,int> owner;
+  n = replyRecv.size();
+  std::vector<int> qcnt(p_nprocs,0);
+  for (i=0; i<n; i++) {
+    j = replySrc[i];
+    owner.insert(std::pair<int,int>(queryList[j][qcnt[j]], replyRecv[i]));
+    qcnt[j]++;
+  }
+
+  // Send list of requested global indices to each owner. Ghost data
+  // will arrive from each owner in the order it was requested.
+  std::vector<std::vector<int> > reqList(p_nprocs);
+  std::vector<std::vector<int> > recvLocal(p_nprocs);
+  n = ghostGlobal.size();
+  for (i=0; i<n; i++) {
+    j = owner[ghostGlobal[i]];
+    reqList[j].push_back(ghostGlobal[i]);
+    recvLocal[j].push_back(ghostLocal[i]);
+  }
+  std::vector<int> reqSrc;
+  std::vector<int> reqRecv;
+  exchangeLists(reqList, reqRecv, reqSrc);
+
+  // Build send schedule from requests
+  std::map<int,int> localIndex;
+  n = ownedGlobal.size();
+  for (i=0; i<n; i++) {
+    localIndex.insert(std::pair<int,int>(ownedGlobal[i], ownedLocal[i]));
+  }
+  std::vector<std::vector<int> > sendLocal(p_nprocs);
+  n = reqRecv.size();
+  for (i=0; i<n; i++) {
+    sendLocal[reqSrc[i]].push_back(localIndex[reqRecv[i]]);
+  }
+  for (i=0; i<p_nprocs; i++) {
+    if (sendLocal[i].size() > 0) {
+      p_sendProcs.push_back(i);
+      p_sendIndices.push_back(sendLocal[i]);
+    }
+    if (recvLocal[i].size() > 0) {
+      p_recvProcs.push_back(i);
+      p_recvIndices.push_back(recvLocal[i]);
+    }
+  }
+}
+
+/**
+ * Start exchange of data. Data in buffers of locally owned elements
+ * must not be modified, and data in buffers of ghost elements must not be
+ * used, until end() is called.
+ * @param buffers array of pointers to exchange buffers, indexed by local index
+ * @param size size (in bytes) of each buffer
+ */
+void begin(void **buffers, int size)
+{
+  if (p_active) {
+    char buf[256];
+    sprintf(buf,"GhostExchange::begin: exchange already in progress\n");
+    throw gridpack::Exception(buf);
+  }
+  if (buffersChanged(buffers, size)) buildTypes(buffers, size);
+  int i;
+  int nrecv = p_recvProcs.size();
+  int nsend = p_sendProcs.size();
+  p_requests.resize(nrecv+nsend);
+  for (i=0; i<nrecv; i++) {
+    MPI_Irecv(MPI_BOTTOM, 1, p_recvTypes[i], p_recvProcs[i], 0, p_comm,
+        &p_requests[i]);
+  }
+  for (i=0; i<nsend; i++) {
+    MPI_Isend(MPI_BOTTOM, 1, p_sendTypes[i], p_sendProcs[i], 0, p_comm,
+        &p_requests[nrecv+i]);
+  }
+  p_active = true;
+}
+
+/**
+ * Complete exchange of data started by begin()
+ */
+void end(void)
+{
+  if (!p_active) return;
+  if (p_requests.size() > 0) {
+    MPI_Waitall(p_requests.size(), &p_requests[0], MPI_STATUSES_IGNORE);
+  }
+  p_active = false;
+}
+
+/**
+ * Exchange data between locally owned elements and ghosts
+ * @param buffers array of pointers to exchange buffers, indexed by local index
+ * @param size size (in bytes) of each buffer
+ */
+void exchange(void **buffers, int size)
+{
+  begin(buffers, size);
+  end();
+}
+
+/**
+ * Check whether an exchange has been started but not completed
+ * @return true if exchange is in progress
+ */
+bool active(void) const
+{
+  return p_active;
+}
+
+/**
+ * Return number of processors that receive data from this processor
+ * @return number of neighboring processors
+ */
+int numSendNeighbors(void) const
+{
+  return p_sendProcs.size();
+}
+
+/**
+ * Return number of processors that send data to this processor
+ * @return number of neighboring processors
+ */
+int numRecvNeighbors(void) const
+{
+  return p_recvProcs.size();
+}
+
+private:
+
+/**
+ * Send a list of integers to every processor and receive lists from every
+ * processor. This is a collective operation.
+ * @param sendList list of values destined for each processor
+ * @param recvList all values received by this processor
+ * @param recvSrc processor that each received value came from
+ */
+void exchangeLists(const std::vector<std::vector<int> > &sendList,
+    std::vector<int> &recvList, std::vector<int> &recvSrc)
+{
+  int i, j;
+  std::vector<int> sendNum(p_nprocs), recvNum(p_nprocs);
+  std::vector<int> sendOffset(p_nprocs), recvOffset(p_nprocs);
+  for (i=0; i<p_nprocs; i++) sendNum[i] = sendList[i].size();
+  MPI_Alltoall(&sendNum[0],1,MPI_INT,&recvNum[0],1,MPI_INT,p_comm);
+  sendOffset[0] = 0;
+  recvOffset[0] = 0;
+  for (i=1; i<p_nprocs; i++) {
+    sendOffset[i] = sendOffset[i-1] + sendNum[i-1];
+    recvOffset[i] = recvOffset[i-1] + recvNum[i-1];
+  }
+  int nsend = sendOffset[p_nprocs-1] + sendNum[p_nprocs-1];
+  int nrecv = recvOffset[p_nprocs-1] + recvNum[p_nprocs-1];
+  // Pad buffers so that addresses of first elements are always valid
+  std::vector<int> sendBuf(nsend+1), recvBuf(nrecv+1);
+  for (i=0; i<p_nprocs; i++) {
+    for (j=0; j<sendNum[i]; j++) {
+      sendBuf[sendOffset[i]+j] = sendList[i][j];
+    }
+  }
+  MPI_Alltoallv(&sendBuf[0], &sendNum[0], &sendOffset[0], MPI_INT,
+      &recvBuf[0], &recvNum[0], &recvOffset[0], MPI_INT, p_comm);
+  recvList.resize(nrecv);
+  recvSrc.resize(nrecv);
+  for (i=0; i<p_nprocs; i++) {
+    for (j=0; j<recvNum[i]; j++) {
+      recvList[recvOffset[i]+j] = recvBuf[recvOffset[i]+j];
+      recvSrc[recvOffset[i]+j] = i;
+    }
+  }
+}
+
+/**
+ * Check whether the exchange buffers of any element in the schedule have
+ * moved since the datatypes were built
+ * @param buffers array of pointers to exchange buffers
+ * @param size size of each buffer
+ * @return true if datatypes need to be rebuilt
+ */
+bool buffersChanged(void **buffers, int size)
+{
+  if (buffers != p_buffers || size != p_bufSize) return true;
+  int i, j, n;
+  int icnt = 0;
+  n = p_sendIndices.size();
+  for (i=0; i<n; i++) {
+    for (j=0; j<p_sendIndices[i].size(); j++) {
+      if (buffers[p_sendIndices[i][j]] != p_addresses[icnt]) return true;
+      icnt++;
+    }
+  }
+  n = p_recvIndices.size();
+  for (i=0; i<n; i++) {
+    for (j=0; j<p_recvIndices[i].size(); j++) {
+      if (buffers[p_recvIndices[i][j]] != p_addresses[icnt]) return true;
+      icnt++;
+    }
+  }
+  return false;
+}
+
+/**
+ * Build datatypes describing the location of exchange buffers for each
+ * neighboring processor
+ * @param buffers array of pointers to exchange buffers
+ * @param size size of each buffer
+ */
+void buildTypes(void **buffers, int size)
+{
+  int i, j, n;
+  freeTypes();
+  p_buffers = buffers;
+  p_bufSize = size;
+  p_addresses.clear();
+  n = p_sendIndices.size();
+  p_sendTypes.resize(n);
+  for (i=0; i<n; i++) {
+    p_sendTypes[i] = createType(buffers, p_sendIndices[i], size);
+    for (j=0; j<p_sendIndices[i].size(); j++) {
+      p_addresses.push_back(buffers[p_sendIndices[i][j]]);
+    }
+  }
+  n = p_recvIndices.size();
+  p_recvTypes.resize(n);
+  for (i=0; i<n; i++) {
+    p_recvTypes[i] = createType(buffers, p_recvIndices[i], size);
+    for (j=0; j<p_recvIndices[i].size(); j++) {
+      p_addresses.push_back(buffers[p_recvIndices[i][j]]);
+    }
+  }
+}
+
+/**
+ * Create a datatype describing a list of buffers at absolute addresses
+ * @param buffers array of pointers to exchange buffers
+ * @param indices local indices of buffers in datatype
+ * @param size size of each buffer
+ * @return committed datatype
+ */
+MPI_Datatype createType(void **buffers, const std::vector<int> &indices,
+    int size)
+{
+  int i;
+  int n = indices.size();
+  std::vector<int> lengths(n, size);
+  std::vector<MPI_Aint> displ(n);
+  for (i=0; i<n; i++) {
+    MPI_Get_address(buffers[indices[i]], &displ[i]);
+  }
+  MPI_Datatype type;
+  MPI_Type_create_hindexed(n, &lengths[0], &displ[0], MPI_BYTE, &type);
+  MPI_Type_commit(&type);
+  return type;
+}
+
+/**
+ * Release datatypes
+ */
+void freeTypes(void)
+{
+  int i;
+  for (i=0; i<p_sendTypes.size(); i++) MPI_Type_free(&p_sendTypes[i]);
+  for (i=0; i<p_recvTypes.size(); i++) MPI_Type_free(&p_recvTypes[i]);
+  p_sendTypes.clear();
+  p_recvTypes.clear();
+  p_buffers = NULL;
+  p_bufSize = 0;
+}
+
+/**
+ * Data elements of exchange
+ * p_comm: private copy of network communicator
+ * p_sendProcs, p_recvProcs: neighboring processors
+ * p_sendIndices, p_recvIndices: local indices of elements sent to, or
+ *      received from, each neighbor
+ * p_sendTypes, p_recvTypes: datatypes for each neighbor
+ * p_buffers, p_bufSize, p_addresses: exchange buffers used to build datatypes
+ * p_requests: outstanding requests
+ * p_active: exchange is in progress
+ */
+MPI_Comm                              p_comm;
+int                                   p_me;
+int                                   p_nprocs;
+std::vector<int>                      p_sendProcs;
+std::vector<std::vector<int> >        p_sendIndices;
+std::vector<int>                      p_recvProcs;
+std::vector<std::vector<int> >        p_recvIndices;
+std::vector<MPI_Datatype>             p_sendTypes;
+std::vector<MPI_Datatype>             p_recvTypes;
+void                                  **p_buffers;
+int                                   p_bufSize;
+std::vector<void*>                    p_addresses;
+std::vector<MPI_Request>              p_requests;
+bool                                  p_active;
+};
+
+}  // namespace network
+}  // namespace gridpack
+
+#endif
@@ -584,6 +584,33 @@ BOOST_AUTO_TEST_CASE( TestNetworkTopology )
       *iptr = -1;
     }
   }
+  // Exchange buffers should be stored contiguously with buffers for active
+  // buses ahead of buffers for ghost buses
+  ok = true;
+  char *lastActive = NULL;
+  char *firstGhost = NULL;
+  for (i=0; i<nbus; i++) {
+    char *cptr = (char*)network.getXCBusBuffer(i);
+    if (network.getActiveBus(i)) {
+      if (lastActive != NULL && cptr <= lastActive) ok = false;
+      lastActive = cptr;
+    } else if (firstGhost == NULL) {
+      firstGhost = cptr;
+    }
+  }
+  if (lastActive != NULL && firstGhost != NULL && firstGhost <= lastActive) {
+    ok = false;
+  }
+  oks = (int)ok;
+  ierr = MPI_Allreduce(&oks, &okr, 1, MPI_INT, MPI_PROD, mpi_world);
+  ok = (bool)okr;
+  if (me == 0 && ok) {
+    printf("\nExchange buffer layout ok\n");
+  } else if (!ok) {
+    printf("\nExchange buffers out of order on %d\n",me);
+  }
+  BOOST_CHECK(ok);
+
   network.initBusUpdate();
   network.initBranchUpdate();
 
@@ -629,6 +656,103 @@ BOOST_AUTO_TEST_CASE( TestNetworkTopology )
   }
   BOOST_CHECK(ok);
 
+  // Repeat ghost update using point-to-point exchanges
+  for (i=0; i<nbus; i++) {
+    iptr = (int*)network.getXCBusBuffer(i);
+    if (!network.getActiveBus(i)) *iptr = -1;
+  }
+  for (i=0; i<nbranch; i++) {
+    iptr = (int*)network.getXCBranchBuffer(i);
+    if (!network.getActiveBranch(i)) *iptr = -1;
+  }
+  network.setGhostExchange(gridpack::network::P2PExchange);
+  network.initBusUpdate();
+  network.initBranchUpdate();
+
+  network.updateBuses();
+  network.updateBranches();
+
+  ok = true;
+  for (i=0; i<nbus; i++) {
+    iptr = (int*)network.getXCBusBuffer(i);
+    if (!network.getActiveBus(i)) {
+      if (*iptr != network.getGlobalBusIndex(i)) {
+        ok = false;
+      }
+    }
+  }
+  for (i=0; i<nbranch; i++) {
+    iptr = (int*)network.getXCBranchBuffer(i);
+    if (!network.getActiveBranch(i)) {
+      if (*iptr != network.getGlobalBranchIndex(i)) {
+        ok = false;
+      }
+    }
+  }
+  oks = (int)ok;
+  ierr = MPI_Allreduce(&oks, &okr, 1, MPI_INT, MPI_PROD, mpi_world);
+  ok = (bool)okr;
+  if (me == 0 && ok) {
+    printf("\nPoint-to-point ghost update ok\n");
+  } else if (!ok) {
+    printf("\nMismatched point-to-point ghost update on %d\n",me);
+  }
+  BOOST_CHECK(ok);
+
+  // Test split-phase bus updates for both exchange methods. Interior buses
+  // should not be connected to any ghost buses
+  int imode;
+  for (imode=0; imode<2; imode++) {
+    if (imode == 0) {
+      network.setGhostExchange(gridpack::network::P2PExchange);
+    } else {
+      network.setGhostExchange(gridpack::network::GAExchange);
+    }
+    network.initBusUpdate();
+    for (i=0; i<nbus; i++) {
+      iptr = (int*)network.getXCBusBuffer(i);
+      if (!network.getActiveBus(i)) *iptr = -1;
+    }
+    network.beginUpdateBuses();
+    ok = true;
+    const std::vector<int> &interior = network.getInteriorBuses();
+    const std::vector<int> &boundary = network.getBoundaryBuses();
+    n = 0;
+    for (i=0; i<nbus; i++) {
+      if (network.getActiveBus(i)) n++;
+    }
+    if (interior.size()+boundary.size() != n) {
+      printf("p[%d] Interior buses: %d boundary buses: %d active buses: %d\n",
+          me,static_cast<int>(interior.size()),
+          static_cast<int>(boundary.size()),n);
+      ok = false;
+    }
+    for (i=0; i<interior.size(); i++) {
+      std::vector<int> nghbrs = network.getConnectedBuses(interior[i]);
+      for (j=0; j<nghbrs.size(); j++) {
+        if (!network.getActiveBus(nghbrs[j])) ok = false;
+      }
+    }
+    network.endUpdateBuses();
+    for (i=0; i<nbus; i++) {
+      iptr = (int*)network.getXCBusBuffer(i);
+      if (!network.getActiveBus(i)) {
+        if (*iptr != network.getGlobalBusIndex(i)) {
+          ok = false;
+        }
+      }
+    }
+    oks = (int)ok;
+    ierr = MPI_Allreduce(&oks, &okr, 1, MPI_INT, MPI_PROD, mpi_world);
+    ok = (bool)okr;
+    if (me == 0 && ok) {
+      printf("\nSplit-phase bus update ok for mode %d\n",imode);
+    } else if (!ok) {
+      printf("\nMismatched split-phase bus update on %d for mode %d\n",me,imode);
+    }
+    BOOST_CHECK(ok);
+  }
+
   network.freeXCBus();
   network.freeXCBranch();
 
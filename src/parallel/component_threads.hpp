@@ -0,0 +1,103 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   component_threads.hpp
+ *
+ * @brief  Number of threads used for loops over network components
+ * within each process
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _component_threads_hpp_
+#define _component_threads_hpp_
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace gridpack {
+namespace parallel {
+
+// -------------------------------------------------------------
+//  class ComponentThreads
+// -------------------------------------------------------------
+/**
+ * Factory and mapper loops over all buses or branches on a process can
+ * be split over several threads if GridPACK is built with OpenMP
+ * (USE_OPENMP). Threads take chunks of consecutive components from the
+ * loop as they finish their previous chunk, so cheap and expensive
+ * components balance out. The number of threads is one unless it is
+ * set, usually from the threadsPerProcess field of the input deck, in
+ * which case fewer MPI processes can be run per node.
+ *
+ * Component methods called from threaded loops may only modify the
+ * component they are called on.
+ */
+class ComponentThreads {
+public:
+
+  /**
+   * Set number of threads used in component loops. This has no effect if
+   * GridPACK was not built with OpenMP
+   * @param nthreads number of threads (values less than one are ignored)
+   */
+  static void setNumThreads(int nthreads)
+  {
+#ifdef _OPENMP
+    if (nthreads < 1) return;
+    if (nthreads > omp_get_max_threads()) nthreads = omp_get_max_threads();
+    p_data().nthreads = nthreads;
+#endif
+  }
+
+  /**
+   * @return number of threads used in component loops
+   */
+  static int numThreads(void)
+  {
+    return p_data().nthreads;
+  }
+
+  /**
+   * Set number of consecutive components handed to a thread at a time
+   * @param chunk number of components (values less than one are ignored)
+   */
+  static void setChunkSize(int chunk)
+  {
+    if (chunk > 0) p_data().chunk = chunk;
+  }
+
+  /**
+   * @return number of consecutive components handed to a thread at a time
+   */
+  static int chunkSize(void)
+  {
+    return p_data().chunk;
+  }
+
+private:
+
+  struct Data {
+    int nthreads;
+    int chunk;
+    Data(void) : nthreads(1), chunk(16) {}
+  };
+
+  static Data& p_data(void)
+  {
+    static Data data;
+    return data;
+  }
+};
+
+}  // namespace parallel
+}  // namespace gridpack
+
+#endif
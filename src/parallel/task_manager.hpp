@@ -21,7 +21,11 @@
 #define _task_manager_hpp_
 
 #include "gridpack/parallel/communicator.hpp"
+#include "gridpack/utilities/exception.hpp"
 #include <ga.h>
+#include <mpi.h>
+#include <vector>
+#include <algorithm>
 
 namespace gridpack {
 namespace parallel {
@@ -29,6 +33,17 @@ namespace parallel {
 // -------------------------------------------------------------
 //  class TaskManager
 // -------------------------------------------------------------
+/**
+ * Hands out tasks to processors or groups of processors from a shared GA
+ * counter. By default tasks are handed out in order, one at a time. If
+ * cost estimates are supplied to set, the most expensive tasks are handed
+ * out first so that long tasks do not end up at the tail of the run. Tasks
+ * can also be taken from the counter in chunks to reduce contention on the
+ * counter when there are many processors. The wall clock time of each task,
+ * measured from the nextTask call that returns it to the following
+ * nextTask call, is recorded and can be used as the cost estimate for the
+ * next set of similar calculations.
+ */
 class TaskManager {
 public:
 
@@ -48,6 +63,12 @@ public:
     }
     GA_Zero(p_GAcounter);
     p_ntasks = 0;
+    p_task_count = 0;
+    p_chunk = 1;
+    p_chunkNext = 0;
+    p_chunkEnd = 0;
+    p_current = -1;
+    p_start = 0.0;
   }
 
   /**
@@ -67,6 +88,12 @@ public:
     }
     GA_Zero(p_GAcounter);
     p_ntasks = 0;
+    p_task_count = 0;
+    p_chunk = 1;
+    p_chunkNext = 0;
+    p_chunkEnd = 0;
+    p_current = -1;
+    p_start = 0.0;
   }
 
   /**
@@ -86,6 +113,69 @@ public:
     GA_Zero(p_GAcounter);
     p_ntasks = ntasks;
     p_task_count = 0;
+    p_order.clear();
+    resetTasks();
+  }
+
+  /**
+   * Specify total number of tasks along with an estimate of the cost of each
+   * task and set task manager to zero. Tasks are handed out in order of
+   * decreasing cost. Tasks with equal costs are handed out in order of
+   * their index. This must be called with the same costs on all processors
+   * @param ntasks total number of tasks
+   * @param costs estimated cost of each task (e.g. the times returned by
+   *        getTaskTimes for a previous calculation)
+   */
+  void set(int ntasks, const std::vector<double> &costs)
+  {
+    if (costs.size() != ntasks) {
+      char buf[256];
+      sprintf(buf,"TaskManager::set: number of costs %d does not match"
+          " number of tasks %d\n",static_cast<int>(costs.size()),ntasks);
+      printf("%s",buf);
+      throw gridpack::Exception(buf);
+    }
+    GA_Zero(p_GAcounter);
+    p_ntasks = ntasks;
+    p_task_count = 0;
+    std::vector<std::pair<double,int> > order(ntasks);
+    int i;
+    for (i=0; i<ntasks; i++) {
+      order[i] = std::make_pair(-costs[i],i);
+    }
+    std::sort(order.begin(),order.end());
+    p_order.resize(ntasks);
+    for (i=0; i<ntasks; i++) p_order[i] = order[i].second;
+    resetTasks();
+  }
+
+  /**
+   * Set the number of tasks taken from the shared counter at a time. Larger
+   * chunks reduce contention on the counter but make the distribution of
+   * the last tasks coarser. This should be called with the same value on
+   * all processors before set
+   * @param chunk number of tasks (values less than one are ignored)
+   */
+  void setChunkSize(int chunk)
+  {
+    if (chunk > 0) p_chunk = chunk;
+  }
+
+  /**
+   * Get the wall clock time spent on each task. This is a collective
+   * operation on the communicator used to create the task manager and
+   * should be called after nextTask has returned false on all processors.
+   * For tasks run on a group of processors, the time is measured on the
+   * first processor in the group.
+   * @param times time spent on each task (zero for tasks that were not run)
+   */
+  void getTaskTimes(std::vector<double> &times)
+  {
+    times = p_taskTime;
+    times.resize(p_ntasks,0.0);
+    char plus[2];
+    strcpy(plus,"+");
+    if (p_ntasks > 0) GA_Pgroup_dgop(p_grp,&times[0],p_ntasks,plus);
   }
   
   /**
@@ -97,10 +187,17 @@ public:
    */
   bool nextTask(int *next) {
     int zero = 0;
-    long one = 1;
-    *next = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero,one));
-    if (*next < p_ntasks) {
+    stopTask();
+    if (p_chunkNext >= p_chunkEnd) {
+      p_chunkNext = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero,
+            static_cast<long>(p_chunk)));
+      p_chunkEnd = std::min(p_chunkNext+p_chunk,p_ntasks);
+    }
+    if (p_chunkNext < p_ntasks) {
+      *next = taskIndex(p_chunkNext);
+      p_chunkNext++;
       p_task_count++;
+      startTask(*next);
       return true;
     } else {
       *next = -1;
@@ -123,16 +220,26 @@ public:
     int zero = 0;
     long one = 1;
     int me = comm.rank();
-    if (me == 0) {
-      *next = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero,one));
-    } else {
-      *next = 0;
+    if (me == 0) stopTask();
+    // All processors in comm take the same chunks, so they all agree on
+    // when a new chunk is needed
+    if (p_chunkNext >= p_chunkEnd) {
+      if (me == 0) {
+        p_chunkNext = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero,
+              static_cast<long>(p_chunk)));
+      } else {
+        p_chunkNext = 0;
+      }
+      char plus[2];
+      strcpy(plus,"+");
+      GA_Pgroup_igop(comm.getGroup(),&p_chunkNext,one,plus);
+      p_chunkEnd = std::min(p_chunkNext+p_chunk,p_ntasks);
     }
-    char plus[2];
-    strcpy(plus,"+");
-    GA_Pgroup_igop(comm.getGroup(),next,one,plus);
-    if (*next < p_ntasks) {
+    if (p_chunkNext < p_ntasks) {
+      *next = taskIndex(p_chunkNext);
+      p_chunkNext++;
       p_task_count++;
+      if (me == 0) startTask(*next);
       return true;
     } else {
       *next = -1;
@@ -150,6 +257,8 @@ public:
   void cancel(void) {
     int zero = 0;
     int n = static_cast<int>(NGA_Read_inc(p_GAcounter,&zero, p_ntasks));
+    // Drop any tasks left in the current chunk
+    p_chunkNext = p_chunkEnd;
   }
 
   /**
@@ -175,11 +284,68 @@ public:
   }
 
 protected:
+
+  /**
+   * Clear chunk and timing information for a new set of tasks
+   */
+  void resetTasks(void)
+  {
+    p_chunkNext = 0;
+    p_chunkEnd = 0;
+    p_current = -1;
+    p_taskTime.assign(p_ntasks,0.0);
+  }
+
+  /**
+   * Convert a position in the sequence of handed out tasks to a task index
+   * @param pos position in sequence
+   * @return task index
+   */
+  int taskIndex(int pos) const
+  {
+    if (p_order.empty()) return pos;
+    return p_order[pos];
+  }
+
+  /**
+   * Start timing a task
+   * @param task task index
+   */
+  void startTask(int task)
+  {
+    p_current = task;
+    p_start = MPI_Wtime();
+  }
+
+  /**
+   * Stop timing the current task, if there is one
+   */
+  void stopTask(void)
+  {
+    if (p_current < 0) return;
+    p_taskTime[p_current] += MPI_Wtime()-p_start;
+    p_current = -1;
+  }
   
   int p_GAcounter;
   int p_ntasks;
   int p_grp;
   int p_task_count;
+
+  // order in which tasks are handed out if costs were supplied
+  std::vector<int> p_order;
+
+  // number of tasks taken from the counter at a time and the part of the
+  // current chunk that has not been handed out yet
+  int p_chunk;
+  int p_chunkNext;
+  int p_chunkEnd;
+
+  // task currently being timed, the time it started and the time spent on
+  // each task handed out on this processor
+  int p_current;
+  double p_start;
+  std::vector<double> p_taskTime;
 };
 
 
@@ -25,6 +25,7 @@
 // -------------------------------------------------------------
 
 #include <iostream>
+#include <vector>
 #include <ga.h>
 #include "gridpack/parallel/parallel.hpp"
 #include "gridpack/parallel/task_manager.hpp"
@@ -80,6 +81,39 @@ main(int argc, char **argv)
             itask,lcomm.rank(),me,lcomm.size());
       }
     }
+    // Hand out tasks in chunks with costs that increase with the task index.
+    // Every task should be handed out exactly once and, on one processor,
+    // in order of decreasing index
+    {
+      std::vector<double> costs(ntasks);
+      for (i=0; i<ntasks; i++) costs[i] = static_cast<double>(i);
+      std::vector<int> count(ntasks,0);
+      tskmgr.setChunkSize(3);
+      tskmgr.set(ntasks,costs);
+      int last = ntasks;
+      int ordered = 1;
+      while(tskmgr.nextTask(&itask)) {
+        count[itask]++;
+        if (itask > last) ordered = 0;
+        last = itask;
+      }
+      world.sum(&count[0],ntasks);
+      int ok = 1;
+      for (i=0; i<ntasks; i++) if (count[i] != 1) ok = 0;
+      if (nprocs == 1 && !ordered) ok = 0;
+      std::vector<double> times;
+      tskmgr.getTaskTimes(times);
+      if (times.size() != ntasks) ok = 0;
+      if (me == 0) {
+        if (ok) {
+          printf("\nTasks with costs handed out correctly\n");
+        } else {
+          printf("\nError handing out tasks with costs\n");
+        }
+      }
+      tskmgr.setChunkSize(1);
+    }
+
     // Check performance of task manager. Create a very large number of tasks.
     ntasks = 1000000*nprocs;
     tskmgr.set(ntasks);
@@ -144,6 +144,7 @@ class MAT_parser : public BaseParser<_network>
       this->setCaseID(p_case_id);
       p_network->broadcastNetworkData(0);
       p_network_data = p_network->getNetworkData();
+      if (this->p_distribute) brdcst_data();
       this->createNetwork(p_busData,p_branchData);
       printf("p[%d] Total buses: %d Total branches: %d\n",p_network->communicator().rank(),
           p_network->numBuses(),p_network->numBranches());
@@ -578,105 +579,9 @@ class MAT_parser : public BaseParser<_network>
     void brdcst_data(void)
     {
       int t_brdcst = p_timer->createCategory("Parser:brdcst_data");
-      int t_serial = p_timer->createCategory("Parser:data packing and unpacking");
-      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
-      int me(p_network->communicator().rank());
-      int nprocs(p_network->communicator().size());
-      if (nprocs == 1) return;
       p_timer->start(t_brdcst);
-
-      // find number of buses and branches and broadcast this information to
-      // all processors
-      int sbus, sbranch;
-      if (me == 0) {
-        sbus = p_busData.size();
-        sbranch = p_branchData.size();
-      } else {
-        sbus = 0;
-        sbranch = 0;
-      }
-      int ierr, nbus, nbranch;
-      ierr = MPI_Allreduce(&sbus, &nbus, 1, MPI_INT, MPI_SUM, comm);
-      ierr = MPI_Allreduce(&sbranch, &nbranch, 1, MPI_INT, MPI_SUM, comm);
-      double rprocs = static_cast<double>(nprocs);
-      double rme = static_cast<double>(me);
-      int n, i;
-      std::vector<gridpack::component::DataCollection>recvV;
-      // distribute buses
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbus)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbus)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbus)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbus)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      int nsize = recvV.size();
-      p_busData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_busData.push_back(data);
-      }
-      p_timer->stop(t_serial);
-      recvV.clear();
-      // distribute branches
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbranch)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbranch)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbranch)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbranch)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      nsize = recvV.size();
-      p_branchData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_branchData.push_back(data);
-      }
-      p_timer->stop(t_serial);
+      this->distributeData(p_busData);
+      this->distributeData(p_branchData);
       p_timer->stop(t_brdcst);
     }
 
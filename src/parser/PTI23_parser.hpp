@@ -27,6 +27,7 @@
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/parser/base_parser.hpp"
 #include "gridpack/parser/base_pti_parser.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 #include "gridpack/parser/hash_distr.hpp"
 
 #define TERM_CHAR '0'
@@ -79,7 +80,7 @@ class PTI23_parser : public BasePTIParser<_network>
       p_check_v23 = true;
       if (ext == "raw") {
         getCase(tmpstr);
-        //brdcst_data();
+        if (this->p_distribute) brdcst_data();
         this->createNetwork(p_busData,p_branchData);
       } else if (ext == "dyr") {
         this->getDS(tmpstr);
@@ -231,6 +232,7 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_buses(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
       int                  index = 0;
       int                  o_idx;
       std::getline(input, line);
@@ -239,17 +241,14 @@ class PTI23_parser : public BasePTIParser<_network>
       double pl,ql,bl,gl;
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(line,true);
         boost::shared_ptr<gridpack::component::DataCollection>
           data(new gridpack::component::DataCollection);
         int nstr = split_line.size();
         if (nstr > 12) p_check_v23 = false;
 
         // BUS_I               "I"                   integer
-        o_idx = atoi(split_line[0].c_str());
+        o_idx = split_line[0].toInt();
         data->addValue(BUS_NUMBER, o_idx);
         p_busData.push_back(data);
         p_busMap.insert(std::pair<int,int>(o_idx,index));
@@ -259,34 +258,37 @@ class PTI23_parser : public BasePTIParser<_network>
         data->addValue(CASE_ID, p_case_id);
 
         // BUS_NAME             "NAME"                 string
-        if (split_line[9].find_first_of('\'',0) != std::string::npos) {
-          gridpack::utility::StringUtils util;
-          util.trim(split_line[9]);
+        if (nstr > 9) {
+          std::string bus_name = split_line[9].str();
+          if (bus_name.find_first_of('\'',0) != std::string::npos) {
+            gridpack::utility::StringUtils util;
+            util.trim(bus_name);
+          }
+          data->addValue(BUS_NAME, bus_name.c_str());
         }
-        if (nstr > 9) data->addValue(BUS_NAME, split_line[9].c_str());
 
         // BUS_BASEKV           "BASKV"               float
-        if (nstr > 10) data->addValue(BUS_BASEKV, atof(split_line[10].c_str()));
+        if (nstr > 10) data->addValue(BUS_BASEKV, split_line[10].toDouble());
 
         // BUS_TYPE               "IDE"                   integer
-        if (nstr > 1) data->addValue(BUS_TYPE, atoi(split_line[1].c_str()));
+        if (nstr > 1) data->addValue(BUS_TYPE, split_line[1].toInt());
 
         // BUS_SHUNT_GL              "GL"                  float
         gl = 0.0;
         if (nstr > 4) {
-          gl = atof(split_line[4].c_str());
+          gl = split_line[4].toDouble();
         }
 
         // BUS_SHUNT_BL              "BL"                  float
         bl = 0.0;
         if (nstr > 5) {
-          bl = atof(split_line[5].c_str());
+          bl = split_line[5].toDouble();
         }
         if (gl != 0.0 || bl != 0.0) {
-          data->addValue(BUS_SHUNT_GL, atof(split_line[4].c_str()));
-          data->addValue(BUS_SHUNT_GL, atof(split_line[4].c_str()),0);
-          data->addValue(BUS_SHUNT_BL, atof(split_line[5].c_str()));
-          data->addValue(BUS_SHUNT_BL, atof(split_line[5].c_str()),0);
+          data->addValue(BUS_SHUNT_GL, split_line[4].toDouble());
+          data->addValue(BUS_SHUNT_GL, split_line[4].toDouble(),0);
+          data->addValue(BUS_SHUNT_BL, split_line[5].toDouble());
+          data->addValue(BUS_SHUNT_BL, split_line[5].toDouble(),0);
           data->addValue(SHUNT_BUSNUMBER,o_idx);
           int ival = 1;
           data->addValue(SHUNT_NUMBER,ival);
@@ -294,38 +296,38 @@ class PTI23_parser : public BasePTIParser<_network>
         }
 
         // BUS_ZONE            "ZONE"                integer
-        if (nstr > 11) data->addValue(BUS_ZONE, atoi(split_line[11].c_str()));
+        if (nstr > 11) data->addValue(BUS_ZONE, split_line[11].toInt());
 
         // BUS_AREA            "IA"                integer
-        if (nstr > 6) data->addValue(BUS_AREA, atoi(split_line[6].c_str()));
+        if (nstr > 6) data->addValue(BUS_AREA, split_line[6].toInt());
 
         // BUS_VOLTAGE_MAG              "VM"                  float
-        if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, atof(split_line[7].c_str()));
+        if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, split_line[7].toDouble());
 
         // BUS_VOLTAGE_ANG              "VA"                  float
-        if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, atof(split_line[8].c_str()));
+        if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, split_line[8].toDouble());
 
         // BUS_OWNER              "IA"                  integer
-        if (nstr > 6) data->addValue(BUS_OWNER, atoi(split_line[6].c_str()));
+        if (nstr > 6) data->addValue(BUS_OWNER, split_line[6].toInt());
 
         // LOAD_PL                "PL"                  float
         pl = 0.0;
         if (nstr > 2) {
-          pl = atof(split_line[2].c_str());
+          pl = split_line[2].toDouble();
         }
 
         // LOAD_QL                "QL"                  float
         ql = 0.0;
         if (nstr > 3) {
-          ql = atof(split_line[3].c_str());
+          ql = split_line[3].toDouble();
         }
         if (pl != 0.0 || ql != 0.0) {
-          data->addValue(LOAD_PL, atof(split_line[2].c_str()));
-          data->addValue(LOAD_PL, atof(split_line[2].c_str()),0);
+          data->addValue(LOAD_PL, split_line[2].toDouble());
+          data->addValue(LOAD_PL, split_line[2].toDouble(),0);
           std::string tmp("1 ");
           data->addValue(LOAD_ID,tmp.c_str(),0);
-          data->addValue(LOAD_QL, atof(split_line[3].c_str()));
-          data->addValue(LOAD_QL, atof(split_line[3].c_str()),0);
+          data->addValue(LOAD_QL, split_line[3].toDouble());
+          data->addValue(LOAD_QL, split_line[3].toDouble(),0);
           int ival = 1;
           data->addValue(LOAD_NUMBER,ival);
           data->addValue(LOAD_STATUS,ival,0);
@@ -344,20 +346,18 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_generators(std::ifstream & input, std::string &oldline, bool &parsed)
     {
       std::string          line;
+      RecordTokenizer split_line;
       if (parsed) {
         std::getline(input, line); //this should be the first line of the block
       } else {
         line = oldline;
       }
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(line,true);
 
         // GENERATOR_BUSNUMBER               "I"                   integer
         int l_idx, o_idx;
-        o_idx = atoi(split_line[0].c_str());
+        o_idx = split_line[0].toInt();
         std::map<int, int>::iterator it;
         int nstr = split_line.size();
         it = p_busMap.find(o_idx);
@@ -374,105 +374,104 @@ class PTI23_parser : public BasePTIParser<_network>
         if (!p_busData[l_idx]->getValue(GENERATOR_NUMBER, &ngen)) ngen = 0;
 
 
-        p_busData[l_idx]->addValue(GENERATOR_BUSNUMBER, atoi(split_line[0].c_str()), ngen);
+        p_busData[l_idx]->addValue(GENERATOR_BUSNUMBER, split_line[0].toInt(), ngen);
 
         // Clean up 2 character tag
-        gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[1]);
+        std::string tag = split_line[1].tag();
         // GENERATOR_ID              "ID"                  integer
         p_busData[l_idx]->addValue(GENERATOR_ID, tag.c_str(), ngen);
 
         // GENERATOR_PG              "PG"                  float
-        if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, atof(split_line[2].c_str()),
+        if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, split_line[2].toDouble(),
             ngen);
 
         // GENERATOR_QG              "QG"                  float
-        if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, atof(split_line[3].c_str()),
+        if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, split_line[3].toDouble(),
             ngen);
 
         // GENERATOR_QMAX              "QT"                  float
         if (nstr > 4) p_busData[l_idx]->addValue(GENERATOR_QMAX,
-            atof(split_line[4].c_str()), ngen);
+            split_line[4].toDouble(), ngen);
 
         // GENERATOR_QMIN              "QB"                  float
         if (nstr > 5) p_busData[l_idx]->addValue(GENERATOR_QMIN,
-            atof(split_line[5].c_str()), ngen);
+            split_line[5].toDouble(), ngen);
 
         // GENERATOR_VS              "VS"                  float
-        if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, atof(split_line[6].c_str()),
+        if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, split_line[6].toDouble(),
             ngen);
 
         // GENERATOR_IREG            "IREG"                integer
         if (nstr > 7) p_busData[l_idx]->addValue(GENERATOR_IREG,
-            atoi(split_line[7].c_str()), ngen);
+            split_line[7].toInt(), ngen);
 
         // GENERATOR_MBASE           "MBASE"               float
         if (nstr > 8) p_busData[l_idx]->addValue(GENERATOR_MBASE,
-            atof(split_line[8].c_str()), ngen);
+            split_line[8].toDouble(), ngen);
 
         // GENERATOR_ZSOURCE                                complex
         if (nstr > 9) p_busData[l_idx]->addValue(GENERATOR_ZSOURCE,
-            gridpack::ComplexType(atof(split_line[9].c_str()),
-              atof(split_line[10].c_str())), ngen);
+            gridpack::ComplexType(split_line[9].toDouble(),
+              split_line[10].toDouble()), ngen);
 
         // GENERATOR_XTRAN                              complex
         if (nstr > 11) p_busData[l_idx]->addValue(GENERATOR_XTRAN,
-            gridpack::ComplexType(atof(split_line[11].c_str()),
-              atof(split_line[12].c_str())), ngen);
+            gridpack::ComplexType(split_line[11].toDouble(),
+              split_line[12].toDouble()), ngen);
 
         // GENERATOR_RT              "RT"                  float
-        if (nstr > 11) p_busData[l_idx]->addValue(GENERATOR_RT, atof(split_line[11].c_str()),
+        if (nstr > 11) p_busData[l_idx]->addValue(GENERATOR_RT, split_line[11].toDouble(),
             ngen);
 
         // GENERATOR_XT              "XT"                  float
-        if (nstr > 12) p_busData[l_idx]->addValue(GENERATOR_XT, atof(split_line[12].c_str()),
+        if (nstr > 12) p_busData[l_idx]->addValue(GENERATOR_XT, split_line[12].toDouble(),
             ngen);
 
         // GENERATOR_GTAP              "GTAP"                  float
         if (nstr > 13) p_busData[l_idx]->addValue(GENERATOR_GTAP,
-            atof(split_line[13].c_str()), ngen);
+            split_line[13].toDouble(), ngen);
 
         // GENERATOR_STAT              "STAT"                  float
         if (nstr > 14)  p_busData[l_idx]->addValue(GENERATOR_STAT,
-            atoi(split_line[14].c_str()), ngen);
+            split_line[14].toInt(), ngen);
 
         // GENERATOR_RMPCT           "RMPCT"               float
         if (nstr > 15) p_busData[l_idx]->addValue(GENERATOR_RMPCT,
-            atof(split_line[15].c_str()), ngen);
+            split_line[15].toDouble(), ngen);
 
         // GENERATOR_PMAX              "PT"                  float
         if (nstr > 16) p_busData[l_idx]->addValue(GENERATOR_PMAX,
-            atof(split_line[16].c_str()), ngen);
+            split_line[16].toDouble(), ngen);
 
         // GENERATOR_PMIN              "PB"                  float
         if (nstr > 17) p_busData[l_idx]->addValue(GENERATOR_PMIN,
-            atof(split_line[17].c_str()), ngen);
+            split_line[17].toDouble(), ngen);
 
         // Pick up some non-standard values for Dynamic Simulation
         // GENERATOR_REACTANCE                             float
         if (nstr > 18) p_busData[l_idx]->addValue(GENERATOR_REACTANCE,
-            atof(split_line[18].c_str()), ngen);
+            split_line[18].toDouble(), ngen);
 
         // GENERATOR_RESISTANCE                             float
         if (nstr > 19) p_busData[l_idx]->addValue(GENERATOR_RESISTANCE,
-            atof(split_line[19].c_str()), ngen);
+            split_line[19].toDouble(), ngen);
 
         // GENERATOR_TRANSIENT_REACTANCE                             float
         if (nstr > 20) p_busData[l_idx]->addValue(GENERATOR_TRANSIENT_REACTANCE,
-            atof(split_line[20].c_str()), ngen);
+            split_line[20].toDouble(), ngen);
 
         // GENERATOR_SUBTRANSIENT_REACTANCE                             float
         if (nstr > 21) p_busData[l_idx]->addValue(GENERATOR_SUBTRANSIENT_REACTANCE,
-            atof(split_line[21].c_str()), ngen);
+            split_line[21].toDouble(), ngen);
 
         // Pick up some more non-standard values for Dynamic Simulation
         // GENERATOR_INERTIA_CONSTANT_H                           float
         if (nstr > 22) p_busData[l_idx]->addValue(GENERATOR_INERTIA_CONSTANT_H,
-            atof(split_line[22].c_str()), ngen);
+            split_line[22].toDouble(), ngen);
 
         // GENERATOR_DAMPING_COEFFICIENT_0                           float
         if (nstr > 23) p_busData[l_idx]->addValue(GENERATOR_DAMPING_COEFFICIENT_0,
-            atof(split_line[23].c_str()), ngen);
+            split_line[23].toDouble(), ngen);
 
         // Increment number of generators in data object
         if (ngen == 0) {
@@ -494,6 +493,7 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_branches(std::ifstream & input)
     {
       std::string line;
+      RecordTokenizer split_line;
       int  o_idx1, o_idx2;
       int index = 0;
 
@@ -502,13 +502,10 @@ class PTI23_parser : public BasePTIParser<_network>
       int nelems;
       while(test_end(line)) {
         std::pair<int, int> branch_pair;
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(line,true);
 
-        o_idx1 = atoi(split_line[0].c_str());
-        o_idx2 = atoi(split_line[1].c_str());
+        o_idx1 = split_line[0].toInt();
+        o_idx2 = split_line[1].toInt();
 
         // Switch sign if indices are negative
         if (o_idx1 < 0) o_idx1 = -o_idx1;
@@ -565,62 +562,61 @@ class PTI23_parser : public BasePTIParser<_network>
         p_branchData[l_idx]->addValue(BRANCH_SWITCHED, switched, nelems);
 
         // Clean up 2 character tag
-        gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[2]);
+        std::string tag = split_line[2].tag();
         // BRANCH_CKT          "CKT"                 character
         p_branchData[l_idx]->addValue(BRANCH_CKT, tag.c_str(),
             nelems);
 
         // BRANCH_R            "R"                   float
-        p_branchData[l_idx]->addValue(BRANCH_R, atof(split_line[3].c_str()),
+        p_branchData[l_idx]->addValue(BRANCH_R, split_line[3].toDouble(),
             nelems);
 
         // BRANCH_X            "X"                   float
-        p_branchData[l_idx]->addValue(BRANCH_X, atof(split_line[4].c_str()),
+        p_branchData[l_idx]->addValue(BRANCH_X, split_line[4].toDouble(),
             nelems);
 
         // BRANCH_B            "B"                   float
-        p_branchData[l_idx]->addValue(BRANCH_B, atof(split_line[5].c_str()),
+        p_branchData[l_idx]->addValue(BRANCH_B, split_line[5].toDouble(),
             nelems);
 
         // BRANCH_RATING_A        "RATEA"               float
         p_branchData[l_idx]->addValue(BRANCH_RATING_A,
-            atof(split_line[6].c_str()), nelems);
+            split_line[6].toDouble(), nelems);
 
         // BBRANCH_RATING_        "RATEB"               float
         p_branchData[l_idx]->addValue(BRANCH_RATING_B,
-            atof(split_line[7].c_str()), nelems);
+            split_line[7].toDouble(), nelems);
 
         // BRANCH_RATING_C        "RATEC"               float
         p_branchData[l_idx]->addValue(BRANCH_RATING_C,
-            atof(split_line[8].c_str()), nelems);
+            split_line[8].toDouble(), nelems);
 
         // BRANCH_TAP        "RATIO"               float
-        p_branchData[l_idx]->addValue(BRANCH_TAP, atof(split_line[9].c_str()), nelems);
+        p_branchData[l_idx]->addValue(BRANCH_TAP, split_line[9].toDouble(), nelems);
 
         // BRANCH_SHIFT        "SHIFT"               float
         p_branchData[l_idx]->addValue(BRANCH_SHIFT,
-            atof(split_line[10].c_str()), nelems);
+            split_line[10].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_G1        "GI"               float
         p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G1,
-            atof(split_line[11].c_str()), nelems);
+            split_line[11].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_B1        "BI"               float
         p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B1,
-            atof(split_line[12].c_str()), nelems);
+            split_line[12].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_G2        "GJ"               float
         p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G2,
-            atof(split_line[13].c_str()), nelems);
+            split_line[13].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_B2        "BJ"               float
         p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B2,
-            atof(split_line[14].c_str()), nelems);
+            split_line[14].toDouble(), nelems);
 
         // BRANCH_STATUS        "STATUS"               integer
         p_branchData[l_idx]->addValue(BRANCH_STATUS,
-            atoi(split_line[15].c_str()), nelems);
+            split_line[15].toInt(), nelems);
 
         nelems++;
         p_branchData[l_idx]->setValue(BRANCH_NUM_ELEMENTS,nelems);
@@ -634,6 +630,7 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_transformer(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
 
@@ -642,17 +639,14 @@ class PTI23_parser : public BasePTIParser<_network>
       // get the branch that has the same to and from buses that the transformer hadto
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(line,true);
 
         // KG: I'm assuming the BRANCH_FROMBUS is the bus index we need to match
-        int fromBus = atoi(split_line[0].c_str());
+        int fromBus = split_line[0].toInt();
         if (fromBus < 0) fromBus = -fromBus;
 
         // KG: I'm assuming the BRANCH_TOBUS is the bus index we need to match
-        int toBus = atoi(split_line[1].c_str());
+        int toBus = split_line[1].toInt();
         if (toBus < 0) toBus = -toBus;
 
         // find branch corresponding to this transformer line
@@ -673,8 +667,7 @@ class PTI23_parser : public BasePTIParser<_network>
         // BRANCH_CKT values
         int nelems = 0;
         p_branchData[l_idx]->getValue(BRANCH_NUM_ELEMENTS,&nelems);
-        gridpack::utility::StringUtils util;
-        std::string b_ckt(util.clean2Char(split_line[2]));
+        std::string b_ckt(split_line[2].tag());
         int i;
         int idx = -1;
         for (i=0; i<nelems; i++) {
@@ -696,49 +689,49 @@ class PTI23_parser : public BasePTIParser<_network>
          * TRANSFORMER_CONTROL
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_CONTROL,
-            atoi(split_line[3].c_str()),idx);
+            split_line[3].toInt(),idx);
 
         /*
          * type: float
          * TRANSFORMER_RMA
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_RMA,
-            atof(split_line[4].c_str()),idx);
+            split_line[4].toDouble(),idx);
 
         /*
          * type: float
          * TRANSFORMER_RMI
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_RMI,
-            atof(split_line[5].c_str()),idx);
+            split_line[5].toDouble(),idx);
 
         /*
          * type: float
          * TRANSFORMER_VMA
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_VMA,
-            atof(split_line[6].c_str()),idx);
+            split_line[6].toDouble(),idx);
 
         /*
          * type: float
          * TRANSFORMER_VMI
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_VMI,
-            atof(split_line[7].c_str()),idx);
+            split_line[7].toDouble(),idx);
 
         /*
          * type: float
          * TRANSFORMER_STEP
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_STEP,
-            atof(split_line[8].c_str()),idx);
+            split_line[8].toDouble(),idx);
 
         /*
          * type: float
          * TRANSFORMER_TABLE
          */
         p_branchData[l_idx]->addValue(TRANSFORMER_TABLE,
-            atof(split_line[9].c_str()),idx);
+            split_line[9].toDouble(),idx);
 
         // This stuff is probably all wrong
 #if 0
@@ -747,19 +740,19 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: integer
          * #define TRANSFORMER_BUS1 "TRANSFORMER_BUS1"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_BUS1, atoi(split_line[0].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_BUS1, split_line[0].toInt());
 
         /*
          * type: integer
          * #define TRANSFORMER_BUS2 "TRANSFORMER_BUS2"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_BUS2, atoi(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_BUS2, split_line[1].toInt());
 
         /*
          * type: integer
          * #define TRANSFORMER_BUS3 "TRANSFORMER_BUS3"
          */
-        //          data->addValue(TRANSFORMER_BUS3, atoi(split_line[1].c_str()));
+        //          data->addValue(TRANSFORMER_BUS3, split_line[1].toInt());
 
         /*
          * type: string
@@ -771,37 +764,37 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: integer
          * #define TRANSFORMER_CW "TRANSFORMER_CW"
          X            */
-        p_branchData[l_idx]->addValue(TRANSFORMER_CW, atoi(split_line[3].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_CW, split_line[3].toInt());
 
         /*
          * type: integer
          * #define TRANSFORMER_CZ "TRANSFORMER_CZ"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_CZ, atoi(split_line[5].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_CZ, split_line[5].toInt());
 
         /*
          * type: integer
          * #define TRANSFORMER_CM "TRANSFORMER_CM"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_CM, atoi(split_line[5].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_CM, split_line[5].toInt());
 
         /*
          * type: real float
          * #define TRANSFORMER_MAG1 "TRANSFORMER_MAG1"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_MAG1, atof(split_line[5].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_MAG1, split_line[5].toDouble());
 
         /*
          * type: real float
          * #define TRANSFORMER_MAG2 "TRANSFORMER_MAG2"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_MAG2, atof(split_line[5].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_MAG2, split_line[5].toDouble());
 
         /*
          * type: integer
          * #define TRANSFORMER_NMETR "TRANSFORMER_NMETR"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_NMETR, atoi(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_NMETR, split_line[1].toInt());
 
         /*
          * type: string
@@ -814,31 +807,31 @@ class PTI23_parser : public BasePTIParser<_network>
          * #define TRANSFORMER_STATUS "TRANSFORMER_STATUS"
          *
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_STATUS, atoi(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_STATUS, split_line[1].toInt());
 
         /*
          * type: integer
          * #define TRANSFORMER_OWNER "TRANSFORMER_OWNER"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_OWNER, atoi(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_OWNER, split_line[1].toInt());
 
         /*
          * type: real float
          * #define TRANSFORMER_R1_2 "TRANSFORMER_R1_2"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_R1_2, atof(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_R1_2, split_line[1].toDouble());
 
         /*
          * type: real float
          * #define TRANSFORMER_X1_2 "TRANSFORMER_X1_2"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_X1_2, atof(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_X1_2, split_line[1].toDouble());
 
         /*
          * type: real float
          * #define TRANSFORMER_SBASE1_2 "TRANSFORMER_SBASE1_2"
          */
-        p_branchData[l_idx]->addValue(TRANSFORMER_SBASE1_2, atof(split_line[1].c_str()));
+        p_branchData[l_idx]->addValue(TRANSFORMER_SBASE1_2, split_line[1].toDouble());
 #endif
 
         std::getline(input, line);
@@ -848,26 +841,25 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_area(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
 
       int ncnt = 0;
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        split_line.tokenize(line,true);
 
         // AREAINTG_NUMBER             "I"                    integer
-        p_network_data->addValue(AREAINTG_NUMBER, atoi(split_line[0].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_NUMBER, split_line[0].toInt(),ncnt);
 
         // AREAINTG_ISW                "I"                    integer
-        p_network_data->addValue(AREAINTG_ISW, atoi(split_line[1].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_ISW, split_line[1].toInt(),ncnt);
 
         // AREAINTG_PDES          "PDES"                 float
-        p_network_data->addValue(AREAINTG_PDES, atof(split_line[2].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_PDES, split_line[2].toDouble(),ncnt);
 
         // AREAINTG_PTOL          "PTOL"                 float
-        p_network_data->addValue(AREAINTG_PTOL, atof(split_line[3].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_PTOL, split_line[3].toDouble(),ncnt);
 
         // AREAINTG_NAME         "ARNAM"                string
         p_network_data->addValue(AREAINTG_NAME, split_line[4].c_str(),ncnt);
@@ -881,13 +873,12 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_2term(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        split_line.tokenize(line,true);
         std::getline(input, line);
       }
     }
@@ -895,13 +886,12 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_line(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        split_line.tokenize(line,true);
         std::getline(input, line);
       }
     }
@@ -913,19 +903,18 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_shunt(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        split_line.tokenize(line,true);
 
         /*
          * type: integer
          * #define SWSHUNT_BUSNUMBER "SWSHUNT_BUSNUMBER"
          */
         int l_idx, o_idx;
-        l_idx = atoi(split_line[0].c_str());
+        l_idx = split_line[0].toInt();
         std::map<int, int>::iterator it;
         it = p_busMap.find(l_idx);
         if (it != p_busMap.end()) {
@@ -936,37 +925,37 @@ class PTI23_parser : public BasePTIParser<_network>
         }
         int nval = split_line.size();
 
-        p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, atoi(split_line[0].c_str()));
+        p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, split_line[0].toInt());
 
         /*
          * type: integer
          * #define SHUNT_MODSW "SHUNT_MODSW"
          */
-        p_busData[o_idx]->addValue(SHUNT_MODSW, atoi(split_line[1].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_MODSW, split_line[1].toInt());
 
         /*
          * type: real float
          * #define SHUNT_VSWHI "SHUNT_VSWHI"
          */
-        p_busData[o_idx]->addValue(SHUNT_VSWHI, atof(split_line[2].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_VSWHI, split_line[2].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_VSWLO "SHUNT_VSWLO"
          */
-        p_busData[o_idx]->addValue(SHUNT_VSWLO, atof(split_line[3].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_VSWLO, split_line[3].toDouble());
 
         /*
          * type: integer
          * #define SHUNT_SWREM "SHUNT_SWREM"
          */
-        p_busData[o_idx]->addValue(SHUNT_SWREM, atoi(split_line[4].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_SWREM, split_line[4].toInt());
 
         /*
          * type: real float
          * #define SHUNT_RMPCT "SHUNT_RMPCT"
          */
-        //          p_busData[o_idx]->addValue(SHUNT_RMPCT, atof(split_line[4].c_str()));
+        //          p_busData[o_idx]->addValue(SHUNT_RMPCT, split_line[4].toDouble());
 
         /*
          * type: string
@@ -978,118 +967,118 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: real float
          * #define SHUNT_BINIT "SHUNT_BINIT"
          */
-        p_busData[o_idx]->addValue(SHUNT_BINIT, atof(split_line[5].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_BINIT, split_line[5].toDouble());
 
         /*
          * type: integer
          * #define SHUNT_N1 "SHUNT_N1"
          */
-        p_busData[o_idx]->addValue(SHUNT_N1, atoi(split_line[6].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_N1, split_line[6].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N2 "SHUNT_N2"
          */
         if (8<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N2, atoi(split_line[8].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N2, split_line[8].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N3 "SHUNT_N3"
          */
         if (10<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N3, atoi(split_line[10].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N3, split_line[10].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N4 "SHUNT_N4"
          */
         if (12<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N4, atoi(split_line[12].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N4, split_line[12].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N5 "SHUNT_N5"
          */
         if (14<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N5, atoi(split_line[14].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N5, split_line[14].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N6 "SHUNT_N6"
          */
         if (16<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N6, atoi(split_line[16].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N6, split_line[16].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N7 "SHUNT_N7"
          */
         if (18<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N7, atoi(split_line[18].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N7, split_line[18].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N8 "SHUNT_N8"
          */
         if (20<nval) 
-          p_busData[o_idx]->addValue(SHUNT_N8, atoi(split_line[20].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N8, split_line[20].toInt());
 
         /*
          * type: real float
          * #define SHUNT_B1 "SHUNT_B1"
          */
         if (7<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B1, atof(split_line[7].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B1, split_line[7].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B2 "SHUNT_B2"
          */
         if (9<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B2, atof(split_line[9].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B2, split_line[9].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B3 "SHUNT_B3"
          */
         if (11<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B3, atof(split_line[11].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B3, split_line[11].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B4 "SHUNT_B4"
          */
         if (13<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B4, atof(split_line[13].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B4, split_line[13].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B5 "SHUNT_B5"
          */
         if (15<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B5, atof(split_line[15].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B5, split_line[15].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B6 "SHUNT_B6"
          */
         if (17<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B6, atof(split_line[17].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B6, split_line[17].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B7 "SHUNT_B7"
          */
         if (19<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B7, atof(split_line[19].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B7, split_line[19].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B8 "SHUNT_B8"
          */
         if (21<nval) 
-          p_busData[o_idx]->addValue(SHUNT_B8, atof(split_line[21].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B8, split_line[21].toDouble());
 
         std::getline(input, line);
       }
@@ -1098,13 +1087,12 @@ class PTI23_parser : public BasePTIParser<_network>
     void find_imped_corr(std::ifstream & input)
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       std::getline(input, line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        split_line.tokenize(line,true);
 #if 0
         std::vector<gridpack::component::DataCollection>   imped_corr_instance;
         gridpack::component::DataCollection          data;
@@ -1113,21 +1101,21 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: integer
          * #define XFMR_CORR_TABLE_NUMBER "XFMR_CORR_TABLE_NUMBER"
          */
-        data.addValue(XFMR_CORR_TABLE_NUMBER, atoi(split_line[0].c_str()));
+        data.addValue(XFMR_CORR_TABLE_NUMBER, split_line[0].toInt());
         imped_corr_instance.push_back(data);
 
         /*
          * type: real float
          * #define XFMR_CORR_TABLE_Ti "XFMR_CORR_TABLE_Ti"
          */
-        data.addValue(XFMR_CORR_TABLE_Ti, atoi(split_line[0].c_str()));
+        data.addValue(XFMR_CORR_TABLE_Ti, split_line[0].toInt());
         imped_corr_instance.push_back(data);
 
         /*
          * type: real float
          * #define XFMR_CORR_TABLE_Fi "XFMR_CORR_TABLE_Fi"
          */
-        data.addValue(XFMR_CORR_TABLE_Fi, atoi(split_line[0].c_str()));
+        data.addValue(XFMR_CORR_TABLE_Fi, split_line[0].toInt());
         imped_corr_instance.push_back(data);
 
         imped_corr_set.push_back(imped_corr_instance);
@@ -1144,9 +1132,8 @@ class PTI23_parser : public BasePTIParser<_network>
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        RecordTokenizer split_line;
+        split_line.tokenize(line,true);
         std::vector<gridpack::component::DataCollection>   multi_section_instance;
         gridpack::component::DataCollection          data;
 
@@ -1155,7 +1142,7 @@ class PTI23_parser : public BasePTIParser<_network>
          * #define MULTI_SEC_LINE_FROMBUS "MULTI_SEC_LINE_FROMBUS"
 
          */
-        data.addValue(MULTI_SEC_LINE_FROMBUS, atoi(split_line[0].c_str()));
+        data.addValue(MULTI_SEC_LINE_FROMBUS, split_line[0].toInt());
         multi_section_instance.push_back(data);
 
         /*
@@ -1163,7 +1150,7 @@ class PTI23_parser : public BasePTIParser<_network>
          * #define MULTI_SEC_LINE_TOBUS "MULTI_SEC_LINE_TOBUS"
 
          */
-        data.addValue(MULTI_SEC_LINE_TOBUS, atoi(split_line[0].c_str()));
+        data.addValue(MULTI_SEC_LINE_TOBUS, split_line[0].toInt());
         multi_section_instance.push_back(data);
 
         /*
@@ -1178,7 +1165,7 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: integer
          * #define MULTI_SEC_LINE_DUMi "MULTI_SEC_LINE_DUMi"
          */
-        data.addValue(MULTI_SEC_LINE_DUMi, atoi(split_line[0].c_str()));
+        data.addValue(MULTI_SEC_LINE_DUMi, split_line[0].toInt());
         multi_section_instance.push_back(data);
 
         multi_section.push_back(multi_section_instance);
@@ -1221,9 +1208,8 @@ class PTI23_parser : public BasePTIParser<_network>
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        RecordTokenizer split_line;
+        split_line.tokenize(line,true);
         std::vector<gridpack::component::DataCollection>   inter_area_instance;
         gridpack::component::DataCollection          data;
 
@@ -1231,14 +1217,14 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: integer
          * #define INTERAREA_TRANSFER_FROM "INTERAREA_TRANSFER_FROM"
          */
-        data.addValue(INTERAREA_TRANSFER_FROM, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_FROM, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
          * type: integer
          * #define INTERAREA_TRANSFER_TO "INTERAREA_TRANSFER_TO"
          */
-        data.addValue(INTERAREA_TRANSFER_TO, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_TO, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
@@ -1252,7 +1238,7 @@ class PTI23_parser : public BasePTIParser<_network>
          * type: real float
          * #define INTERAREA_TRANSFER_PTRAN "INTERAREA_TRANSFER_PTRAN"
          */
-        data.addValue(INTERAREA_TRANSFER_PTRAN, atof(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_PTRAN, split_line[0].toDouble());
         inter_area_instance.push_back(data);
 
         inter_area.push_back(inter_area_instance);
@@ -1275,13 +1261,12 @@ class PTI23_parser : public BasePTIParser<_network>
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_on);
+        RecordTokenizer split_line;
+        split_line.tokenize(line,true);
         std::vector<gridpack::component::DataCollection>   owner_instance;
         gridpack::component::DataCollection          data;
 
-        data.addValue(OWNER_NUMBER, atoi(split_line[0].c_str()));
+        data.addValue(OWNER_NUMBER, split_line[0].toInt());
         owner_instance.push_back(data);
 
         data.addValue(OWNER_NAME, split_line[1].c_str());
@@ -1297,118 +1282,9 @@ class PTI23_parser : public BasePTIParser<_network>
     void brdcst_data(void)
     {
       int t_brdcst = p_timer->createCategory("Parser:brdcst_data");
-      int t_serial = p_timer->createCategory("Parser:data packing and unpacking");
-      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
-      int me(p_network->communicator().rank());
-      int nprocs(p_network->communicator().size());
-      if (nprocs == 1) return;
       p_timer->start(t_brdcst);
-
-      // find number of buses and branches and broadcast this information to
-      // all processors
-      int sbus, sbranch;
-      if (me == 0) {
-        sbus = p_busData.size();
-        sbranch = p_branchData.size();
-      } else {
-        sbus = 0;
-        sbranch = 0;
-      }
-      int ierr, nbus, nbranch;
-      ierr = MPI_Allreduce(&sbus, &nbus, 1, MPI_INT, MPI_SUM, comm);
-      ierr = MPI_Allreduce(&sbranch, &nbranch, 1, MPI_INT, MPI_SUM, comm);
-      double rprocs = static_cast<double>(nprocs);
-      double rme = static_cast<double>(me);
-      int n, i;
-      std::vector<gridpack::component::DataCollection>recvV;
-      // distribute buses
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbus)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbus)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbus)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbus)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      int nsize = recvV.size();
-      p_busData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_busData.push_back(data);
-      }
-      p_timer->stop(t_serial);
-      recvV.clear();
-      // distribute branches
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbranch)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbranch)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbranch)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbranch)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      nsize = recvV.size();
-      p_branchData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_branchData.push_back(data);
-      }
-      p_timer->stop(t_serial);
-#if 0
-      // debug
-      printf("p[%d] BUS data size: %d\n",me,p_busData.size());
-      for (i=0; i<p_busData.size(); i++) {
-        printf("p[%d] Dumping bus: %d\n",me,i);
-        p_busData[i]->dump();
-      }
-      printf("p[%d] BRANCH data size: %d\n",me,p_branchData.size());
-      for (i=0; i<p_branchData.size(); i++) {
-        printf("p[%d] Dumping branch: %d\n",me,i);
-        p_branchData[i]->dump();
-      }
-#endif
+      this->distributeData(p_busData);
+      this->distributeData(p_branchData);
       p_timer->stop(t_brdcst);
     }
 
@@ -22,6 +22,8 @@
 #endif
 #include <vector>
 #include <map>
+#include <set>
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 
@@ -32,6 +34,8 @@
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/parser/base_parser.hpp"
 #include "gridpack/parser/base_pti_parser.hpp"
+#include "gridpack/parser/mapped_file.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 
 #define TERM_CHAR '0'
 // SOURCE: http://www.ee.washington.edu/research/pstca/formats/pti.txt
@@ -51,7 +55,8 @@ class PTI33_parser : public BasePTIParser<_network>
      * of network configuration file (must be child of network::BaseNetwork<>)
      */
     PTI33_parser(boost::shared_ptr<_network> network)
-      : p_network(network), p_maxBusIndex(-1)
+      : p_network(network), p_maxBusIndex(-1), p_parallelParse(false),
+        p_nextStarBus(0)
     {
       this->setNetwork(network);
       p_network_data = network->getNetworkData();
@@ -81,9 +86,12 @@ class PTI33_parser : public BasePTIParser<_network>
       util.trim(tmpstr);
       std::string ext = this->getExtension(tmpstr);
       if (ext == "raw") {
-        openStream(tmpstr);
-        getCase();
-        this->createNetwork(p_busData,p_branchData);
+        if (!p_parallelParse || !getCaseParallel(tmpstr)) {
+          openStream(tmpstr);
+          getCase();
+          if (this->p_distribute) brdcst_data();
+          this->createNetwork(p_busData,p_branchData);
+        }
       } else if (ext == "dyr") {
         this->getDS(tmpstr);
       }
@@ -105,6 +113,7 @@ class PTI33_parser : public BasePTIParser<_network>
       openStream(fileVec);
       if (isRAW) {
         getCase();
+        if (this->p_distribute) brdcst_data();
         this->createNetwork(p_busData,p_branchData);
       } else {
         this->getDS(fileVec);
@@ -113,6 +122,20 @@ class PTI33_parser : public BasePTIParser<_network>
       p_timer->configTimer(true);
     }
 
+    /**
+     * Parse RAW files on all processors instead of reading them on process
+     * 0. Each processor reads part of the file and sends the records to the
+     * processors that own the corresponding buses and branches. The network
+     * has the same buses and branches, with the same global indices, as a
+     * network created by parsing the file on process 0. Files that refer to
+     * buses by name instead of number are still parsed on process 0
+     * @param flag if true, parse RAW files in parallel
+     */
+    void setParallelParse(bool flag)
+    {
+      p_parallelParse = flag;
+    }
+
     /**
      * Return values of impedence correction table corresponding to tableID
      * @param tableID ID of correction table
@@ -279,44 +302,489 @@ class PTI33_parser : public BasePTIParser<_network>
       p_timer->stop(t_case);
     }
 
+    /**
+     * Parse a RAW file on all processors. The sections in front of the
+     * transformer section and the sections after it contain one record per
+     * line, so their boundaries are found by having each processor scan
+     * its part of the file for lines that terminate a section. Transformer
+     * records span several lines and the transformer section is split into
+     * records on process 0. Records are sent to the processors that own the
+     * buses and branches they refer to, other records are sent to process 0,
+     * and each processor then parses the records it receives with the same
+     * functions that are used to parse the whole file
+     * @param fileName name of RAW file
+     * @return false if the file cannot be parsed in parallel. Nothing has
+     * been parsed in this case
+     */
+    bool getCaseParallel(const std::string &fileName)
+    {
+      int t_case = p_timer->createCategory("Parser:getCaseParallel");
+      int t_scan = p_timer->createCategory("Parser:scan file");
+      int t_exchange = p_timer->createCategory("Parser:exchange records");
+      p_timer->start(t_case);
+      p_timer->start(t_scan);
+      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
+      int me(p_network->communicator().rank());
+      int nprocs(p_network->communicator().size());
+
+      // Sections are numbered in the order in which they are parsed in
+      // getCase
+      const int nsect = 17;
+      const int s_bus = 0;
+      const int s_branch = 4;
+      const int s_xform = 5;
+      const int s_multi_section = 11;
+      const int s_switched_shunt = 16;
+      int i;
+
+      MappedFile file(p_network->communicator(), fileName);
+      int iok = file.isOpen() ? 1 : 0;
+      int ok;
+      MPI_Allreduce(&iok,&ok,1,MPI_INT,MPI_MIN,comm);
+      if (!ok) {
+        p_timer->stop(t_scan);
+        p_timer->stop(t_case);
+        return false;
+      }
+
+      // The header consists of comment lines, the case line and two title
+      // lines
+      std::vector<std::string> header;
+      long pos = 0;
+      std::string line = file.getLine(pos);
+      while (pos < file.size() && check_comment(line)) {
+        header.push_back(line);
+        pos = file.nextLine(pos);
+        line = file.getLine(pos);
+      }
+      for (i=0; i<3; i++) {
+        header.push_back(file.getLine(pos));
+        pos = file.nextLine(pos);
+      }
+      long hdr_end = pos;
+
+      // Find ends of sections in front of transformer section
+      std::vector<long> term;
+      if (findTerminators(file,hdr_end,s_xform,term) < s_xform) {
+        p_timer->stop(t_scan);
+        p_timer->stop(t_case);
+        return false;
+      }
+
+      // Find position of buses on this processor in bus section
+      const std::vector<long> &lines = file.lines();
+      int nlines = lines.size();
+      int sbus = 0;
+      for (i=0; i<nlines; i++) {
+        if (lines[i] >= hdr_end && lines[i] < term[s_bus]) sbus++;
+      }
+      int bus_offset = 0;
+      MPI_Exscan(&sbus,&bus_offset,1,MPI_INT,MPI_SUM,comm);
+      if (me == 0) bus_offset = 0;
+      int nbus;
+      MPI_Allreduce(&sbus,&nbus,1,MPI_INT,MPI_SUM,comm);
+
+      // Assign records in front of transformer section to processors
+      int fallback = 0;
+      int max_bus = -1;
+      int ibus = bus_offset;
+      int idx1, idx2;
+      for (i=0; i<nlines; i++) {
+        pos = lines[i];
+        if (pos < hdr_end || pos >= term[s_xform-1]) continue;
+        int sect = std::lower_bound(term.begin(),term.end(),pos)-term.begin();
+        if (term[sect] == pos) continue;
+        line = file.getLine(pos);
+        if (!scanBusNumber(line,0,&idx1)) fallback = 1;
+        if (sect == s_bus) {
+          if (idx1 > max_bus) max_bus = idx1;
+          file.addRecord(busOwner(idx1,nprocs),sect,pos,ibus,0,line);
+          ibus++;
+        } else if (sect == s_branch) {
+          if (!scanBusNumber(line,1,&idx2)) fallback = 1;
+          file.addRecord(branchOwner(idx1,idx2,nprocs),sect,pos,0,0,line);
+        } else {
+          file.addRecord(busOwner(idx1,nprocs),sect,pos,0,0,line);
+        }
+      }
+      int gmax_bus;
+      MPI_Allreduce(&max_bus,&gmax_bus,1,MPI_INT,MPI_MAX,comm);
+
+      // Split transformer section into records on process 0. Active
+      // 3-winding transformers create a new bus. These buses are numbered
+      // and indexed in the order in which they appear in the file, following
+      // the regular buses. Auxiliary values for transformer records are the
+      // bus number and index of the new bus for active 3-winding
+      // transformers, -2 for inactive 3-winding transformers and -1 for
+      // 2-winding transformers
+      long long xform_end = static_cast<long long>(file.size());
+      if (me == 0) {
+        RecordTokenizer split_line;
+        RecordTokenizer split_line2;
+        int nstar = 0;
+        pos = file.nextLine(term[s_xform-1]);
+        while (pos < file.size()) {
+          line = file.getLine(pos);
+          if (!test_end(line)) {
+            xform_end = static_cast<long long>(pos);
+            break;
+          }
+          split_line.tokenize(line);
+          int k;
+          if (!scanBusNumber(line,0,&idx1) || !scanBusNumber(line,1,&idx2)
+              || !scanBusNumber(line,2,&k)) {
+            fallback = 1;
+          }
+          long next;
+          std::string text = file.getLines(pos,(k != 0 ? 5 : 4),&next);
+          int aux1 = -1;
+          int aux2 = -1;
+          int owner;
+          if (k != 0) {
+            // Use the same test for an active transformer as
+            // find_transformer
+            std::string line2 = file.getLine(file.nextLine(pos));
+            split_line2.tokenize(line2);
+            int stat = 0;
+            if (split_line.size() > 11) stat = split_line[11].toInt();
+            if (split_line2.size() < 4 || stat == 0) {
+              aux1 = -2;
+            } else {
+              aux1 = gmax_bus+1+nstar;
+              aux2 = nbus+nstar;
+              nstar++;
+            }
+            owner = busOwner(idx1,nprocs);
+          } else {
+            owner = branchOwner(idx1,idx2,nprocs);
+          }
+          file.addRecord(owner,s_xform,pos,aux1,aux2,text);
+          pos = next;
+        }
+      }
+      MPI_Bcast(&xform_end,1,MPI_LONG_LONG,0,comm);
+
+      // Find ends of sections after transformer section and assign records
+      // to processors
+      long tail = file.nextLine(static_cast<long>(xform_end));
+      std::vector<long> tterm;
+      findTerminators(file,tail,nsect-s_xform-1,tterm);
+      for (i=0; i<nlines; i++) {
+        pos = lines[i];
+        if (pos < tail) continue;
+        int sect = std::lower_bound(tterm.begin(),tterm.end(),pos)
+          -tterm.begin();
+        if (sect < tterm.size() && tterm[sect] == pos) continue;
+        sect += s_xform+1;
+        if (sect >= nsect) continue;
+        line = file.getLine(pos);
+        if (sect == s_multi_section) {
+          if (!scanBusNumber(line,0,&idx1) || !scanBusNumber(line,1,&idx2)) {
+            fallback = 1;
+          }
+          file.addRecord(branchOwner(idx1,idx2,nprocs),sect,pos,0,0,line);
+        } else if (sect == s_switched_shunt) {
+          scanBusNumber(line,0,&idx1);
+          file.addRecord(busOwner(idx1,nprocs),sect,pos,0,0,line);
+        } else {
+          file.addRecord(0,sect,pos,0,0,line);
+        }
+      }
+
+      // Records that refer to buses by name can only be parsed on a single
+      // processor
+      int gfallback;
+      MPI_Allreduce(&fallback,&gfallback,1,MPI_INT,MPI_MAX,comm);
+      p_timer->stop(t_scan);
+      if (gfallback) {
+        p_timer->stop(t_case);
+        return false;
+      }
+
+      p_timer->start(t_exchange);
+      std::vector<MappedRecord> records;
+      file.exchange(records);
+      p_timer->stop(t_exchange);
+
+      // Assemble the records on this processor into a RAW file and parse it
+      std::vector<std::string> subfile(header);
+      std::vector<int> busIndex;
+      std::vector<int> starIndex;
+      p_starBuses.clear();
+      p_nextStarBus = 0;
+      int nrec = records.size();
+      int irec = 0;
+      int sect;
+      for (sect=0; sect<nsect; sect++) {
+        while (irec < nrec && records[irec].section == sect) {
+          const MappedRecord &rec = records[irec];
+          size_t start = 0;
+          size_t end;
+          while ((end = rec.text.find('\n',start)) != std::string::npos) {
+            subfile.push_back(rec.text.substr(start,end-start));
+            start = end+1;
+          }
+          subfile.push_back(rec.text.substr(start));
+          if (sect == s_bus) busIndex.push_back(rec.aux1);
+          if (sect == s_xform && rec.aux1 >= 0) {
+            p_starBuses.push_back(rec.aux1);
+            starIndex.push_back(rec.aux2);
+          }
+          irec++;
+        }
+        subfile.push_back("0 / END OF DATA");
+      }
+      p_busData.clear();
+      p_branchData.clear();
+      p_busMap.clear();
+      openStream(subfile);
+      find_case();
+      this->setCaseID(p_case_id);
+      this->setCaseSBase(p_case_sbase);
+      find_buses();
+      // New buses for 3-winding transformers are numbered after the largest
+      // bus number in the whole file
+      p_maxBusIndex = gmax_bus;
+      find_loads();
+      find_fixed_shunts();
+      find_generators();
+      find_branches();
+      find_transformer();
+      find_area();
+      find_2term();
+      find_vsc_line();
+      find_imped_corr();
+      find_multi_term();
+      find_multi_section();
+      find_zone();
+      find_interarea();
+      find_owner();
+      find_facts();
+      find_switched_shunt();
+      p_istream.close();
+      p_starBuses.clear();
+      p_network->broadcastNetworkData(0);
+      p_network_data = p_network->getNetworkData();
+
+      // Buses get the same global index that they have if the file is
+      // parsed on process 0
+      busIndex.insert(busIndex.end(),starIndex.begin(),starIndex.end());
+      if (busIndex.size() != p_busData.size()) {
+        char buf[256];
+        sprintf(buf,"p[%d] Parallel parse of %s found %d buses, expected %d\n",
+            me,fileName.c_str(),static_cast<int>(p_busData.size()),
+            static_cast<int>(busIndex.size()));
+        throw gridpack::Exception(buf);
+      }
+
+      // Branches are indexed in the order in which they are created if the
+      // file is parsed on process 0. Find the position in the file of the
+      // record that created each branch on this processor, using the same
+      // rules as find_branches and find_transformer. Branches created by
+      // 3-winding transformers are distinguished by adding 0, 1 or 2 to
+      // three times the position of the record
+      std::vector<long long> seq;
+      std::vector<int> type;
+      std::set<std::pair<int,int> > pairs;
+      for (irec=0; irec<nrec; irec++) {
+        const MappedRecord &rec = records[irec];
+        long long base = 3*static_cast<long long>(rec.offset);
+        if (rec.section == s_branch ||
+            (rec.section == s_xform && rec.aux1 == -1)) {
+          line = rec.text.substr(0,rec.text.find('\n'));
+          scanBusNumber(line,0,&idx1);
+          scanBusNumber(line,1,&idx2);
+          idx1 = abs(idx1);
+          idx2 = abs(idx2);
+          std::pair<int,int> key(std::min(idx1,idx2),std::max(idx1,idx2));
+          if (pairs.insert(key).second) {
+            seq.push_back(base);
+            type.push_back(rec.section == s_branch ? 0 : 1);
+          }
+        } else if (rec.section == s_xform && rec.aux1 >= 0) {
+          for (i=0; i<3; i++) {
+            seq.push_back(base+i);
+            type.push_back(2);
+          }
+        }
+      }
+      int nseq = seq.size();
+      if (nseq != p_branchData.size()) {
+        char buf[256];
+        sprintf(buf,"p[%d] Parallel parse of %s found %d branches, expected %d\n",
+            me,fileName.c_str(),static_cast<int>(p_branchData.size()),nseq);
+        throw gridpack::Exception(buf);
+      }
+      std::vector<int> counts(nprocs);
+      std::vector<int> displ(nprocs);
+      MPI_Allgather(&nseq,1,MPI_INT,&counts[0],1,MPI_INT,comm);
+      int total = 0;
+      for (i=0; i<nprocs; i++) {
+        displ[i] = total;
+        total += counts[i];
+      }
+      std::vector<long long> all_seq(total+1);
+      std::vector<int> all_type(total+1);
+      MPI_Allgatherv((nseq > 0 ? &seq[0] : NULL),nseq,MPI_LONG_LONG,
+          &all_seq[0],&counts[0],&displ[0],MPI_LONG_LONG,comm);
+      MPI_Allgatherv((nseq > 0 ? &type[0] : NULL),nseq,MPI_INT,
+          &all_type[0],&counts[0],&displ[0],MPI_INT,comm);
+      std::vector<std::pair<long long,int> > order(total);
+      int nline = 0;
+      for (i=0; i<total; i++) {
+        order[i] = std::pair<long long,int>(all_seq[i],all_type[i]);
+        if (all_type[i] == 0) nline++;
+      }
+      std::sort(order.begin(),order.end());
+      // BRANCH_INDEX is the global index of the branch, except for branches
+      // created by 2-winding transformers. These are counted separately,
+      // starting from the number of branches in the branch section
+      std::vector<int> bindex(total);
+      int nxform = 0;
+      for (i=0; i<total; i++) {
+        if (order[i].second == 1) {
+          bindex[i] = nline+nxform;
+          nxform++;
+        } else {
+          bindex[i] = i;
+        }
+      }
+      std::vector<int> branchIndex(nseq);
+      for (i=0; i<nseq; i++) {
+        int idx = std::lower_bound(order.begin(),order.end(),
+            std::pair<long long,int>(seq[i],type[i]))-order.begin();
+        branchIndex[i] = idx;
+        p_branchData[i]->setValue(BRANCH_INDEX,bindex[idx]);
+      }
+
+      this->createNetwork(p_busData,p_branchData,busIndex,branchIndex);
+      p_timer->stop(t_case);
+      return true;
+    }
+
+    /**
+     * Find lines that terminate sections of a RAW file. Each processor
+     * checks the lines that start in its part of the file. This is
+     * collective
+     * @param file mapped RAW file
+     * @param start offset at which search starts
+     * @param count maximum number of terminating lines
+     * @param term offsets of the first count terminating lines after start
+     * @return number of terminating lines found
+     */
+    int findTerminators(const MappedFile &file, long start, int count,
+        std::vector<long> &term)
+    {
+      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
+      int nprocs(p_network->communicator().size());
+      std::vector<long long> found(count,-1);
+      const std::vector<long> &lines = file.lines();
+      int nlines = lines.size();
+      int n = 0;
+      int i = std::lower_bound(lines.begin(),lines.end(),start)-lines.begin();
+      while (i<nlines && n<count) {
+        std::string line = file.getLine(lines[i]);
+        if (!test_end(line)) {
+          found[n] = static_cast<long long>(lines[i]);
+          n++;
+        }
+        i++;
+      }
+      std::vector<long long> all(count*nprocs);
+      MPI_Allgather(&found[0],count,MPI_LONG_LONG,&all[0],count,
+          MPI_LONG_LONG,comm);
+      term.clear();
+      for (i=0; i<count*nprocs && term.size()<count; i++) {
+        if (all[i] >= 0) term.push_back(static_cast<long>(all[i]));
+      }
+      return term.size();
+    }
+
+    /**
+     * Get a bus number from a field of a RAW file record without splitting
+     * up the whole record. The number is returned the same way as getBusIndex
+     * would return it, except that the sign is kept
+     * @param line record
+     * @param ifield index of field
+     * @param idx bus number
+     * @return false if the field contains a bus name instead of a number
+     */
+    bool scanBusNumber(const std::string &line, int ifield, int *idx)
+    {
+      std::string str = line;
+      this->cleanComment(str);
+      size_t start = 0;
+      int i;
+      for (i=0; i<ifield && start != std::string::npos; i++) {
+        start = str.find(',',start);
+        if (start != std::string::npos) start++;
+      }
+      *idx = 0;
+      if (start == std::string::npos) return true;
+      size_t first = str.find_first_not_of(' ',start);
+      if (first != std::string::npos && str[first] == '\'') return false;
+      *idx = atoi(str.c_str()+start);
+      return true;
+    }
+
+    /**
+     * Processor that owns the records of a bus when a file is parsed in
+     * parallel
+     * @param idx bus number
+     * @param nprocs number of processors
+     */
+    int busOwner(int idx, int nprocs) const
+    {
+      return abs(idx)%nprocs;
+    }
+
+    /**
+     * Processor that owns the records of a branch when a file is parsed in
+     * parallel. This does not depend on the order of the buses
+     * @param idx1 number of bus 1
+     * @param idx2 number of bus 2
+     * @param nprocs number of processors
+     */
+    int branchOwner(int idx1, int idx2, int nprocs) const
+    {
+      return busOwner(std::min(abs(idx1),abs(idx2)),nprocs);
+    }
+
     void find_case()
     {
       std::string                                        line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line);
       while (check_comment(line)) {
         p_istream.nextLine(line);
       }
-      std::vector<std::string>  split_line;
-
-      this->cleanComment(line);
-      boost::algorithm::split(split_line, line, boost::algorithm::is_any_of(","),
-          boost::token_compress_off);
+      split_line.tokenize(line);
 
       // CASE_ID             "IC"                   ranged integer
-      p_case_id = atoi(split_line[0].c_str());
+      p_case_id = split_line[0].toInt();
 
       // CASE_SBASE          "SBASE"                float
-      p_case_sbase = atof(split_line[1].c_str());
+      p_case_sbase = split_line[1].toDouble();
 
       p_network_data->addValue(CASE_SBASE, p_case_sbase);
       p_network_data->addValue(CASE_ID, p_case_id);
       /*  These do not appear in the dictionary
       // REVISION_ID
       if (split_line.size() > 2)
-      p_revision_id = atoi(split_line[2].c_str());
+      p_revision_id = split_line[2].toInt();
 
       // XFRRAT_UNITS
       if (split_line.size() > 3)
-      p_xffrat_units = atof(split_line[3].c_str());
+      p_xffrat_units = split_line[3].toDouble();
 
       // NXFRAT_UNITS
       if (split_line.size() > 4)
-      p_nxfrat_units = atof(split_line[4].c_str());
+      p_nxfrat_units = split_line[4].toDouble();
 
       // BASE_FREQ
       if (split_line.size() > 5)
-      p_base_freq = atof(split_line[5].c_str());
+      p_base_freq = split_line[5].toDouble();
        */
 
     }
@@ -324,6 +792,7 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_buses()
     {
       std::string          line;
+      RecordTokenizer split_line;
       int                  index = 0;
       int                  o_idx;
       p_istream.nextLine(line);
@@ -331,16 +800,13 @@ class PTI33_parser : public BasePTIParser<_network>
       p_istream.nextLine(line);
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
         boost::shared_ptr<gridpack::component::DataCollection>
           data(new gridpack::component::DataCollection);
         int nstr = split_line.size();
 
         // BUS_I               "I"                   integer
-        o_idx = atoi(split_line[0].c_str());
+        o_idx = split_line[0].toInt();
         if (p_maxBusIndex<o_idx) p_maxBusIndex = o_idx;
         data->addValue(BUS_NUMBER, o_idx);
         p_busData.push_back(data);
@@ -351,42 +817,38 @@ class PTI33_parser : public BasePTIParser<_network>
         data->addValue(CASE_ID, p_case_id);
 
         // BUS_NAME             "NAME"                 string
-        std::string bus_name = split_line[1];
+        std::string bus_name = split_line[1].str();
 
         //store bus and index as a pair
         storeBus(bus_name, o_idx);
-        if (split_line[1].find_first_of('\'',0) != std::string::npos) {
-          gridpack::utility::StringUtils util;
-          util.trim(split_line[1]);
-        }
         if (nstr > 1) data->addValue(BUS_NAME, bus_name.c_str());
 
         // BUS_BASEKV           "BASKV"               float
-        if (nstr > 2) data->addValue(BUS_BASEKV, atof(split_line[2].c_str()));
+        if (nstr > 2) data->addValue(BUS_BASEKV, split_line[2].toDouble());
 
         // BUS_TYPE               "IDE"                   integer
-        if (nstr > 3) data->addValue(BUS_TYPE, atoi(split_line[3].c_str()));
+        if (nstr > 3) data->addValue(BUS_TYPE, split_line[3].toInt());
 
         // BUS_AREA            "IA"                integer
-        if (nstr > 4) data->addValue(BUS_AREA, atoi(split_line[4].c_str()));
+        if (nstr > 4) data->addValue(BUS_AREA, split_line[4].toInt());
 
         // BUS_ZONE            "ZONE"                integer
-        if (nstr > 5) data->addValue(BUS_ZONE, atoi(split_line[5].c_str()));
+        if (nstr > 5) data->addValue(BUS_ZONE, split_line[5].toInt());
 
         // BUS_OWNER              "IA"                  integer
-        if (nstr > 6) data->addValue(BUS_OWNER, atoi(split_line[6].c_str()));
+        if (nstr > 6) data->addValue(BUS_OWNER, split_line[6].toInt());
 
         // BUS_VOLTAGE_MAG              "VM"                  float
-        if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, atof(split_line[7].c_str()));
+        if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, split_line[7].toDouble());
 
         // BUS_VOLTAGE_ANG              "VA"                  float
-        if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, atof(split_line[8].c_str()));
+        if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, split_line[8].toDouble());
 
         // BUS_VOLTAGE_MAX              "VOLTAGE_MAX"               float
-        if (nstr > 9) data->addValue(BUS_VOLTAGE_MAX, atof(split_line[9].c_str()));
+        if (nstr > 9) data->addValue(BUS_VOLTAGE_MAX, split_line[9].toDouble());
 
         // BUS_VOLTAGE_MIN              "VOLTAGE_MIN"              float
-        if (nstr > 10) data->addValue(BUS_VOLTAGE_MIN, atof(split_line[10].c_str()));
+        if (nstr > 10) data->addValue(BUS_VOLTAGE_MIN, split_line[10].toDouble());
 
         // TODO: Need to add EVHI, EVLO
         index++;
@@ -397,13 +859,11 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_loads()
     {
       std::string          line;
+      RecordTokenizer split_line;
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         // LOAD_BUSNUMBER               "I"                   integer
         int l_idx, o_idx;
@@ -432,53 +892,52 @@ class PTI33_parser : public BasePTIParser<_network>
 
         p_busData[l_idx]->addValue(LOAD_BUSNUMBER, o_idx, nld);
 
-        gridpack::utility::StringUtils util;
         if (nstr > 1) {
           // Clean up 2 character tag
-          std::string tag = util.clean2Char(split_line[1]);
+          std::string tag = split_line[1].tag();
           // LOAD_ID              "ID"                  integer
           p_busData[l_idx]->addValue(LOAD_ID, tag.c_str(), nld);
         }
 
         // LOAD_STATUS              "ID"                  integer
         if (nstr > 2) p_busData[l_idx]->addValue(LOAD_STATUS,
-            atoi(split_line[2].c_str()), nld);
+            split_line[2].toInt(), nld);
 
         // LOAD_AREA            "AREA"                integer
         if (nstr > 3) p_busData[l_idx]->addValue(LOAD_AREA,
-            atoi(split_line[3].c_str()), nld);
+            split_line[3].toInt(), nld);
 
         // LOAD_ZONE            "ZONE"                integer
         if (nstr > 4) p_busData[l_idx]->addValue(LOAD_ZONE,
-            atoi(split_line[4].c_str()), nld);
+            split_line[4].toInt(), nld);
 
         // LOAD_PL              "PL"                  float
         if (nstr > 5) {
-          if (nld == 0) p_busData[l_idx]->addValue(LOAD_PL, atof(split_line[5].c_str()));
-          p_busData[l_idx]->addValue(LOAD_PL, atof(split_line[5].c_str()), nld);
+          if (nld == 0) p_busData[l_idx]->addValue(LOAD_PL, split_line[5].toDouble());
+          p_busData[l_idx]->addValue(LOAD_PL, split_line[5].toDouble(), nld);
         }
 
         // LOAD_QL              "QL"                  float
         if (nstr > 6) {
-          if (nld == 0) p_busData[l_idx]->addValue(LOAD_QL, atof(split_line[6].c_str()));
-          p_busData[l_idx]->addValue(LOAD_QL, atof(split_line[6].c_str()), nld);
+          if (nld == 0) p_busData[l_idx]->addValue(LOAD_QL, split_line[6].toDouble());
+          p_busData[l_idx]->addValue(LOAD_QL, split_line[6].toDouble(), nld);
         }
 
         // LOAD_IP              "IP"                  float
         if (nstr > 7) p_busData[l_idx]->addValue(LOAD_IP,
-            atof(split_line[7].c_str()), nld);
+            split_line[7].toDouble(), nld);
 
         // LOAD_IQ              "IQ"                  float
         if (nstr > 8) p_busData[l_idx]->addValue(LOAD_IQ,
-            atof(split_line[8].c_str()), nld);
+            split_line[8].toDouble(), nld);
 
         // LOAD_YP              "YP"                  float
         if (nstr > 9) p_busData[l_idx]->addValue(LOAD_YP,
-            atof(split_line[9].c_str()), nld);
+            split_line[9].toDouble(), nld);
 
         // LOAD_YQ            "YQ"                integer
         if (nstr > 10) p_busData[l_idx]->addValue(LOAD_YQ,
-            atof(split_line[10].c_str()), nld);
+            split_line[10].toDouble(), nld);
 
         // TODO: add variables OWNER, SCALE, INTRPT
 
@@ -498,13 +957,11 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_fixed_shunts()
     {
       std::string          line;
+      RecordTokenizer split_line;
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         // SHUNT_BUSNUMBER               "I"                   integer
         int l_idx, o_idx;
@@ -531,30 +988,29 @@ class PTI33_parser : public BasePTIParser<_network>
 
         if (nstr > 1) {
           // Clean up 2 character tag
-          gridpack::utility::StringUtils util;
-          std::string tag = util.clean2Char(split_line[1]);
+          std::string tag = split_line[1].tag();
           // SHUNT_ID              "ID"                  integer
           p_busData[l_idx]->addValue(SHUNT_ID, tag.c_str(), nshnt);
         }
 
         // SHUNT_STATUS              "STATUS"                  integer
         if (nstr > 2) p_busData[l_idx]->addValue(SHUNT_STATUS,
-            atoi(split_line[2].c_str()), nshnt);
+            split_line[2].toInt(), nshnt);
 
         // BUS_SHUNT_GL              "GL"                  float
         if (nstr > 3) {
           if (nshnt==0) p_busData[l_idx]->addValue(BUS_SHUNT_GL,
-              atof(split_line[3].c_str()));
+              split_line[3].toDouble());
           p_busData[l_idx]->addValue(BUS_SHUNT_GL,
-              atof(split_line[3].c_str()),nshnt);
+              split_line[3].toDouble(),nshnt);
         }
 
         // BUS_SHUNT_BL              "BL"                  float
         if (nstr > 4) {
           if (nshnt == 0) p_busData[l_idx]->addValue(BUS_SHUNT_BL,
-              atof(split_line[4].c_str()));
+              split_line[4].toDouble());
           p_busData[l_idx]->addValue(BUS_SHUNT_BL,
-              atof(split_line[4].c_str()),nshnt);
+              split_line[4].toDouble(),nshnt);
         }
 
         // Increment number of shunts in data object
@@ -573,12 +1029,10 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_generators()
     {
       std::string          line;
+      RecordTokenizer split_line;
       p_istream.nextLine(line); //this should be the first line of the block
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         // GENERATOR_BUSNUMBER               "I"                   integer
         int l_idx, o_idx;
@@ -605,68 +1059,67 @@ class PTI33_parser : public BasePTIParser<_network>
         p_busData[l_idx]->addValue(GENERATOR_BUSNUMBER, o_idx, ngen);
 
         // Clean up 2 character tag
-        gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[1]);
+        std::string tag = split_line[1].tag();
         // GENERATOR_ID              "ID"                  integer
         p_busData[l_idx]->addValue(GENERATOR_ID, tag.c_str(), ngen);
 
         // GENERATOR_PG              "PG"                  float
-        if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, atof(split_line[2].c_str()),
+        if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, split_line[2].toDouble(),
             ngen);
 
         // GENERATOR_QG              "QG"                  float
-        if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, atof(split_line[3].c_str()),
+        if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, split_line[3].toDouble(),
             ngen);
 
         // GENERATOR_QMAX              "QT"                  float
         if (nstr > 4) p_busData[l_idx]->addValue(GENERATOR_QMAX,
-            atof(split_line[4].c_str()), ngen);
+            split_line[4].toDouble(), ngen);
 
         // GENERATOR_QMIN              "QB"                  float
         if (nstr > 5) p_busData[l_idx]->addValue(GENERATOR_QMIN,
-            atof(split_line[5].c_str()), ngen);
+            split_line[5].toDouble(), ngen);
 
         // GENERATOR_VS              "VS"                  float
-        if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, atof(split_line[6].c_str()),
+        if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, split_line[6].toDouble(),
             ngen);
 
         // GENERATOR_IREG            "IREG"                integer
         if (nstr > 7) p_busData[l_idx]->addValue(GENERATOR_IREG,
-            atoi(split_line[7].c_str()), ngen);
+            split_line[7].toInt(), ngen);
 
         // GENERATOR_MBASE           "MBASE"               float
         if (nstr > 8) p_busData[l_idx]->addValue(GENERATOR_MBASE,
-            atof(split_line[8].c_str()), ngen);
+            split_line[8].toDouble(), ngen);
 
         // GENERATOR_ZSOURCE                                complex
         if (nstr > 10) p_busData[l_idx]->addValue(GENERATOR_ZSOURCE,
-            gridpack::ComplexType(atof(split_line[9].c_str()),
-              atof(split_line[10].c_str())), ngen);
+            gridpack::ComplexType(split_line[9].toDouble(),
+              split_line[10].toDouble()), ngen);
 
         // GENERATOR_XTRAN                              complex
         if (nstr > 12) p_busData[l_idx]->addValue(GENERATOR_XTRAN,
-            gridpack::ComplexType(atof(split_line[11].c_str()),
-              atof(split_line[12].c_str())), ngen);
+            gridpack::ComplexType(split_line[11].toDouble(),
+              split_line[12].toDouble()), ngen);
 
         // GENERATOR_GTAP              "GTAP"                  float
         if (nstr > 13) p_busData[l_idx]->addValue(GENERATOR_GTAP,
-            atof(split_line[13].c_str()), ngen);
+            split_line[13].toDouble(), ngen);
 
         // GENERATOR_STAT              "STAT"                  float
         if (nstr > 14)  p_busData[l_idx]->addValue(GENERATOR_STAT,
-            atoi(split_line[14].c_str()), ngen);
+            split_line[14].toInt(), ngen);
 
         // GENERATOR_RMPCT           "RMPCT"               float
         if (nstr > 15) p_busData[l_idx]->addValue(GENERATOR_RMPCT,
-            atof(split_line[15].c_str()), ngen);
+            split_line[15].toDouble(), ngen);
 
         // GENERATOR_PMAX              "PT"                  float
         if (nstr > 16) p_busData[l_idx]->addValue(GENERATOR_PMAX,
-            atof(split_line[16].c_str()), ngen);
+            split_line[16].toDouble(), ngen);
 
         // GENERATOR_PMIN              "PB"                  float
         if (nstr > 17) p_busData[l_idx]->addValue(GENERATOR_PMIN,
-            atof(split_line[17].c_str()), ngen);
+            split_line[17].toDouble(), ngen);
 
         // TODO: add variables Oi, Fi, WMOD, WPF
         // There may be between 0 and 4 owner pairs.
@@ -674,64 +1127,64 @@ class PTI33_parser : public BasePTIParser<_network>
         // in the line. The owners may be included as blanks.
         if (nstr > 18) {
           int owner = 0;
-          if (this->isBlank(split_line[18])) {
+          if (split_line[18].isBlank()) {
             p_busData[l_idx]->getValue(BUS_OWNER,&owner);
           } else {
-            owner = atoi(split_line[18].c_str());
+            owner = split_line[18].toInt();
           }
           p_busData[l_idx]->addValue(GENERATOR_OWNER1, owner, ngen);
           double frac = 1.0;
           if (nstr > 19) {
-            if (!this->isBlank(split_line[19])) {
-              frac = atof(split_line[19].c_str());
+            if (!split_line[19].isBlank()) {
+              frac = split_line[19].toDouble();
             }
           }
           p_busData[l_idx]->addValue(GENERATOR_OFRAC1, frac, ngen);
         }
         if (nstr > 20) {
           int owner = 0;
-          if (this->isBlank(split_line[20])) {
+          if (split_line[20].isBlank()) {
             owner = 0;
           } else {
-            owner = atoi(split_line[20].c_str());
+            owner = split_line[20].toInt();
           }
           p_busData[l_idx]->addValue(GENERATOR_OWNER2, owner, ngen);
           double frac = 0.0;
           if (nstr > 21) {
-            if (!this->isBlank(split_line[21])) {
-              frac = atof(split_line[21].c_str());
+            if (!split_line[21].isBlank()) {
+              frac = split_line[21].toDouble();
             }
           }
           p_busData[l_idx]->addValue(GENERATOR_OFRAC2, frac, ngen);
         }
         if (nstr > 22) {
           int owner = 0;
-          if (this->isBlank(split_line[22])) {
+          if (split_line[22].isBlank()) {
             owner = 0;
           } else {
-            owner = atoi(split_line[22].c_str());
+            owner = split_line[22].toInt();
           }
           p_busData[l_idx]->addValue(GENERATOR_OWNER3, owner, ngen);
           double frac = 0.0;
           if (nstr > 23) {
-            if (!this->isBlank(split_line[23])) {
-              frac = atof(split_line[23].c_str());
+            if (!split_line[23].isBlank()) {
+              frac = split_line[23].toDouble();
             }
           }
           p_busData[l_idx]->addValue(GENERATOR_OFRAC3, frac, ngen);
         }
         if (nstr > 24) {
           int owner = 0;
-          if (this->isBlank(split_line[24])) {
+          if (split_line[24].isBlank()) {
             owner = 0;
           } else {
-            owner = atoi(split_line[24].c_str());
+            owner = split_line[24].toInt();
           }
           p_busData[l_idx]->addValue(GENERATOR_OWNER4, owner, ngen);
           double frac = 0.0;
           if (nstr > 25) {
-            if (!this->isBlank(split_line[25])) {
-              frac = atof(split_line[25].c_str());
+            if (!split_line[25].isBlank()) {
+              frac = split_line[25].toDouble();
             }
           }
           p_busData[l_idx]->addValue(GENERATOR_OFRAC4, frac, ngen);
@@ -740,11 +1193,11 @@ class PTI33_parser : public BasePTIParser<_network>
         // Last two entries are WMOD and WPF
         if (nstr > 26) {
           p_busData[l_idx]->addValue(GENERATOR_WMOD,
-            atoi(split_line[26].c_str()), ngen);
+            split_line[26].toInt(), ngen);
         }
         if (nstr > 27) {
           p_busData[l_idx]->addValue(GENERATOR_WPF,
-            atof(split_line[27].c_str()), ngen);
+            split_line[27].toDouble(), ngen);
         }
 
         // Increment number of generators in data object
@@ -763,6 +1216,7 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_branches()
     {
       std::string line;
+      RecordTokenizer split_line;
       int  o_idx1, o_idx2;
       int index = 0;
 
@@ -771,10 +1225,7 @@ class PTI33_parser : public BasePTIParser<_network>
       int nelems;
       while(test_end(line)) {
         std::pair<int, int> branch_pair;
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         o_idx1 = getBusIndex(split_line[0]);
         o_idx2 = getBusIndex(split_line[1]);
@@ -835,95 +1286,94 @@ class PTI33_parser : public BasePTIParser<_network>
 
         int nstr = split_line.size();
         // Clean up 2 character tag
-        gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[2]);
+        std::string tag = split_line[2].tag();
         // BRANCH_CKT          "CKT"                 character
         if (nstr > 2) p_branchData[l_idx]->addValue(BRANCH_CKT,
             tag.c_str(), nelems);
 
         // BRANCH_R            "R"                   float
         if (nstr > 3) p_branchData[l_idx]->addValue(BRANCH_R,
-            atof(split_line[3].c_str()), nelems);
+            split_line[3].toDouble(), nelems);
 
         // BRANCH_X            "X"                   float
         if (nstr > 4) p_branchData[l_idx]->addValue(BRANCH_X,
-            atof(split_line[4].c_str()), nelems);
+            split_line[4].toDouble(), nelems);
 
         // BRANCH_B            "B"                   float
         if (nstr > 5) p_branchData[l_idx]->addValue(BRANCH_B,
-            atof(split_line[5].c_str()), nelems);
+            split_line[5].toDouble(), nelems);
 
         // BRANCH_RATING_A        "RATEA"               float
         if (nstr > 6) p_branchData[l_idx]->addValue(BRANCH_RATING_A,
-            atof(split_line[6].c_str()), nelems);
+            split_line[6].toDouble(), nelems);
 
         // BBRANCH_RATING_        "RATEB"               float
         if (nstr > 7) p_branchData[l_idx]->addValue(BRANCH_RATING_B,
-            atof(split_line[7].c_str()), nelems);
+            split_line[7].toDouble(), nelems);
 
         // BRANCH_RATING_C        "RATEC"               float
         if (nstr > 8) p_branchData[l_idx]->addValue(BRANCH_RATING_C,
-            atof(split_line[8].c_str()), nelems);
+            split_line[8].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_G1        "GI"               float
         if (nstr > 9) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G1,
-            atof(split_line[9].c_str()), nelems);
+            split_line[9].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_B1        "BI"               float
         if (nstr > 10) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B1,
-            atof(split_line[10].c_str()), nelems);
+            split_line[10].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_G2        "GJ"               float
         if (nstr > 11) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G2,
-            atof(split_line[11].c_str()), nelems);
+            split_line[11].toDouble(), nelems);
 
         // BRANCH_SHUNT_ADMTTNC_B2        "BJ"               float
         if (nstr > 12) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B2,
-            atof(split_line[12].c_str()), nelems);
+            split_line[12].toDouble(), nelems);
 
         // BRANCH_STATUS        "STATUS"               integer
         if (nstr > 13) p_branchData[l_idx]->addValue(BRANCH_STATUS,
-            atoi(split_line[13].c_str()), nelems);
+            split_line[13].toInt(), nelems);
 
         // BRANCH_METER         "MET"                  integer
         if (nstr > 14) p_branchData[l_idx]->addValue(BRANCH_METER,
-            atoi(split_line[14].c_str()), nelems);
+            split_line[14].toInt(), nelems);
 
         // BRANCH_LENGTH        "LEN"                        float
         if (nstr > 15) p_branchData[l_idx]->addValue(BRANCH_LENGTH,
-            atof(split_line[15].c_str()), nelems);
+            split_line[15].toDouble(), nelems);
 
         // BRANCH_O1        "O1"                       integer
         if (nstr > 16) p_branchData[l_idx]->addValue(BRANCH_O1,
-            atoi(split_line[16].c_str()), nelems);
+            split_line[16].toInt(), nelems);
 
         // BRANCH_F1        "F1"                             float
         if (nstr > 17) p_branchData[l_idx]->addValue(BRANCH_F1,
-            atoi(split_line[17].c_str()), nelems);
+            split_line[17].toInt(), nelems);
 
         // BRANCH_O2        "O2"                       integer
         if (nstr > 18) p_branchData[l_idx]->addValue(BRANCH_O2,
-            atoi(split_line[18].c_str()), nelems);
+            split_line[18].toInt(), nelems);
 
         // BRANCH_F2        "F2"                             float
         if (nstr > 19) p_branchData[l_idx]->addValue(BRANCH_F2,
-            atoi(split_line[19].c_str()), nelems);
+            split_line[19].toInt(), nelems);
 
         // BRANCH_O3        "O3"                       integer
         if (nstr > 20) p_branchData[l_idx]->addValue(BRANCH_O3,
-            atoi(split_line[20].c_str()), nelems);
+            split_line[20].toInt(), nelems);
 
         // BRANCH_F3        "F3"                             float
         if (nstr > 21) p_branchData[l_idx]->addValue(BRANCH_F3,
-            atoi(split_line[21].c_str()), nelems);
+            split_line[21].toInt(), nelems);
 
         // BRANCH_O4        "O4"                       integer
         if (nstr > 22) p_branchData[l_idx]->addValue(BRANCH_O4,
-            atoi(split_line[22].c_str()), nelems);
+            split_line[22].toInt(), nelems);
 
         // BRANCH_F4        "F4"                             float
         if (nstr > 23) p_branchData[l_idx]->addValue(BRANCH_F4,
-            atoi(split_line[23].c_str()), nelems);
+            split_line[23].toInt(), nelems);
 
         // TODO: add variables MET, LEN, Oi, Fi
 
@@ -940,14 +1390,14 @@ class PTI33_parser : public BasePTIParser<_network>
     }
 
     // Utility function to parse lines in 3-winding transformer block
-    bool parse3WindXForm(std::vector<std::string>split_line, double *windv,
+    bool parse3WindXForm(const RecordTokenizer &split_line, double *windv,
         double* ang, double *ratea, double *rateb, double *ratec)
     {
-      *windv = atof(split_line[0].c_str());
-      *ang = atof(split_line[2].c_str());
-      *ratea = atof(split_line[3].c_str());
-      *rateb = atof(split_line[4].c_str());
-      *ratec = atof(split_line[5].c_str());
+      *windv = split_line[0].toDouble();
+      *ang = split_line[2].toDouble();
+      *ratea = split_line[3].toDouble();
+      *rateb = split_line[4].toDouble();
+      *ratec = split_line[5].toDouble();
       bool ret = true;
       return ret && (split_line.size() > 5);
     }
@@ -958,6 +1408,11 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_transformer()
     {
       std::string          line;
+      RecordTokenizer split_line;
+      RecordTokenizer split_line2;
+      RecordTokenizer split_line3;
+      RecordTokenizer split_line4;
+      RecordTokenizer split_line5;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
@@ -969,10 +1424,7 @@ class PTI33_parser : public BasePTIParser<_network>
       bool wind3X = true;
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
         int o_idx1, o_idx2;
         o_idx1 = getBusIndex(split_line[0]);
         o_idx2 = getBusIndex(split_line[1]);
@@ -983,13 +1435,10 @@ class PTI33_parser : public BasePTIParser<_network>
           if (wind3X) {
             int o_idx3 = k;
             p_istream.nextLine(line);
-            std::vector<std::string>  split_line2;
-            this->cleanComment(line);
-            boost::split(split_line2, line, boost::algorithm::is_any_of(","),
-                boost::token_compress_off);
+            split_line2.tokenize(line);
             // Check to see if transformer is active
             int stat;
-            stat = atoi(split_line[11].c_str());
+            stat = split_line[11].toInt();
             if (split_line2.size() < 4 || stat == 0) {
               p_istream.nextLine(line);
               p_istream.nextLine(line);
@@ -997,8 +1446,11 @@ class PTI33_parser : public BasePTIParser<_network>
               p_istream.nextLine(line);
               continue;
             }
-            // Get internal indices corresponding to buses 1,2,3
-            int l_idx1, l_idx2, l_idx3;
+            // Get internal index corresponding to bus 1. Buses 2 and 3 are
+            // only checked if the file is parsed on one processor, since
+            // they can be on other processors if the file is parsed in
+            // parallel
+            int l_idx1;
             std::map<int,int>::iterator it;
             it = p_busMap.find(o_idx1);
             if (it != p_busMap.end()) {
@@ -1006,17 +1458,15 @@ class PTI33_parser : public BasePTIParser<_network>
             } else {
               printf("No match found for bus %s\n",split_line[0].c_str());
             }
-            it = p_busMap.find(o_idx2);
-            if (it != p_busMap.end()) {
-              l_idx2 = it->second;
-            } else {
-              printf("No match found for bus %s\n",split_line[1].c_str());
-            }
-            it = p_busMap.find(o_idx3);
-            if (it != p_busMap.end()) {
-              l_idx3 = it->second;
-            } else {
-              printf("No match found for bus %s\n",split_line[2].c_str());
+            if (!p_parallelParse) {
+              it = p_busMap.find(o_idx2);
+              if (it == p_busMap.end()) {
+                printf("No match found for bus %s\n",split_line[1].c_str());
+              }
+              it = p_busMap.find(o_idx3);
+              if (it == p_busMap.end()) {
+                printf("No match found for bus %s\n",split_line[2].c_str());
+              }
             }
             // Create a new bus and three new branches. No need to check
             // previous branches to see if they match since they are all
@@ -1027,7 +1477,14 @@ class PTI33_parser : public BasePTIParser<_network>
               data(new gridpack::component::DataCollection);
             int n_idx = p_busData.size();
             p_busData.push_back(data);
-            p_maxBusIndex++;
+            if (p_nextStarBus < p_starBuses.size()) {
+              // Numbers of new buses are assigned before the transformers
+              // are parsed if the file is parsed in parallel
+              p_maxBusIndex = p_starBuses[p_nextStarBus];
+              p_nextStarBus++;
+            } else {
+              p_maxBusIndex++;
+            }
             data->addValue(BUS_NUMBER,p_maxBusIndex);
             char cbuf[128];
             sprintf(cbuf,"DUMMY_BUS-%d-%d-%d",o_idx1,o_idx2,o_idx3);
@@ -1039,48 +1496,31 @@ class PTI33_parser : public BasePTIParser<_network>
             data->addValue(BUS_AREA,ival);
             p_busData[l_idx1]->getValue(BUS_OWNER,&ival);
             data->addValue(BUS_OWNER, ival);
-            double rval = 0.0;
-            double rvol;
-            p_busData[l_idx1]->getValue(BUS_VOLTAGE_MAG,&rvol);
-            rval += rvol;
-            p_busData[l_idx2]->getValue(BUS_VOLTAGE_MAG,&rvol);
-            rval += rvol;
-            p_busData[l_idx3]->getValue(BUS_VOLTAGE_MAG,&rvol);
-            rval += rvol;
-            rval = rval/3.0;
-            rval = 1.0;
+            // New bus starts from a flat voltage profile
+            double rval = 1.0;
             data->addValue(BUS_VOLTAGE_MAG,rval);
             rval = 0.0;
-            p_busData[l_idx1]->getValue(BUS_VOLTAGE_ANG,&rvol);
-            rval += rvol;
-            p_busData[l_idx2]->getValue(BUS_VOLTAGE_ANG,&rvol);
-            rval += rvol;
-            p_busData[l_idx3]->getValue(BUS_VOLTAGE_ANG,&rvol);
-            rval += rvol;
-            rval = rval/3.0;
-            rval = 0.0;
             data->addValue(BUS_VOLTAGE_ANG,rval);
 
             // parse remainder of line 1
             double mag1, mag2;
-            mag1 = atof(split_line[7].c_str());
-            mag2 = atof(split_line[8].c_str());
+            mag1 = split_line[7].toDouble();
+            mag2 = split_line[8].toDouble();
             // Clean up 2 character tag
-            gridpack::utility::StringUtils util;
-            std::string tag = util.clean2Char(split_line[3]);
+            std::string tag = split_line[3].tag();
 
             // parse line 2
             double r12, r23, r31, x12, x23, x31, sb12, sb23, sb31;
             double r1, r2, r3, x1, x2, x3, b1, b2, b3;
-            r12 = atof(split_line2[0].c_str());
-            x12 = atof(split_line2[1].c_str());
-            sb12 = atof(split_line2[2].c_str());
-            r23 = atof(split_line2[3].c_str());
-            x23 = atof(split_line2[4].c_str());
-            sb23 = atof(split_line2[5].c_str());
-            r31 = atof(split_line2[6].c_str());
-            x31 = atof(split_line2[7].c_str());
-            sb31 = atof(split_line2[8].c_str());
+            r12 = split_line2[0].toDouble();
+            x12 = split_line2[1].toDouble();
+            sb12 = split_line2[2].toDouble();
+            r23 = split_line2[3].toDouble();
+            x23 = split_line2[4].toDouble();
+            sb23 = split_line2[5].toDouble();
+            r31 = split_line2[6].toDouble();
+            x31 = split_line2[7].toDouble();
+            sb31 = split_line2[8].toDouble();
             r1 = 0.5*(r12+r31-r23);
             x1 = 0.5*(x12+x31-x23);
             b1 = 0.0;
@@ -1110,10 +1550,7 @@ class PTI33_parser : public BasePTIParser<_network>
               data1(new gridpack::component::DataCollection);
             p_branchData.push_back(data1);
             p_istream.nextLine(line);
-            std::vector<std::string> split_line3;
-            this->cleanComment(line);
-            boost::split(split_line3, line, boost::algorithm::is_any_of(","),
-                boost::token_compress_off);
+            split_line3.tokenize(line);
             double windv, ang, ratea, rateb, ratec;
             parse3WindXForm(split_line3, &windv, &ang, &ratea, &rateb, &ratec);
             data1->addValue(BRANCH_INDEX,index);
@@ -1146,10 +1583,7 @@ class PTI33_parser : public BasePTIParser<_network>
               data2(new gridpack::component::DataCollection);
             p_branchData.push_back(data2);
             p_istream.nextLine(line);
-            std::vector<std::string> split_line4;
-            this->cleanComment(line);
-            boost::split(split_line4, line, boost::algorithm::is_any_of(","),
-                boost::token_compress_off);
+            split_line4.tokenize(line);
             parse3WindXForm(split_line4, &windv, &ang, &ratea, &rateb, &ratec);
             data2->addValue(BRANCH_INDEX,index);
             data2->addValue(BRANCH_FROMBUS,o_idx2);
@@ -1181,10 +1615,7 @@ class PTI33_parser : public BasePTIParser<_network>
               data3(new gridpack::component::DataCollection);
             p_branchData.push_back(data3);
             p_istream.nextLine(line);
-            std::vector<std::string> split_line5;
-            this->cleanComment(line);
-            boost::split(split_line5, line, boost::algorithm::is_any_of(","),
-                boost::token_compress_off);
+            split_line5.tokenize(line);
             parse3WindXForm(split_line5, &windv, &ang, &ratea, &rateb, &ratec);
             data3->addValue(BRANCH_INDEX,index);
             data3->addValue(BRANCH_FROMBUS,o_idx3);
@@ -1220,22 +1651,13 @@ class PTI33_parser : public BasePTIParser<_network>
         } else {
           int ntoken = split_line.size();
           p_istream.nextLine(line);
-          std::vector<std::string>  split_line2;
-          this->cleanComment(line);
-          boost::split(split_line2, line, boost::algorithm::is_any_of(","),
-              boost::token_compress_off);
+          split_line2.tokenize(line);
 
           p_istream.nextLine(line);
-          std::vector<std::string>  split_line3;
-          this->cleanComment(line);
-          boost::split(split_line3, line, boost::algorithm::is_any_of(","),
-              boost::token_compress_off);
+          split_line3.tokenize(line);
 
           p_istream.nextLine(line);
-          std::vector<std::string>  split_line4;
-          this->cleanComment(line);
-          boost::split(split_line4, line, boost::algorithm::is_any_of(","),
-              boost::token_compress_off);
+          split_line4.tokenize(line);
           // find branch corresponding to this transformer line. If it doesn't
           // exist, create one
           int l_idx = 0;
@@ -1295,8 +1717,7 @@ class PTI33_parser : public BasePTIParser<_network>
           }
 
           // Clean up 2 character tag
-          gridpack::utility::StringUtils util;
-          std::string tag = util.clean2Char(split_line[3]);
+          std::string tag = split_line[3].tag();
           // BRANCH_CKT          "CKT"                 character
           p_branchData[l_idx]->addValue(BRANCH_CKT, tag.c_str(), nelems);
 
@@ -1306,105 +1727,105 @@ class PTI33_parser : public BasePTIParser<_network>
            * TRANSFORMER_CW
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CW,
-              atoi(split_line[4].c_str()),nelems);
+              split_line[4].toInt(),nelems);
 
           /*
            * type: integer
            * TRANSFORMER_CZ
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CZ,
-              atoi(split_line[5].c_str()),nelems);
+              split_line[5].toInt(),nelems);
 
           /*
            * type: integer
            * TRANSFORMER_CM
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CM,
-              atoi(split_line[6].c_str()),nelems);
+              split_line[6].toInt(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_MAG1
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_MAG1,
-              atof(split_line[7].c_str()),nelems);
+              split_line[7].toDouble(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_MAG2
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_MAG2,
-              atof(split_line[8].c_str()),nelems);
+              split_line[8].toDouble(),nelems);
 
           /*
            * type: integer
            * BRANCH_STATUS
            */
           p_branchData[l_idx]->addValue(BRANCH_STATUS,
-              atoi(split_line[11].c_str()),nelems);
+              split_line[11].toInt(),nelems);
 
           /**
            * type: integer
            * TRANSFORMER_NMETR
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_NMETR,
-              atoi(split_line[9].c_str()),nelems);
+              split_line[9].toInt(),nelems);
 
           /*
            * type: integer
            * BRANCH_O1
            */
           if (ntoken > 12) p_branchData[l_idx]->addValue(BRANCH_O1,
-              atoi(split_line[12].c_str()), nelems);
+              split_line[12].toInt(), nelems);
 
           /*
            * type: float
            * BRANCH_F1
            */
           if (ntoken > 13) p_branchData[l_idx]->addValue(BRANCH_F1,
-              atoi(split_line[13].c_str()), nelems);
+              split_line[13].toInt(), nelems);
 
           /*
            * type: integer
            * BRANCH_O2
            */
           if (ntoken > 14) p_branchData[l_idx]->addValue(BRANCH_O2,
-              atoi(split_line[14].c_str()), nelems);
+              split_line[14].toInt(), nelems);
 
           /*
            * type: float
            * BRANCH_F2
            */
           if (ntoken > 15) p_branchData[l_idx]->addValue(BRANCH_F2,
-              atoi(split_line[15].c_str()), nelems);
+              split_line[15].toInt(), nelems);
 
           /*
            * type: integer
            * BRANCH_O3
            */
           if (ntoken > 16) p_branchData[l_idx]->addValue(BRANCH_O3,
-              atoi(split_line[16].c_str()), nelems);
+              split_line[16].toInt(), nelems);
 
           /*
            * type: float
            * BRANCH_F3
            */
           if (ntoken > 17) p_branchData[l_idx]->addValue(BRANCH_F3,
-              atoi(split_line[17].c_str()), nelems);
+              split_line[17].toInt(), nelems);
 
           /*
            * type: integer
            * BRANCH_O4
            */
           if (ntoken > 18) p_branchData[l_idx]->addValue(BRANCH_O4,
-              atoi(split_line[18].c_str()), nelems);
+              split_line[18].toInt(), nelems);
 
           /*
            * type: float
            * BRANCH_F4
            */
           if (ntoken > 19) p_branchData[l_idx]->addValue(BRANCH_F4,
-              atoi(split_line[19].c_str()), nelems);
+              split_line[19].toInt(), nelems);
 
 
           // Add parameters from line 2
@@ -1412,14 +1833,14 @@ class PTI33_parser : public BasePTIParser<_network>
            * type: float
            * SBASE2
            */
-          double sbase2 = atof(split_line2[2].c_str());
+          double sbase2 = split_line2[2].toDouble();
           p_branchData[l_idx]->addValue(TRANSFORMER_SBASE1_2,sbase2,nelems);
 
           /*
            * type: float
            * BRANCH_R
            */
-          double rval = atof(split_line2[0].c_str());
+          double rval = split_line2[0].toDouble();
           if (sbase2 == p_case_sbase || sbase2 == 0.0) {
             p_branchData[l_idx]->addValue(BRANCH_R,rval,nelems);
           } else {
@@ -1432,7 +1853,7 @@ class PTI33_parser : public BasePTIParser<_network>
            * type: float
            * BRANCH_X
            */
-          rval = atof(split_line2[1].c_str());
+          rval = split_line2[1].toDouble();
           if (sbase2 == p_case_sbase || sbase2 == 0.0) {
             p_branchData[l_idx]->addValue(BRANCH_X,rval,nelems);
           } else {
@@ -1447,8 +1868,8 @@ class PTI33_parser : public BasePTIParser<_network>
            * BRANCH_TAP: This is the ratio of WINDV1 and WINDV2
            */
           ntoken = split_line3.size();
-          double windv1 = atof(split_line3[0].c_str());
-          double windv2 = atof(split_line4[0].c_str());
+          double windv1 = split_line3[0].toDouble();
+          double windv2 = split_line4[0].toDouble();
           double tap = windv1/windv2;
           p_branchData[l_idx]->addValue(BRANCH_TAP,tap,nelems);
           p_branchData[l_idx]->addValue(TRANSFORMER_WINDV1,windv1,nelems);
@@ -1459,93 +1880,93 @@ class PTI33_parser : public BasePTIParser<_network>
            * BRANCH_SHIFT
            */
           p_branchData[l_idx]->addValue(BRANCH_SHIFT,
-              atof(split_line3[2].c_str()),nelems);
+              split_line3[2].toDouble(),nelems);
           p_branchData[l_idx]->addValue(TRANSFORMER_ANG1,
-              atof(split_line3[2].c_str()),nelems);
+              split_line3[2].toDouble(),nelems);
 
           /*
            * type: float
            * BRANCH_RATING_A
            */
           p_branchData[l_idx]->addValue(BRANCH_RATING_A,
-              atof(split_line3[3].c_str()),nelems);
+              split_line3[3].toDouble(),nelems);
 
           /*
            * type: float
            * BRANCH_RATING_B
            */
           p_branchData[l_idx]->addValue(BRANCH_RATING_B,
-              atof(split_line3[4].c_str()),nelems);
+              split_line3[4].toDouble(),nelems);
 
           /*
            * type: float
            * BRANCH_RATING_C
            */
           p_branchData[l_idx]->addValue(BRANCH_RATING_C,
-              atof(split_line3[5].c_str()),nelems);
+              split_line3[5].toDouble(),nelems);
 
           /*
            * type: integer
            * TRANSFORMER_CODE1
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CODE1,
-              atoi(split_line3[6].c_str()),nelems);
+              split_line3[6].toInt(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_RMA
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_RMA,
-              atof(split_line3[8].c_str()),nelems);
+              split_line3[8].toDouble(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_RMI
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_RMI,
-              atof(split_line3[9].c_str()),nelems);
+              split_line3[9].toDouble(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_VMA
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_VMA,
-              atof(split_line3[10].c_str()),nelems);
+              split_line3[10].toDouble(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_VMI
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_VMI,
-              atof(split_line3[11].c_str()),nelems);
+              split_line3[11].toDouble(),nelems);
 
           /*
            * type: integer
            * TRANSFORMER_NPT
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_NTP,
-              atoi(split_line3[12].c_str()),nelems);
+              split_line3[12].toInt(),nelems);
 
           /*
            * type: integer
            * TRANSFORMER_TAB
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_TAB,
-              atoi(split_line3[13].c_str()),nelems);
+              split_line3[13].toInt(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_CR
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CR,
-              atof(split_line3[14].c_str()),nelems);
+              split_line3[14].toDouble(),nelems);
 
           /*
            * type: float
            * TRANSFORMER_CI
            */
           p_branchData[l_idx]->addValue(TRANSFORMER_CX,
-              atof(split_line3[15].c_str()),nelems);
+              split_line3[15].toDouble(),nelems);
 
           /*
            * type: float
@@ -1553,7 +1974,7 @@ class PTI33_parser : public BasePTIParser<_network>
            */
           if (ntoken > 16) {
           p_branchData[l_idx]->addValue(TRANSFORMER_CNXA,
-              atof(split_line3[16].c_str()),nelems);
+              split_line3[16].toDouble(),nelems);
           }
 
           nelems++;
@@ -1566,27 +1987,25 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_area()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
       int ncnt = 0;
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         // AREAINTG_ISW             "I"                    integer
-        p_network_data->addValue(AREAINTG_ISW, atoi(split_line[1].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_ISW, split_line[1].toInt(),ncnt);
 
         // AREAINTG_NUMBER             "I"                    integer
-        p_network_data->addValue(AREAINTG_NUMBER, atoi(split_line[0].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_NUMBER, split_line[0].toInt(),ncnt);
 
         // AREAINTG_PDES          "PDES"                 float
-        p_network_data->addValue(AREAINTG_PDES, atof(split_line[2].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_PDES, split_line[2].toDouble(),ncnt);
 
         // AREAINTG_PTOL          "PTOL"                 float
-        p_network_data->addValue(AREAINTG_PTOL, atof(split_line[3].c_str()),ncnt);
+        p_network_data->addValue(AREAINTG_PTOL, split_line[3].toDouble(),ncnt);
 
         // AREAINTG_NAME         "ARNAM"                string
         p_network_data->addValue(AREAINTG_NAME, split_line[4].c_str(),ncnt);
@@ -1600,16 +2019,14 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_2term()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
         int l_idx, o_idx;
-        o_idx = atoi(split_line[1].c_str());
+        o_idx = split_line[1].toInt();
 #ifdef OLD_MAP
         std::map<int, int>::iterator it;
 #else
@@ -1630,14 +2047,12 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_vsc_line()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         p_istream.nextLine(line);
       }
@@ -1650,20 +2065,18 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_switched_shunt()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
 
         /*
          * type: integer
          * #define SWSHUNT_BUSNUMBER "SWSHUNT_BUSNUMBER"
          */
         int l_idx, o_idx;
-        l_idx = atoi(split_line[0].c_str());
+        l_idx = split_line[0].toInt();
 #ifdef OLD_MAP
         std::map<int, int>::iterator it;
 #else
@@ -1678,49 +2091,49 @@ class PTI33_parser : public BasePTIParser<_network>
         }
         int nval = split_line.size();
 
-        p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, atoi(split_line[0].c_str()));
+        p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, split_line[0].toInt());
 
         /*
          * type: integer
          * #define SHUNT_MODSW "SHUNT_MODSW"
          */
-        p_busData[o_idx]->addValue(SHUNT_MODSW, atoi(split_line[1].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_MODSW, split_line[1].toInt());
 
         /*
          * type: integer
          * #define SHUNT_ADJM "SHUNT_ADJM"
          */
-        p_busData[o_idx]->addValue(SHUNT_ADJM, atoi(split_line[2].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_ADJM, split_line[2].toInt());
 
         /*
          * type: integer
          * #define SHUNT_SWCH_STAT "SHUNT_SWCH_STAT"
          */
-        p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, atoi(split_line[3].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, split_line[3].toInt());
 
         /*
          * type: real float
          * #define SHUNT_VSWHI "SHUNT_VSWHI"
          */
-        p_busData[o_idx]->addValue(SHUNT_VSWHI, atof(split_line[4].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_VSWHI, split_line[4].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_VSWLO "SHUNT_VSWLO"
          */
-        p_busData[o_idx]->addValue(SHUNT_VSWLO, atof(split_line[5].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_VSWLO, split_line[5].toDouble());
 
         /*
          * type: integer
          * #define SHUNT_SWREM "SHUNT_SWREM"
          */
-        p_busData[o_idx]->addValue(SHUNT_SWREM, atoi(split_line[6].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_SWREM, split_line[6].toInt());
 
         /*
          * type: real float
          * #define SHUNT_RMPCT "SHUNT_RMPCT"
          */
-        p_busData[o_idx]->addValue(SHUNT_RMPCT, atof(split_line[7].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_RMPCT, split_line[7].toDouble());
 
         /*
          * type: string
@@ -1732,115 +2145,115 @@ class PTI33_parser : public BasePTIParser<_network>
          * type: real float
          * #define SHUNT_BINIT "SHUNT_BINIT"
          */
-        p_busData[o_idx]->addValue(SHUNT_BINIT, atof(split_line[9].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_BINIT, split_line[9].toDouble());
 
         if (nval > 10)
-        p_busData[o_idx]->addValue(SHUNT_N1, atoi(split_line[10].c_str()));
+        p_busData[o_idx]->addValue(SHUNT_N1, split_line[10].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N2 "SHUNT_N2"
          */
         if (nval > 12)
-          p_busData[o_idx]->addValue(SHUNT_N2, atoi(split_line[12].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N2, split_line[12].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N3 "SHUNT_N3"
          */
         if (nval > 14)
-          p_busData[o_idx]->addValue(SHUNT_N3, atoi(split_line[14].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N3, split_line[14].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N4 "SHUNT_N4"
          */
         if (nval > 16)
-          p_busData[o_idx]->addValue(SHUNT_N4, atoi(split_line[16].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N4, split_line[16].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N5 "SHUNT_N5"
          */
         if (nval > 18)
-          p_busData[o_idx]->addValue(SHUNT_N5, atoi(split_line[18].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N5, split_line[18].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N6 "SHUNT_N6"
          */
         if (nval > 20)
-          p_busData[o_idx]->addValue(SHUNT_N6, atoi(split_line[20].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N6, split_line[20].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N7 "SHUNT_N7"
          */
         if (nval > 22) 
-          p_busData[o_idx]->addValue(SHUNT_N7, atoi(split_line[22].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N7, split_line[22].toInt());
 
         /*
          * type: integer
          * #define SHUNT_N8 "SHUNT_N8"
          */
         if (nval > 24) 
-          p_busData[o_idx]->addValue(SHUNT_N8, atoi(split_line[24].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_N8, split_line[24].toInt());
 
         /*
          * type: real float
          * #define SHUNT_B1 "SHUNT_B1"
          */
         if (nval > 11) 
-          p_busData[o_idx]->addValue(SHUNT_B1, atof(split_line[11].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B1, split_line[11].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B2 "SHUNT_B2"
          */
         if (nval > 13) 
-          p_busData[o_idx]->addValue(SHUNT_B2, atof(split_line[13].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B2, split_line[13].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B3 "SHUNT_B3"
          */
         if (nval > 15) 
-          p_busData[o_idx]->addValue(SHUNT_B3, atof(split_line[15].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B3, split_line[15].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B4 "SHUNT_B4"
          */
         if (nval > 17) 
-          p_busData[o_idx]->addValue(SHUNT_B4, atof(split_line[17].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B4, split_line[17].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B5 "SHUNT_B5"
          */
         if (nval > 19) 
-          p_busData[o_idx]->addValue(SHUNT_B5, atof(split_line[19].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B5, split_line[19].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B6 "SHUNT_B6"
          */
         if (nval > 21) 
-          p_busData[o_idx]->addValue(SHUNT_B6, atof(split_line[21].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B6, split_line[21].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B7 "SHUNT_B7"
          */
         if (nval > 23) 
-          p_busData[o_idx]->addValue(SHUNT_B7, atof(split_line[23].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B7, split_line[23].toDouble());
 
         /*
          * type: real float
          * #define SHUNT_B8 "SHUNT_B8"
          */
         if (nval > 25) 
-          p_busData[o_idx]->addValue(SHUNT_B8, atof(split_line[25].c_str()));
+          p_busData[o_idx]->addValue(SHUNT_B8, split_line[25].toDouble());
 
         p_istream.nextLine(line);
       }
@@ -1849,14 +2262,12 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_imped_corr()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
         int nval = split_line.size();
         int entries = nval-1;
         entries =  entries - entries%2;
@@ -1869,7 +2280,7 @@ class PTI33_parser : public BasePTIParser<_network>
          * type: integer
          * #define XFMR_CORR_TABLE_NUMBER "XFMR_CORR_TABLE_NUMBER"
          */
-        int tableid = atoi(split_line[0].c_str());
+        int tableid = split_line[0].toInt();
         data->addValue(XFMR_CORR_TABLE_NUMBER, tableid);
 
         int i;
@@ -1880,14 +2291,14 @@ class PTI33_parser : public BasePTIParser<_network>
            * #define XFMR_CORR_TABLE_Ti "XFMR_CORR_TABLE_Ti"
            */
           sprintf(buf,"XFMR_CORR_TABLE_T%d",i+1);
-          data->addValue(buf, atof(split_line[1+2*i].c_str()));
+          data->addValue(buf, split_line[1+2*i].toDouble());
 
           /*
            * type: real float
            * #define XFMR_CORR_TABLE_Fi "XFMR_CORR_TABLE_Fi"
            */
           sprintf(buf,"XFMR_CORR_TABLE_F%d",i+1);
-          data->addValue(buf, atof(split_line[2+2*i].c_str()));
+          data->addValue(buf, split_line[2+2*i].toDouble());
         }
 
         p_imp_corr_table.insert(std::pair<int,
@@ -1911,14 +2322,12 @@ class PTI33_parser : public BasePTIParser<_network>
     void find_multi_section()
     {
       std::string          line;
+      RecordTokenizer split_line;
 
       p_istream.nextLine(line); //this should be the first line of the block
 
       while(test_end(line)) {
-        std::vector<std::string>  split_line;
-        this->cleanComment(line);
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_off);
+        split_line.tokenize(line);
         int o_idx1, o_idx2;
         o_idx1 = getBusIndex(split_line[0]);
         o_idx2 = getBusIndex(split_line[1]);
@@ -1952,8 +2361,7 @@ class PTI33_parser : public BasePTIParser<_network>
         if (!found || nelems <= 0) continue;
 
         // Clean up 2 character tag
-        gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[2]);
+        std::string tag = split_line[2].tag();
         if (tag.length() != 2 || tag[0] != '&') {
           tag = "&1";
         }
@@ -1968,14 +2376,14 @@ class PTI33_parser : public BasePTIParser<_network>
          * type: integer
          * #define MULTI_SEC_LINE_MET "MULTI_SEC_LINE_MET"
          */
-        p_branchData[l_idx]->addValue(MULTI_SEC_LINE_MET, atoi(split_line[3].c_str()));
+        p_branchData[l_idx]->addValue(MULTI_SEC_LINE_MET, split_line[3].toInt());
 
 
         int i;
         char buf[32];
         for (i=0; i<9; i++) {
           sprintf(buf,"MULTI_SEC_LINE_DUM%d",i+1);
-          p_branchData[l_idx]->addValue(buf,atoi(split_line[i+4].c_str()));
+          p_branchData[l_idx]->addValue(buf,split_line[i+4].toInt());
         }
 
         p_istream.nextLine(line);
@@ -2005,8 +2413,8 @@ class PTI33_parser : public BasePTIParser<_network>
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_off);
+        RecordTokenizer split_line;
+        split_line.tokenize(line);
         std::vector<gridpack::component::DataCollection>   inter_area_instance;
         gridpack::component::DataCollection          data;
 
@@ -2014,14 +2422,14 @@ class PTI33_parser : public BasePTIParser<_network>
          * type: integer
          * #define INTERAREA_TRANSFER_FROM "INTERAREA_TRANSFER_FROM"
          */
-        data.addValue(INTERAREA_TRANSFER_FROM, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_FROM, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
          * type: integer
          * #define INTERAREA_TRANSFER_TO "INTERAREA_TRANSFER_TO"
          */
-        data.addValue(INTERAREA_TRANSFER_TO, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_TO, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
@@ -2035,7 +2443,7 @@ class PTI33_parser : public BasePTIParser<_network>
          * type: real float
          * #define INTERAREA_TRANSFER_PTRAN "INTERAREA_TRANSFER_PTRAN"
          */
-        data.addValue(INTERAREA_TRANSFER_PTRAN, atof(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_PTRAN, split_line[0].toDouble());
         inter_area_instance.push_back(data);
 
         inter_area.push_back(inter_area_instance);
@@ -2058,12 +2466,12 @@ class PTI33_parser : public BasePTIParser<_network>
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
-        boost::split(split_line, line, boost::algorithm::is_any_of(","), boost::token_compress_off);
+        RecordTokenizer split_line;
+        split_line.tokenize(line);
         std::vector<gridpack::component::DataCollection>   owner_instance;
         gridpack::component::DataCollection          data;
 
-        data.addValue(OWNER_NUMBER, atoi(split_line[0].c_str()));
+        data.addValue(OWNER_NUMBER, split_line[0].toInt());
         owner_instance.push_back(data);
 
         data.addValue(OWNER_NAME, split_line[1].c_str());
@@ -2089,118 +2497,9 @@ class PTI33_parser : public BasePTIParser<_network>
     void brdcst_data(void)
     {
       int t_brdcst = p_timer->createCategory("Parser:brdcst_data");
-      int t_serial = p_timer->createCategory("Parser:data packing and unpacking");
-      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
-      int me(p_network->communicator().rank());
-      int nprocs(p_network->communicator().size());
-      if (nprocs == 1) return;
       p_timer->start(t_brdcst);
-
-      // find number of buses and branches and broadcast this information to
-      // all processors
-      int sbus, sbranch;
-      if (me == 0) {
-        sbus = p_busData.size();
-        sbranch = p_branchData.size();
-      } else {
-        sbus = 0;
-        sbranch = 0;
-      }
-      int ierr, nbus, nbranch;
-      ierr = MPI_Allreduce(&sbus, &nbus, 1, MPI_INT, MPI_SUM, comm);
-      ierr = MPI_Allreduce(&sbranch, &nbranch, 1, MPI_INT, MPI_SUM, comm);
-      double rprocs = static_cast<double>(nprocs);
-      double rme = static_cast<double>(me);
-      int n, i;
-      std::vector<gridpack::component::DataCollection>recvV;
-      // distribute buses
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbus)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbus)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_busData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbus)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbus)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      int nsize = recvV.size();
-      p_busData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_busData.push_back(data);
-      }
-      p_timer->stop(t_serial);
-      recvV.clear();
-      // distribute branches
-      if (me == 0) {
-        for (n=0; n<nprocs; n++) {
-          double rn = static_cast<double>(n);
-          int istart = static_cast<int>(static_cast<double>(nbranch)*rn/rprocs);
-          int iend = static_cast<int>(static_cast<double>(nbranch)*(rn+1.0)/rprocs);
-          if (n != 0) {
-            p_timer->start(t_serial);
-            std::vector<gridpack::component::DataCollection> sendV;
-            for (i=istart; i<iend; i++) {
-              sendV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-            static_cast<boost::mpi::communicator>(p_network->communicator()).send(n,n,sendV);
-          } else {
-            p_timer->start(t_serial);
-            for (i=istart; i<iend; i++) {
-              recvV.push_back(*(p_branchData[i]));
-            }
-            p_timer->stop(t_serial);
-          }
-        }
-      } else {
-        int istart = static_cast<int>(static_cast<double>(nbranch)*rme/rprocs);
-        int iend = static_cast<int>(static_cast<double>(nbranch)*(rme+1.0)/rprocs)-1;
-        static_cast<boost::mpi::communicator>(p_network->communicator()).recv(0,me,recvV);
-      }
-      nsize = recvV.size();
-      p_branchData.clear();
-      p_timer->start(t_serial);
-      for (i=0; i<nsize; i++) {
-        boost::shared_ptr<gridpack::component::DataCollection> data(new
-            gridpack::component::DataCollection);
-        *data = recvV[i];
-        p_branchData.push_back(data);
-      }
-      p_timer->stop(t_serial);
-#if 0
-      // debug
-      printf("p[%d] BUS data size: %d\n",me,p_busData.size());
-      for (i=0; i<p_busData.size(); i++) {
-        printf("p[%d] Dumping bus: %d\n",me,i);
-        p_busData[i]->dump();
-      }
-      printf("p[%d] BRANCH data size: %d\n",me,p_branchData.size());
-      for (i=0; i<p_branchData.size(); i++) {
-        printf("p[%d] Dumping branch: %d\n",me,i);
-        p_branchData[i]->dump();
-      }
-#endif
+      this->distributeData(p_busData);
+      this->distributeData(p_branchData);
       p_timer->stop(t_brdcst);
     }
 
@@ -2364,6 +2663,16 @@ class PTI33_parser : public BasePTIParser<_network>
       }
     }
 
+    /**
+     * Get bus index from a field of a record. This avoids creating a string
+     * for fields that contain a bus number
+     */
+    int getBusIndex(const RecordField &field)
+    {
+      if (field.isQuoted()) return getBusIndex(field.str());
+      return abs(field.toInt());
+    }
+
     /*
      * The case_data is the collection of all data points in the case file.
      * Each collection in the case data contains the data associated with a given
@@ -2425,6 +2734,13 @@ class PTI33_parser : public BasePTIParser<_network>
     // Global variables that apply to whole network
     int p_case_id;
     int p_maxBusIndex;
+
+    // Parse RAW files on all processors
+    bool p_parallelParse;
+    // Bus numbers of new buses created for 3-winding transformers, if they
+    // have been assigned ahead of time
+    std::vector<int> p_starBuses;
+    int p_nextStarBus;
     double p_case_sbase;
     gridpack::utility::CoarseTimer *p_timer;
 
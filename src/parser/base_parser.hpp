@@ -40,7 +40,8 @@ class BaseParser
   public:
 
     /// Constructor
-    explicit BaseParser() : p_configExists(false) {}
+    explicit BaseParser() : p_configExists(false), p_distribute(false),
+      p_maxBuffer(64*1024*1024) {}
 
     /**
      * Destructor
@@ -82,13 +83,41 @@ class BaseParser
         offset_bus[i] = offset_bus[i-1]+nbus[i-1];
         offset_branch[i] = offset_branch[i-1]+nbranch[i-1];
       }
+      std::vector<int> busIndex(busData.size());
+      std::vector<int> branchIndex(branchData.size());
+      for (i=0; i<busIndex.size(); i++) {
+        busIndex[i] = i+offset_bus[me];
+      }
+      for (i=0; i<branchIndex.size(); i++) {
+        branchIndex[i] = i+offset_branch[me];
+      }
+      p_timer->stop(t_create);
+      createNetwork(busData,branchData,busIndex,branchIndex);
+    }
 
+    /**
+     * Create network from bus and branch data using global indices that
+     * have already been assigned to the buses and branches
+     * @param busData data for buses on this processor
+     * @param branchData data for branches on this processor
+     * @param busIndex global index of each bus
+     * @param branchIndex global index of each branch
+     */
+    void createNetwork(std::vector<boost::shared_ptr<component::DataCollection> >
+        &busData, std::vector<boost::shared_ptr<component::DataCollection> >
+        &branchData, const std::vector<int> &busIndex,
+        const std::vector<int> &branchIndex)
+    {
+      p_timer = gridpack::utility::CoarseTimer::instance();
+      int t_create = p_timer->createCategory("Parser:createNetwork");
+      p_timer->start(t_create);
+      int i;
       int numBus = busData.size();
       for (i=0; i<numBus; i++) {
         int idx;
         busData[i]->getValue(BUS_NUMBER,&idx);
         p_network->addBus(idx);
-        p_network->setGlobalBusIndex(i,i+offset_bus[me]);
+        p_network->setGlobalBusIndex(i,busIndex[i]);
         *(p_network->getBusData(i)) = *(busData[i]);
         p_network->getBusData(i)->addValue(CASE_ID,p_case_id);
         p_network->getBusData(i)->addValue(CASE_SBASE,p_case_sbase);
@@ -99,7 +128,7 @@ class BaseParser
         branchData[i]->getValue(BRANCH_FROMBUS,&idx1);
         branchData[i]->getValue(BRANCH_TOBUS,&idx2);
         p_network->addBranch(idx1, idx2);
-        p_network->setGlobalBranchIndex(i,i+offset_branch[me]);
+        p_network->setGlobalBranchIndex(i,branchIndex[i]);
 #ifdef OLD_MAP
         std::map<int, int>::iterator it;
 #else
@@ -128,6 +157,106 @@ class BaseParser
       p_timer->stop(t_create);
     }
 
+    /**
+     * Distribute data read on process 0 evenly over all processors before
+     * the network is created, instead of creating the network on process 0
+     * and relying on the partitioner to move all of it
+     * @param flag if true, distribute data before creating network
+     * @param maxBuffer largest number of bytes that process 0 uses for data
+     * that is waiting to be sent
+     */
+    void setDistributeData(bool flag, size_t maxBuffer = 64*1024*1024)
+    {
+      p_distribute = flag;
+      p_maxBuffer = maxBuffer;
+    }
+
+    /**
+     * Distribute data collections on process 0 evenly over all processors,
+     * keeping their order, so that processor n gets the n'th block of data
+     * collections. Process 0 packs the data collections for each processor
+     * into chunks and sends each chunk as soon as it is full, so packing of
+     * the next chunk overlaps with sending and several processors receive
+     * data at the same time. A data collection is released as soon as it
+     * has been packed and at most maxBuffer bytes are waiting to be sent,
+     * so process 0 never holds a second copy of the network. This is
+     * collective
+     * @param data data collections to distribute. On process 0 this
+     * contains all data collections on input, on other processors it
+     * should be empty
+     */
+    void distributeData(std::vector<boost::shared_ptr<component::DataCollection> >
+        &data)
+    {
+      MPI_Comm comm = static_cast<MPI_Comm>(p_network->communicator());
+      int me(p_network->communicator().rank());
+      int nprocs(p_network->communicator().size());
+      if (nprocs == 1) return;
+      long ntotal = (me == 0) ? static_cast<long>(data.size()) : 0;
+      MPI_Bcast(&ntotal,1,MPI_LONG,0,comm);
+      const int tag = 11;
+      if (me == 0) {
+        // Use a small pool of chunks so that several sends can be in
+        // progress while the next chunk is packed
+        const int nchunks = 4;
+        size_t chunkSize = p_maxBuffer/nchunks;
+        if (chunkSize < 1024) chunkSize = 1024;
+        std::vector<std::vector<char> > chunks(nchunks);
+        std::vector<MPI_Request> requests(nchunks,MPI_REQUEST_NULL);
+        int current = 0;
+        int n;
+        long i;
+        for (n=1; n<nprocs; n++) {
+          long istart = (ntotal*n)/nprocs;
+          long iend = (ntotal*(n+1))/nprocs;
+          for (i=istart; i<iend; i++) {
+            data[i]->pack(chunks[current]);
+            data[i].reset();
+            if (chunks[current].size() >= chunkSize || i == iend-1) {
+              MPI_Isend(&chunks[current][0],
+                  static_cast<int>(chunks[current].size()),MPI_BYTE,n,tag,
+                  comm,&requests[current]);
+              current = (current+1)%nchunks;
+              MPI_Status status;
+              MPI_Wait(&requests[current],&status);
+              chunks[current].clear();
+            }
+          }
+        }
+        std::vector<MPI_Status> status(nchunks);
+        MPI_Waitall(nchunks,&requests[0],&status[0]);
+        data.resize(ntotal/nprocs);
+      } else {
+        long nrecv = (ntotal*(me+1))/nprocs - (ntotal*me)/nprocs;
+        data.clear();
+        data.reserve(nrecv);
+        std::vector<char> buf;
+        while (static_cast<long>(data.size()) < nrecv) {
+          MPI_Status status;
+          MPI_Probe(0,tag,comm,&status);
+          int len;
+          MPI_Get_count(&status,MPI_BYTE,&len);
+          buf.resize(len);
+          MPI_Recv(&buf[0],len,MPI_BYTE,0,tag,comm,&status);
+          size_t pos = 0;
+          while (pos < static_cast<size_t>(len)) {
+            boost::shared_ptr<component::DataCollection>
+              collection(new component::DataCollection);
+            size_t nbytes = collection->unpack(&buf[pos],len-pos);
+            if (nbytes == 0) {
+              char ebuf[256];
+              sprintf(ebuf,"p[%d] BaseParser::distributeData: corrupted"
+                  " message\n",me);
+              printf("%s",ebuf);
+              throw gridpack::Exception(ebuf);
+            }
+            pos += nbytes;
+            data.push_back(collection);
+          }
+        }
+      }
+    }
+
   protected:
 
     /* ************************************************************************
@@ -173,6 +302,8 @@ class BaseParser
     double                   p_case_sbase;
     gridpack::utility::CoarseTimer *p_timer;
     bool                     p_configExists;
+    bool                     p_distribute;
+    size_t                   p_maxBuffer;
     /**
      * Data collection object associated with network as a whole
      */
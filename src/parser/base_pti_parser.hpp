@@ -32,6 +32,7 @@
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/parser/base_parser.hpp"
 #include "gridpack/parser/hash_distr.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 #include "gridpack/factory/base_factory.hpp"
 #include "parser_classes/gencls.hpp"
 #include "parser_classes/gensal.hpp"
@@ -1250,6 +1251,7 @@ class BasePTIParser : public BaseParser<_network>
     void find_ds_par()
     {
       std::string          line;
+      RecordTokenizer      split_line;
       gridpack::component::DataCollection *data;
       while(p_input_stream.nextLine(line)) {
         // Check to see if line is blank
@@ -1263,22 +1265,18 @@ class BasePTIParser : public BaseParser<_network>
           idx = line.find('/');
           record.append(line);
         }
-        idx = record.find('/');
-        if (idx != std::string::npos) record.erase(idx,record.length()-idx);
-        std::vector<std::string>  split_line;
-        boost::split(split_line, record, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(record,true);
 
         std::string sval;
         // MODEL TYPE              "MODEL"                  string
         gridpack::utility::StringUtils util;
-        sval = util.trimQuotes(split_line[1]);
+        sval = split_line[1].unquoted();
         util.toUpper(sval);
 
         if (onGenerator(sval)) {
           // GENERATOR_BUSNUMBER               "I"                   integer
           int l_idx, o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
 #else
@@ -1300,7 +1298,7 @@ class BasePTIParser : public BaseParser<_network>
           int g_id = -1;
           if (ngen > 0) {
             // Clean up 2 character tag for generator ID
-            std::string tag = util.clean2Char(split_line[2]);
+            std::string tag = split_line[2].tag();
             int i;
             for (i=0; i<ngen; i++) {
               std::string t_id;
@@ -1358,9 +1356,9 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onBus(sval)) {
           int l_idx, o_idx;
           if (sval == "LVSHBL") {
-            o_idx = atoi(split_line[0].c_str());
+            o_idx = split_line[0].toInt();
           } else if (sval == "FRQTPAT") {
-            o_idx = atoi(split_line[3].c_str());
+            o_idx = split_line[3].toInt();
           }
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
@@ -1385,7 +1383,7 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onLoad(sval)) {
           // Load bus number
           int l_idx, o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
 #else
@@ -1407,7 +1405,7 @@ class BasePTIParser : public BaseParser<_network>
           int l_id = -1;
           if (nload > 0) {
             // Clean up 2 character tag for load ID
-            std::string tag = util.clean2Char(split_line[2]);
+            std::string tag = split_line[2].tag();
             int i;
             for (i=0; i<nload; i++) {
               std::string t_id;
@@ -1426,7 +1424,7 @@ class BasePTIParser : public BaseParser<_network>
             parser.parse(split_line, data, l_id);
           } else if (sval == "USRLOD") {
             std::string sdev;
-            sdev = util.trimQuotes(split_line[3]);
+            sdev = split_line[3].unquoted();
             if (sdev == "ACMTBLU1") {
               Acmtblu1Parser<load_params> parser;
               parser.parse(split_line, data, l_id);
@@ -1437,8 +1435,8 @@ class BasePTIParser : public BaseParser<_network>
           }
         } else if (onBranch(sval)) {
           int l_idx, from_idx, to_idx;
-          from_idx = atoi(split_line[0].c_str());
-          to_idx = atoi(split_line[2].c_str());
+          from_idx = split_line[0].toInt();
+          to_idx = split_line[2].toInt();
           std::map<std::pair<int, int>, int>::iterator it;
           it = p_branchMap->find(std::pair<int,int>(from_idx,to_idx));
           if (it != p_branchMap->end()) {
@@ -1461,6 +1459,7 @@ class BasePTIParser : public BaseParser<_network>
         std::vector<load_params> *load_vector)
     {
       std::string          line;
+      RecordTokenizer      split_line;
       gen_vector->clear();
       while(p_input_stream.nextLine(line)) {
         // Check to see if line is blank
@@ -1474,14 +1473,10 @@ class BasePTIParser : public BaseParser<_network>
           idx = line.find('/');
           record.append(line);
         }
-        idx = record.find('/');
-        if (idx != std::string::npos) record.erase(idx,record.length()-idx);
-        std::vector<std::string>  split_line;
-        boost::split(split_line, record, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(record,true);
         std::string sval;
         gridpack::utility::StringUtils util;
-        sval = util.trimQuotes(split_line[1]);
+        sval = split_line[1].unquoted();
         util.toUpper(sval);
 
         if (onGenerator(sval)) {
@@ -1489,11 +1484,11 @@ class BasePTIParser : public BaseParser<_network>
 
           // GENERATOR_BUSNUMBER               "I"                   integer
           int o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
           data.bus_id = o_idx;
 
           // Clean up 2 character tag for generator ID
-          std::string tag = util.clean2Char(split_line[2]);
+          std::string tag = split_line[2].tag();
           strcpy(data.gen_id, tag.c_str());
 
           double rval;
@@ -1547,14 +1542,14 @@ class BasePTIParser : public BaseParser<_network>
           int o_idx;
           if (sval == "LVSHBL") {
             bus_relay_params data;
-            o_idx = atoi(split_line[0].c_str());
+            o_idx = split_line[0].toInt();
             data.bus_id = o_idx;
             LvshblParser<bus_relay_params> parser;
             parser.store(split_line,data);
             bus_relay_vector->push_back(data);
           } else if (sval == "FRQTPAT") {
             bus_relay_params data;
-            o_idx = atoi(split_line[3].c_str());
+            o_idx = split_line[3].toInt();
             data.bus_id = o_idx;
             FrqtpatParser<bus_relay_params> parser;
             parser.store(split_line,data);
@@ -1563,11 +1558,11 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onLoad(sval)) {
           // ID of bus that owns load
           load_params data;
-          int o_idx = atoi(split_line[0].c_str());
+          int o_idx = split_line[0].toInt();
           data.bus_id = o_idx;
 
           // Clean up 2 character tag for load ID
-          std::string tag = util.clean2Char(split_line[2]);
+          std::string tag = split_line[2].tag();
           strcpy(data.id, tag.c_str());
           if (sval == "CIM6BL") {
             Cim6blParser<load_params> parser;
@@ -1577,7 +1572,7 @@ class BasePTIParser : public BaseParser<_network>
             parser.store(split_line,data);
           } else if (sval == "USRLOD") {
             std::string sdev;
-            sdev = util.trimQuotes(split_line[3]);
+            sdev = split_line[3].unquoted();
             if (sdev == "ACMTBLU1") {
               Acmtblu1Parser<load_params> parser;
               parser.store(split_line,data);
@@ -1592,8 +1587,8 @@ class BasePTIParser : public BaseParser<_network>
 
           int from_idx, to_idx;
           if (sval == "DISTR1") {
-            from_idx = atoi(split_line[0].c_str());
-            to_idx = atoi(split_line[3].c_str());
+            from_idx = split_line[0].toInt();
+            to_idx = split_line[3].toInt();
             data.from_bus = from_idx;
             data.to_bus = to_idx;
             Distr1Parser<branch_relay_params> parser;
@@ -1607,72 +1602,70 @@ class BasePTIParser : public BaseParser<_network>
     void find_uc_vector(std::vector<uc_params> *uc_vector)
     {
       std::string          line;
+      RecordTokenizer      split_line;
       uc_vector->clear();
       // Ignore first line containing header information
       p_input_stream.nextLine(line);
       while(p_input_stream.nextLine(line)) {
-        std::vector<std::string>  split_line;
-        boost::split(split_line, line, boost::algorithm::is_any_of(","),
-            boost::token_compress_on);
+        split_line.tokenize(line,true,false);
 
         uc_params data;
 
         int nstr = split_line.size();
         if (nstr > 1) {
-          data.type = atoi(split_line[1].c_str());
+          data.type = split_line[1].toInt();
         }
         if (nstr > 2) {
-          data.init_level = atof(split_line[2].c_str());
+          data.init_level = split_line[2].toDouble();
         }
         if (nstr > 3) {
-          data.min_gen = atof(split_line[3].c_str());
+          data.min_gen = split_line[3].toDouble();
         }
         if (nstr > 4) {
-          data.max_gen = atof(split_line[4].c_str());
+          data.max_gen = split_line[4].toDouble();
         }
         if (nstr > 5) {
-          data.max_oper = atof(split_line[5].c_str());
+          data.max_oper = split_line[5].toDouble();
         }
         if (nstr > 6) {
-          data.min_up = atof(split_line[6].c_str());
+          data.min_up = split_line[6].toDouble();
         }
         if (nstr > 7) {
-          data.min_down = atof(split_line[7].c_str());
+          data.min_down = split_line[7].toDouble();
         }
         if (nstr > 8) {
-          data.ramp_up = atof(split_line[8].c_str());
+          data.ramp_up = split_line[8].toDouble();
         }
         if (nstr > 9) {
-          data.ramp_down = atof(split_line[9].c_str());
+          data.ramp_down = split_line[9].toDouble();
         }
         if (nstr > 10) {
-          data.start_up = atof(split_line[10].c_str());
+          data.start_up = split_line[10].toDouble();
         }
         if (nstr > 11) {
-          data.const_cost = atof(split_line[11].c_str());
+          data.const_cost = split_line[11].toDouble();
         }
         if (nstr > 12) {
-          data.lin_cost = atof(split_line[12].c_str());
+          data.lin_cost = split_line[12].toDouble();
         }
         if (nstr > 13) {
-          data.co_2_cost = atof(split_line[13].c_str());
+          data.co_2_cost = split_line[13].toDouble();
         }
         if (nstr > 14) {
-          data.init_prd = atof(split_line[14].c_str());
+          data.init_prd = split_line[14].toDouble();
         }
         if (nstr > 15) {
-          data.start_cap = atof(split_line[15].c_str());
+          data.start_cap = split_line[15].toDouble();
         }
         if (nstr > 16) {
-          data.shut_cap = atof(split_line[16].c_str());
+          data.shut_cap = split_line[16].toDouble();
         }
         if (nstr > 17) {
-          data.bus_id = atoi(split_line[17].c_str());
+          data.bus_id = split_line[17].toInt();
         }
         if (nstr > 18) {
           // Clean up 2 character tag for generator ID
-          gridpack::utility::StringUtils util;
-          std::string tag = util.clean2Char(split_line[18]);
+          std::string tag = split_line[18].tag();
           strcpy(data.gen_id, tag.c_str());
         }
         uc_vector->push_back(data);
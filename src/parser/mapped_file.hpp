@@ -0,0 +1,281 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   mapped_file.hpp
+ *
+ * @brief
+ * This is a utility that allows all processors to read a text file at the
+ * same time. Each processor maps the whole file into memory and is assigned
+ * the lines that start in an equal sized part of the file. Groups of lines
+ * (records) can be sent to the processors that need them with a single
+ * all-to-all exchange.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _mapped_file_hpp_
+#define _mapped_file_hpp_
+
+#include <mpi.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "gridpack/parallel/communicator.hpp"
+
+namespace gridpack {
+namespace parser {
+
+// A group of consecutive lines from a mapped file, labeled by the section of
+// the file it came from and its position in the file
+struct MappedRecord {
+  int section;
+  long offset;
+  int aux1;
+  int aux2;
+  std::string text;
+
+  bool operator<(const MappedRecord &rec) const
+  {
+    if (section != rec.section) return section < rec.section;
+    return offset < rec.offset;
+  }
+};
+
+// -------------------------------------------------------------
+//  class MappedFile
+// -------------------------------------------------------------
+class MappedFile {
+private:
+  // Header of a packed record
+  typedef struct {
+    int section;
+    int aux1;
+    int aux2;
+    int len;
+    long long offset;
+  } record_header;
+
+public:
+  /**
+   * Constructor. Map file into memory and find the lines that start in this
+   * processor's part of the file. This is not collective, but isOpen should
+   * be checked on all processors before the file is used
+   * @param comm communicator on which file is read
+   * @param filename name of file
+   */
+  MappedFile(const parallel::Communicator &comm, const std::string &filename)
+    : p_comm(comm), p_data(NULL), p_size(0)
+  {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    if (fstat(fd,&st) == 0 && st.st_size > 0) {
+      void *ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr != MAP_FAILED) {
+        p_data = static_cast<const char*>(ptr);
+        p_size = static_cast<long>(st.st_size);
+      }
+    }
+    ::close(fd);
+    if (p_data == NULL) return;
+
+    // Find all lines that start in this processor's part of the file
+    long me = static_cast<long>(comm.rank());
+    long nprocs = static_cast<long>(comm.size());
+    long lo = (p_size/nprocs)*me + std::min(me, p_size%nprocs);
+    long hi = (p_size/nprocs)*(me+1) + std::min(me+1, p_size%nprocs);
+    long pos = lo;
+    if (pos > 0 && p_data[pos-1] != '\n') pos = nextLine(pos);
+    while (pos < hi) {
+      p_lines.push_back(pos);
+      pos = nextLine(pos);
+    }
+    p_send.resize(comm.size());
+  }
+
+  /**
+   * Destructor
+   */
+  ~MappedFile(void)
+  {
+    if (p_data != NULL) {
+      munmap(const_cast<char*>(p_data), p_size);
+    }
+  }
+
+  /**
+   * @return true if file was mapped successfully
+   */
+  bool isOpen(void) const
+  {
+    return (p_data != NULL);
+  }
+
+  /**
+   * @return size of file in bytes
+   */
+  long size(void) const
+  {
+    return p_size;
+  }
+
+  /**
+   * @return offsets of lines that start in this processor's part of file
+   */
+  const std::vector<long>& lines(void) const
+  {
+    return p_lines;
+  }
+
+  /**
+   * Find the start of the line following position pos
+   * @param pos position in file
+   * @return offset of next line or size of file if there are no more lines
+   */
+  long nextLine(long pos) const
+  {
+    if (pos >= p_size) return p_size;
+    const char *ptr = static_cast<const char*>(memchr(p_data+pos,'\n',
+          p_size-pos));
+    if (ptr == NULL) return p_size;
+    return static_cast<long>(ptr-p_data)+1;
+  }
+
+  /**
+   * Return the line starting at pos without the end of line character
+   * @param pos offset of line
+   * @return contents of line
+   */
+  std::string getLine(long pos) const
+  {
+    if (pos >= p_size) return std::string();
+    long end = nextLine(pos);
+    if (end > pos && p_data[end-1] == '\n') end--;
+    return std::string(p_data+pos, end-pos);
+  }
+
+  /**
+   * Return a block of lines
+   * @param pos offset of first line
+   * @param nlines number of lines
+   * @param next offset of line following the block
+   * @return contents of lines, separated by end of line characters
+   */
+  std::string getLines(long pos, int nlines, long *next) const
+  {
+    long end = pos;
+    int i;
+    for (i=0; i<nlines; i++) end = nextLine(end);
+    *next = end;
+    if (end > pos && p_data[end-1] == '\n') end--;
+    return std::string(p_data+pos, end-pos);
+  }
+
+  /**
+   * Add a record that will be sent to another processor in the next call
+   * to exchange
+   * @param proc processor that receives record
+   * @param section section of file containing record
+   * @param offset offset of record in file
+   * @param aux1 auxiliary value that is sent with record
+   * @param aux2 auxiliary value that is sent with record
+   * @param text contents of record
+   */
+  void addRecord(int proc, int section, long offset, int aux1, int aux2,
+      const std::string &text)
+  {
+    record_header header;
+    header.section = section;
+    header.aux1 = aux1;
+    header.aux2 = aux2;
+    header.len = static_cast<int>(text.size());
+    header.offset = static_cast<long long>(offset);
+    std::vector<char> &buf = p_send[proc];
+    size_t start = buf.size();
+    buf.resize(start+sizeof(record_header)+text.size());
+    memcpy(&buf[start],&header,sizeof(record_header));
+    if (text.size() > 0) {
+      memcpy(&buf[start+sizeof(record_header)],text.data(),text.size());
+    }
+  }
+
+  /**
+   * Send all records to the processors that were specified in addRecord
+   * and return the records that were sent to this processor, ordered by
+   * section and position in file. This is collective
+   * @param records records received by this processor
+   */
+  void exchange(std::vector<MappedRecord> &records)
+  {
+    MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+    int nprocs = p_comm.size();
+    std::vector<int> scount(nprocs), rcount(nprocs);
+    std::vector<int> sdispl(nprocs), rdispl(nprocs);
+    int i;
+    for (i=0; i<nprocs; i++) {
+      scount[i] = static_cast<int>(p_send[i].size());
+    }
+    MPI_Alltoall(&scount[0],1,MPI_INT,&rcount[0],1,MPI_INT,comm);
+    int stotal = 0;
+    int rtotal = 0;
+    for (i=0; i<nprocs; i++) {
+      sdispl[i] = stotal;
+      rdispl[i] = rtotal;
+      stotal += scount[i];
+      rtotal += rcount[i];
+    }
+    std::vector<char> sbuf(stotal+1);
+    std::vector<char> rbuf(rtotal+1);
+    for (i=0; i<nprocs; i++) {
+      if (scount[i] > 0) memcpy(&sbuf[sdispl[i]],&p_send[i][0],scount[i]);
+      p_send[i].clear();
+    }
+    MPI_Alltoallv(&sbuf[0],&scount[0],&sdispl[0],MPI_BYTE,
+        &rbuf[0],&rcount[0],&rdispl[0],MPI_BYTE,comm);
+    sbuf.clear();
+
+    records.clear();
+    size_t pos = 0;
+    while (pos < static_cast<size_t>(rtotal)) {
+      record_header header;
+      memcpy(&header,&rbuf[pos],sizeof(record_header));
+      pos += sizeof(record_header);
+      MappedRecord rec;
+      rec.section = header.section;
+      rec.offset = static_cast<long>(header.offset);
+      rec.aux1 = header.aux1;
+      rec.aux2 = header.aux2;
+      rec.text.assign(&rbuf[pos],header.len);
+      pos += header.len;
+      records.push_back(rec);
+    }
+    std::sort(records.begin(),records.end());
+  }
+
+private:
+  // Not copyable since the mapped file is released in the destructor
+  MappedFile(const MappedFile&);
+  MappedFile& operator=(const MappedFile&);
+
+  parallel::Communicator p_comm;
+  const char *p_data;
+  long p_size;
+  std::vector<long> p_lines;
+  std::vector<std::vector<char> > p_send;
+};
+
+} // namespace parser
+} // namespace gridpack
+
+#endif
@@ -0,0 +1,509 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   network_snapshot.hpp
+ *
+ * @brief
+ * Binary snapshot of the data collections of a network. A snapshot is
+ * written once from a network that has been created by one of the parsers
+ * and can then be loaded on all processors in place of the original network
+ * files. The file contains a header, the network data collection, a table
+ * of buses and a table of branches ordered by global index, and the packed
+ * data collections of the buses and branches. Each table entry holds the
+ * position and size of the data collection and the processor that owned the
+ * bus or branch when the snapshot was written. The header records the name,
+ * size and modification time of the network file the snapshot was created
+ * from, so that a snapshot that is out of date can be detected with
+ * isCurrent.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _network_snapshot_hpp_
+#define _network_snapshot_hpp_
+
+#include <mpi.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "gridpack/parser/base_parser.hpp"
+#include "gridpack/parser/dictionary.hpp"
+#include "gridpack/utilities/exception.hpp"
+
+#define SNAPSHOT_MAGIC 0x534E5047
+#define SNAPSHOT_ENDIAN 0x01020304
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_SOURCE_LEN 256
+#define SNAPSHOT_PARTITION 1
+
+namespace gridpack {
+namespace parser {
+
+template <class _network>
+class NetworkSnapshot : public BaseParser<_network>
+{
+  private:
+    // Header at start of file
+    typedef struct {
+      int magic;
+      int endian;
+      int version;
+      int flags;
+      int nprocs;
+      int nbus;
+      int nbranch;
+      int unused;
+      long long networkOffset;
+      long long networkLength;
+      long long busTable;
+      long long branchTable;
+      long long sourceSize;
+      long long sourceTime;
+      char source[SNAPSHOT_SOURCE_LEN];
+    } snapshot_header;
+
+    // Entry in bus or branch table
+    typedef struct {
+      long long offset;
+      int length;
+      int owner;
+    } snapshot_entry;
+
+  public:
+    /**
+     * Constructor
+     * @param network network that snapshot is written from or loaded into
+     */
+    explicit NetworkSnapshot(boost::shared_ptr<_network> network)
+    {
+      this->setNetwork(network);
+    }
+
+    /**
+     * Destructor
+     */
+    virtual ~NetworkSnapshot()
+    {
+    }
+
+    /**
+     * Check to see if a file is a snapshot that can be loaded on this
+     * machine. This is not collective
+     * @param fileName name of file
+     * @return true if file has the header of a snapshot
+     */
+    static bool isSnapshot(const std::string &fileName)
+    {
+      snapshot_header header;
+      FILE *fp = fopen(fileName.c_str(),"rb");
+      if (fp == NULL) return false;
+      size_t nread = fread(&header,sizeof(snapshot_header),1,fp);
+      fclose(fp);
+      return (nread == 1 && header.magic == SNAPSHOT_MAGIC &&
+          header.endian == SNAPSHOT_ENDIAN &&
+          header.version == SNAPSHOT_VERSION);
+    }
+
+    /**
+     * Check to see if a file is a snapshot that is up to date. The snapshot
+     * must have been written from the same network file, the network file
+     * must have the same size and modification time as when the snapshot
+     * was written, and the snapshot must have been written on the same
+     * number of processors. This is not collective
+     * @param fileName name of snapshot file
+     * @param sourceFile name of network file
+     * @param nprocs number of processors the snapshot is loaded on
+     * @return true if snapshot can be loaded in place of network file
+     */
+    static bool isCurrent(const std::string &fileName,
+        const std::string &sourceFile, int nprocs)
+    {
+      if (!isSnapshot(fileName)) return false;
+      snapshot_header header;
+      FILE *fp = fopen(fileName.c_str(),"rb");
+      if (fp == NULL) return false;
+      size_t nread = fread(&header,sizeof(snapshot_header),1,fp);
+      fclose(fp);
+      if (nread != 1) return false;
+      long long size, mtime;
+      if (!sourceStat(sourceFile,&size,&mtime)) return false;
+      header.source[SNAPSHOT_SOURCE_LEN-1] = '\0';
+      return (header.nprocs == nprocs && header.sourceSize == size &&
+          header.sourceTime == mtime &&
+          strncmp(header.source,sourceFile.c_str(),
+            SNAPSHOT_SOURCE_LEN-1) == 0);
+    }
+
+    /**
+     * Write a snapshot of the network. Only active buses and branches are
+     * written, so the snapshot can be written before or after the network is
+     * partitioned. This is collective
+     * @param fileName name of snapshot file
+     * @param partition store the processor that owns each bus and branch.
+     * The buses and branches are loaded on the same processors if the
+     * snapshot is loaded on the same number of processors
+     * @param sourceFile name of network file that the network was created
+     * from. It is recorded in the snapshot so that isCurrent can check that
+     * the snapshot is up to date
+     */
+    void write(const std::string &fileName, bool partition = false,
+        const std::string &sourceFile = "")
+    {
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_write = timer->createCategory("Snapshot:write");
+      timer->start(t_write);
+      MPI_Comm comm =
+        static_cast<MPI_Comm>(this->p_network->communicator());
+      int me(this->p_network->communicator().rank());
+      int nprocs(this->p_network->communicator().size());
+      int i;
+
+      // Pack data collections of active buses and branches
+      std::vector<char> data;
+      std::vector<std::pair<int,snapshot_entry> > buses;
+      std::vector<std::pair<int,snapshot_entry> > branches;
+      int nbus = this->p_network->numBuses();
+      for (i=0; i<nbus; i++) {
+        if (!this->p_network->getActiveBus(i)) continue;
+        snapshot_entry entry;
+        entry.offset = static_cast<long long>(data.size());
+        this->p_network->getBusData(i)->pack(data);
+        entry.length = static_cast<int>(data.size()-entry.offset);
+        entry.owner = me;
+        buses.push_back(std::pair<int,snapshot_entry>(
+              this->p_network->getGlobalBusIndex(i),entry));
+      }
+      int nbranch = this->p_network->numBranches();
+      for (i=0; i<nbranch; i++) {
+        if (!this->p_network->getActiveBranch(i)) continue;
+        snapshot_entry entry;
+        entry.offset = static_cast<long long>(data.size());
+        this->p_network->getBranchData(i)->pack(data);
+        entry.length = static_cast<int>(data.size()-entry.offset);
+        entry.owner = me;
+        branches.push_back(std::pair<int,snapshot_entry>(
+              this->p_network->getGlobalBranchIndex(i),entry));
+      }
+      std::vector<char> network;
+      this->p_network->getNetworkData()->pack(network);
+
+      // Find position of data on this processor in file
+      int counts[2], totals[2];
+      counts[0] = buses.size();
+      counts[1] = branches.size();
+      MPI_Allreduce(counts,totals,2,MPI_INT,MPI_SUM,comm);
+      long long size = static_cast<long long>(data.size());
+      long long offset = 0;
+      MPI_Exscan(&size,&offset,1,MPI_LONG_LONG,MPI_SUM,comm);
+      if (me == 0) offset = 0;
+      snapshot_header header;
+      memset(&header,0,sizeof(snapshot_header));
+      header.magic = SNAPSHOT_MAGIC;
+      header.endian = SNAPSHOT_ENDIAN;
+      header.version = SNAPSHOT_VERSION;
+      header.flags = partition ? SNAPSHOT_PARTITION : 0;
+      header.nprocs = nprocs;
+      header.nbus = totals[0];
+      header.nbranch = totals[1];
+      if (me == 0 && sourceFile.size() > 0 &&
+          sourceStat(sourceFile,&header.sourceSize,&header.sourceTime)) {
+        strncpy(header.source,sourceFile.c_str(),SNAPSHOT_SOURCE_LEN-1);
+      }
+      header.networkOffset = sizeof(snapshot_header);
+      header.networkLength = network.size();
+      MPI_Bcast(&header.networkLength,1,MPI_LONG_LONG,0,comm);
+      header.busTable = header.networkOffset+header.networkLength;
+      header.branchTable = header.busTable
+        + static_cast<long long>(header.nbus)*sizeof(snapshot_entry);
+      long long dataStart = header.branchTable
+        + static_cast<long long>(header.nbranch)*sizeof(snapshot_entry);
+      offset += dataStart;
+      for (i=0; i<buses.size(); i++) {
+        buses[i].second.offset += offset;
+        checkIndex(buses[i].first,header.nbus,"bus");
+      }
+      for (i=0; i<branches.size(); i++) {
+        branches[i].second.offset += offset;
+        checkIndex(branches[i].first,header.nbranch,"branch");
+      }
+
+      MPI_File fh;
+      int ierr = MPI_File_open(comm,const_cast<char*>(fileName.c_str()),
+          MPI_MODE_CREATE|MPI_MODE_WRONLY,MPI_INFO_NULL,&fh);
+      if (ierr != MPI_SUCCESS) {
+        char buf[256];
+        sprintf(buf,"NetworkSnapshot::write: unable to open file %s\n",
+            fileName.c_str());
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      MPI_File_set_size(fh,0);
+      MPI_Status status;
+      if (me == 0) {
+        MPI_File_write_at(fh,0,&header,sizeof(snapshot_header),MPI_BYTE,
+            &status);
+        if (network.size() > 0) {
+          MPI_File_write_at(fh,header.networkOffset,&network[0],
+              network.size(),MPI_BYTE,&status);
+        }
+      }
+      writeTable(fh,header.busTable,buses);
+      writeTable(fh,header.branchTable,branches);
+      char dummy;
+      MPI_File_write_at_all(fh,static_cast<MPI_Offset>(offset),
+          (data.size() > 0 ? &data[0] : &dummy),static_cast<int>(data.size()),
+          MPI_BYTE,&status);
+      MPI_File_close(&fh);
+      timer->stop(t_write);
+    }
+
+    /**
+     * Load network from a snapshot. The file is mapped into memory on all
+     * processors and each processor unpacks its own buses and branches. If
+     * the snapshot contains the processor that owned each bus and branch and
+     * it is loaded on the same number of processors, each processor gets
+     * the buses and branches that it owned when the snapshot was written.
+     * Otherwise the buses and branches are divided evenly between
+     * processors. In both cases the network must still be partitioned. This
+     * is collective
+     * @param fileName name of snapshot file
+     */
+    void parse(const std::string &fileName)
+    {
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_load = timer->createCategory("Snapshot:load");
+      timer->start(t_load);
+      int me(this->p_network->communicator().rank());
+      int nprocs(this->p_network->communicator().size());
+      int i;
+
+      const char *file = NULL;
+      size_t fsize = 0;
+      int fd = ::open(fileName.c_str(),O_RDONLY);
+      if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd,&st) == 0 && st.st_size >= sizeof(snapshot_header)) {
+          void *ptr = mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+          if (ptr != MAP_FAILED) {
+            file = static_cast<const char*>(ptr);
+            fsize = st.st_size;
+          }
+        }
+        ::close(fd);
+      }
+      if (file == NULL) {
+        char buf[256];
+        sprintf(buf,"p[%d] NetworkSnapshot::parse: unable to map file %s\n",
+            me,fileName.c_str());
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      snapshot_header header;
+      memcpy(&header,file,sizeof(snapshot_header));
+      const char *err = NULL;
+      if (header.magic != SNAPSHOT_MAGIC) {
+        err = "is not a network snapshot";
+      } else if (header.endian != SNAPSHOT_ENDIAN) {
+        err = "was written on a machine with a different byte order";
+      } else if (header.version != SNAPSHOT_VERSION) {
+        err = "was written by a different version of GridPACK";
+      } else if (header.branchTable +
+          static_cast<long long>(header.nbranch)*sizeof(snapshot_entry)
+          > static_cast<long long>(fsize)) {
+        err = "is truncated";
+      }
+      if (err != NULL) {
+        munmap(const_cast<char*>(file),fsize);
+        char buf[256];
+        sprintf(buf,"NetworkSnapshot::parse: file %s %s\n",fileName.c_str(),
+            err);
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+
+      // Network data is loaded on all processors
+      this->p_network->getNetworkData()->unpack(file+header.networkOffset,
+          header.networkLength);
+      int case_id = 0;
+      double case_sbase = 0.0;
+      this->p_network->getNetworkData()->getValue(CASE_ID,&case_id);
+      this->p_network->getNetworkData()->getValue(CASE_SBASE,&case_sbase);
+      this->setCaseID(case_id);
+      this->setCaseSBase(case_sbase);
+
+      bool owners = ((header.flags & SNAPSHOT_PARTITION) != 0 &&
+          header.nprocs == nprocs);
+      std::vector<boost::shared_ptr<component::DataCollection> > busData;
+      std::vector<boost::shared_ptr<component::DataCollection> > branchData;
+      std::vector<int> busIndex;
+      std::vector<int> branchIndex;
+      bool ok = loadTable(file,fsize,header.busTable,header.nbus,owners,
+          busData,busIndex);
+      if (ok) ok = loadTable(file,fsize,header.branchTable,header.nbranch,
+          owners,branchData,branchIndex);
+      munmap(const_cast<char*>(file),fsize);
+      if (!ok) {
+        char buf[256];
+        sprintf(buf,"p[%d] NetworkSnapshot::parse: file %s is corrupted\n",
+            me,fileName.c_str());
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      timer->stop(t_load);
+      this->createNetwork(busData,branchData,busIndex,branchIndex);
+    }
+
+  private:
+
+    /**
+     * Get size and modification time of a file
+     * @param fileName name of file
+     * @param size size of file in bytes
+     * @param mtime modification time of file
+     * @return false if file could not be found
+     */
+    static bool sourceStat(const std::string &fileName, long long *size,
+        long long *mtime)
+    {
+      struct stat st;
+      if (fileName.size() == 0 || stat(fileName.c_str(),&st) != 0) {
+        return false;
+      }
+      *size = static_cast<long long>(st.st_size);
+      *mtime = static_cast<long long>(st.st_mtime);
+      return true;
+    }
+
+    /**
+     * Check that global index is within range
+     * @param idx global index
+     * @param nval number of buses or branches
+     * @param type type of object
+     */
+    void checkIndex(int idx, int nval, const char *type)
+    {
+      if (idx < 0 || idx >= nval) {
+        char buf[256];
+        sprintf(buf,"NetworkSnapshot::write: global %s index %d is out of"
+            " range [0,%d)\n",type,idx,nval);
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+    }
+
+    /**
+     * Write entries of a bus or branch table. Each processor writes the
+     * entries of the buses or branches it owns at the position given by
+     * their global index. This is collective
+     * @param fh MPI file handle
+     * @param start offset of table in file
+     * @param entries global indices and table entries on this processor
+     */
+    void writeTable(MPI_File fh, long long start,
+        std::vector<std::pair<int,snapshot_entry> > &entries)
+    {
+      std::sort(entries.begin(),entries.end(),compareEntries);
+      int nentries = entries.size();
+      int esize = sizeof(snapshot_entry);
+      std::vector<char> buf(nentries*esize+1);
+      std::vector<int> blocks;
+      std::vector<MPI_Aint> displ;
+      int i;
+      for (i=0; i<nentries; i++) {
+        memcpy(&buf[i*esize],&entries[i].second,esize);
+        // Combine entries with consecutive global indices into one block
+        if (i > 0 && entries[i].first == entries[i-1].first+1) {
+          blocks.back() += esize;
+        } else {
+          blocks.push_back(esize);
+          displ.push_back(static_cast<MPI_Aint>(start)
+              + static_cast<MPI_Aint>(entries[i].first)*esize);
+        }
+      }
+      MPI_Datatype ftype;
+      MPI_Type_create_hindexed(blocks.size(),
+          (blocks.size() > 0 ? &blocks[0] : NULL),
+          (displ.size() > 0 ? &displ[0] : NULL),MPI_BYTE,&ftype);
+      MPI_Type_commit(&ftype);
+      char native[] = "native";
+      MPI_File_set_view(fh,0,MPI_BYTE,ftype,native,MPI_INFO_NULL);
+      MPI_Status status;
+      MPI_File_write_all(fh,&buf[0],nentries*esize,MPI_BYTE,&status);
+      MPI_File_set_view(fh,0,MPI_BYTE,MPI_BYTE,native,MPI_INFO_NULL);
+      MPI_Type_free(&ftype);
+    }
+
+    /**
+     * Order table entries by global index
+     */
+    static bool compareEntries(const std::pair<int,snapshot_entry> &a,
+        const std::pair<int,snapshot_entry> &b)
+    {
+      return a.first < b.first;
+    }
+
+    /**
+     * Unpack the data collections of the buses or branches that are loaded
+     * on this processor
+     * @param file start of mapped file
+     * @param fsize size of file
+     * @param start offset of table in file
+     * @param nval number of entries in table
+     * @param owners use processor stored in table instead of dividing entries
+     * evenly
+     * @param data data collections on this processor
+     * @param index global indices of data collections
+     * @return false if an entry could not be unpacked
+     */
+    bool loadTable(const char *file, size_t fsize, long long start, int nval,
+        bool owners, std::vector<boost::shared_ptr<component::DataCollection> >
+        &data, std::vector<int> &index)
+    {
+      int me(this->p_network->communicator().rank());
+      int nprocs(this->p_network->communicator().size());
+      int lo = 0;
+      int hi = nval;
+      if (!owners) {
+        lo = (nval/nprocs)*me + std::min(me,nval%nprocs);
+        hi = (nval/nprocs)*(me+1) + std::min(me+1,nval%nprocs);
+      }
+      int i;
+      for (i=lo; i<hi; i++) {
+        snapshot_entry entry;
+        memcpy(&entry,file+start+static_cast<long long>(i)
+            *sizeof(snapshot_entry),sizeof(snapshot_entry));
+        if (owners && entry.owner != me) continue;
+        if (entry.offset < 0 || entry.length < 0 ||
+            entry.offset+entry.length > static_cast<long long>(fsize)) {
+          return false;
+        }
+        boost::shared_ptr<component::DataCollection>
+          collection(new component::DataCollection);
+        if (collection->unpack(file+entry.offset,entry.length) == 0) {
+          return false;
+        }
+        data.push_back(collection);
+        index.push_back(i);
+      }
+      return true;
+    }
+};
+
+} /* namespace parser */
+} /* namespace gridpack */
+
+#endif /* _network_snapshot_hpp_ */
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class Acmtblu1Parser
@@ -304,7 +305,7 @@ template <class _data_struct> class Acmtblu1Parser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int l_id)
     {
       double rval;
@@ -314,7 +315,7 @@ template <class _data_struct> class Acmtblu1Parser
       // LOAD_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[3]);
+      model = split_line[3].unquoted();
       util.toUpper(model);
       if (!data->getValue(LOAD_MODEL,&stmp,l_id)) {
         data->addValue(LOAD_MODEL, model.c_str(), l_id);
@@ -325,315 +326,315 @@ template <class _data_struct> class Acmtblu1Parser
       // LOAD_TSTALL
       if (nstr > 11) {
         if (!data->getValue(LOAD_TSTALL,&rval,l_id)) {
-          data->addValue(LOAD_TSTALL, atof(split_line[11].c_str()), l_id);
+          data->addValue(LOAD_TSTALL, split_line[11].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TSTALL, atof(split_line[11].c_str()), l_id);
+          data->setValue(LOAD_TSTALL, split_line[11].toDouble(), l_id);
         }
       } 
 
       // LOAD_TRESTART
       if (nstr > 12) {
         if (!data->getValue(LOAD_TRESTART,&rval,l_id)) {
-          data->addValue(LOAD_TRESTART, atof(split_line[12].c_str()), l_id);
+          data->addValue(LOAD_TRESTART, split_line[12].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRESTART, atof(split_line[12].c_str()), l_id);
+          data->setValue(LOAD_TRESTART, split_line[12].toDouble(), l_id);
         }
       } 
 
       // LOAD_TV
       if (nstr > 13) {
         if (!data->getValue(LOAD_TV,&rval,l_id)) {
-          data->addValue(LOAD_TV, atof(split_line[13].c_str()), l_id);
+          data->addValue(LOAD_TV, split_line[13].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TV, atof(split_line[13].c_str()), l_id);
+          data->setValue(LOAD_TV, split_line[13].toDouble(), l_id);
         }
       } 
 
       // LOAD_TF
       if (nstr > 14) {
         if (!data->getValue(LOAD_TF,&rval,l_id)) {
-          data->addValue(LOAD_TF, atof(split_line[14].c_str()), l_id);
+          data->addValue(LOAD_TF, split_line[14].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TF, atof(split_line[14].c_str()), l_id);
+          data->setValue(LOAD_TF, split_line[14].toDouble(), l_id);
         }
       } 
 
       // LOAD_COMPLF
       if (nstr > 15) {
         if (!data->getValue(LOAD_COMPLF,&rval,l_id)) {
-          data->addValue(LOAD_COMPLF, atof(split_line[15].c_str()), l_id);
+          data->addValue(LOAD_COMPLF, split_line[15].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_COMPLF, atof(split_line[15].c_str()), l_id);
+          data->setValue(LOAD_COMPLF, split_line[15].toDouble(), l_id);
         }
       } 
 
       // LOAD_COMPPF
       if (nstr > 16) {
         if (!data->getValue(LOAD_COMPPF,&rval,l_id)) {
-          data->addValue(LOAD_COMPPF, atof(split_line[16].c_str()), l_id);
+          data->addValue(LOAD_COMPPF, split_line[16].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_COMPPF, atof(split_line[16].c_str()), l_id);
+          data->setValue(LOAD_COMPPF, split_line[16].toDouble(), l_id);
         }
       } 
 
       // LOAD_VSTALL
       if (nstr > 17) {
         if (!data->getValue(LOAD_VSTALL,&rval,l_id)) {
-          data->addValue(LOAD_VSTALL, atof(split_line[17].c_str()), l_id);
+          data->addValue(LOAD_VSTALL, split_line[17].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VSTALL, atof(split_line[17].c_str()), l_id);
+          data->setValue(LOAD_VSTALL, split_line[17].toDouble(), l_id);
         }
       }
 
       // LOAD_RSTALL
       if (nstr > 18) {
         if (!data->getValue(LOAD_RSTALL,&rval,l_id)) {
-          data->addValue(LOAD_RSTALL, atof(split_line[18].c_str()), l_id);
+          data->addValue(LOAD_RSTALL, split_line[18].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RSTALL, atof(split_line[18].c_str()), l_id);
+          data->setValue(LOAD_RSTALL, split_line[18].toDouble(), l_id);
         }
       }
 
       // LOAD_XSTALL
       if (nstr > 19) {
         if (!data->getValue(LOAD_XSTALL,&rval,l_id)) {
-          data->addValue(LOAD_XSTALL, atof(split_line[19].c_str()), l_id);
+          data->addValue(LOAD_XSTALL, split_line[19].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XSTALL, atof(split_line[19].c_str()), l_id);
+          data->setValue(LOAD_XSTALL, split_line[19].toDouble(), l_id);
         }
       }
 
       // LOAD_LFADJ
       if (nstr > 20) {
         if (!data->getValue(LOAD_LFADJ,&rval,l_id)) {
-          data->addValue(LOAD_LFADJ, atof(split_line[20].c_str()), l_id);
+          data->addValue(LOAD_LFADJ, split_line[20].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFADJ, atof(split_line[20].c_str()), l_id);
+          data->setValue(LOAD_LFADJ, split_line[20].toDouble(), l_id);
         }
       }
 
       // LOAD_KP1
       if (nstr > 21) {
         if (!data->getValue(LOAD_KP1,&rval,l_id)) {
-          data->addValue(LOAD_KP1, atof(split_line[21].c_str()), l_id);
+          data->addValue(LOAD_KP1, split_line[21].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KP1, atof(split_line[21].c_str()), l_id);
+          data->setValue(LOAD_KP1, split_line[21].toDouble(), l_id);
         }
       }
 
       // LOAD_NP1
       if (nstr > 22) {
         if (!data->getValue(LOAD_NP1,&rval,l_id)) {
-          data->addValue(LOAD_NP1, atof(split_line[22].c_str()), l_id);
+          data->addValue(LOAD_NP1, split_line[22].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NP1, atof(split_line[22].c_str()), l_id);
+          data->setValue(LOAD_NP1, split_line[22].toDouble(), l_id);
         }
       }
 
       // LOAD_KQ1
       if (nstr > 23) {
         if (!data->getValue(LOAD_KQ1,&rval,l_id)) {
-          data->addValue(LOAD_KQ1, atof(split_line[23].c_str()), l_id);
+          data->addValue(LOAD_KQ1, split_line[23].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KQ1, atof(split_line[23].c_str()), l_id);
+          data->setValue(LOAD_KQ1, split_line[23].toDouble(), l_id);
         }
       }
 
       // LOAD_NQ1
       if (nstr > 24) {
         if (!data->getValue(LOAD_NQ1,&rval,l_id)) {
-          data->addValue(LOAD_NQ1, atof(split_line[24].c_str()), l_id);
+          data->addValue(LOAD_NQ1, split_line[24].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NQ1, atof(split_line[24].c_str()), l_id);
+          data->setValue(LOAD_NQ1, split_line[24].toDouble(), l_id);
         }
       } 
 
       // LOAD_KP2
       if (nstr > 25) {
         if (!data->getValue(LOAD_KP2,&rval,l_id)) {
-          data->addValue(LOAD_KP2, atof(split_line[25].c_str()), l_id);
+          data->addValue(LOAD_KP2, split_line[25].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KP2, atof(split_line[25].c_str()), l_id);
+          data->setValue(LOAD_KP2, split_line[25].toDouble(), l_id);
         }
       } 
 
       // LOAD_NP2
       if (nstr > 26) {
         if (!data->getValue(LOAD_NP2,&rval,l_id)) {
-          data->addValue(LOAD_NP2, atof(split_line[26].c_str()), l_id);
+          data->addValue(LOAD_NP2, split_line[26].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NP2, atof(split_line[26].c_str()), l_id);
+          data->setValue(LOAD_NP2, split_line[26].toDouble(), l_id);
         }
       }
 
       // LOAD_KQ2
       if (nstr > 27) {
         if (!data->getValue(LOAD_KQ2,&rval,l_id)) {
-          data->addValue(LOAD_KQ2, atof(split_line[27].c_str()), l_id);
+          data->addValue(LOAD_KQ2, split_line[27].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KQ2, atof(split_line[27].c_str()), l_id);
+          data->setValue(LOAD_KQ2, split_line[27].toDouble(), l_id);
         }
       }
 
       // LOAD_NQ2
       if (nstr > 28) {
         if (!data->getValue(LOAD_NQ2,&rval,l_id)) {
-          data->addValue(LOAD_NQ2, atof(split_line[28].c_str()), l_id);
+          data->addValue(LOAD_NQ2, split_line[28].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NQ2, atof(split_line[28].c_str()), l_id);
+          data->setValue(LOAD_NQ2, split_line[28].toDouble(), l_id);
         }
       }
 
       // LOAD_VBRK
       if (nstr > 29) {
         if (!data->getValue(LOAD_VBRK,&rval,l_id)) {
-          data->addValue(LOAD_VBRK, atof(split_line[29].c_str()), l_id);
+          data->addValue(LOAD_VBRK, split_line[29].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VBRK, atof(split_line[29].c_str()), l_id);
+          data->setValue(LOAD_VBRK, split_line[29].toDouble(), l_id);
         }
       }
 
       // LOAD_FRST
       if (nstr > 30) {
         if (!data->getValue(LOAD_FRST,&rval,l_id)) {
-          data->addValue(LOAD_FRST, atof(split_line[30].c_str()), l_id);
+          data->addValue(LOAD_FRST, split_line[30].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FRST, atof(split_line[30].c_str()), l_id);
+          data->setValue(LOAD_FRST, split_line[30].toDouble(), l_id);
         }
       }
 
       // LOAD_VRST
       if (nstr > 31) {
         if (!data->getValue(LOAD_VRST,&rval,l_id)) {
-          data->addValue(LOAD_VRST, atof(split_line[31].c_str()), l_id);
+          data->addValue(LOAD_VRST, split_line[31].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRST, atof(split_line[31].c_str()), l_id);
+          data->setValue(LOAD_VRST, split_line[31].toDouble(), l_id);
         }
       }
 
       // LOAD_CMPKPF
       if (nstr > 32) {
         if (!data->getValue(LOAD_CMPKPF,&rval,l_id)) {
-          data->addValue(LOAD_CMPKPF, atof(split_line[32].c_str()), l_id);
+          data->addValue(LOAD_CMPKPF, split_line[32].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_CMPKPF, atof(split_line[32].c_str()), l_id);
+          data->setValue(LOAD_CMPKPF, split_line[32].toDouble(), l_id);
         }
       }
 
       // LOAD_CMPKQF
       if (nstr > 33) {
         if (!data->getValue(LOAD_CMPKQF,&rval,l_id)) {
-          data->addValue(LOAD_CMPKQF, atof(split_line[33].c_str()), l_id);
+          data->addValue(LOAD_CMPKQF, split_line[33].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_CMPKQF, atof(split_line[33].c_str()), l_id);
+          data->setValue(LOAD_CMPKQF, split_line[33].toDouble(), l_id);
         }
       }
 
       // LOAD_VC1OFF
       if (nstr > 34) {
         if (!data->getValue(LOAD_VC1OFF,&rval,l_id)) {
-          data->addValue(LOAD_VC1OFF, atof(split_line[34].c_str()), l_id);
+          data->addValue(LOAD_VC1OFF, split_line[34].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC1OFF, atof(split_line[34].c_str()), l_id);
+          data->setValue(LOAD_VC1OFF, split_line[34].toDouble(), l_id);
         }
       }
 
       // LOAD_VC2OFF
       if (nstr > 35) {
         if (!data->getValue(LOAD_VC2OFF,&rval,l_id)) {
-          data->addValue(LOAD_VC2OFF, atof(split_line[35].c_str()), l_id);
+          data->addValue(LOAD_VC2OFF, split_line[35].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC2OFF, atof(split_line[35].c_str()), l_id);
+          data->setValue(LOAD_VC2OFF, split_line[35].toDouble(), l_id);
         }
       }
 
       // LOAD_VC1ON
       if (nstr > 36) {
         if (!data->getValue(LOAD_VC1ON,&rval,l_id)) {
-          data->addValue(LOAD_VC1ON, atof(split_line[36].c_str()), l_id);
+          data->addValue(LOAD_VC1ON, split_line[36].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC1ON, atof(split_line[36].c_str()), l_id);
+          data->setValue(LOAD_VC1ON, split_line[36].toDouble(), l_id);
         }
       }
 
       // LOAD_VC2ON
       if (nstr > 37) {
         if (!data->getValue(LOAD_VC2ON,&rval,l_id)) {
-          data->addValue(LOAD_VC2ON, atof(split_line[37].c_str()), l_id);
+          data->addValue(LOAD_VC2ON, split_line[37].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC2ON, atof(split_line[37].c_str()), l_id);
+          data->setValue(LOAD_VC2ON, split_line[37].toDouble(), l_id);
         }
       }
 
       // LOAD_TTH
       if (nstr > 38) {
         if (!data->getValue(LOAD_TTH,&rval,l_id)) {
-          data->addValue(LOAD_TTH, atof(split_line[38].c_str()), l_id);
+          data->addValue(LOAD_TTH, split_line[38].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTH, atof(split_line[38].c_str()), l_id);
+          data->setValue(LOAD_TTH, split_line[38].toDouble(), l_id);
         }
       }
 
       // LOAD_TH1T
       if (nstr > 39) {
         if (!data->getValue(LOAD_TH1T,&rval,l_id)) {
-          data->addValue(LOAD_TH1T, atof(split_line[39].c_str()), l_id);
+          data->addValue(LOAD_TH1T, split_line[39].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TH1T, atof(split_line[39].c_str()), l_id);
+          data->setValue(LOAD_TH1T, split_line[39].toDouble(), l_id);
         }
       }
 
       // LOAD_TH2T
       if (nstr > 40) {
         if (!data->getValue(LOAD_TH2T,&rval,l_id)) {
-          data->addValue(LOAD_TH2T, atof(split_line[40].c_str()), l_id);
+          data->addValue(LOAD_TH2T, split_line[40].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TH2T, atof(split_line[40].c_str()), l_id);
+          data->setValue(LOAD_TH2T, split_line[40].toDouble(), l_id);
         }
       }
 
       // LOAD_FUVR
       if (nstr > 41) {
         if (!data->getValue(LOAD_FUVR,&rval,l_id)) {
-          data->addValue(LOAD_FUVR, atof(split_line[41].c_str()), l_id);
+          data->addValue(LOAD_FUVR, split_line[41].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FUVR, atof(split_line[41].c_str()), l_id);
+          data->setValue(LOAD_FUVR, split_line[41].toDouble(), l_id);
         }
       }
 
       // LOAD_UVTR1
       if (nstr > 42) {
         if (!data->getValue(LOAD_UVTR1,&rval,l_id)) {
-          data->addValue(LOAD_UVTR1, atof(split_line[42].c_str()), l_id);
+          data->addValue(LOAD_UVTR1, split_line[42].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_UVTR1, atof(split_line[42].c_str()), l_id);
+          data->setValue(LOAD_UVTR1, split_line[42].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR1
       if (nstr > 43) {
         if (!data->getValue(LOAD_TTR1,&rval,l_id)) {
-          data->addValue(LOAD_TTR1, atof(split_line[43].c_str()), l_id);
+          data->addValue(LOAD_TTR1, split_line[43].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR1, atof(split_line[43].c_str()), l_id);
+          data->setValue(LOAD_TTR1, split_line[43].toDouble(), l_id);
         }
       }
 
       // LOAD_UVTR1
       if (nstr > 44) {
         if (!data->getValue(LOAD_UVTR1,&rval,l_id)) {
-          data->addValue(LOAD_UVTR1, atof(split_line[44].c_str()), l_id);
+          data->addValue(LOAD_UVTR1, split_line[44].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_UVTR1, atof(split_line[44].c_str()), l_id);
+          data->setValue(LOAD_UVTR1, split_line[44].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR2
       if (nstr > 45) {
         if (!data->getValue(LOAD_TTR2,&rval,l_id)) {
-          data->addValue(LOAD_TTR2, atof(split_line[45].c_str()), l_id);
+          data->addValue(LOAD_TTR2, split_line[45].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR2, atof(split_line[45].c_str()), l_id);
+          data->setValue(LOAD_TTR2, split_line[45].toDouble(), l_id);
         }
       }
     }
@@ -643,11 +644,11 @@ template <class _data_struct> class Acmtblu1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[3]);
+      sval = split_line[3].unquoted();
       util.toUpper(sval);
 
       // LOAD_MODEL              "MODEL"                  integer
@@ -656,183 +657,183 @@ template <class _data_struct> class Acmtblu1Parser
 
       // LOAD_ID
       if (nstr > 2) {
-        sval = util.clean2Char(split_line[2]);
+        sval = split_line[2].tag();
         strcpy(data.id, sval.c_str());
       }
 
       // LOAD_TSTALL
       if (nstr > 11) {
-        data.tstall = atof(split_line[11].c_str());
+        data.tstall = split_line[11].toDouble();
       }
 
       // LOAD_TRESTART
       if (nstr > 12) {
-        data.trestart = atof(split_line[12].c_str());
+        data.trestart = split_line[12].toDouble();
       }
 
       // LOAD_TV
       if (nstr > 13) {
-        data.tv = atof(split_line[13].c_str());
+        data.tv = split_line[13].toDouble();
       }
 
       // LOAD_TF
       if (nstr > 14) {
-        data.tf = atof(split_line[14].c_str());
+        data.tf = split_line[14].toDouble();
       }
 
       // LOAD_COMPLF
       if (nstr > 15) {
-        data.complf = atof(split_line[15].c_str());
+        data.complf = split_line[15].toDouble();
       }
 
       // LOAD_COMPPF
       if (nstr > 16) {
-        data.comppf = atof(split_line[16].c_str());
+        data.comppf = split_line[16].toDouble();
       }
 
       // LOAD_VSTALL
       if (nstr > 17) {
-        data.vstall = atof(split_line[17].c_str());
+        data.vstall = split_line[17].toDouble();
       }
 
       // LOAD_RSTALL
       if (nstr > 18) {
-        data.rstall = atof(split_line[18].c_str());
+        data.rstall = split_line[18].toDouble();
       }
 
       // LOAD_XSTALL
       if (nstr > 19) {
-        data.xstall = atof(split_line[19].c_str());
+        data.xstall = split_line[19].toDouble();
       }
 
       // LOAD_LFADJ
       if (nstr > 20) {
-        data.lfadj = atof(split_line[20].c_str());
+        data.lfadj = split_line[20].toDouble();
       }
 
       // LOAD_KP1
       if (nstr > 21) {
-        data.kp1 = atof(split_line[21].c_str());
+        data.kp1 = split_line[21].toDouble();
       }
 
       // LOAD_NP1
       if (nstr > 22) {
-        data.np1 = atof(split_line[22].c_str());
+        data.np1 = split_line[22].toDouble();
       }
 
       // LOAD_KQ1
       if (nstr > 23) {
-        data.kq1 = atof(split_line[23].c_str());
+        data.kq1 = split_line[23].toDouble();
       }
 
       // LOAD_NQ1
       if (nstr > 24) {
-        data.nq1 = atof(split_line[24].c_str());
+        data.nq1 = split_line[24].toDouble();
       }
 
       // LOAD_KP2
       if (nstr > 25) {
-        data.kp2 = atof(split_line[25].c_str());
+        data.kp2 = split_line[25].toDouble();
       }
 
       // LOAD_NP2
       if (nstr > 26) {
-        data.np2 = atof(split_line[26].c_str());
+        data.np2 = split_line[26].toDouble();
       }
 
       // LOAD_KQ2
       if (nstr > 27) {
-        data.kq2 = atof(split_line[27].c_str());
+        data.kq2 = split_line[27].toDouble();
       }
 
       // LOAD_NQ2
       if (nstr > 28) {
-        data.nq2 = atof(split_line[28].c_str());
+        data.nq2 = split_line[28].toDouble();
       }
 
       // LOAD_VBRK
       if (nstr > 29) {
-        data.vbrk = atof(split_line[29].c_str());
+        data.vbrk = split_line[29].toDouble();
       }
 
       // LOAD_FRST
       if (nstr > 30) {
-        data.frst = atof(split_line[30].c_str());
+        data.frst = split_line[30].toDouble();
       }
 
       // LOAD_VRST
       if (nstr > 31) {
-        data.vrst = atof(split_line[31].c_str());
+        data.vrst = split_line[31].toDouble();
       }
 
       // LOAD_CMPKPF
       if (nstr > 32) {
-        data.cmpkpf = atof(split_line[32].c_str());
+        data.cmpkpf = split_line[32].toDouble();
       }
 
       // LOAD_CMPKQF
       if (nstr > 33) {
-        data.cmpkqf = atof(split_line[33].c_str());
+        data.cmpkqf = split_line[33].toDouble();
       }
 
       // LOAD_VC1OFF
       if (nstr > 34) {
-        data.vc1off = atof(split_line[34].c_str());
+        data.vc1off = split_line[34].toDouble();
       }
 
       // LOAD_VC2OFF
       if (nstr > 35) {
-        data.vc2off = atof(split_line[35].c_str());
+        data.vc2off = split_line[35].toDouble();
       }
 
       // LOAD_VC1ON
       if (nstr > 36) {
-        data.vc1on = atof(split_line[36].c_str());
+        data.vc1on = split_line[36].toDouble();
       }
 
       // LOAD_VC2ON
       if (nstr > 37) {
-        data.vc2on = atof(split_line[37].c_str());
+        data.vc2on = split_line[37].toDouble();
       }
 
       // LOAD_TTH
       if (nstr > 38) {
-        data.tth = atof(split_line[38].c_str());
+        data.tth = split_line[38].toDouble();
       }
 
       // LOAD_TH1T
       if (nstr > 39) {
-        data.th1t = atof(split_line[39].c_str());
+        data.th1t = split_line[39].toDouble();
       }
 
       // LOAD_TH2T
       if (nstr > 40) {
-        data.th2t = atof(split_line[40].c_str());
+        data.th2t = split_line[40].toDouble();
       }
 
       // LOAD_FUVR
       if (nstr > 41) {
-        data.fuvr = atof(split_line[41].c_str());
+        data.fuvr = split_line[41].toDouble();
       }
 
       // LOAD_UVTR1
       if (nstr > 42) {
-        data.uvtr1 = atof(split_line[42].c_str());
+        data.uvtr1 = split_line[42].toDouble();
       }
 
       // LOAD_TTR1
       if (nstr > 43) {
-        data.ttr1 = atof(split_line[43].c_str());
+        data.ttr1 = split_line[43].toDouble();
       }
 
       // LOAD_UVTR2
       if (nstr > 44) {
-        data.uvtr2 = atof(split_line[44].c_str());
+        data.uvtr2 = split_line[44].toDouble();
       }
 
       // LOAD_TTR2
       if (nstr > 45) {
-        data.ttr2 = atof(split_line[45].c_str());
+        data.ttr2 = split_line[45].toDouble();
       }
     }
 };
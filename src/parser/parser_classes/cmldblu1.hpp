@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class Cmldblu1Parser
@@ -990,7 +991,7 @@ template <class _data_struct> class Cmldblu1Parser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int l_id)
     {
       double rval;
@@ -1000,7 +1001,7 @@ template <class _data_struct> class Cmldblu1Parser
       // LOAD_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[3]);
+      model = split_line[3].unquoted();
       util.toUpper(model);
       if (!data->getValue(LOAD_MODEL,&stmp,l_id)) {
         data->addValue(LOAD_MODEL, model.c_str(), l_id);
@@ -1011,1197 +1012,1197 @@ template <class _data_struct> class Cmldblu1Parser
       // LOAD_IT
       if (nstr > 5) {
         if (!data->getValue(LOAD_IT,&ival,l_id)) {
-          data->addValue(LOAD_IT, atoi(split_line[5].c_str()), l_id);
+          data->addValue(LOAD_IT, split_line[5].toInt(), l_id);
         } else {
-          data->setValue(LOAD_IT, atoi(split_line[5].c_str()), l_id);
+          data->setValue(LOAD_IT, split_line[5].toInt(), l_id);
         }
       } 
 
       // LOAD_MVA
       if (nstr > 11) {
         if (!data->getValue(LOAD_MVA,&rval,l_id)) {
-          data->addValue(LOAD_MVA, atof(split_line[11].c_str()), l_id);
+          data->addValue(LOAD_MVA, split_line[11].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_MVA, atof(split_line[11].c_str()), l_id);
+          data->setValue(LOAD_MVA, split_line[11].toDouble(), l_id);
         }
       } 
 
       // LOAD_BSS
       if (nstr > 12) {
         if (!data->getValue(LOAD_BSS,&rval,l_id)) {
-          data->addValue(LOAD_BSS, atof(split_line[12].c_str()), l_id);
+          data->addValue(LOAD_BSS, split_line[12].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_BSS, atof(split_line[12].c_str()), l_id);
+          data->setValue(LOAD_BSS, split_line[12].toDouble(), l_id);
         }
       } 
 
       // LOAD_RFDR
       if (nstr > 13) {
         if (!data->getValue(LOAD_RFDR,&rval,l_id)) {
-          data->addValue(LOAD_RFDR, atof(split_line[13].c_str()), l_id);
+          data->addValue(LOAD_RFDR, split_line[13].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RFDR, atof(split_line[13].c_str()), l_id);
+          data->setValue(LOAD_RFDR, split_line[13].toDouble(), l_id);
         }
       } 
 
       // LOAD_XFDR
       if (nstr > 14) {
         if (!data->getValue(LOAD_XFDR,&rval,l_id)) {
-          data->addValue(LOAD_XFDR, atof(split_line[14].c_str()), l_id);
+          data->addValue(LOAD_XFDR, split_line[14].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XFDR, atof(split_line[14].c_str()), l_id);
+          data->setValue(LOAD_XFDR, split_line[14].toDouble(), l_id);
         }
       } 
 
       // LOAD_FB
       if (nstr > 15) {
         if (!data->getValue(LOAD_FB,&rval,l_id)) {
-          data->addValue(LOAD_FB, atof(split_line[15].c_str()), l_id);
+          data->addValue(LOAD_FB, split_line[15].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FB, atof(split_line[15].c_str()), l_id);
+          data->setValue(LOAD_FB, split_line[15].toDouble(), l_id);
         }
       } 
 
       // LOAD_XXF
       if (nstr > 16) {
         if (!data->getValue(LOAD_XXF,&rval,l_id)) {
-          data->addValue(LOAD_XXF, atof(split_line[16].c_str()), l_id);
+          data->addValue(LOAD_XXF, split_line[16].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XXF, atof(split_line[16].c_str()), l_id);
+          data->setValue(LOAD_XXF, split_line[16].toDouble(), l_id);
         }
       } 
 
       // LOAD_TFIXHS
       if (nstr > 17) {
         if (!data->getValue(LOAD_TFIXHS,&rval,l_id)) {
-          data->addValue(LOAD_TFIXHS, atof(split_line[17].c_str()), l_id);
+          data->addValue(LOAD_TFIXHS, split_line[17].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TFIXHS, atof(split_line[17].c_str()), l_id);
+          data->setValue(LOAD_TFIXHS, split_line[17].toDouble(), l_id);
         }
       }
 
       // LOAD_TFIXLS
       if (nstr > 18) {
         if (!data->getValue(LOAD_TFIXLS,&rval,l_id)) {
-          data->addValue(LOAD_TFIXLS, atof(split_line[18].c_str()), l_id);
+          data->addValue(LOAD_TFIXLS, split_line[18].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TFIXLS, atof(split_line[18].c_str()), l_id);
+          data->setValue(LOAD_TFIXLS, split_line[18].toDouble(), l_id);
         }
       }
 
       // LOAD_LTC
       if (nstr > 19) {
         if (!data->getValue(LOAD_LTC,&rval,l_id)) {
-          data->addValue(LOAD_LTC, atof(split_line[19].c_str()), l_id);
+          data->addValue(LOAD_LTC, split_line[19].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LTC, atof(split_line[19].c_str()), l_id);
+          data->setValue(LOAD_LTC, split_line[19].toDouble(), l_id);
         }
       }
 
       // LOAD_TMIN
       if (nstr > 20) {
         if (!data->getValue(LOAD_TMIN,&rval,l_id)) {
-          data->addValue(LOAD_TMIN, atof(split_line[20].c_str()), l_id);
+          data->addValue(LOAD_TMIN, split_line[20].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TMIN, atof(split_line[20].c_str()), l_id);
+          data->setValue(LOAD_TMIN, split_line[20].toDouble(), l_id);
         }
       }
 
       // LOAD_TMAX
       if (nstr > 21) {
         if (!data->getValue(LOAD_TMAX,&rval,l_id)) {
-          data->addValue(LOAD_TMAX, atof(split_line[21].c_str()), l_id);
+          data->addValue(LOAD_TMAX, split_line[21].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TMAX, atof(split_line[21].c_str()), l_id);
+          data->setValue(LOAD_TMAX, split_line[21].toDouble(), l_id);
         }
       }
 
       // LOAD_STEP
       if (nstr > 22) {
         if (!data->getValue(LOAD_STEP,&rval,l_id)) {
-          data->addValue(LOAD_STEP, atof(split_line[22].c_str()), l_id);
+          data->addValue(LOAD_STEP, split_line[22].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_STEP, atof(split_line[22].c_str()), l_id);
+          data->setValue(LOAD_STEP, split_line[22].toDouble(), l_id);
         }
       }
 
       // LOAD_VMIN
       if (nstr > 23) {
         if (!data->getValue(LOAD_VMIN,&rval,l_id)) {
-          data->addValue(LOAD_VMIN, atof(split_line[23].c_str()), l_id);
+          data->addValue(LOAD_VMIN, split_line[23].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VMIN, atof(split_line[23].c_str()), l_id);
+          data->setValue(LOAD_VMIN, split_line[23].toDouble(), l_id);
         }
       }
 
       // LOAD_VMAX
       if (nstr > 24) {
         if (!data->getValue(LOAD_VMAX,&rval,l_id)) {
-          data->addValue(LOAD_VMAX, atof(split_line[24].c_str()), l_id);
+          data->addValue(LOAD_VMAX, split_line[24].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VMAX, atof(split_line[24].c_str()), l_id);
+          data->setValue(LOAD_VMAX, split_line[24].toDouble(), l_id);
         }
       } 
 
       // LOAD_TDEL
       if (nstr > 25) {
         if (!data->getValue(LOAD_TDEL,&rval,l_id)) {
-          data->addValue(LOAD_TDEL, atof(split_line[25].c_str()), l_id);
+          data->addValue(LOAD_TDEL, split_line[25].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TDEL, atof(split_line[25].c_str()), l_id);
+          data->setValue(LOAD_TDEL, split_line[25].toDouble(), l_id);
         }
       } 
 
       // LOAD_TTAP
       if (nstr > 26) {
         if (!data->getValue(LOAD_TTAP,&rval,l_id)) {
-          data->addValue(LOAD_TTAP, atof(split_line[26].c_str()), l_id);
+          data->addValue(LOAD_TTAP, split_line[26].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTAP, atof(split_line[26].c_str()), l_id);
+          data->setValue(LOAD_TTAP, split_line[26].toDouble(), l_id);
         }
       }
 
       // LOAD_RCOMP
       if (nstr > 27) {
         if (!data->getValue(LOAD_RCOMP,&rval,l_id)) {
-          data->addValue(LOAD_RCOMP, atof(split_line[27].c_str()), l_id);
+          data->addValue(LOAD_RCOMP, split_line[27].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RCOMP, atof(split_line[27].c_str()), l_id);
+          data->setValue(LOAD_RCOMP, split_line[27].toDouble(), l_id);
         }
       }
 
       // LOAD_XCOMP
       if (nstr > 28) {
         if (!data->getValue(LOAD_XCOMP,&rval,l_id)) {
-          data->addValue(LOAD_XCOMP, atof(split_line[28].c_str()), l_id);
+          data->addValue(LOAD_XCOMP, split_line[28].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XCOMP, atof(split_line[28].c_str()), l_id);
+          data->setValue(LOAD_XCOMP, split_line[28].toDouble(), l_id);
         }
       }
 
       // LOAD_FMA
       if (nstr > 29) {
         if (!data->getValue(LOAD_FMA,&rval,l_id)) {
-          data->addValue(LOAD_FMA, atof(split_line[29].c_str()), l_id);
+          data->addValue(LOAD_FMA, split_line[29].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FMA, atof(split_line[29].c_str()), l_id);
+          data->setValue(LOAD_FMA, split_line[29].toDouble(), l_id);
         }
       }
 
       // LOAD_FMB
       if (nstr > 30) {
         if (!data->getValue(LOAD_FMB,&rval,l_id)) {
-          data->addValue(LOAD_FMB, atof(split_line[30].c_str()), l_id);
+          data->addValue(LOAD_FMB, split_line[30].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FMB, atof(split_line[30].c_str()), l_id);
+          data->setValue(LOAD_FMB, split_line[30].toDouble(), l_id);
         }
       }
 
       // LOAD_FMC
       if (nstr > 31) {
         if (!data->getValue(LOAD_FMC,&rval,l_id)) {
-          data->addValue(LOAD_FMC, atof(split_line[31].c_str()), l_id);
+          data->addValue(LOAD_FMC, split_line[31].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FMC, atof(split_line[31].c_str()), l_id);
+          data->setValue(LOAD_FMC, split_line[31].toDouble(), l_id);
         }
       }
 
       // LOAD_FMD
       if (nstr > 32) {
         if (!data->getValue(LOAD_FMD,&rval,l_id)) {
-          data->addValue(LOAD_FMD, atof(split_line[32].c_str()), l_id);
+          data->addValue(LOAD_FMD, split_line[32].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FMD, atof(split_line[32].c_str()), l_id);
+          data->setValue(LOAD_FMD, split_line[32].toDouble(), l_id);
         }
       }
 
       // LOAD_FEL
       if (nstr > 33) {
         if (!data->getValue(LOAD_FEL,&rval,l_id)) {
-          data->addValue(LOAD_FEL, atof(split_line[33].c_str()), l_id);
+          data->addValue(LOAD_FEL, split_line[33].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FEL, atof(split_line[33].c_str()), l_id);
+          data->setValue(LOAD_FEL, split_line[33].toDouble(), l_id);
         }
       }
 
       // LOAD_PFEL
       if (nstr > 34) {
         if (!data->getValue(LOAD_PFEL,&rval,l_id)) {
-          data->addValue(LOAD_PFEL, atof(split_line[34].c_str()), l_id);
+          data->addValue(LOAD_PFEL, split_line[34].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_PFEL, atof(split_line[34].c_str()), l_id);
+          data->setValue(LOAD_PFEL, split_line[34].toDouble(), l_id);
         }
       }
 
       // LOAD_VD1
       if (nstr > 35) {
         if (!data->getValue(LOAD_VD1,&rval,l_id)) {
-          data->addValue(LOAD_VD1, atof(split_line[35].c_str()), l_id);
+          data->addValue(LOAD_VD1, split_line[35].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VD1, atof(split_line[35].c_str()), l_id);
+          data->setValue(LOAD_VD1, split_line[35].toDouble(), l_id);
         }
       }
 
       // LOAD_VD2
       if (nstr > 36) {
         if (!data->getValue(LOAD_VD2,&rval,l_id)) {
-          data->addValue(LOAD_VD2, atof(split_line[36].c_str()), l_id);
+          data->addValue(LOAD_VD2, split_line[36].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VD2, atof(split_line[36].c_str()), l_id);
+          data->setValue(LOAD_VD2, split_line[36].toDouble(), l_id);
         }
       }
 
       // LOAD_PFS
       if (nstr > 37) {
         if (!data->getValue(LOAD_PFS,&rval,l_id)) {
-          data->addValue(LOAD_PFS, atof(split_line[37].c_str()), l_id);
+          data->addValue(LOAD_PFS, split_line[37].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_PFS, atof(split_line[37].c_str()), l_id);
+          data->setValue(LOAD_PFS, split_line[37].toDouble(), l_id);
         }
       }
 
       // LOAD_P1E
       if (nstr > 38) {
         if (!data->getValue(LOAD_P1E,&rval,l_id)) {
-          data->addValue(LOAD_P1E, atof(split_line[38].c_str()), l_id);
+          data->addValue(LOAD_P1E, split_line[38].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_P1E, atof(split_line[38].c_str()), l_id);
+          data->setValue(LOAD_P1E, split_line[38].toDouble(), l_id);
         }
       }
 
       // LOAD_P1C
       if (nstr > 39) {
         if (!data->getValue(LOAD_P1C,&rval,l_id)) {
-          data->addValue(LOAD_P1C, atof(split_line[39].c_str()), l_id);
+          data->addValue(LOAD_P1C, split_line[39].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_P1C, atof(split_line[39].c_str()), l_id);
+          data->setValue(LOAD_P1C, split_line[39].toDouble(), l_id);
         }
       }
 
       // LOAD_P2E
       if (nstr > 40) {
         if (!data->getValue(LOAD_P2E,&rval,l_id)) {
-          data->addValue(LOAD_P2E, atof(split_line[40].c_str()), l_id);
+          data->addValue(LOAD_P2E, split_line[40].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_P2E, atof(split_line[40].c_str()), l_id);
+          data->setValue(LOAD_P2E, split_line[40].toDouble(), l_id);
         }
       }
 
       // LOAD_P2C
       if (nstr > 41) {
         if (!data->getValue(LOAD_P2C,&rval,l_id)) {
-          data->addValue(LOAD_P2C, atof(split_line[41].c_str()), l_id);
+          data->addValue(LOAD_P2C, split_line[41].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_P2C, atof(split_line[41].c_str()), l_id);
+          data->setValue(LOAD_P2C, split_line[41].toDouble(), l_id);
         }
       }
 
       // LOAD_PFREQ
       if (nstr > 42) {
         if (!data->getValue(LOAD_PFREQ,&rval,l_id)) {
-          data->addValue(LOAD_PFREQ, atof(split_line[42].c_str()), l_id);
+          data->addValue(LOAD_PFREQ, split_line[42].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_PFREQ, atof(split_line[42].c_str()), l_id);
+          data->setValue(LOAD_PFREQ, split_line[42].toDouble(), l_id);
         }
       }
 
       // LOAD_Q1E
       if (nstr > 43) {
         if (!data->getValue(LOAD_Q1E,&rval,l_id)) {
-          data->addValue(LOAD_Q1E, atof(split_line[43].c_str()), l_id);
+          data->addValue(LOAD_Q1E, split_line[43].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_Q1E, atof(split_line[43].c_str()), l_id);
+          data->setValue(LOAD_Q1E, split_line[43].toDouble(), l_id);
         }
       }
 
       // LOAD_Q1C
       if (nstr > 44) {
         if (!data->getValue(LOAD_Q1C,&rval,l_id)) {
-          data->addValue(LOAD_Q1C, atof(split_line[44].c_str()), l_id);
+          data->addValue(LOAD_Q1C, split_line[44].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_Q1C, atof(split_line[44].c_str()), l_id);
+          data->setValue(LOAD_Q1C, split_line[44].toDouble(), l_id);
         }
       }
 
       // LOAD_Q2E
       if (nstr > 45) {
         if (!data->getValue(LOAD_Q2E,&rval,l_id)) {
-          data->addValue(LOAD_Q2E, atof(split_line[45].c_str()), l_id);
+          data->addValue(LOAD_Q2E, split_line[45].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_Q2E, atof(split_line[45].c_str()), l_id);
+          data->setValue(LOAD_Q2E, split_line[45].toDouble(), l_id);
         }
       }
 
       // LOAD_Q2C
       if (nstr > 46) {
         if (!data->getValue(LOAD_Q2C,&rval,l_id)) {
-          data->addValue(LOAD_Q2C, atof(split_line[46].c_str()), l_id);
+          data->addValue(LOAD_Q2C, split_line[46].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_Q2C, atof(split_line[46].c_str()), l_id);
+          data->setValue(LOAD_Q2C, split_line[46].toDouble(), l_id);
         }
       }
 
       // LOAD_QFREQ
       if (nstr > 47) {
         if (!data->getValue(LOAD_QFREQ,&rval,l_id)) {
-          data->addValue(LOAD_QFREQ, atof(split_line[47].c_str()), l_id);
+          data->addValue(LOAD_QFREQ, split_line[47].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_QFREQ, atof(split_line[47].c_str()), l_id);
+          data->setValue(LOAD_QFREQ, split_line[47].toDouble(), l_id);
         }
       }
 
       // LOAD_MTPA
       if (nstr > 48) {
         if (!data->getValue(LOAD_MTPA,&ival,l_id)) {
-          data->addValue(LOAD_MTPA, atoi(split_line[48].c_str()), l_id);
+          data->addValue(LOAD_MTPA, split_line[48].toInt(), l_id);
         } else {
-          data->setValue(LOAD_MTPA, atoi(split_line[48].c_str()), l_id);
+          data->setValue(LOAD_MTPA, split_line[48].toInt(), l_id);
         }
       }
 
       // LOAD_LFMA
       if (nstr > 49) {
         if (!data->getValue(LOAD_LFMA,&rval,l_id)) {
-          data->addValue(LOAD_LFMA, atof(split_line[49].c_str()), l_id);
+          data->addValue(LOAD_LFMA, split_line[49].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFMA, atof(split_line[49].c_str()), l_id);
+          data->setValue(LOAD_LFMA, split_line[49].toDouble(), l_id);
         }
       }
 
       // LOAD_RSA
       if (nstr > 50) {
         if (!data->getValue(LOAD_RSA,&rval,l_id)) {
-          data->addValue(LOAD_RSA, atof(split_line[50].c_str()), l_id);
+          data->addValue(LOAD_RSA, split_line[50].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RSA, atof(split_line[50].c_str()), l_id);
+          data->setValue(LOAD_RSA, split_line[50].toDouble(), l_id);
         }
       }
 
       // LOAD_LSA
       if (nstr > 51) {
         if (!data->getValue(LOAD_LSA,&rval,l_id)) {
-          data->addValue(LOAD_LSA, atof(split_line[51].c_str()), l_id);
+          data->addValue(LOAD_LSA, split_line[51].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LSA, atof(split_line[51].c_str()), l_id);
+          data->setValue(LOAD_LSA, split_line[51].toDouble(), l_id);
         }
       }
 
       // LOAD_LPA
       if (nstr > 52) {
         if (!data->getValue(LOAD_LPA,&rval,l_id)) {
-          data->addValue(LOAD_LPA, atof(split_line[52].c_str()), l_id);
+          data->addValue(LOAD_LPA, split_line[52].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPA, atof(split_line[52].c_str()), l_id);
+          data->setValue(LOAD_LPA, split_line[52].toDouble(), l_id);
         }
       }
 
       // LOAD_LPPA
       if (nstr > 53) {
         if (!data->getValue(LOAD_LPPA,&rval,l_id)) {
-          data->addValue(LOAD_LPPA, atof(split_line[53].c_str()), l_id);
+          data->addValue(LOAD_LPPA, split_line[53].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPPA, atof(split_line[53].c_str()), l_id);
+          data->setValue(LOAD_LPPA, split_line[53].toDouble(), l_id);
         }
       }
 
       // LOAD_TPOA
       if (nstr > 54) {
         if (!data->getValue(LOAD_TPOA,&rval,l_id)) {
-          data->addValue(LOAD_TPOA, atof(split_line[54].c_str()), l_id);
+          data->addValue(LOAD_TPOA, split_line[54].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPOA, atof(split_line[54].c_str()), l_id);
+          data->setValue(LOAD_TPOA, split_line[54].toDouble(), l_id);
         }
       }
 
       // LOAD_TPPOA
       if (nstr > 55) {
         if (!data->getValue(LOAD_TPPOA,&rval,l_id)) {
-          data->addValue(LOAD_TPPOA, atof(split_line[55].c_str()), l_id);
+          data->addValue(LOAD_TPPOA, split_line[55].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPPOA, atof(split_line[55].c_str()), l_id);
+          data->setValue(LOAD_TPPOA, split_line[55].toDouble(), l_id);
         }
       }
 
       // LOAD_HA
       if (nstr > 56) {
         if (!data->getValue(LOAD_HA,&rval,l_id)) {
-          data->addValue(LOAD_HA, atof(split_line[56].c_str()), l_id);
+          data->addValue(LOAD_HA, split_line[56].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_HA, atof(split_line[56].c_str()), l_id);
+          data->setValue(LOAD_HA, split_line[56].toDouble(), l_id);
         }
       }
 
       // LOAD_ETRQA
       if (nstr > 57) {
         if (!data->getValue(LOAD_ETRQA,&rval,l_id)) {
-          data->addValue(LOAD_ETRQA, atof(split_line[57].c_str()), l_id);
+          data->addValue(LOAD_ETRQA, split_line[57].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_ETRQA, atof(split_line[57].c_str()), l_id);
+          data->setValue(LOAD_ETRQA, split_line[57].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR1A
       if (nstr > 58) {
         if (!data->getValue(LOAD_VTR1A,&rval,l_id)) {
-          data->addValue(LOAD_VTR1A, atof(split_line[58].c_str()), l_id);
+          data->addValue(LOAD_VTR1A, split_line[58].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR1A, atof(split_line[58].c_str()), l_id);
+          data->setValue(LOAD_VTR1A, split_line[58].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR1A
       if (nstr > 59) {
         if (!data->getValue(LOAD_TTR1A,&rval,l_id)) {
-          data->addValue(LOAD_TTR1A, atof(split_line[59].c_str()), l_id);
+          data->addValue(LOAD_TTR1A, split_line[59].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR1A, atof(split_line[59].c_str()), l_id);
+          data->setValue(LOAD_TTR1A, split_line[59].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR1A
       if (nstr > 60) {
         if (!data->getValue(LOAD_FTR1A,&rval,l_id)) {
-          data->addValue(LOAD_FTR1A, atof(split_line[60].c_str()), l_id);
+          data->addValue(LOAD_FTR1A, split_line[60].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR1A, atof(split_line[60].c_str()), l_id);
+          data->setValue(LOAD_FTR1A, split_line[60].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC1A
       if (nstr > 61) {
         if (!data->getValue(LOAD_VRC1A,&rval,l_id)) {
-          data->addValue(LOAD_VRC1A, atof(split_line[61].c_str()), l_id);
+          data->addValue(LOAD_VRC1A, split_line[61].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC1A, atof(split_line[61].c_str()), l_id);
+          data->setValue(LOAD_VRC1A, split_line[61].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC1A
       if (nstr > 62) {
         if (!data->getValue(LOAD_TRC1A,&rval,l_id)) {
-          data->addValue(LOAD_TRC1A, atof(split_line[62].c_str()), l_id);
+          data->addValue(LOAD_TRC1A, split_line[62].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC1A, atof(split_line[62].c_str()), l_id);
+          data->setValue(LOAD_TRC1A, split_line[62].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR2A
       if (nstr > 63) {
         if (!data->getValue(LOAD_VTR2A,&rval,l_id)) {
-          data->addValue(LOAD_VTR2A, atof(split_line[63].c_str()), l_id);
+          data->addValue(LOAD_VTR2A, split_line[63].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR2A, atof(split_line[63].c_str()), l_id);
+          data->setValue(LOAD_VTR2A, split_line[63].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR2A
       if (nstr > 64) {
         if (!data->getValue(LOAD_TTR2A,&rval,l_id)) {
-          data->addValue(LOAD_TTR2A, atof(split_line[64].c_str()), l_id);
+          data->addValue(LOAD_TTR2A, split_line[64].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR2A, atof(split_line[64].c_str()), l_id);
+          data->setValue(LOAD_TTR2A, split_line[64].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR2A
       if (nstr > 65) {
         if (!data->getValue(LOAD_FTR2A,&rval,l_id)) {
-          data->addValue(LOAD_FTR2A, atof(split_line[65].c_str()), l_id);
+          data->addValue(LOAD_FTR2A, split_line[65].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR2A, atof(split_line[65].c_str()), l_id);
+          data->setValue(LOAD_FTR2A, split_line[65].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC2A
       if (nstr > 66) {
         if (!data->getValue(LOAD_VRC2A,&rval,l_id)) {
-          data->addValue(LOAD_VRC2A, atof(split_line[66].c_str()), l_id);
+          data->addValue(LOAD_VRC2A, split_line[66].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC2A, atof(split_line[66].c_str()), l_id);
+          data->setValue(LOAD_VRC2A, split_line[66].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC2A
       if (nstr > 67) {
         if (!data->getValue(LOAD_TRC2A,&rval,l_id)) {
-          data->addValue(LOAD_TRC2A, atof(split_line[67].c_str()), l_id);
+          data->addValue(LOAD_TRC2A, split_line[67].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC2A, atof(split_line[67].c_str()), l_id);
+          data->setValue(LOAD_TRC2A, split_line[67].toDouble(), l_id);
         }
       }
 
       // LOAD_MTPB
       if (nstr > 68) {
         if (!data->getValue(LOAD_MTPB,&ival,l_id)) {
-          data->addValue(LOAD_MTPB, atoi(split_line[68].c_str()), l_id);
+          data->addValue(LOAD_MTPB, split_line[68].toInt(), l_id);
         } else {
-          data->setValue(LOAD_MTPB, atoi(split_line[68].c_str()), l_id);
+          data->setValue(LOAD_MTPB, split_line[68].toInt(), l_id);
         }
       }
 
       // LOAD_LFMB
       if (nstr > 69) {
         if (!data->getValue(LOAD_LFMB,&rval,l_id)) {
-          data->addValue(LOAD_LFMB, atof(split_line[69].c_str()), l_id);
+          data->addValue(LOAD_LFMB, split_line[69].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFMB, atof(split_line[69].c_str()), l_id);
+          data->setValue(LOAD_LFMB, split_line[69].toDouble(), l_id);
         }
       }
 
       // LOAD_RSB
       if (nstr > 71) {
         if (!data->getValue(LOAD_RSB,&rval,l_id)) {
-          data->addValue(LOAD_RSB, atof(split_line[70].c_str()), l_id);
+          data->addValue(LOAD_RSB, split_line[70].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RSB, atof(split_line[70].c_str()), l_id);
+          data->setValue(LOAD_RSB, split_line[70].toDouble(), l_id);
         }
       }
 
       // LOAD_LSB
       if (nstr > 72) {
         if (!data->getValue(LOAD_LSB,&rval,l_id)) {
-          data->addValue(LOAD_LSB, atof(split_line[71].c_str()), l_id);
+          data->addValue(LOAD_LSB, split_line[71].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LSB, atof(split_line[71].c_str()), l_id);
+          data->setValue(LOAD_LSB, split_line[71].toDouble(), l_id);
         }
       }
 
       // LOAD_LPB
       if (nstr > 72) {
         if (!data->getValue(LOAD_LPB,&rval,l_id)) {
-          data->addValue(LOAD_LPB, atof(split_line[72].c_str()), l_id);
+          data->addValue(LOAD_LPB, split_line[72].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPB, atof(split_line[72].c_str()), l_id);
+          data->setValue(LOAD_LPB, split_line[72].toDouble(), l_id);
         }
       }
 
       // LOAD_LPPB
       if (nstr > 73) {
         if (!data->getValue(LOAD_LPPB,&rval,l_id)) {
-          data->addValue(LOAD_LPPB, atof(split_line[73].c_str()), l_id);
+          data->addValue(LOAD_LPPB, split_line[73].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPPB, atof(split_line[73].c_str()), l_id);
+          data->setValue(LOAD_LPPB, split_line[73].toDouble(), l_id);
         }
       }
 
       // LOAD_TPOB
       if (nstr > 74) {
         if (!data->getValue(LOAD_TPOB,&rval,l_id)) {
-          data->addValue(LOAD_TPOB, atof(split_line[74].c_str()), l_id);
+          data->addValue(LOAD_TPOB, split_line[74].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPOB, atof(split_line[74].c_str()), l_id);
+          data->setValue(LOAD_TPOB, split_line[74].toDouble(), l_id);
         }
       }
 
       // LOAD_TPPOB
       if (nstr > 75) {
         if (!data->getValue(LOAD_TPPOB,&rval,l_id)) {
-          data->addValue(LOAD_TPPOB, atof(split_line[75].c_str()), l_id);
+          data->addValue(LOAD_TPPOB, split_line[75].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPPOB, atof(split_line[75].c_str()), l_id);
+          data->setValue(LOAD_TPPOB, split_line[75].toDouble(), l_id);
         }
       }
 
       // LOAD_HB
       if (nstr > 76) {
         if (!data->getValue(LOAD_HB,&rval,l_id)) {
-          data->addValue(LOAD_HB, atof(split_line[76].c_str()), l_id);
+          data->addValue(LOAD_HB, split_line[76].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_HB, atof(split_line[76].c_str()), l_id);
+          data->setValue(LOAD_HB, split_line[76].toDouble(), l_id);
         }
       }
 
       // LOAD_ETRQB
       if (nstr > 77) {
         if (!data->getValue(LOAD_ETRQB,&rval,l_id)) {
-          data->addValue(LOAD_ETRQB, atof(split_line[77].c_str()), l_id);
+          data->addValue(LOAD_ETRQB, split_line[77].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_ETRQB, atof(split_line[77].c_str()), l_id);
+          data->setValue(LOAD_ETRQB, split_line[77].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR1B
       if (nstr > 78) {
         if (!data->getValue(LOAD_VTR1B,&rval,l_id)) {
-          data->addValue(LOAD_VTR1B, atof(split_line[78].c_str()), l_id);
+          data->addValue(LOAD_VTR1B, split_line[78].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR1B, atof(split_line[78].c_str()), l_id);
+          data->setValue(LOAD_VTR1B, split_line[78].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR1B
       if (nstr > 79) {
         if (!data->getValue(LOAD_TTR1B,&rval,l_id)) {
-          data->addValue(LOAD_TTR1B, atof(split_line[79].c_str()), l_id);
+          data->addValue(LOAD_TTR1B, split_line[79].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR1B, atof(split_line[79].c_str()), l_id);
+          data->setValue(LOAD_TTR1B, split_line[79].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR1B
       if (nstr > 80) {
         if (!data->getValue(LOAD_FTR1B,&rval,l_id)) {
-          data->addValue(LOAD_FTR1B, atof(split_line[80].c_str()), l_id);
+          data->addValue(LOAD_FTR1B, split_line[80].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR1B, atof(split_line[80].c_str()), l_id);
+          data->setValue(LOAD_FTR1B, split_line[80].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC1B
       if (nstr > 81) {
         if (!data->getValue(LOAD_VRC1B,&rval,l_id)) {
-          data->addValue(LOAD_VRC1B, atof(split_line[81].c_str()), l_id);
+          data->addValue(LOAD_VRC1B, split_line[81].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC1B, atof(split_line[81].c_str()), l_id);
+          data->setValue(LOAD_VRC1B, split_line[81].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC1B
       if (nstr > 82) {
         if (!data->getValue(LOAD_TRC1B,&rval,l_id)) {
-          data->addValue(LOAD_TRC1B, atof(split_line[82].c_str()), l_id);
+          data->addValue(LOAD_TRC1B, split_line[82].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC1B, atof(split_line[82].c_str()), l_id);
+          data->setValue(LOAD_TRC1B, split_line[82].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR2B
       if (nstr > 83) {
         if (!data->getValue(LOAD_VTR2B,&rval,l_id)) {
-          data->addValue(LOAD_VTR2B, atof(split_line[83].c_str()), l_id);
+          data->addValue(LOAD_VTR2B, split_line[83].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR2B, atof(split_line[83].c_str()), l_id);
+          data->setValue(LOAD_VTR2B, split_line[83].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR2B
       if (nstr > 84) {
         if (!data->getValue(LOAD_TTR2B,&rval,l_id)) {
-          data->addValue(LOAD_TTR2B, atof(split_line[84].c_str()), l_id);
+          data->addValue(LOAD_TTR2B, split_line[84].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR2B, atof(split_line[84].c_str()), l_id);
+          data->setValue(LOAD_TTR2B, split_line[84].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR2B
       if (nstr > 85) {
         if (!data->getValue(LOAD_FTR2B,&rval,l_id)) {
-          data->addValue(LOAD_FTR2B, atof(split_line[85].c_str()), l_id);
+          data->addValue(LOAD_FTR2B, split_line[85].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR2B, atof(split_line[85].c_str()), l_id);
+          data->setValue(LOAD_FTR2B, split_line[85].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC2B
       if (nstr > 86) {
         if (!data->getValue(LOAD_VRC2B,&rval,l_id)) {
-          data->addValue(LOAD_VRC2B, atof(split_line[86].c_str()), l_id);
+          data->addValue(LOAD_VRC2B, split_line[86].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC2B, atof(split_line[86].c_str()), l_id);
+          data->setValue(LOAD_VRC2B, split_line[86].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC2B
       if (nstr > 87) {
         if (!data->getValue(LOAD_TRC2B,&rval,l_id)) {
-          data->addValue(LOAD_TRC2B, atof(split_line[87].c_str()), l_id);
+          data->addValue(LOAD_TRC2B, split_line[87].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC2B, atof(split_line[87].c_str()), l_id);
+          data->setValue(LOAD_TRC2B, split_line[87].toDouble(), l_id);
         }
       }
 
       // LOAD_MTPC
       if (nstr > 88) {
         if (!data->getValue(LOAD_MTPC,&ival,l_id)) {
-          data->addValue(LOAD_MTPC, atoi(split_line[88].c_str()), l_id);
+          data->addValue(LOAD_MTPC, split_line[88].toInt(), l_id);
         } else {
-          data->setValue(LOAD_MTPC, atoi(split_line[88].c_str()), l_id);
+          data->setValue(LOAD_MTPC, split_line[88].toInt(), l_id);
         }
       }
 
       // LOAD_LFMC
       if (nstr > 89) {
         if (!data->getValue(LOAD_LFMC,&rval,l_id)) {
-          data->addValue(LOAD_LFMC, atof(split_line[89].c_str()), l_id);
+          data->addValue(LOAD_LFMC, split_line[89].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFMC, atof(split_line[89].c_str()), l_id);
+          data->setValue(LOAD_LFMC, split_line[89].toDouble(), l_id);
         }
       }
 
       // LOAD_RSC
       if (nstr > 90) {
         if (!data->getValue(LOAD_RSC,&rval,l_id)) {
-          data->addValue(LOAD_RSC, atof(split_line[90].c_str()), l_id);
+          data->addValue(LOAD_RSC, split_line[90].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RSC, atof(split_line[90].c_str()), l_id);
+          data->setValue(LOAD_RSC, split_line[90].toDouble(), l_id);
         }
       }
 
       // LOAD_LSC
       if (nstr > 91) {
         if (!data->getValue(LOAD_LSC,&rval,l_id)) {
-          data->addValue(LOAD_LSC, atof(split_line[91].c_str()), l_id);
+          data->addValue(LOAD_LSC, split_line[91].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LSC, atof(split_line[91].c_str()), l_id);
+          data->setValue(LOAD_LSC, split_line[91].toDouble(), l_id);
         }
       }
 
       // LOAD_LPC
       if (nstr > 92) {
         if (!data->getValue(LOAD_LPC,&rval,l_id)) {
-          data->addValue(LOAD_LPC, atof(split_line[92].c_str()), l_id);
+          data->addValue(LOAD_LPC, split_line[92].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPC, atof(split_line[92].c_str()), l_id);
+          data->setValue(LOAD_LPC, split_line[92].toDouble(), l_id);
         }
       }
 
       // LOAD_LPPC
       if (nstr > 93) {
         if (!data->getValue(LOAD_LPPC,&rval,l_id)) {
-          data->addValue(LOAD_LPPC, atof(split_line[93].c_str()), l_id);
+          data->addValue(LOAD_LPPC, split_line[93].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LPPC, atof(split_line[93].c_str()), l_id);
+          data->setValue(LOAD_LPPC, split_line[93].toDouble(), l_id);
         }
       }
 
       // LOAD_TPOC
       if (nstr > 94) {
         if (!data->getValue(LOAD_TPOC,&rval,l_id)) {
-          data->addValue(LOAD_TPOC, atof(split_line[94].c_str()), l_id);
+          data->addValue(LOAD_TPOC, split_line[94].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPOC, atof(split_line[94].c_str()), l_id);
+          data->setValue(LOAD_TPOC, split_line[94].toDouble(), l_id);
         }
       }
 
       // LOAD_TPPOC
       if (nstr > 95) {
         if (!data->getValue(LOAD_TPPOC,&rval,l_id)) {
-          data->addValue(LOAD_TPPOC, atof(split_line[95].c_str()), l_id);
+          data->addValue(LOAD_TPPOC, split_line[95].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TPPOC, atof(split_line[95].c_str()), l_id);
+          data->setValue(LOAD_TPPOC, split_line[95].toDouble(), l_id);
         }
       }
 
       // LOAD_HC
       if (nstr > 96) {
         if (!data->getValue(LOAD_HC,&rval,l_id)) {
-          data->addValue(LOAD_HC, atof(split_line[96].c_str()), l_id);
+          data->addValue(LOAD_HC, split_line[96].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_HC, atof(split_line[96].c_str()), l_id);
+          data->setValue(LOAD_HC, split_line[96].toDouble(), l_id);
         }
       }
 
       // LOAD_ETRQC
       if (nstr > 97) {
         if (!data->getValue(LOAD_ETRQC,&rval,l_id)) {
-          data->addValue(LOAD_ETRQC, atof(split_line[97].c_str()), l_id);
+          data->addValue(LOAD_ETRQC, split_line[97].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_ETRQC, atof(split_line[97].c_str()), l_id);
+          data->setValue(LOAD_ETRQC, split_line[97].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR1C
       if (nstr > 98) {
         if (!data->getValue(LOAD_VTR1C,&rval,l_id)) {
-          data->addValue(LOAD_VTR1C, atof(split_line[98].c_str()), l_id);
+          data->addValue(LOAD_VTR1C, split_line[98].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR1C, atof(split_line[98].c_str()), l_id);
+          data->setValue(LOAD_VTR1C, split_line[98].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR1C
       if (nstr > 99) {
         if (!data->getValue(LOAD_TTR1C,&rval,l_id)) {
-          data->addValue(LOAD_TTR1C, atof(split_line[99].c_str()), l_id);
+          data->addValue(LOAD_TTR1C, split_line[99].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR1C, atof(split_line[99].c_str()), l_id);
+          data->setValue(LOAD_TTR1C, split_line[99].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR1C
       if (nstr > 100) {
         if (!data->getValue(LOAD_FTR1C,&rval,l_id)) {
-          data->addValue(LOAD_FTR1C, atof(split_line[100].c_str()), l_id);
+          data->addValue(LOAD_FTR1C, split_line[100].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR1C, atof(split_line[100].c_str()), l_id);
+          data->setValue(LOAD_FTR1C, split_line[100].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC1C
       if (nstr > 101) {
         if (!data->getValue(LOAD_VRC1C,&rval,l_id)) {
-          data->addValue(LOAD_VRC1C, atof(split_line[101].c_str()), l_id);
+          data->addValue(LOAD_VRC1C, split_line[101].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC1C, atof(split_line[101].c_str()), l_id);
+          data->setValue(LOAD_VRC1C, split_line[101].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC1C
       if (nstr > 102) {
         if (!data->getValue(LOAD_TRC1C,&rval,l_id)) {
-          data->addValue(LOAD_TRC1C, atof(split_line[102].c_str()), l_id);
+          data->addValue(LOAD_TRC1C, split_line[102].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC1C, atof(split_line[102].c_str()), l_id);
+          data->setValue(LOAD_TRC1C, split_line[102].toDouble(), l_id);
         }
       }
 
       // LOAD_VTR2C
       if (nstr > 103) {
         if (!data->getValue(LOAD_VTR2C,&rval,l_id)) {
-          data->addValue(LOAD_VTR2C, atof(split_line[103].c_str()), l_id);
+          data->addValue(LOAD_VTR2C, split_line[103].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VTR2C, atof(split_line[103].c_str()), l_id);
+          data->setValue(LOAD_VTR2C, split_line[103].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR2C
       if (nstr > 104) {
         if (!data->getValue(LOAD_TTR2C,&rval,l_id)) {
-          data->addValue(LOAD_TTR2C, atof(split_line[104].c_str()), l_id);
+          data->addValue(LOAD_TTR2C, split_line[104].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR2C, atof(split_line[104].c_str()), l_id);
+          data->setValue(LOAD_TTR2C, split_line[104].toDouble(), l_id);
         }
       }
 
       // LOAD_FTR2C
       if (nstr > 105) {
         if (!data->getValue(LOAD_FTR2C,&rval,l_id)) {
-          data->addValue(LOAD_FTR2C, atof(split_line[105].c_str()), l_id);
+          data->addValue(LOAD_FTR2C, split_line[105].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FTR2C, atof(split_line[105].c_str()), l_id);
+          data->setValue(LOAD_FTR2C, split_line[105].toDouble(), l_id);
         }
       }
 
       // LOAD_VRC2C
       if (nstr > 106) {
         if (!data->getValue(LOAD_VRC2C,&rval,l_id)) {
-          data->addValue(LOAD_VRC2C, atof(split_line[106].c_str()), l_id);
+          data->addValue(LOAD_VRC2C, split_line[106].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRC2C, atof(split_line[106].c_str()), l_id);
+          data->setValue(LOAD_VRC2C, split_line[106].toDouble(), l_id);
         }
       }
 
       // LOAD_TRC2C
       if (nstr > 107) {
         if (!data->getValue(LOAD_TRC2C,&rval,l_id)) {
-          data->addValue(LOAD_TRC2C, atof(split_line[107].c_str()), l_id);
+          data->addValue(LOAD_TRC2C, split_line[107].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRC2C, atof(split_line[107].c_str()), l_id);
+          data->setValue(LOAD_TRC2C, split_line[107].toDouble(), l_id);
         }
       }
 
       // LOAD_TSTALL
       if (nstr > 108) {
         if (!data->getValue(LOAD_TSTALL,&rval,l_id)) {
-          data->addValue(LOAD_TSTALL, atof(split_line[108].c_str()), l_id);
+          data->addValue(LOAD_TSTALL, split_line[108].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TSTALL, atof(split_line[108].c_str()), l_id);
+          data->setValue(LOAD_TSTALL, split_line[108].toDouble(), l_id);
         }
       }
 
       // LOAD_TRST
       if (nstr > 109) {
         if (!data->getValue(LOAD_TRST,&rval,l_id)) {
-          data->addValue(LOAD_TRST, atof(split_line[109].c_str()), l_id);
+          data->addValue(LOAD_TRST, split_line[109].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TRST, atof(split_line[109].c_str()), l_id);
+          data->setValue(LOAD_TRST, split_line[109].toDouble(), l_id);
         }
       }
 
       // LOAD_TV
       if (nstr > 110) {
         if (!data->getValue(LOAD_TV,&rval,l_id)) {
-          data->addValue(LOAD_TV, atof(split_line[110].c_str()), l_id);
+          data->addValue(LOAD_TV, split_line[110].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TV, atof(split_line[110].c_str()), l_id);
+          data->setValue(LOAD_TV, split_line[110].toDouble(), l_id);
         }
       }
 
       // LOAD_TF
       if (nstr > 111) {
         if (!data->getValue(LOAD_TF,&rval,l_id)) {
-          data->addValue(LOAD_TF, atof(split_line[111].c_str()), l_id);
+          data->addValue(LOAD_TF, split_line[111].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TF, atof(split_line[111].c_str()), l_id);
+          data->setValue(LOAD_TF, split_line[111].toDouble(), l_id);
         }
       }
 
       // LOAD_LFMD
       if (nstr > 112) {
         if (!data->getValue(LOAD_LFMD,&rval,l_id)) {
-          data->addValue(LOAD_LFMD, atof(split_line[112].c_str()), l_id);
+          data->addValue(LOAD_LFMD, split_line[112].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFMD, atof(split_line[112].c_str()), l_id);
+          data->setValue(LOAD_LFMD, split_line[112].toDouble(), l_id);
         }
       }
 
       // LOAD_COMPPF
       if (nstr > 113) {
         if (!data->getValue(LOAD_COMPPF,&rval,l_id)) {
-          data->addValue(LOAD_COMPPF, atof(split_line[113].c_str()), l_id);
+          data->addValue(LOAD_COMPPF, split_line[113].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_COMPPF, atof(split_line[113].c_str()), l_id);
+          data->setValue(LOAD_COMPPF, split_line[113].toDouble(), l_id);
         }
       }
 
       // LOAD_VSTALL
       if (nstr > 114) {
         if (!data->getValue(LOAD_VSTALL,&rval,l_id)) {
-          data->addValue(LOAD_VSTALL, atof(split_line[114].c_str()), l_id);
+          data->addValue(LOAD_VSTALL, split_line[114].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VSTALL, atof(split_line[114].c_str()), l_id);
+          data->setValue(LOAD_VSTALL, split_line[114].toDouble(), l_id);
         }
       }
 
       // LOAD_RSTALL
       if (nstr > 115) {
         if (!data->getValue(LOAD_RSTALL,&rval,l_id)) {
-          data->addValue(LOAD_RSTALL, atof(split_line[115].c_str()), l_id);
+          data->addValue(LOAD_RSTALL, split_line[115].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RSTALL, atof(split_line[115].c_str()), l_id);
+          data->setValue(LOAD_RSTALL, split_line[115].toDouble(), l_id);
         }
       }
 
       // LOAD_XSTALL
       if (nstr > 116) {
         if (!data->getValue(LOAD_XSTALL,&rval,l_id)) {
-          data->addValue(LOAD_XSTALL, atof(split_line[116].c_str()), l_id);
+          data->addValue(LOAD_XSTALL, split_line[116].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XSTALL, atof(split_line[116].c_str()), l_id);
+          data->setValue(LOAD_XSTALL, split_line[116].toDouble(), l_id);
         }
       }
 
       // LOAD_LFADJ
       if (nstr > 117) {
         if (!data->getValue(LOAD_LFADJ,&rval,l_id)) {
-          data->addValue(LOAD_LFADJ, atof(split_line[117].c_str()), l_id);
+          data->addValue(LOAD_LFADJ, split_line[117].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_LFADJ, atof(split_line[117].c_str()), l_id);
+          data->setValue(LOAD_LFADJ, split_line[117].toDouble(), l_id);
         }
       }
 
       // LOAD_KP1
       if (nstr > 118) {
         if (!data->getValue(LOAD_KP1,&rval,l_id)) {
-          data->addValue(LOAD_KP1, atof(split_line[118].c_str()), l_id);
+          data->addValue(LOAD_KP1, split_line[118].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KP1, atof(split_line[118].c_str()), l_id);
+          data->setValue(LOAD_KP1, split_line[118].toDouble(), l_id);
         }
       }
 
       // LOAD_NP1
       if (nstr > 119) {
         if (!data->getValue(LOAD_NP1,&rval,l_id)) {
-          data->addValue(LOAD_NP1, atof(split_line[119].c_str()), l_id);
+          data->addValue(LOAD_NP1, split_line[119].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NP1, atof(split_line[119].c_str()), l_id);
+          data->setValue(LOAD_NP1, split_line[119].toDouble(), l_id);
         }
       }
 
       // LOAD_KQ1
       if (nstr > 120) {
         if (!data->getValue(LOAD_KQ1,&rval,l_id)) {
-          data->addValue(LOAD_KQ1, atof(split_line[120].c_str()), l_id);
+          data->addValue(LOAD_KQ1, split_line[120].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KQ1, atof(split_line[120].c_str()), l_id);
+          data->setValue(LOAD_KQ1, split_line[120].toDouble(), l_id);
         }
       }
 
       // LOAD_NQ1
       if (nstr > 121) {
         if (!data->getValue(LOAD_NQ1,&rval,l_id)) {
-          data->addValue(LOAD_NQ1, atof(split_line[121].c_str()), l_id);
+          data->addValue(LOAD_NQ1, split_line[121].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NQ1, atof(split_line[121].c_str()), l_id);
+          data->setValue(LOAD_NQ1, split_line[121].toDouble(), l_id);
         }
       }
 
       // LOAD_KP2
       if (nstr > 122) {
         if (!data->getValue(LOAD_KP2,&rval,l_id)) {
-          data->addValue(LOAD_KP2, atof(split_line[122].c_str()), l_id);
+          data->addValue(LOAD_KP2, split_line[122].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KP2, atof(split_line[122].c_str()), l_id);
+          data->setValue(LOAD_KP2, split_line[122].toDouble(), l_id);
         }
       }
 
       // LOAD_NP2
       if (nstr > 123) {
         if (!data->getValue(LOAD_NP2,&rval,l_id)) {
-          data->addValue(LOAD_NP2, atof(split_line[123].c_str()), l_id);
+          data->addValue(LOAD_NP2, split_line[123].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NP2, atof(split_line[123].c_str()), l_id);
+          data->setValue(LOAD_NP2, split_line[123].toDouble(), l_id);
         }
       }
 
       // LOAD_KQ2
       if (nstr > 124) {
         if (!data->getValue(LOAD_KQ2,&rval,l_id)) {
-          data->addValue(LOAD_KQ2, atof(split_line[124].c_str()), l_id);
+          data->addValue(LOAD_KQ2, split_line[124].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_KQ2, atof(split_line[124].c_str()), l_id);
+          data->setValue(LOAD_KQ2, split_line[124].toDouble(), l_id);
         }
       }
 
       // LOAD_NQ2
       if (nstr > 125) {
         if (!data->getValue(LOAD_NQ2,&rval,l_id)) {
-          data->addValue(LOAD_NQ2, atof(split_line[125].c_str()), l_id);
+          data->addValue(LOAD_NQ2, split_line[125].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_NQ2, atof(split_line[125].c_str()), l_id);
+          data->setValue(LOAD_NQ2, split_line[125].toDouble(), l_id);
         }
       }
 
       // LOAD_VBRK
       if (nstr > 126) {
         if (!data->getValue(LOAD_VBRK,&rval,l_id)) {
-          data->addValue(LOAD_VBRK, atof(split_line[126].c_str()), l_id);
+          data->addValue(LOAD_VBRK, split_line[126].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VBRK, atof(split_line[126].c_str()), l_id);
+          data->setValue(LOAD_VBRK, split_line[126].toDouble(), l_id);
         }
       }
 
       // LOAD_FRST
       if (nstr > 127) {
         if (!data->getValue(LOAD_FRST,&rval,l_id)) {
-          data->addValue(LOAD_FRST, atof(split_line[127].c_str()), l_id);
+          data->addValue(LOAD_FRST, split_line[127].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FRST, atof(split_line[127].c_str()), l_id);
+          data->setValue(LOAD_FRST, split_line[127].toDouble(), l_id);
         }
       }
 
       // LOAD_VRST
       if (nstr > 128) {
         if (!data->getValue(LOAD_VRST,&rval,l_id)) {
-          data->addValue(LOAD_VRST, atof(split_line[128].c_str()), l_id);
+          data->addValue(LOAD_VRST, split_line[128].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VRST, atof(split_line[128].c_str()), l_id);
+          data->setValue(LOAD_VRST, split_line[128].toDouble(), l_id);
         }
       }
 
       // LOAD_CMPKPF
       if (nstr > 129) {
         if (!data->getValue(LOAD_CMPKPF,&rval,l_id)) {
-          data->addValue(LOAD_CMPKPF, atof(split_line[129].c_str()), l_id);
+          data->addValue(LOAD_CMPKPF, split_line[129].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_CMPKPF, atof(split_line[129].c_str()), l_id);
+          data->setValue(LOAD_CMPKPF, split_line[129].toDouble(), l_id);
         }
       }
 
       // LOAD_CMPKQF
       if (nstr > 130) {
         if (!data->getValue(LOAD_CMPKQF,&rval,l_id)) {
-          data->addValue(LOAD_CMPKQF, atof(split_line[130].c_str()), l_id);
+          data->addValue(LOAD_CMPKQF, split_line[130].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_CMPKQF, atof(split_line[130].c_str()), l_id);
+          data->setValue(LOAD_CMPKQF, split_line[130].toDouble(), l_id);
         }
       }
 
       // LOAD_VC1OFF
       if (nstr > 131) {
         if (!data->getValue(LOAD_VC1OFF,&rval,l_id)) {
-          data->addValue(LOAD_VC1OFF, atof(split_line[131].c_str()), l_id);
+          data->addValue(LOAD_VC1OFF, split_line[131].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC1OFF, atof(split_line[131].c_str()), l_id);
+          data->setValue(LOAD_VC1OFF, split_line[131].toDouble(), l_id);
         }
       }
 
       // LOAD_VC2OFF
       if (nstr > 132) {
         if (!data->getValue(LOAD_VC2OFF,&rval,l_id)) {
-          data->addValue(LOAD_VC2OFF, atof(split_line[132].c_str()), l_id);
+          data->addValue(LOAD_VC2OFF, split_line[132].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC2OFF, atof(split_line[132].c_str()), l_id);
+          data->setValue(LOAD_VC2OFF, split_line[132].toDouble(), l_id);
         }
       }
 
       // LOAD_VC1ON
       if (nstr > 133) {
         if (!data->getValue(LOAD_VC1ON,&rval,l_id)) {
-          data->addValue(LOAD_VC1ON, atof(split_line[133].c_str()), l_id);
+          data->addValue(LOAD_VC1ON, split_line[133].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC1ON, atof(split_line[133].c_str()), l_id);
+          data->setValue(LOAD_VC1ON, split_line[133].toDouble(), l_id);
         }
       }
 
       // LOAD_VC2ON
       if (nstr > 134) {
         if (!data->getValue(LOAD_VC2ON,&rval,l_id)) {
-          data->addValue(LOAD_VC2ON, atof(split_line[134].c_str()), l_id);
+          data->addValue(LOAD_VC2ON, split_line[134].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VC2ON, atof(split_line[134].c_str()), l_id);
+          data->setValue(LOAD_VC2ON, split_line[134].toDouble(), l_id);
         }
       }
 
       // LOAD_TTH
       if (nstr > 135) {
         if (!data->getValue(LOAD_TTH,&rval,l_id)) {
-          data->addValue(LOAD_TTH, atof(split_line[135].c_str()), l_id);
+          data->addValue(LOAD_TTH, split_line[135].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTH, atof(split_line[135].c_str()), l_id);
+          data->setValue(LOAD_TTH, split_line[135].toDouble(), l_id);
         }
       }
 
       // LOAD_TH1T
       if (nstr > 136) {
         if (!data->getValue(LOAD_TH1T,&rval,l_id)) {
-          data->addValue(LOAD_TH1T, atof(split_line[136].c_str()), l_id);
+          data->addValue(LOAD_TH1T, split_line[136].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TH1T, atof(split_line[136].c_str()), l_id);
+          data->setValue(LOAD_TH1T, split_line[136].toDouble(), l_id);
         }
       }
 
       // LOAD_TH2T
       if (nstr > 137) {
         if (!data->getValue(LOAD_TH2T,&rval,l_id)) {
-          data->addValue(LOAD_TH2T, atof(split_line[137].c_str()), l_id);
+          data->addValue(LOAD_TH2T, split_line[137].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TH2T, atof(split_line[137].c_str()), l_id);
+          data->setValue(LOAD_TH2T, split_line[137].toDouble(), l_id);
         }
       }
 
       // LOAD_FUVR
       if (nstr > 138) {
         if (!data->getValue(LOAD_FUVR,&rval,l_id)) {
-          data->addValue(LOAD_FUVR, atof(split_line[138].c_str()), l_id);
+          data->addValue(LOAD_FUVR, split_line[138].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_FUVR, atof(split_line[138].c_str()), l_id);
+          data->setValue(LOAD_FUVR, split_line[138].toDouble(), l_id);
         }
       }
 
       // LOAD_UVTR1
       if (nstr > 139) {
         if (!data->getValue(LOAD_UVTR1,&rval,l_id)) {
-          data->addValue(LOAD_UVTR1, atof(split_line[139].c_str()), l_id);
+          data->addValue(LOAD_UVTR1, split_line[139].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_UVTR1, atof(split_line[139].c_str()), l_id);
+          data->setValue(LOAD_UVTR1, split_line[139].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR1
       if (nstr > 140) {
         if (!data->getValue(LOAD_TTR1,&rval,l_id)) {
-          data->addValue(LOAD_TTR1, atof(split_line[140].c_str()), l_id);
+          data->addValue(LOAD_TTR1, split_line[140].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR1, atof(split_line[140].c_str()), l_id);
+          data->setValue(LOAD_TTR1, split_line[140].toDouble(), l_id);
         }
       }
 
       // LOAD_UVTR2
       if (nstr > 141) {
         if (!data->getValue(LOAD_UVTR2,&rval,l_id)) {
-          data->addValue(LOAD_UVTR2, atof(split_line[141].c_str()), l_id);
+          data->addValue(LOAD_UVTR2, split_line[141].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_UVTR2, atof(split_line[141].c_str()), l_id);
+          data->setValue(LOAD_UVTR2, split_line[141].toDouble(), l_id);
         }
       }
 
       // LOAD_TTR2
       if (nstr > 142) {
         if (!data->getValue(LOAD_TTR2,&rval,l_id)) {
-          data->addValue(LOAD_TTR2, atof(split_line[142].c_str()), l_id);
+          data->addValue(LOAD_TTR2, split_line[142].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TTR2, atof(split_line[142].c_str()), l_id);
+          data->setValue(LOAD_TTR2, split_line[142].toDouble(), l_id);
         }
       }
     }
@@ -2211,11 +2212,11 @@ template <class _data_struct> class Cmldblu1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[3]);
+      sval = split_line[3].unquoted();
       util.toUpper(sval);
 
       // LOAD_MODEL              "MODEL"                  integer
@@ -2224,673 +2225,673 @@ template <class _data_struct> class Cmldblu1Parser
 
       // LOAD_ID
       if (nstr > 2) {
-        sval = util.clean2Char(split_line[2]);
+        sval = split_line[2].tag();
         strcpy(data.id, sval.c_str());
       }
 
       // LOAD_IT
       if (nstr > 5) {
-        data.it = atoi(split_line[5].c_str());
+        data.it = split_line[5].toInt();
       }
 
       // LOAD_MVA
       if (nstr > 11) {
-        data.mva = atof(split_line[11].c_str());
+        data.mva = split_line[11].toDouble();
       }
 
       // LOAD_BSS
       if (nstr > 12) {
-        data.bss = atof(split_line[12].c_str());
+        data.bss = split_line[12].toDouble();
       }
 
       // LOAD_RFDR
       if (nstr > 13) {
-        data.rfdr = atof(split_line[13].c_str());
+        data.rfdr = split_line[13].toDouble();
       }
 
       // LOAD_XFDR
       if (nstr > 14) {
-        data.xfdr = atof(split_line[14].c_str());
+        data.xfdr = split_line[14].toDouble();
       }
 
       // LOAD_FB
       if (nstr > 15) {
-        data.fb = atof(split_line[15].c_str());
+        data.fb = split_line[15].toDouble();
       }
 
       // LOAD_XXF
       if (nstr > 16) {
-        data.xxf = atof(split_line[16].c_str());
+        data.xxf = split_line[16].toDouble();
       }
 
       // LOAD_TFIXHS
       if (nstr > 17) {
-        data.tfixhs = atof(split_line[17].c_str());
+        data.tfixhs = split_line[17].toDouble();
       }
 
       // LOAD_TFIXLS
       if (nstr > 18) {
-        data.tfixls = atof(split_line[18].c_str());
+        data.tfixls = split_line[18].toDouble();
       }
 
       // LOAD_LTC
       if (nstr > 19) {
-        data.ltc = atof(split_line[19].c_str());
+        data.ltc = split_line[19].toDouble();
       }
 
       // LOAD_TMIN
       if (nstr > 20) {
-        data.tmin = atof(split_line[20].c_str());
+        data.tmin = split_line[20].toDouble();
       }
 
       // LOAD_TMAX
       if (nstr > 21) {
-        data.tmax = atof(split_line[21].c_str());
+        data.tmax = split_line[21].toDouble();
       }
 
       // LOAD_STEP
       if (nstr > 22) {
-        data.step = atof(split_line[22].c_str());
+        data.step = split_line[22].toDouble();
       }
 
       // LOAD_VMIN
       if (nstr > 23) {
-        data.vmin = atof(split_line[23].c_str());
+        data.vmin = split_line[23].toDouble();
       }
 
       // LOAD_VMAX
       if (nstr > 24) {
-        data.vmax = atof(split_line[24].c_str());
+        data.vmax = split_line[24].toDouble();
       }
 
       // LOAD_TDEL
       if (nstr > 25) {
-        data.tdel = atof(split_line[25].c_str());
+        data.tdel = split_line[25].toDouble();
       }
 
       // LOAD_TTAP
       if (nstr > 26) {
-        data.ttap = atof(split_line[26].c_str());
+        data.ttap = split_line[26].toDouble();
       }
 
       // LOAD_RCOMP
       if (nstr > 27) {
-        data.rcomp = atof(split_line[27].c_str());
+        data.rcomp = split_line[27].toDouble();
       }
 
       // LOAD_XCOMP
       if (nstr > 28) {
-        data.xcomp = atof(split_line[28].c_str());
+        data.xcomp = split_line[28].toDouble();
       }
 
       // LOAD_FMA
       if (nstr > 29) {
-        data.fma = atof(split_line[29].c_str());
+        data.fma = split_line[29].toDouble();
       }
 
       // LOAD_FMB
       if (nstr > 30) {
-        data.fmb = atof(split_line[30].c_str());
+        data.fmb = split_line[30].toDouble();
       }
 
       // LOAD_FMC
       if (nstr > 31) {
-        data.fmc = atof(split_line[31].c_str());
+        data.fmc = split_line[31].toDouble();
       }
 
       // LOAD_FMD
       if (nstr > 32) {
-        data.fmd = atof(split_line[32].c_str());
+        data.fmd = split_line[32].toDouble();
       }
 
       // LOAD_FEL
       if (nstr > 33) {
-        data.fel = atof(split_line[33].c_str());
+        data.fel = split_line[33].toDouble();
       }
 
       // LOAD_PFEL
       if (nstr > 34) {
-        data.pfel = atof(split_line[34].c_str());
+        data.pfel = split_line[34].toDouble();
       }
 
       // LOAD_VD1
       if (nstr > 35) {
-        data.vd1 = atof(split_line[35].c_str());
+        data.vd1 = split_line[35].toDouble();
       }
 
       // LOAD_VD2
       if (nstr > 36) {
-        data.vd2 = atof(split_line[36].c_str());
+        data.vd2 = split_line[36].toDouble();
       }
 
       // LOAD_PFS
       if (nstr > 37) {
-        data.pfs = atof(split_line[37].c_str());
+        data.pfs = split_line[37].toDouble();
       }
 
       // LOAD_P1E
       if (nstr > 38) {
-        data.p1e = atof(split_line[38].c_str());
+        data.p1e = split_line[38].toDouble();
       }
 
       // LOAD_P1C
       if (nstr > 39) {
-        data.p1c = atof(split_line[39].c_str());
+        data.p1c = split_line[39].toDouble();
       }
 
       // LOAD_P2E
       if (nstr > 40) {
-        data.p2e = atof(split_line[40].c_str());
+        data.p2e = split_line[40].toDouble();
       }
 
       // LOAD_P2C
       if (nstr > 41) {
-        data.p2c = atof(split_line[41].c_str());
+        data.p2c = split_line[41].toDouble();
       }
 
       // LOAD_PFREQ
       if (nstr > 42) {
-        data.pfreq = atof(split_line[42].c_str());
+        data.pfreq = split_line[42].toDouble();
       }
 
       // LOAD_Q1E
       if (nstr > 43) {
-        data.q1e = atof(split_line[43].c_str());
+        data.q1e = split_line[43].toDouble();
       }
 
       // LOAD_Q1C
       if (nstr > 44) {
-        data.q1c = atof(split_line[44].c_str());
+        data.q1c = split_line[44].toDouble();
       }
 
       // LOAD_Q2E
       if (nstr > 45) {
-        data.q2e = atof(split_line[45].c_str());
+        data.q2e = split_line[45].toDouble();
       }
 
       // LOAD_Q2C
       if (nstr > 46) {
-        data.q2c = atof(split_line[46].c_str());
+        data.q2c = split_line[46].toDouble();
       }
 
       // LOAD_QFREQ
       if (nstr > 47) {
-        data.qfreq = atof(split_line[47].c_str());
+        data.qfreq = split_line[47].toDouble();
       }
 
       // LOAD_MTPA
       if (nstr > 48) {
-        data.mtpa = atoi(split_line[48].c_str());
+        data.mtpa = split_line[48].toInt();
       }
 
       // LOAD_LFMA
       if (nstr > 49) {
-        data.lfma = atof(split_line[49].c_str());
+        data.lfma = split_line[49].toDouble();
       }
 
       // LOAD_RSA
       if (nstr > 50) {
-        data.rsa = atof(split_line[50].c_str());
+        data.rsa = split_line[50].toDouble();
       }
 
       // LOAD_LSA
       if (nstr > 51) {
-        data.lsa = atof(split_line[51].c_str());
+        data.lsa = split_line[51].toDouble();
       }
 
       // LOAD_LPA
       if (nstr > 52) {
-        data.lpa = atof(split_line[52].c_str());
+        data.lpa = split_line[52].toDouble();
       }
 
       // LOAD_LPPA
       if (nstr > 53) {
-        data.lppa = atof(split_line[53].c_str());
+        data.lppa = split_line[53].toDouble();
       }
 
       // LOAD_TPOA
       if (nstr > 54) {
-        data.tpoa = atof(split_line[54].c_str());
+        data.tpoa = split_line[54].toDouble();
       }
 
       // LOAD_TPPOA
       if (nstr > 55) {
-        data.tppoa = atof(split_line[55].c_str());
+        data.tppoa = split_line[55].toDouble();
       }
 
       // LOAD_HA
       if (nstr > 56) {
-        data.ha = atof(split_line[56].c_str());
+        data.ha = split_line[56].toDouble();
       }
 
       // LOAD_ETRQA
       if (nstr > 57) {
-        data.etrqa = atof(split_line[57].c_str());
+        data.etrqa = split_line[57].toDouble();
       }
 
       // LOAD_VTR1A
       if (nstr > 58) {
-        data.vtr1a = atof(split_line[58].c_str());
+        data.vtr1a = split_line[58].toDouble();
       }
 
       // LOAD_TTR1A
       if (nstr > 59) {
-        data.ttr1a = atof(split_line[59].c_str());
+        data.ttr1a = split_line[59].toDouble();
       }
 
       // LOAD_FTR1A
       if (nstr > 60) {
-        data.ftr1a = atof(split_line[60].c_str());
+        data.ftr1a = split_line[60].toDouble();
       }
 
       // LOAD_VRC1A
       if (nstr > 61) {
-        data.vrc1a = atof(split_line[61].c_str());
+        data.vrc1a = split_line[61].toDouble();
       }
 
       // LOAD_TRC1A
       if (nstr > 62) {
-        data.trc1a = atof(split_line[62].c_str());
+        data.trc1a = split_line[62].toDouble();
       }
 
       // LOAD_VTR2A
       if (nstr > 63) {
-        data.vtr2a = atof(split_line[63].c_str());
+        data.vtr2a = split_line[63].toDouble();
       }
 
       // LOAD_TTR2A
       if (nstr > 64) {
-        data.ttr2a = atof(split_line[64].c_str());
+        data.ttr2a = split_line[64].toDouble();
       }
 
       // LOAD_FTR2A
       if (nstr > 65) {
-        data.ftr2a = atof(split_line[65].c_str());
+        data.ftr2a = split_line[65].toDouble();
       }
 
       // LOAD_VRC2A
       if (nstr > 66) {
-        data.vrc2a = atof(split_line[66].c_str());
+        data.vrc2a = split_line[66].toDouble();
       }
 
       // LOAD_TRC2A
       if (nstr > 67) {
-        data.trc2a = atof(split_line[67].c_str());
+        data.trc2a = split_line[67].toDouble();
       }
 
       // LOAD_MTPB
       if (nstr > 68) {
-        data.mtpb = atoi(split_line[68].c_str());
+        data.mtpb = split_line[68].toInt();
       }
 
       // LOAD_LFMB
       if (nstr > 69) {
-        data.lfmb = atof(split_line[69].c_str());
+        data.lfmb = split_line[69].toDouble();
       }
 
       // LOAD_RSB
       if (nstr > 70) {
-        data.rsb = atof(split_line[70].c_str());
+        data.rsb = split_line[70].toDouble();
       }
 
       // LOAD_LSB
       if (nstr > 71) {
-        data.lsb = atof(split_line[71].c_str());
+        data.lsb = split_line[71].toDouble();
       }
 
       // LOAD_LPB
       if (nstr > 72) {
-        data.lpb = atof(split_line[72].c_str());
+        data.lpb = split_line[72].toDouble();
       }
 
       // LOAD_LPPB
       if (nstr > 73) {
-        data.lppb = atof(split_line[73].c_str());
+        data.lppb = split_line[73].toDouble();
       }
 
       // LOAD_TPOB
       if (nstr > 74) {
-        data.tpob = atof(split_line[74].c_str());
+        data.tpob = split_line[74].toDouble();
       }
 
       // LOAD_TPPOB
       if (nstr > 75) {
-        data.tppob = atof(split_line[75].c_str());
+        data.tppob = split_line[75].toDouble();
       }
 
       // LOAD_HB
       if (nstr > 76) {
-        data.hb = atof(split_line[76].c_str());
+        data.hb = split_line[76].toDouble();
       }
 
       // LOAD_ETRQB
       if (nstr > 77) {
-        data.etrqb = atof(split_line[77].c_str());
+        data.etrqb = split_line[77].toDouble();
       }
 
       // LOAD_VTR1B
       if (nstr > 78) {
-        data.vtr1b = atof(split_line[78].c_str());
+        data.vtr1b = split_line[78].toDouble();
       }
 
       // LOAD_TTR1B
       if (nstr > 79) {
-        data.ttr1b = atof(split_line[79].c_str());
+        data.ttr1b = split_line[79].toDouble();
       }
 
       // LOAD_FTR1B
       if (nstr > 80) {
-        data.ftr1b = atof(split_line[80].c_str());
+        data.ftr1b = split_line[80].toDouble();
       }
 
       // LOAD_VRC1B
       if (nstr > 81) {
-        data.vrc1b = atof(split_line[81].c_str());
+        data.vrc1b = split_line[81].toDouble();
       }
 
       // LOAD_TRC1B
       if (nstr > 82) {
-        data.trc1b = atof(split_line[82].c_str());
+        data.trc1b = split_line[82].toDouble();
       }
 
       // LOAD_VTR2B
       if (nstr > 83) {
-        data.vtr2b = atof(split_line[83].c_str());
+        data.vtr2b = split_line[83].toDouble();
       }
 
       // LOAD_TTR2B
       if (nstr > 84) {
-        data.ttr2b = atof(split_line[84].c_str());
+        data.ttr2b = split_line[84].toDouble();
       }
 
       // LOAD_FTR2B
       if (nstr > 85) {
-        data.ftr2b = atof(split_line[85].c_str());
+        data.ftr2b = split_line[85].toDouble();
       }
 
       // LOAD_VRC2B
       if (nstr > 86) {
-        data.vrc2b = atof(split_line[86].c_str());
+        data.vrc2b = split_line[86].toDouble();
       }
 
       // LOAD_TRC2B
       if (nstr > 87) {
-        data.trc2b = atof(split_line[87].c_str());
+        data.trc2b = split_line[87].toDouble();
       }
 
       // LOAD_MTPC
       if (nstr > 88) {
-        data.mtpc = atoi(split_line[88].c_str());
+        data.mtpc = split_line[88].toInt();
       }
 
       // LOAD_LFMC
       if (nstr > 89) {
-        data.lfmc = atof(split_line[89].c_str());
+        data.lfmc = split_line[89].toDouble();
       }
 
       // LOAD_RSC
       if (nstr > 90) {
-        data.rsc = atof(split_line[90].c_str());
+        data.rsc = split_line[90].toDouble();
       }
 
       // LOAD_LSC
       if (nstr > 91) {
-        data.lsc = atof(split_line[91].c_str());
+        data.lsc = split_line[91].toDouble();
       }
 
       // LOAD_LPC
       if (nstr > 92) {
-        data.lpc = atof(split_line[92].c_str());
+        data.lpc = split_line[92].toDouble();
       }
 
       // LOAD_LPPC
       if (nstr > 93) {
-        data.lppc = atof(split_line[93].c_str());
+        data.lppc = split_line[93].toDouble();
       }
 
       // LOAD_TPOC
       if (nstr > 94) {
-        data.tpoc = atof(split_line[94].c_str());
+        data.tpoc = split_line[94].toDouble();
       }
 
       // LOAD_TPPOC
       if (nstr > 95) {
-        data.tppoc = atof(split_line[95].c_str());
+        data.tppoc = split_line[95].toDouble();
       }
 
       // LOAD_HC
       if (nstr > 96) {
-        data.hc = atof(split_line[96].c_str());
+        data.hc = split_line[96].toDouble();
       }
 
       // LOAD_ETRQC
       if (nstr > 97) {
-        data.etrqc = atof(split_line[97].c_str());
+        data.etrqc = split_line[97].toDouble();
       }
 
       // LOAD_VTR1C
       if (nstr > 98) {
-        data.vtr1c = atof(split_line[98].c_str());
+        data.vtr1c = split_line[98].toDouble();
       }
 
       // LOAD_TTR1C
       if (nstr > 99) {
-        data.ttr1c = atof(split_line[99].c_str());
+        data.ttr1c = split_line[99].toDouble();
       }
 
       // LOAD_FTR1C
       if (nstr > 100) {
-        data.ftr1c = atof(split_line[100].c_str());
+        data.ftr1c = split_line[100].toDouble();
       }
 
       // LOAD_VRC1C
       if (nstr > 101) {
-        data.vrc1c = atof(split_line[101].c_str());
+        data.vrc1c = split_line[101].toDouble();
       }
 
       // LOAD_TRC1C
       if (nstr > 102) {
-        data.trc1c = atof(split_line[102].c_str());
+        data.trc1c = split_line[102].toDouble();
       }
 
       // LOAD_VTR2C
       if (nstr > 103) {
-        data.vtr2c = atof(split_line[103].c_str());
+        data.vtr2c = split_line[103].toDouble();
       }
 
       // LOAD_TTR2C
       if (nstr > 104) {
-        data.ttr2c = atof(split_line[104].c_str());
+        data.ttr2c = split_line[104].toDouble();
       }
 
       // LOAD_FTR2C
       if (nstr > 105) {
-        data.ftr2c = atof(split_line[105].c_str());
+        data.ftr2c = split_line[105].toDouble();
       }
 
       // LOAD_VRC2C
       if (nstr > 106) {
-        data.vrc2c = atof(split_line[106].c_str());
+        data.vrc2c = split_line[106].toDouble();
       }
 
       // LOAD_TRC2C
       if (nstr > 107) {
-        data.trc2c = atof(split_line[107].c_str());
+        data.trc2c = split_line[107].toDouble();
       }
 
       // LOAD_TSTALL
       if (nstr > 108) {
-        data.tstall = atof(split_line[108].c_str());
+        data.tstall = split_line[108].toDouble();
       }
 
       // LOAD_TRST
       if (nstr > 109) {
-        data.trst = atof(split_line[109].c_str());
+        data.trst = split_line[109].toDouble();
       }
 
       // LOAD_TV
       if (nstr > 110) {
-        data.tv = atof(split_line[110].c_str());
+        data.tv = split_line[110].toDouble();
       }
 
       // LOAD_TF
       if (nstr > 111) {
-        data.tf = atof(split_line[111].c_str());
+        data.tf = split_line[111].toDouble();
       }
 
       // LOAD_LFMD
       if (nstr > 112) {
-        data.lfmd = atof(split_line[112].c_str());
+        data.lfmd = split_line[112].toDouble();
       }
 
       // LOAD_COMPPF
       if (nstr > 113) {
-        data.comppf = atof(split_line[113].c_str());
+        data.comppf = split_line[113].toDouble();
       }
 
       // LOAD_VSTALL
       if (nstr > 114) {
-        data.vstall = atof(split_line[114].c_str());
+        data.vstall = split_line[114].toDouble();
       }
 
       // LOAD_RSTALL
       if (nstr > 115) {
-        data.rstall = atof(split_line[115].c_str());
+        data.rstall = split_line[115].toDouble();
       }
 
       // LOAD_XSTALL
       if (nstr > 116) {
-        data.xstall = atof(split_line[116].c_str());
+        data.xstall = split_line[116].toDouble();
       }
 
       // LOAD_LFADJ
       if (nstr > 117) {
-        data.lfadj = atof(split_line[117].c_str());
+        data.lfadj = split_line[117].toDouble();
       }
 
       // LOAD_KP1
       if (nstr > 118) {
-        data.kp1 = atof(split_line[118].c_str());
+        data.kp1 = split_line[118].toDouble();
       }
 
       // LOAD_NP1
       if (nstr > 119) {
-        data.np1 = atof(split_line[119].c_str());
+        data.np1 = split_line[119].toDouble();
       }
 
       // LOAD_KQ1
       if (nstr > 120) {
-        data.kq1 = atof(split_line[120].c_str());
+        data.kq1 = split_line[120].toDouble();
       }
 
       // LOAD_NQ1
       if (nstr > 121) {
-        data.nq1 = atof(split_line[121].c_str());
+        data.nq1 = split_line[121].toDouble();
       }
 
       // LOAD_KP2
       if (nstr > 122) {
-        data.kp2 = atof(split_line[122].c_str());
+        data.kp2 = split_line[122].toDouble();
       }
 
       // LOAD_NP2
       if (nstr > 123) {
-        data.np2 = atof(split_line[123].c_str());
+        data.np2 = split_line[123].toDouble();
       }
 
       // LOAD_KQ2
       if (nstr > 124) {
-        data.kq2 = atof(split_line[124].c_str());
+        data.kq2 = split_line[124].toDouble();
       }
 
       // LOAD_NQ2
       if (nstr > 125) {
-        data.nq2 = atof(split_line[125].c_str());
+        data.nq2 = split_line[125].toDouble();
       }
 
       // LOAD_VBRK
       if (nstr > 126) {
-        data.vbrk = atof(split_line[126].c_str());
+        data.vbrk = split_line[126].toDouble();
       }
 
       // LOAD_FRST
       if (nstr > 127) {
-        data.frst = atof(split_line[127].c_str());
+        data.frst = split_line[127].toDouble();
       }
 
       // LOAD_VRST
       if (nstr > 128) {
-        data.vrst = atof(split_line[128].c_str());
+        data.vrst = split_line[128].toDouble();
       }
 
       // LOAD_CMPKPF
       if (nstr > 129) {
-        data.cmpkpf = atof(split_line[129].c_str());
+        data.cmpkpf = split_line[129].toDouble();
       }
 
       // LOAD_CMPKQF
       if (nstr > 130) {
-        data.cmpkqf = atof(split_line[130].c_str());
+        data.cmpkqf = split_line[130].toDouble();
       }
 
       // LOAD_VC1OFF
       if (nstr > 131) {
-        data.vc1off = atof(split_line[131].c_str());
+        data.vc1off = split_line[131].toDouble();
       }
 
       // LOAD_VC2OFF
       if (nstr > 132) {
-        data.vc2off = atof(split_line[132].c_str());
+        data.vc2off = split_line[132].toDouble();
       }
 
       // LOAD_VC1ON
       if (nstr > 133) {
-        data.vc1on = atof(split_line[133].c_str());
+        data.vc1on = split_line[133].toDouble();
       }
 
       // LOAD_VC2ON
       if (nstr > 134) {
-        data.vc2on = atof(split_line[134].c_str());
+        data.vc2on = split_line[134].toDouble();
       }
 
       // LOAD_TTH
       if (nstr > 135) {
-        data.tth = atof(split_line[135].c_str());
+        data.tth = split_line[135].toDouble();
       }
 
       // LOAD_TH1T
       if (nstr > 136) {
-        data.th1t = atof(split_line[136].c_str());
+        data.th1t = split_line[136].toDouble();
       }
 
       // LOAD_TH2T
       if (nstr > 137) {
-        data.th2t = atof(split_line[137].c_str());
+        data.th2t = split_line[137].toDouble();
       }
 
       // LOAD_FUVR
       if (nstr > 138) {
-        data.fuvr = atof(split_line[138].c_str());
+        data.fuvr = split_line[138].toDouble();
       }
 
       // LOAD_UVTR1
       if (nstr > 139) {
-        data.uvtr1 = atof(split_line[139].c_str());
+        data.uvtr1 = split_line[139].toDouble();
       }
 
       // LOAD_TTR1
       if (nstr > 140) {
-        data.ttr1= atof(split_line[140].c_str());
+        data.ttr1= split_line[140].toDouble();
       }
 
       // LOAD_UVTR2
       if (nstr > 141) {
-        data.uvtr2 = atof(split_line[141].c_str());
+        data.uvtr2 = split_line[141].toDouble();
       }
 
       // LOAD_TTR2
       if (nstr > 142) {
-        data.ttr2 = atof(split_line[142].c_str());
+        data.ttr2 = split_line[142].toDouble();
       }
     }
 
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class Esst1aParser
@@ -204,7 +205,7 @@ template <class _data_struct> class Esst1aParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data,
         int g_id)
     {
@@ -221,7 +222,7 @@ template <class _data_struct> class Esst1aParser
       // EXCITER_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(EXCITER_MODEL,&stmp,g_id)) {
         data->addValue(EXCITER_MODEL, model.c_str(), g_id);
@@ -233,10 +234,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 3) {
         if (!data->getValue(EXCITER_UEL,&rval,g_id)) {
           data->addValue(EXCITER_UEL,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_UEL,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -244,10 +245,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 4) {
         if (!data->getValue(EXCITER_VOS,&rval,g_id)) {
           data->addValue(EXCITER_VOS,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VOS,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -255,10 +256,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 5) {
         if (!data->getValue(EXCITER_TR,&rval,g_id)) {
           data->addValue(EXCITER_TR,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TR,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       }
 
@@ -266,10 +267,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 6) {
         if (!data->getValue(EXCITER_VIMAX,&rval,g_id)) {
           data->addValue(EXCITER_VIMAX,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VIMAX,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       }
 
@@ -277,10 +278,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 7) {
         if (!data->getValue(EXCITER_VIMIN,&rval,g_id)) {
           data->addValue(EXCITER_VIMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VIMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       }
 
@@ -288,10 +289,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 8) {
         if (!data->getValue(EXCITER_TC,&rval,g_id)) {
           data->addValue(EXCITER_TC,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TC,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -299,10 +300,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 9) {
         if (!data->getValue(EXCITER_TB,&rval,g_id)) {
           data->addValue(EXCITER_TB,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TB,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       } 
 
@@ -310,10 +311,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 10) {
         if (!data->getValue(EXCITER_TC1,&rval,g_id)) {
           data->addValue(EXCITER_TC1,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TC1,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -321,10 +322,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 11) {
         if (!data->getValue(EXCITER_TB1,&rval,g_id)) {
           data->addValue(EXCITER_TB1,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TB1,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -332,10 +333,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 12) {
         if (!data->getValue(EXCITER_KA,&rval,g_id)) {
           data->addValue(EXCITER_KA,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KA,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -343,10 +344,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 13) {
         if (!data->getValue(EXCITER_TA,&rval,g_id)) {
           data->addValue(EXCITER_TA,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TA,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -354,10 +355,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 14) {
         if (!data->getValue(EXCITER_VAMAX,&rval,g_id)) {
           data->addValue(EXCITER_VAMAX,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VAMAX,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -365,10 +366,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 15) {
         if (!data->getValue(EXCITER_VAMIN,&rval,g_id)) {
           data->addValue(EXCITER_VAMIN,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VAMIN,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -376,10 +377,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 16) {
         if (!data->getValue(EXCITER_VRMAX,&rval,g_id)) {
           data->addValue(EXCITER_VRMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -387,10 +388,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 17) {
         if (!data->getValue(EXCITER_VRMAX,&rval,g_id)) {
           data->addValue(EXCITER_VRMAX,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMAX,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -398,10 +399,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 18) {
         if (!data->getValue(EXCITER_KC,&rval,g_id)) {
           data->addValue(EXCITER_KC,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KC,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
 
@@ -409,10 +410,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 19) {
         if (!data->getValue(EXCITER_KF,&rval,g_id)) {
           data->addValue(EXCITER_KF,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KF,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         }
       } 
 
@@ -420,10 +421,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 20) {
         if (!data->getValue(EXCITER_TF,&rval,g_id)) {
           data->addValue(EXCITER_TF,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TF,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         }
       } 
 
@@ -431,10 +432,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 21) {
         if (!data->getValue(EXCITER_KLR,&rval,g_id)) {
           data->addValue(EXCITER_KLR,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KLR,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         }
       } 
 
@@ -442,10 +443,10 @@ template <class _data_struct> class Esst1aParser
       if (nstr > 22) {
         if (!data->getValue(EXCITER_ILR,&rval,g_id)) {
           data->addValue(EXCITER_ILR,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_ILR,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         }
       } 
     }
@@ -455,21 +456,21 @@ template <class _data_struct> class Esst1aParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // EXCITOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // EXCITER_MODEL              "MODEL"                  integer
@@ -478,102 +479,102 @@ template <class _data_struct> class Esst1aParser
 
       // EXCITER_UEL
       if (nstr > 3) {
-        data.uel = atof(split_line[3].c_str());
+        data.uel = split_line[3].toDouble();
       }
 
       // EXCITER_VOS
       if (nstr > 4) {
-        data.vos = atof(split_line[4].c_str());
+        data.vos = split_line[4].toDouble();
       }
 
       // EXCITER_TR
       if (nstr > 5) {
-        data.ex_tr = atof(split_line[5].c_str());
+        data.ex_tr = split_line[5].toDouble();
       }
 
       // EXCITER_VIMAX
       if (nstr > 6) {
-        data.vimax = atof(split_line[6].c_str());
+        data.vimax = split_line[6].toDouble();
       }
 
       // EXCITER_VIMIN
       if (nstr > 7) {
-        data.vimin = atof(split_line[7].c_str());
+        data.vimin = split_line[7].toDouble();
       }
 
       // EXCITER_TC
       if (nstr > 8) {
-        data.ex_tc = atof(split_line[8].c_str());
+        data.ex_tc = split_line[8].toDouble();
       }
 
       // EXCITER_TB
       if (nstr > 9) {
-        data.ex_tb = atof(split_line[9].c_str());
+        data.ex_tb = split_line[9].toDouble();
       }
 
       // EXCITER_TC1
       if (nstr > 10) {
-        data.tc1 = atof(split_line[10].c_str());
+        data.tc1 = split_line[10].toDouble();
       }
 
       // EXCITER_TB1
       if (nstr > 11) {
-        data.tb1 = atof(split_line[11].c_str());
+        data.tb1 = split_line[11].toDouble();
       }
 
       // EXCITER_KA
       if (nstr > 12) {
-        data.ex_ka = atof(split_line[12].c_str());
+        data.ex_ka = split_line[12].toDouble();
       }
 
       // EXCITER_TA
       if (nstr > 13) {
-        data.ex_ta = atof(split_line[13].c_str());
+        data.ex_ta = split_line[13].toDouble();
       }
 
       // EXCITER_VAMAX
       if (nstr > 14) {
-        data.vamax = atof(split_line[14].c_str());
+        data.vamax = split_line[14].toDouble();
       }
 
       // EXCITER_VAMIN
       if (nstr > 15) {
-        data.vamin = atof(split_line[15].c_str());
+        data.vamin = split_line[15].toDouble();
       }
 
       // EXCITER_VRMAX
       if (nstr > 16) {
-        data.vrmax = atof(split_line[16].c_str());
+        data.vrmax = split_line[16].toDouble();
       }
 
       // EXCITER_VRMIN
       if (nstr > 17) {
-        data.vrmin = atof(split_line[17].c_str());
+        data.vrmin = split_line[17].toDouble();
       }
 
       // EXCITER_KC
       if (nstr > 18) {
-        data.ex_kc = atof(split_line[18].c_str());
+        data.ex_kc = split_line[18].toDouble();
       }
 
       // EXCITER_KF
       if (nstr > 19) {
-        data.ex_kf = atof(split_line[19].c_str());
+        data.ex_kf = split_line[19].toDouble();
       }
 
       // EXCITER_TF
       if (nstr > 20) {
-        data.ex_tf = atof(split_line[20].c_str());
+        data.ex_tf = split_line[20].toDouble();
       }
 
       // EXCITER_KLR
       if (nstr > 21) {
-        data.klr = atof(split_line[21].c_str());
+        data.klr = split_line[21].toDouble();
       }
 
       // EXCITER_ILR
       if (nstr > 22) {
-        data.ilr = atof(split_line[22].c_str());
+        data.ilr = split_line[22].toDouble();
       }
     }
 };
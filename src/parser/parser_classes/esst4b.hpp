@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class Esst4bParser
@@ -183,7 +184,7 @@ template <class _data_struct> class Esst4bParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -199,7 +200,7 @@ template <class _data_struct> class Esst4bParser
       // EXCITER_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(EXCITER_MODEL,&stmp,g_id)) {
         data->addValue(EXCITER_MODEL, model.c_str(), g_id);
@@ -211,10 +212,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 3) {
         if (!data->getValue(EXCITER_TR,&rval,g_id)) {
           data->addValue(EXCITER_TR,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TR,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -222,10 +223,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 4) {
         if (!data->getValue(EXCITER_KPR,&rval,g_id)) {
           data->addValue(EXCITER_KPR,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KPR,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -233,10 +234,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 5) {
         if (!data->getValue(EXCITER_KIR,&rval,g_id)) {
           data->addValue(EXCITER_KIR,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KIR,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       }
 
@@ -244,10 +245,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 6) {
         if (!data->getValue(EXCITER_VRMAX,&rval,g_id)) {
           data->addValue(EXCITER_VRMAX,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMAX,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       }
 
@@ -255,10 +256,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 7) {
         if (!data->getValue(EXCITER_VRMIN,&rval,g_id)) {
           data->addValue(EXCITER_VRMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       }
 
@@ -266,10 +267,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 8) {
         if (!data->getValue(EXCITER_TA,&rval,g_id)) {
           data->addValue(EXCITER_TA,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TA,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -277,10 +278,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 9) {
         if (!data->getValue(EXCITER_KPM,&rval,g_id)) {
           data->addValue(EXCITER_KPM,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KPM,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       } 
 
@@ -288,10 +289,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 10) {
         if (!data->getValue(EXCITER_KIM,&rval,g_id)) {
           data->addValue(EXCITER_KIM,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KIM,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -299,10 +300,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 11) {
         if (!data->getValue(EXCITER_VMMAX,&rval,g_id)) {
           data->addValue(EXCITER_VMMAX,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VMMAX,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -310,10 +311,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 12) {
         if (!data->getValue(EXCITER_VMMIN,&rval,g_id)) {
           data->addValue(EXCITER_VMMIN,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VMMIN,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -321,10 +322,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 13) {
         if (!data->getValue(EXCITER_KG,&rval,g_id)) {
           data->addValue(EXCITER_KG,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KG,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -332,10 +333,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 14) {
         if (!data->getValue(EXCITER_KP,&rval,g_id)) {
           data->addValue(EXCITER_KP,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KP,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -343,10 +344,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 15) {
         if (!data->getValue(EXCITER_KI,&rval,g_id)) {
           data->addValue(EXCITER_KI,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KI,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -354,10 +355,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 16) {
         if (!data->getValue(EXCITER_VBMAX,&rval,g_id)) {
           data->addValue(EXCITER_VBMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VBMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -365,10 +366,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 17) {
         if (!data->getValue(EXCITER_KC,&rval,g_id)) {
           data->addValue(EXCITER_KC,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KC,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -376,10 +377,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 18) {
         if (!data->getValue(EXCITER_XL,&rval,g_id)) {
           data->addValue(EXCITER_XL,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_XL,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
 
@@ -387,10 +388,10 @@ template <class _data_struct> class Esst4bParser
       if (nstr > 19) {
         if (!data->getValue(EXCITER_THETAP,&rval,g_id)) {
           data->addValue(EXCITER_THETAP,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_THETAP,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         }
       } 
     }
@@ -400,21 +401,21 @@ template <class _data_struct> class Esst4bParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // EXCITER_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // EXCITER_MODEL              "MODEL"                  integer
@@ -423,87 +424,87 @@ template <class _data_struct> class Esst4bParser
       int nstr = split_line.size();
       // EXCITER_TR
       if (nstr > 3) {
-        data.ex_tr = atof(split_line[3].c_str());
+        data.ex_tr = split_line[3].toDouble();
       }
 
       // EXCITER_KPR
       if (nstr > 4) {
-        data.kpr = atof(split_line[4].c_str());
+        data.kpr = split_line[4].toDouble();
       }
 
       // EXCITER_KIR
       if (nstr > 5) {
-        data.kir = atof(split_line[5].c_str());
+        data.kir = split_line[5].toDouble();
       }
 
       // EXCITER_VRMAX
       if (nstr > 6) {
-        data.vrmax = atof(split_line[6].c_str());
+        data.vrmax = split_line[6].toDouble();
       }
 
       // EXCITER_VRMIN
       if (nstr > 7) {
-        data.vrmin = atof(split_line[7].c_str());
+        data.vrmin = split_line[7].toDouble();
       }
 
       // EXCITER_TA
       if (nstr > 8) {
-        data.ex_ta = atof(split_line[8].c_str());
+        data.ex_ta = split_line[8].toDouble();
       }
 
       // EXCITER_KPM
       if (nstr > 9) {
-        data.kpm = atof(split_line[9].c_str());
+        data.kpm = split_line[9].toDouble();
       }
 
       // EXCITER_KIM
       if (nstr > 10) {
-        data.kim = atof(split_line[10].c_str());
+        data.kim = split_line[10].toDouble();
       }
 
       // EXCITER_VMMAX
       if (nstr > 11) {
-        data.vmmax = atof(split_line[11].c_str());
+        data.vmmax = split_line[11].toDouble();
       }
 
       // EXCITER_VMMIN
       if (nstr > 12) {
-        data.vmmin = atof(split_line[12].c_str());
+        data.vmmin = split_line[12].toDouble();
       }
 
       // EXCITER_KG
       if (nstr > 13) {
-        data.ex_kg = atof(split_line[13].c_str());
+        data.ex_kg = split_line[13].toDouble();
       }
 
       // EXCITER_KP
       if (nstr > 14) {
-        data.ex_kp = atof(split_line[14].c_str());
+        data.ex_kp = split_line[14].toDouble();
       }
 
       // EXCITER_KI
       if (nstr > 15) {
-        data.ex_ki = atof(split_line[15].c_str());
+        data.ex_ki = split_line[15].toDouble();
       }
 
       // EXCITER_VBMAX
       if (nstr > 16) {
-        data.vbmax = atof(split_line[16].c_str());
+        data.vbmax = split_line[16].toDouble();
       }
 
       // EXCITER_KC
       if (nstr > 17) {
-        data.ex_kc = atof(split_line[17].c_str());
+        data.ex_kc = split_line[17].toDouble();
       }
 
       // EXCITER_XL
       if (nstr > 18) {
-        data.ex_xl = atof(split_line[18].c_str());
+        data.ex_xl = split_line[18].toDouble();
       }
 
       // EXCITER_THETAP
       if (nstr > 19) {
-        data.thetap = atof(split_line[19].c_str());
+        data.thetap = split_line[19].toDouble();
       }
     }
 };
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class FrqtpatParser
@@ -117,7 +118,7 @@ template <class _data_struct> class FrqtpatParser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data)
     {
       double rval;
@@ -136,7 +137,7 @@ template <class _data_struct> class FrqtpatParser
       // RELAY_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(RELAY_MODEL,&stmp,r_id)) {
         data->addValue(RELAY_MODEL, model.c_str(), r_id);
@@ -146,7 +147,7 @@ template <class _data_struct> class FrqtpatParser
 
       // RELAY_GENID
       if (nstr > 4) {
-        model = util.clean2Char(split_line[4]);
+        model = split_line[4].tag();
         if (!data->getValue(RELAY_GENID,&stmp,r_id)) {
           data->addValue(RELAY_GENID, model.c_str(), r_id);
         } else {
@@ -157,54 +158,54 @@ template <class _data_struct> class FrqtpatParser
       // RELAY_MINS
       if (nstr > 1) {
         if (!data->getValue(RELAY_MINS,&ival,r_id)) {
-          data->addValue(RELAY_MINS, atoi(split_line[0].c_str()), r_id);
+          data->addValue(RELAY_MINS, split_line[0].toInt(), r_id);
         } else {
-          data->setValue(RELAY_MINS, atoi(split_line[0].c_str()), r_id);
+          data->setValue(RELAY_MINS, split_line[0].toInt(), r_id);
         }
       }
 
       // RELAY_FREBUS
       if (nstr > 2) {
         if (!data->getValue(RELAY_FREBUS,&ival,r_id)) {
-          data->addValue(RELAY_FREBUS, atoi(split_line[2].c_str()), r_id);
+          data->addValue(RELAY_FREBUS, split_line[2].toInt(), r_id);
         } else {
-          data->setValue(RELAY_FREBUS, atoi(split_line[2].c_str()), r_id);
+          data->setValue(RELAY_FREBUS, split_line[2].toInt(), r_id);
         }
       }
 
       // RELAY_FL
       if (nstr > 5) {
         if (!data->getValue(RELAY_FL,&rval,r_id)) {
-          data->addValue(RELAY_FL, atof(split_line[5].c_str()), r_id);
+          data->addValue(RELAY_FL, split_line[5].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_FL, atof(split_line[5].c_str()), r_id);
+          data->setValue(RELAY_FL, split_line[5].toDouble(), r_id);
         }
       }
 
       // RELAY_FU
       if (nstr > 6) {
         if (!data->getValue(RELAY_FU,&rval,r_id)) {
-          data->addValue(RELAY_FU, atof(split_line[6].c_str()), r_id);
+          data->addValue(RELAY_FU, split_line[6].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_FU, atof(split_line[6].c_str()), r_id);
+          data->setValue(RELAY_FU, split_line[6].toDouble(), r_id);
         }
       }
 
       // RELAY_TP
       if (nstr > 7) {
         if (!data->getValue(RELAY_TP,&rval,r_id)) {
-          data->addValue(RELAY_TP, atof(split_line[7].c_str()), r_id);
+          data->addValue(RELAY_TP, split_line[7].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_TP, atof(split_line[7].c_str()), r_id);
+          data->setValue(RELAY_TP, split_line[7].toDouble(), r_id);
         }
       }
 
       // RELAY_TB
       if (nstr > 8) {
         if (!data->getValue(RELAY_TB,&rval,r_id)) {
-          data->addValue(RELAY_TB, atof(split_line[8].c_str()), r_id);
+          data->addValue(RELAY_TB, split_line[8].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_TB, atof(split_line[8].c_str()), r_id);
+          data->setValue(RELAY_TB, split_line[8].toDouble(), r_id);
         }
       }
     }
@@ -214,16 +215,16 @@ template <class _data_struct> class FrqtpatParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // RELAY_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[3].c_str());
+      o_idx = split_line[3].toInt();
       data.bus_id = o_idx;
 
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // RELAY_MODEL              "MODEL"                  integer
@@ -232,38 +233,38 @@ template <class _data_struct> class FrqtpatParser
 
       // RELAY_GENID
       if (nstr > 4) {
-        sval = util.clean2Char(split_line[4]);
+        sval = split_line[4].tag();
         strcpy(data.tag, sval.c_str());
       }
 
       // RELAY_MINS
       if (nstr > 1) {
-        data.mins = atoi(split_line[0].c_str());
+        data.mins = split_line[0].toInt();
       }
 
       // RELAY_FREBUS
       if (nstr > 2) {
-        data.frebus = atoi(split_line[2].c_str());
+        data.frebus = split_line[2].toInt();
       }
 
       // RELAY_FL
       if (nstr > 5) {
-        data.fl = atof(split_line[5].c_str());
+        data.fl = split_line[5].toDouble();
       }
 
       // RELAY_FU
       if (nstr > 6) {
-        data.fu = atof(split_line[6].c_str());
+        data.fu = split_line[6].toDouble();
       }
 
       // RELAY_TP
       if (nstr > 7) {
-        data.tp = atof(split_line[7].c_str());
+        data.tp = split_line[7].toDouble();
       }
 
       // RELAY_TB
       if (nstr > 8) {
-        data.tb = atof(split_line[8].c_str());
+        data.tb = split_line[8].toDouble();
       }
     }
 };
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class GdformParser
@@ -147,7 +148,7 @@ template <class _data_struct> class GdformParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -155,7 +156,7 @@ template <class _data_struct> class GdformParser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL, &stmp, g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -166,90 +167,90 @@ template <class _data_struct> class GdformParser
       // GENERATOR_XL
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_XL,&rval,g_id)) {
-          data->addValue(GENERATOR_XL, atof(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_XL, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_XL, atof(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_XL, split_line[3].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_VSET
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_VSET,&rval,g_id)) {
-          data->addValue(GENERATOR_VSET, atof(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_VSET, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_VSET, atof(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_VSET, split_line[4].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_MQ
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_MQ,&rval,g_id)) {
-          data->addValue(GENERATOR_MQ, atof(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_MQ, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_MQ, atof(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_MQ, split_line[5].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KPV                           float
       if (nstr > 6) {
         if (!data->getValue(GENERATOR_KPV,&rval,g_id)) {
-          data->addValue(GENERATOR_KPV, atof(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_KPV, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KPV, atof(split_line[6].c_str()), g_id);
+          data->setValue(GENERATOR_KPV, split_line[6].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KIV                           float
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_KIV,&rval,g_id)) {
-          data->addValue(GENERATOR_KIV, atof(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_KIV, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KIV, atof(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_KIV, split_line[7].toDouble(), g_id);
         }
       }
 
       // GENERATOR_EMAX
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_EMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_EMAX, atof(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_EMAX, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_EMAX, atof(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_EMAX, split_line[8].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_EMIN
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_EMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_EMIN, atof(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_EMIN, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_EMIN, atof(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_EMIN, split_line[9].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_MP
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_MP,&rval,g_id)) {
-          data->addValue(GENERATOR_MP, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_MP, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_MP, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_MP, split_line[10].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KPPMAX
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_KPPMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_KPPMAX, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_KPPMAX, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KPPMAX, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_KPPMAX, split_line[11].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KIPMAX
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_KIPMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_XL, atof(split_line[12].c_str()), g_id);
+          data->addValue(GENERATOR_XL, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_XL, atof(split_line[12].c_str()), g_id);
+          data->setValue(GENERATOR_XL, split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -257,28 +258,28 @@ template <class _data_struct> class GdformParser
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_PSET,&rval,g_id)) {
           data->addValue(GENERATOR_PSET,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_PSET,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_PMAX
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_PMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_PMAX, atof(split_line[14].c_str()), g_id);
+          data->addValue(GENERATOR_PMAX, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_PMAX, atof(split_line[14].c_str()), g_id);
+          data->setValue(GENERATOR_PMAX, split_line[14].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_PMIN
       if (nstr > 15) {
         if (!data->getValue(GENERATOR_PMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_PMIN, atof(split_line[15].c_str()), g_id);
+          data->addValue(GENERATOR_PMIN, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_PMIN, atof(split_line[15].c_str()), g_id);
+          data->setValue(GENERATOR_PMIN, split_line[15].toDouble(), g_id);
         }
       } 
     }
@@ -288,21 +289,21 @@ template <class _data_struct> class GdformParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -311,67 +312,67 @@ template <class _data_struct> class GdformParser
       int nstr = split_line.size();
       // GENERATOR_XL
       if (nstr > 3) {
-        data.gn_xl = atof(split_line[3].c_str());
+        data.gn_xl = split_line[3].toDouble();
       } 
 
       // GENERATOR_VSET
       if (nstr > 4) {
-        data.vset = atof(split_line[4].c_str());
+        data.vset = split_line[4].toDouble();
       } 
 
       // GENERATOR_MQ
       if (nstr > 5) {
-        data.mq = atof(split_line[5].c_str());
+        data.mq = split_line[5].toDouble();
       } 
 
       // GENERATOR_KPV                           float
       if (nstr > 6) {
-        data.kpv = atof(split_line[6].c_str());
+        data.kpv = split_line[6].toDouble();
       } 
 
       // GENERATOR_KIV                           float
       if (nstr > 7) {
-        data.kiv = atof(split_line[7].c_str());
+        data.kiv = split_line[7].toDouble();
       }
 
       // GENERATOR_EMAX
       if (nstr > 8) {
-        data.emax = atof(split_line[8].c_str());
+        data.emax = split_line[8].toDouble();
       } 
 
       // GENERATOR_EMIN
       if (nstr > 9) {
-        data.emin = atof(split_line[9].c_str());
+        data.emin = split_line[9].toDouble();
       } 
 
       // GENERATOR_MP
       if (nstr > 10) {
-        data.mp = atof(split_line[10].c_str());
+        data.mp = split_line[10].toDouble();
       } 
 
       // GENERATOR_KPPMAX
       if (nstr > 11) {
-        data.kppmax = atof(split_line[11].c_str());
+        data.kppmax = split_line[11].toDouble();
       } 
 
       // GENERATOR_KIPMAX
       if (nstr > 12) {
-        data.kipmax = atof(split_line[12].c_str());
+        data.kipmax = split_line[12].toDouble();
       } 
 
       // GENERATOR_PSET
       if (nstr > 13) {
-        data.pset = atof(split_line[13].c_str());
+        data.pset = split_line[13].toDouble();
       } 
 
       // GENERATOR_PMAX
       if (nstr > 14) {
-        data.pmax = atof(split_line[14].c_str());
+        data.pmax = split_line[14].toDouble();
       } 
 
       // GENERATOR_PMIN
       if (nstr > 15) {
-        data.pmin = atof(split_line[15].c_str());
+        data.pmin = split_line[15].toDouble();
       } 
     }
 };
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class GenclsParser
@@ -83,7 +84,7 @@ template <class _data_struct> class GenclsParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -91,7 +92,7 @@ template <class _data_struct> class GenclsParser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL,&stmp,g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -103,10 +104,10 @@ template <class _data_struct> class GenclsParser
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_INERTIA_CONSTANT_H,&rval,g_id)) {
           data->addValue(GENERATOR_INERTIA_CONSTANT_H,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_INERTIA_CONSTANT_H,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -114,20 +115,20 @@ template <class _data_struct> class GenclsParser
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_DAMPING_COEFFICIENT_0,&rval,g_id)) {
           data->addValue(GENERATOR_DAMPING_COEFFICIENT_0,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_DAMPING_COEFFICIENT_0,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       }
       // GENERATOR_TRANSIENT_REACTANCE               float
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_TRANSIENT_REACTANCE,&rval,g_id)) {
           data->addValue(GENERATOR_TRANSIENT_REACTANCE,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_TRANSIENT_REACTANCE,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       }
     }
@@ -137,21 +138,21 @@ template <class _data_struct> class GenclsParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -160,17 +161,17 @@ template <class _data_struct> class GenclsParser
       int nstr = split_line.size();
       // GENERATOR_INERTIA_CONSTANT_H                           float
       if (nstr > 3) {
-        data.inertia = atof(split_line[3].c_str());
+        data.inertia = split_line[3].toDouble();
       } 
 
       // GENERATOR_DAMPING_COEFFICIENT_0                           float
       if (nstr > 4) {
-        data.damping = atof(split_line[4].c_str());
+        data.damping = split_line[4].toDouble();
       }
 
       // GENERATOR_TRANSIENT_REACTANCE                             float
       if (nstr > 5) {
-        data.reactance = atof(split_line[5].c_str());
+        data.reactance = split_line[5].toDouble();
       }
     }
 };
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class IeelblParser
@@ -157,7 +158,7 @@ template <class _data_struct> class IeelblParser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int l_id)
     {
       double rval;
@@ -167,7 +168,7 @@ template <class _data_struct> class IeelblParser
       // LOAD_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(LOAD_MODEL,&stmp,l_id)) {
         data->addValue(LOAD_MODEL, model.c_str(), l_id);
@@ -178,126 +179,126 @@ template <class _data_struct> class IeelblParser
       // LOAD_A1
       if (nstr > 3) {
         if (!data->getValue(LOAD_A1,&ival,l_id)) {
-          data->addValue(LOAD_A1, atof(split_line[3].c_str()), l_id);
+          data->addValue(LOAD_A1, split_line[3].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A1, atof(split_line[3].c_str()), l_id);
+          data->setValue(LOAD_A1, split_line[3].toDouble(), l_id);
         }
       }
 
       // LOAD_A2
       if (nstr > 4) {
         if (!data->getValue(LOAD_A2,&rval,l_id)) {
-          data->addValue(LOAD_A2, atof(split_line[4].c_str()), l_id);
+          data->addValue(LOAD_A2, split_line[4].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A2, atof(split_line[4].c_str()), l_id);
+          data->setValue(LOAD_A2, split_line[4].toDouble(), l_id);
         }
       } 
 
       // LOAD_A3
       if (nstr > 5) {
         if (!data->getValue(LOAD_A3,&rval,l_id)) {
-          data->addValue(LOAD_A3, atof(split_line[5].c_str()), l_id);
+          data->addValue(LOAD_A3, split_line[5].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A3, atof(split_line[5].c_str()), l_id);
+          data->setValue(LOAD_A3, split_line[5].toDouble(), l_id);
         }
       } 
 
       // LOAD_A4
       if (nstr > 6) {
         if (!data->getValue(LOAD_A4,&rval,l_id)) {
-          data->addValue(LOAD_A4, atof(split_line[6].c_str()), l_id);
+          data->addValue(LOAD_A4, split_line[6].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A4, atof(split_line[6].c_str()), l_id);
+          data->setValue(LOAD_A4, split_line[6].toDouble(), l_id);
         }
       } 
 
       // LOAD_A5
       if (nstr > 7) {
         if (!data->getValue(LOAD_A5,&rval,l_id)) {
-          data->addValue(LOAD_A5, atof(split_line[7].c_str()), l_id);
+          data->addValue(LOAD_A5, split_line[7].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A5, atof(split_line[7].c_str()), l_id);
+          data->setValue(LOAD_A5, split_line[7].toDouble(), l_id);
         }
       } 
 
       // LOAD_A6
       if (nstr > 8) {
         if (!data->getValue(LOAD_A6,&rval,l_id)) {
-          data->addValue(LOAD_A6, atof(split_line[8].c_str()), l_id);
+          data->addValue(LOAD_A6, split_line[8].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A6, atof(split_line[8].c_str()), l_id);
+          data->setValue(LOAD_A6, split_line[8].toDouble(), l_id);
         }
       } 
 
       // LOAD_A7
       if (nstr > 9) {
         if (!data->getValue(LOAD_A7,&rval,l_id)) {
-          data->addValue(LOAD_A7, atof(split_line[9].c_str()), l_id);
+          data->addValue(LOAD_A7, split_line[9].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A7, atof(split_line[9].c_str()), l_id);
+          data->setValue(LOAD_A7, split_line[9].toDouble(), l_id);
         }
       } 
 
       // LOAD_A8
       if (nstr > 10) {
         if (!data->getValue(LOAD_A8,&rval,l_id)) {
-          data->addValue(LOAD_A8, atof(split_line[10].c_str()), l_id);
+          data->addValue(LOAD_A8, split_line[10].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A8, atof(split_line[10].c_str()), l_id);
+          data->setValue(LOAD_A8, split_line[10].toDouble(), l_id);
         }
       } 
 
       // LOAD_N1
       if (nstr > 11) {
         if (!data->getValue(LOAD_N1,&rval,l_id)) {
-          data->addValue(LOAD_N1, atof(split_line[11].c_str()), l_id);
+          data->addValue(LOAD_N1, split_line[11].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N1, atof(split_line[11].c_str()), l_id);
+          data->setValue(LOAD_N1, split_line[11].toDouble(), l_id);
         }
       } 
 
       // LOAD_N2
       if (nstr > 12) {
         if (!data->getValue(LOAD_N2,&rval,l_id)) {
-          data->addValue(LOAD_N2, atof(split_line[12].c_str()), l_id);
+          data->addValue(LOAD_N2, split_line[12].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N2, atof(split_line[12].c_str()), l_id);
+          data->setValue(LOAD_N2, split_line[12].toDouble(), l_id);
         }
       } 
 
       // LOAD_N3
       if (nstr > 13) {
         if (!data->getValue(LOAD_N3,&rval,l_id)) {
-          data->addValue(LOAD_N3, atof(split_line[13].c_str()), l_id);
+          data->addValue(LOAD_N3, split_line[13].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N3, atof(split_line[13].c_str()), l_id);
+          data->setValue(LOAD_N3, split_line[13].toDouble(), l_id);
         }
       } 
 
       // LOAD_N4
       if (nstr > 14) {
         if (!data->getValue(LOAD_N4,&rval,l_id)) {
-          data->addValue(LOAD_N4, atof(split_line[14].c_str()), l_id);
+          data->addValue(LOAD_N4, split_line[14].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N4, atof(split_line[14].c_str()), l_id);
+          data->setValue(LOAD_N4, split_line[14].toDouble(), l_id);
         }
       } 
 
       // LOAD_N5
       if (nstr > 15) {
         if (!data->getValue(LOAD_N5,&rval,l_id)) {
-          data->addValue(LOAD_N5, atof(split_line[15].c_str()), l_id);
+          data->addValue(LOAD_N5, split_line[15].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N5, atof(split_line[15].c_str()), l_id);
+          data->setValue(LOAD_N5, split_line[15].toDouble(), l_id);
         }
       } 
 
       // LOAD_N6
       if (nstr > 16) {
         if (!data->getValue(LOAD_N6,&rval,l_id)) {
-          data->addValue(LOAD_N6, atof(split_line[16].c_str()), l_id);
+          data->addValue(LOAD_N6, split_line[16].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_N6, atof(split_line[16].c_str()), l_id);
+          data->setValue(LOAD_N6, split_line[16].toDouble(), l_id);
         }
       } 
     }
@@ -307,11 +308,11 @@ template <class _data_struct> class IeelblParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // LOAD_MODEL              "MODEL"                  integer
@@ -320,77 +321,77 @@ template <class _data_struct> class IeelblParser
 
       // LOAD_ID
       if (nstr > 2) {
-        sval = util.clean2Char(split_line[2]);
+        sval = split_line[2].tag();
         strcpy(data.id, sval.c_str());
       }
 
       // LOAD_A1
       if (nstr > 3) {
-        data.a1 = atof(split_line[3].c_str());
+        data.a1 = split_line[3].toDouble();
       }
 
       // LOAD_A2
       if (nstr > 4) {
-        data.a2 = atof(split_line[4].c_str());
+        data.a2 = split_line[4].toDouble();
       }
       // LOAD_A3
       if (nstr > 5) {
-        data.a3 = atof(split_line[5].c_str());
+        data.a3 = split_line[5].toDouble();
       }
 
       // LOAD_A4
       if (nstr > 6) {
-        data.a4 = atof(split_line[6].c_str());
+        data.a4 = split_line[6].toDouble();
       }
 
       // LOAD_A5
       if (nstr > 7) {
-        data.a5 = atof(split_line[7].c_str());
+        data.a5 = split_line[7].toDouble();
       }
 
       // LOAD_A6
       if (nstr > 8) {
-        data.a6 = atof(split_line[8].c_str());
+        data.a6 = split_line[8].toDouble();
       }
 
       // LOAD_A7
       if (nstr > 9) {
-        data.a7 = atof(split_line[9].c_str());
+        data.a7 = split_line[9].toDouble();
       }
 
       // LOAD_A8
       if (nstr > 10) {
-        data.a8 = atof(split_line[10].c_str());
+        data.a8 = split_line[10].toDouble();
       }
 
       // LOAD_N1
       if (nstr > 11) {
-        data.n1 = atof(split_line[11].c_str());
+        data.n1 = split_line[11].toDouble();
       }
 
       // LOAD_N2
       if (nstr > 12) {
-        data.n2 = atof(split_line[12].c_str());
+        data.n2 = split_line[12].toDouble();
       }
 
       // LOAD_N3
       if (nstr > 13) {
-        data.n3 = atof(split_line[13].c_str());
+        data.n3 = split_line[13].toDouble();
       }
 
       // LOAD_N4
       if (nstr > 14) {
-        data.n4 = atof(split_line[14].c_str());
+        data.n4 = split_line[14].toDouble();
       }
 
       // LOAD_N5
       if (nstr > 15) {
-        data.n5 = atof(split_line[15].c_str());
+        data.n5 = split_line[15].toDouble();
       }
 
       // LOAD_N6
       if (nstr > 16) {
-        data.n6 = atof(split_line[16].c_str());
+        data.n6 = split_line[16].toDouble();
       }
     }
 };
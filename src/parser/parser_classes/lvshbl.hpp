@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class LvshblParser
@@ -152,7 +153,7 @@ template <class _data_struct> class LvshblParser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data)
     {
       double rval;
@@ -171,7 +172,7 @@ template <class _data_struct> class LvshblParser
       // RELAY_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(RELAY_MODEL,&stmp,r_id)) {
         data->addValue(RELAY_MODEL, model.c_str(), r_id);
@@ -181,7 +182,7 @@ template <class _data_struct> class LvshblParser
 
       // RELAY_LID
       if (nstr > 2) {
-        model = util.clean2Char(split_line[2]);
+        model = split_line[2].tag();
         if (!data->getValue(RELAY_LID,&stmp,r_id)) {
           data->addValue(RELAY_LID, model.c_str(), r_id);
         } else {
@@ -192,99 +193,99 @@ template <class _data_struct> class LvshblParser
       // RELAY_JBUS
       if (nstr > 3) {
         if (!data->getValue(RELAY_JBUS,&ival,r_id)) {
-          data->addValue(RELAY_JBUS, atoi(split_line[3].c_str()), r_id);
+          data->addValue(RELAY_JBUS, split_line[3].toInt(), r_id);
         } else {
-          data->setValue(RELAY_JBUS, atoi(split_line[3].c_str()), r_id);
+          data->setValue(RELAY_JBUS, split_line[3].toInt(), r_id);
         }
       }
 
       // RELAY_V1
       if (nstr > 4) {
         if (!data->getValue(RELAY_V1,&rval,r_id)) {
-          data->addValue(RELAY_V1, atof(split_line[4].c_str()), r_id);
+          data->addValue(RELAY_V1, split_line[4].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_V1, atof(split_line[4].c_str()), r_id);
+          data->setValue(RELAY_V1, split_line[4].toDouble(), r_id);
         }
       }
 
       // RELAY_T1
       if (nstr > 5) {
         if (!data->getValue(RELAY_T1,&rval,r_id)) {
-          data->addValue(RELAY_T1, atof(split_line[5].c_str()), r_id);
+          data->addValue(RELAY_T1, split_line[5].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_T1, atof(split_line[5].c_str()), r_id);
+          data->setValue(RELAY_T1, split_line[5].toDouble(), r_id);
         }
       }
 
       // RELAY_F1
       if (nstr > 6) {
         if (!data->getValue(RELAY_F1,&rval,r_id)) {
-          data->addValue(RELAY_F1, atof(split_line[6].c_str()), r_id);
+          data->addValue(RELAY_F1, split_line[6].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_F1, atof(split_line[6].c_str()), r_id);
+          data->setValue(RELAY_F1, split_line[6].toDouble(), r_id);
         }
       }
 
       // RELAY_V2
       if (nstr > 7) {
         if (!data->getValue(RELAY_V2,&rval,r_id)) {
-          data->addValue(RELAY_V2, atof(split_line[7].c_str()), r_id);
+          data->addValue(RELAY_V2, split_line[7].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_V2, atof(split_line[7].c_str()), r_id);
+          data->setValue(RELAY_V2, split_line[7].toDouble(), r_id);
         }
       }
 
       // RELAY_T2
       if (nstr > 8) {
         if (!data->getValue(RELAY_T2,&rval,r_id)) {
-          data->addValue(RELAY_T2, atof(split_line[8].c_str()), r_id);
+          data->addValue(RELAY_T2, split_line[8].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_T2, atof(split_line[8].c_str()), r_id);
+          data->setValue(RELAY_T2, split_line[8].toDouble(), r_id);
         }
       }
 
       // RELAY_F2
       if (nstr > 9) {
         if (!data->getValue(RELAY_F2,&rval,r_id)) {
-          data->addValue(RELAY_F2, atof(split_line[9].c_str()), r_id);
+          data->addValue(RELAY_F2, split_line[9].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_F2, atof(split_line[9].c_str()), r_id);
+          data->setValue(RELAY_F2, split_line[9].toDouble(), r_id);
         }
       }
 
       // RELAY_V3
       if (nstr > 10) {
         if (!data->getValue(RELAY_V3,&rval,r_id)) {
-          data->addValue(RELAY_V3, atof(split_line[10].c_str()), r_id);
+          data->addValue(RELAY_V3, split_line[10].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_V3, atof(split_line[10].c_str()), r_id);
+          data->setValue(RELAY_V3, split_line[10].toDouble(), r_id);
         }
       }
 
       // RELAY_T3
       if (nstr > 11) {
         if (!data->getValue(RELAY_T3,&rval,r_id)) {
-          data->addValue(RELAY_T3, atof(split_line[11].c_str()), r_id);
+          data->addValue(RELAY_T3, split_line[11].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_T3, atof(split_line[11].c_str()), r_id);
+          data->setValue(RELAY_T3, split_line[11].toDouble(), r_id);
         }
       }
 
       // RELAY_F3
       if (nstr > 12) {
         if (!data->getValue(RELAY_F3,&rval,r_id)) {
-          data->addValue(RELAY_F3, atof(split_line[12].c_str()), r_id);
+          data->addValue(RELAY_F3, split_line[12].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_F3, atof(split_line[12].c_str()), r_id);
+          data->setValue(RELAY_F3, split_line[12].toDouble(), r_id);
         }
       }
 
       // RELAY_TB
       if (nstr > 13) {
         if (!data->getValue(RELAY_TB,&rval,r_id)) {
-          data->addValue(RELAY_TB, atof(split_line[13].c_str()), r_id);
+          data->addValue(RELAY_TB, split_line[13].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_TB, atof(split_line[13].c_str()), r_id);
+          data->setValue(RELAY_TB, split_line[13].toDouble(), r_id);
         }
       }
     }
@@ -294,16 +295,16 @@ template <class _data_struct> class LvshblParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // RELAY_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // RELAY_MODEL              "MODEL"                  integer
@@ -312,63 +313,63 @@ template <class _data_struct> class LvshblParser
 
       // RELAY_LID
       if (nstr > 2) {
-        sval = util.clean2Char(split_line[2]);
+        sval = split_line[2].tag();
           strcpy(data.tag, sval.c_str());
       }
 
       // RELAY_JBUS
       if (nstr > 3) {
-        data.jbus = atoi(split_line[3].c_str());
+        data.jbus = split_line[3].toInt();
       }
 
       // RELAY_V1
       if (nstr > 4) {
-        data.v1 = atof(split_line[4].c_str());
+        data.v1 = split_line[4].toDouble();
       }
 
       // RELAY_T1
       if (nstr > 5) {
-        data.t1 = atof(split_line[5].c_str());
+        data.t1 = split_line[5].toDouble();
       }
 
       // RELAY_F1
       if (nstr > 6) {
-        data.f1 = atof(split_line[6].c_str());
+        data.f1 = split_line[6].toDouble();
       }
 
       // RELAY_V2
       if (nstr > 7) {
-        data.v2 = atof(split_line[7].c_str());
+        data.v2 = split_line[7].toDouble();
       }
 
       // RELAY_T2
       if (nstr > 8) {
-        data.t2 = atof(split_line[8].c_str());
+        data.t2 = split_line[8].toDouble();
       }
 
       // RELAY_F2
       if (nstr > 9) {
-        data.f2 = atof(split_line[9].c_str());
+        data.f2 = split_line[9].toDouble();
       }
 
       // RELAY_V3
       if (nstr > 10) {
-        data.v3 = atof(split_line[10].c_str());
+        data.v3 = split_line[10].toDouble();
       }
 
       // RELAY_T3
       if (nstr > 11) {
-        data.t3 = atof(split_line[11].c_str());
+        data.t3 = split_line[11].toDouble();
       }
 
       // RELAY_F3
       if (nstr > 12) {
-        data.f3 = atof(split_line[12].c_str());
+        data.f3 = split_line[12].toDouble();
       }
 
       // RELAY_TB
       if (nstr > 13) {
-        data.tb = atof(split_line[13].c_str());
+        data.tb = split_line[13].toDouble();
       }
     }
 };
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class PsssimParser
@@ -172,7 +173,7 @@ template <class _data_struct> class PsssimParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -188,7 +189,7 @@ template <class _data_struct> class PsssimParser
       // PSSSIM_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(PSS_MODEL,&stmp,g_id)) {
         data->addValue(PSS_MODEL, model.c_str(), g_id);
@@ -201,10 +202,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 3) {
         if (!data->getValue(PSSSIM_INPUTTYPE,&ival,g_id)) {
           data->addValue(PSSSIM_INPUTTYPE,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_INPUTTYPE,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -212,10 +213,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 4) {
         if (!data->getValue(PSSSIM_BUS1,&ival,g_id)) {
           data->addValue(PSSSIM_BUS1,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS1,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -223,10 +224,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 5) {
         if (!data->getValue(PSSSIM_BUS2,&ival,g_id)) {
           data->addValue(PSSSIM_BUS2,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS2,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       } 
 
@@ -234,10 +235,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 6) {
         if (!data->getValue(PSSSIM_BUS3,&ival,g_id)) {
           data->addValue(PSSSIM_BUS3,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS3,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       } 
 
@@ -245,10 +246,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 7) {
         if (!data->getValue(PSSSIM_BUS4,&ival,g_id)) {
           data->addValue(PSSSIM_BUS4,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS4,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       } 
 
@@ -256,10 +257,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 8) {
         if (!data->getValue(PSSSIM_BUS5,&ival,g_id)) {
           data->addValue(PSSSIM_BUS5,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS5,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -267,10 +268,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 9) {
         if (!data->getValue(PSSSIM_BUS6,&ival,g_id)) {
           data->addValue(PSSSIM_BUS6,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_BUS6,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       }
 
@@ -278,10 +279,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 10) {
         if (!data->getValue(PSSSIM_GAINK,&rval,g_id)) {
           data->addValue(PSSSIM_GAINK,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_GAINK,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -289,10 +290,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 11) {
         if (!data->getValue(PSSSIM_TW,&rval,g_id)) {
           data->addValue(PSSSIM_TW,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_TW,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -300,10 +301,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 12) {
         if (!data->getValue(PSSSIM_T1,&rval,g_id)) {
           data->addValue(PSSSIM_T1,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_T1,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -311,10 +312,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 13) {
         if (!data->getValue(PSSSIM_T2,&rval,g_id)) {
           data->addValue(PSSSIM_T2,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_T2,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -322,10 +323,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 14) {
         if (!data->getValue(PSSSIM_T3,&rval,g_id)) {
           data->addValue(PSSSIM_T3,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_T3,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -333,10 +334,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 15) {
         if (!data->getValue(PSSSIM_T4,&rval,g_id)) {
           data->addValue(PSSSIM_T4,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_T4,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -344,10 +345,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 16) {
         if (!data->getValue(PSSSIM_MAXOUT,&rval,g_id)) {
           data->addValue(PSSSIM_MAXOUT,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_MAXOUT,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -355,10 +356,10 @@ template <class _data_struct> class PsssimParser
       if (nstr > 17) {
         if (!data->getValue(PSSSIM_MINOUT,&rval,g_id)) {
           data->addValue(PSSSIM_MINOUT,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(PSSSIM_MINOUT,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
     }
@@ -368,21 +369,21 @@ template <class _data_struct> class PsssimParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // PSSSIM_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // PSSSIM_MODEL              "MODEL"                  integer
@@ -391,77 +392,77 @@ template <class _data_struct> class PsssimParser
       int nstr = split_line.size();
       // PSSSIM_INPUTTYPE
       if (nstr > 3) {
-        data.psssim_inputtype= atof(split_line[3].c_str());
+        data.psssim_inputtype= split_line[3].toDouble();
       }
 
       // PSSSIM_BUS1
       if (nstr > 4) {
-        data.psssim_bus1= atof(split_line[4].c_str());
+        data.psssim_bus1= split_line[4].toDouble();
       }
 
       // PSSSIM_BUS2
       if (nstr > 5) {
-        data.psssim_bus2 = atof(split_line[5].c_str());
+        data.psssim_bus2 = split_line[5].toDouble();
       }
 
       // PSSSIM_BUS3
       if (nstr > 6) {
-        data.psssim_bus3 = atof(split_line[6].c_str());
+        data.psssim_bus3 = split_line[6].toDouble();
       }
 
       // PSSSIM_BUS4
       if (nstr > 7) {
-        data.psssim_bus4 = atof(split_line[7].c_str());
+        data.psssim_bus4 = split_line[7].toDouble();
       }
 
       // PSSSIM_BUS5
       if (nstr > 8) {
-        data.psssim_bus5 = atof(split_line[8].c_str());
+        data.psssim_bus5 = split_line[8].toDouble();
       }
 
       // PSSSIM_BUS6
       if (nstr > 9) {
-        data.psssim_bus6 = atof(split_line[9].c_str());
+        data.psssim_bus6 = split_line[9].toDouble();
       }
 
       // PSSSIM_GAINK
       if (nstr > 10) {
-        data.psssim_gaink = atof(split_line[10].c_str());
+        data.psssim_gaink = split_line[10].toDouble();
       }
 
       // PSSSIM_TW
       if (nstr > 11) {
-        data.psssim_tw = atof(split_line[11].c_str());
+        data.psssim_tw = split_line[11].toDouble();
       }
 
       // PSSSIM_T1
       if (nstr > 12) {
-        data.psssim_t1 = atof(split_line[12].c_str());
+        data.psssim_t1 = split_line[12].toDouble();
       }
 
       // PSSSIM_T2
       if (nstr > 13) {
-        data.psssim_t2 = atof(split_line[13].c_str());
+        data.psssim_t2 = split_line[13].toDouble();
       }
 
       // PSSSIM_T3
       if (nstr > 14) {
-        data.psssim_t3 = atof(split_line[14].c_str());
+        data.psssim_t3 = split_line[14].toDouble();
       }
 
       // PSSSIM_T4
       if (nstr > 15) {
-        data.psssim_t4 = atof(split_line[15].c_str());
+        data.psssim_t4 = split_line[15].toDouble();
       }
 
       // PSSSIM_MAXOUT
       if (nstr > 16) {
-        data.psssim_maxout = atof(split_line[16].c_str());
+        data.psssim_maxout = split_line[16].toDouble();
       }
 
       // PSSSIM_MINOUT
       if (nstr > 17) {
-        data.psssim_minout = atof(split_line[17].c_str());
+        data.psssim_minout = split_line[17].toDouble();
       }
 
     }
@@ -12,6 +12,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
 #include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
 namespace gridpack {
 namespace parser {
 template <class _data_struct> class WshygpParser
@@ -274,7 +275,7 @@ template <class _data_struct> class WshygpParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const RecordTokenizer &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -290,7 +291,7 @@ template <class _data_struct> class WshygpParser
       // GOVERNOR_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted();
       util.toUpper(model);
       if (!data->getValue(GOVERNOR_MODEL,&stmp,g_id)) {
         data->addValue(GOVERNOR_MODEL, model.c_str(), g_id);
@@ -302,10 +303,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 3) {
         if (!data->getValue(GOVERNOR_DB1,&rval,g_id)) {
           data->addValue(GOVERNOR_DB1,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DB1,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -313,10 +314,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 4) {
         if (!data->getValue(GOVERNOR_ERR,&rval,g_id)) {
           data->addValue(GOVERNOR_ERR,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_ERR,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -324,10 +325,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 5) {
         if (!data->getValue(GOVERNOR_TD,&rval,g_id)) {
           data->addValue(GOVERNOR_TD,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TD,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       } 
 
@@ -335,10 +336,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 6) {
         if (!data->getValue(GOVERNOR_KI,&rval,g_id)) {
           data->addValue(GOVERNOR_KI,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KI,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       } 
 
@@ -346,10 +347,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 7) {
         if (!data->getValue(GOVERNOR_TF,&rval,g_id)) {
           data->addValue(GOVERNOR_TF,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TF,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       } 
 
@@ -357,10 +358,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 8) {
         if (!data->getValue(GOVERNOR_KD,&rval,g_id)) {
           data->addValue(GOVERNOR_KD,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KD,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -368,10 +369,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 9) {
         if (!data->getValue(GOVERNOR_KP,&rval,g_id)) {
           data->addValue(GOVERNOR_KP,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KP,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       }
 
@@ -379,10 +380,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 10) {
         if (!data->getValue(GOVERNOR_R,&rval,g_id)) {
           data->addValue(GOVERNOR_R,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_R,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -390,10 +391,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 11) {
         if (!data->getValue(GOVERNOR_TT,&rval,g_id)) {
           data->addValue(GOVERNOR_TT,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TT,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -401,10 +402,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 12) {
         if (!data->getValue(GOVERNOR_KG,&rval,g_id)) {
           data->addValue(GOVERNOR_KG,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KG,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -412,10 +413,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 13) {
         if (!data->getValue(GOVERNOR_TP,&rval,g_id)) {
           data->addValue(GOVERNOR_TP,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TP,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -423,10 +424,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 14) {
         if (!data->getValue(GOVERNOR_VELOPEN,&rval,g_id)) {
           data->addValue(GOVERNOR_VELOPEN,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_VELOPEN,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -434,10 +435,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 15) {
         if (!data->getValue(GOVERNOR_VELCLOSE,&rval,g_id)) {
           data->addValue(GOVERNOR_VELCLOSE,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_VELCLOSE,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -445,10 +446,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 16) {
         if (!data->getValue(GOVERNOR_PMAX,&rval,g_id)) {
           data->addValue(GOVERNOR_PMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PMAX,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -456,10 +457,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 17) {
         if (!data->getValue(GOVERNOR_PMIN,&rval,g_id)) {
           data->addValue(GOVERNOR_PMIN,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PMIN,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -467,10 +468,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 18) {
         if (!data->getValue(GOVERNOR_DB2,&rval,g_id)) {
           data->addValue(GOVERNOR_DB2,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DB2,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
 
@@ -478,10 +479,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 19) {
         if (!data->getValue(GOVERNOR_GV1,&rval,g_id)) {
           data->addValue(GOVERNOR_GV1,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV1,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         }
       } 
 
@@ -489,10 +490,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 20) {
         if (!data->getValue(GOVERNOR_PGV1,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV1,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV1,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         }
       } 
 
@@ -500,10 +501,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 21) {
         if (!data->getValue(GOVERNOR_GV2,&rval,g_id)) {
           data->addValue(GOVERNOR_GV2,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV2,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         }
       } 
 
@@ -511,10 +512,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 22) {
         if (!data->getValue(GOVERNOR_PGV2,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV2,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV2,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         }
       } 
 
@@ -522,10 +523,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 23) {
         if (!data->getValue(GOVERNOR_GV3,&rval,g_id)) {
           data->addValue(GOVERNOR_GV3,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV3,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         }
       } 
 
@@ -533,10 +534,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 24) {
         if (!data->getValue(GOVERNOR_PGV3,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV3,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV3,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         }
       } 
 
@@ -544,10 +545,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 25) {
         if (!data->getValue(GOVERNOR_GV4,&rval,g_id)) {
           data->addValue(GOVERNOR_GV4,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV4,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         }
       } 
 
@@ -555,10 +556,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 26) {
         if (!data->getValue(GOVERNOR_PGV4,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV4,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV4,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         }
       } 
 
@@ -566,10 +567,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 27) {
         if (!data->getValue(GOVERNOR_GV5,&rval,g_id)) {
           data->addValue(GOVERNOR_GV5,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV5,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         }
       } 
 
@@ -577,10 +578,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 28) {
         if (!data->getValue(GOVERNOR_PGV5,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV5,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV5,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         }
       } 
 
@@ -588,10 +589,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 29) {
         if (!data->getValue(GOVERNOR_ATURB,&rval,g_id)) {
           data->addValue(GOVERNOR_ATURB,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_ATURB,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         }
       } 
 
@@ -599,10 +600,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 30) {
         if (!data->getValue(GOVERNOR_BTURB,&rval,g_id)) {
           data->addValue(GOVERNOR_BTURB,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_BTURB,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         }
       } 
 
@@ -610,10 +611,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 31) {
         if (!data->getValue(GOVERNOR_TTURB,&rval,g_id)) {
           data->addValue(GOVERNOR_TTURB,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TTURB,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         }
       } 
 
@@ -621,10 +622,10 @@ template <class _data_struct> class WshygpParser
       if (nstr > 32) {
         if (!data->getValue(GOVERNOR_TRATE,&rval,g_id)) {
           data->addValue(GOVERNOR_TRATE,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TRATE,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         }
       } 
     }
@@ -634,21 +635,21 @@ template <class _data_struct> class WshygpParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const RecordTokenizer &split_line,_data_struct &data)
     {
       // GOVERNOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted();
       util.toUpper(sval);
 
       // GOVERNOR_MODEL              "MODEL"                  integer
@@ -657,152 +658,152 @@ template <class _data_struct> class WshygpParser
       int nstr = split_line.size();
       // GOVERNOR_DB1
       if (nstr > 3) {
-        data.db1 = atof(split_line[3].c_str());
+        data.db1 = split_line[3].toDouble();
       }
 
       // GOVERNOR_ERR
       if (nstr > 4) {
-        data.err = atof(split_line[4].c_str());
+        data.err = split_line[4].toDouble();
       }
 
       // GOVERNOR_TD
       if (nstr > 5) {
-        data.gv_td = atof(split_line[5].c_str());
+        data.gv_td = split_line[5].toDouble();
       }
 
       // GOVERNOR_KL
       if (nstr > 6) {
-        data.gv_ki = atof(split_line[6].c_str());
+        data.gv_ki = split_line[6].toDouble();
       }
 
       // GOVERNOR_TF
       if (nstr > 7) {
-        data.gv_tf = atof(split_line[7].c_str());
+        data.gv_tf = split_line[7].toDouble();
       }
 
       // GOVERNOR_KD
       if (nstr > 8) {
-        data.gv_kd = atof(split_line[8].c_str());
+        data.gv_kd = split_line[8].toDouble();
       }
 
       // GOVERNOR_KP
       if (nstr > 9) {
-        data.gv_kp = atof(split_line[9].c_str());
+        data.gv_kp = split_line[9].toDouble();
       }
 
       // GOVERNOR_R
       if (nstr > 10) {
-        data.gv_r = atof(split_line[10].c_str());
+        data.gv_r = split_line[10].toDouble();
       }
 
       // GOVERNOR_TT
       if (nstr > 11) {
-        data.gv_tt = atof(split_line[11].c_str());
+        data.gv_tt = split_line[11].toDouble();
       }
 
       // GOVERNOR_KG
       if (nstr > 12) {
-        data.gv_kg = atof(split_line[12].c_str());
+        data.gv_kg = split_line[12].toDouble();
       }
 
       // GOVERNOR_TP
       if (nstr > 13) {
-        data.gv_tp = atof(split_line[13].c_str());
+        data.gv_tp = split_line[13].toDouble();
       }
 
       // GOVERNOR_VELOPEN
       if (nstr > 14) {
-        data.velopen = atof(split_line[14].c_str());
+        data.velopen = split_line[14].toDouble();
       }
 
       // GOVERNOR_VELCLOSE
       if (nstr > 15) {
-        data.velclose = atof(split_line[15].c_str());
+        data.velclose = split_line[15].toDouble();
       }
 
       // GOVERNOR_PMAX
       if (nstr > 16) {
-        data.pmax = atof(split_line[16].c_str());
+        data.pmax = split_line[16].toDouble();
       }
 
       // GOVERNOR_PMIN
       if (nstr > 17) {
-        data.pmin = atof(split_line[17].c_str());
+        data.pmin = split_line[17].toDouble();
       }
 
       // GOVERNOR_DB2
       if (nstr > 18) {
-        data.db2 = atof(split_line[18].c_str());
+        data.db2 = split_line[18].toDouble();
       }
 
       // GOVERNOR_GV1
       if (nstr > 19) {
-        data.gv1 = atof(split_line[19].c_str());
+        data.gv1 = split_line[19].toDouble();
       }
 
       // GOVERNOR_PGV1
       if (nstr > 20) {
-        data.pgv1 = atof(split_line[20].c_str());
+        data.pgv1 = split_line[20].toDouble();
       }
 
       // GOVERNOR_GV2
       if (nstr > 21) {
-        data.gv2 = atof(split_line[21].c_str());
+        data.gv2 = split_line[21].toDouble();
       }
 
       // GOVERNOR_PGV2
       if (nstr > 22) {
-        data.pgv2 = atof(split_line[22].c_str());
+        data.pgv2 = split_line[22].toDouble();
       }
 
       // GOVERNOR_GV3
       if (nstr > 23) {
-        data.gv3 = atof(split_line[23].c_str());
+        data.gv3 = split_line[23].toDouble();
       }
 
       // GOVERNOR_PGV3
       if (nstr > 24) {
-        data.pgv3 = atof(split_line[24].c_str());
+        data.pgv3 = split_line[24].toDouble();
       }
 
       // GOVERNOR_GV4
       if (nstr > 25) {
-        data.gv4 = atof(split_line[25].c_str());
+        data.gv4 = split_line[25].toDouble();
       }
 
       // GOVERNOR_PGV4
       if (nstr > 26) {
-        data.pgv4 = atof(split_line[26].c_str());
+        data.pgv4 = split_line[26].toDouble();
       }
 
       // GOVERNOR_GV5
       if (nstr > 27) {
-        data.gv5 = atof(split_line[27].c_str());
+        data.gv5 = split_line[27].toDouble();
       }
 
       // GOVERNOR_PGV5
       if (nstr > 28) {
-        data.pgv5 = atof(split_line[28].c_str());
+        data.pgv5 = split_line[28].toDouble();
       }
 
       // GOVERNOR_ATURB
       if (nstr > 29) {
-        data.aturb = atof(split_line[29].c_str());
+        data.aturb = split_line[29].toDouble();
       }
 
       // GOVERNOR_BTURB
       if (nstr > 30) {
-        data.bturb = atof(split_line[30].c_str());
+        data.bturb = split_line[30].toDouble();
       }
 
       // GOVERNOR_TTURB
       if (nstr > 31) {
-        data.tturb = atof(split_line[31].c_str());
+        data.tturb = split_line[31].toDouble();
       }
 
       // GOVERNOR_TRATE
       if (nstr > 32) {
-        data.trate = atof(split_line[32].c_str());
+        data.trate = split_line[32].toDouble();
       }
     }
 };
@@ -0,0 +1,363 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   record_tokenizer.hpp
+ *
+ * @brief
+ * Split comma separated records from PTI and dynamic data files into fields
+ * without creating a string for each field. The record is copied into a
+ * buffer that is reused for each record and the separators are replaced by
+ * null characters, so each field can be used as a C string. Numbers are
+ * converted with parsers that do not depend on the locale.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _record_tokenizer_hpp_
+#define _record_tokenizer_hpp_
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "gridpack/utilities/string_utils.hpp"
+
+namespace gridpack {
+namespace parser {
+
+/**
+ * Convert the leading part of a string to an integer. Leading white space
+ * is skipped and conversion stops at the first character that is not a
+ * digit, the same as atoi
+ * @param str null terminated string
+ * @return integer value
+ */
+inline int parseInt(const char *str)
+{
+  while (*str == ' ' || *str == '\t' || *str == '\r' || *str == '\n') str++;
+  bool neg = false;
+  if (*str == '-' || *str == '+') {
+    neg = (*str == '-');
+    str++;
+  }
+  long ret = 0;
+  while (*str >= '0' && *str <= '9') {
+    ret = 10*ret + static_cast<long>(*str-'0');
+    str++;
+  }
+  return static_cast<int>(neg ? -ret : ret);
+}
+
+/**
+ * Convert the leading part of a string to a double, the same as atof. Only
+ * '.' is accepted as a decimal point. Numbers with at most 19 significant
+ * digits and a decimal exponent that can be applied with a single exact
+ * multiplication or division are converted directly, which gives the
+ * correctly rounded result. Everything else is passed on to strtod
+ * @param str null terminated string
+ * @return value
+ */
+inline double parseDouble(const char *str)
+{
+  static const double pow10[] = {1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5,
+    1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14,
+    1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+  const char *ptr = str;
+  while (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\n') ptr++;
+  bool neg = false;
+  if (*ptr == '-' || *ptr == '+') {
+    neg = (*ptr == '-');
+    ptr++;
+  }
+  unsigned long long mant = 0;
+  int ndigits = 0;
+  int nsig = 0;
+  int exp10 = 0;
+  while (*ptr >= '0' && *ptr <= '9') {
+    if (mant > 0 || *ptr != '0') {
+      mant = 10*mant + static_cast<unsigned long long>(*ptr-'0');
+      nsig++;
+    }
+    ndigits++;
+    ptr++;
+  }
+  if (*ptr == '.') {
+    ptr++;
+    while (*ptr >= '0' && *ptr <= '9') {
+      if (mant > 0 || *ptr != '0') {
+        mant = 10*mant + static_cast<unsigned long long>(*ptr-'0');
+        nsig++;
+      }
+      exp10--;
+      ndigits++;
+      ptr++;
+    }
+  }
+  // Hexadecimal numbers, infinities and NaNs are left to strtod
+  if (ndigits == 0 || nsig > 19 || *ptr == 'x' || *ptr == 'X') {
+    return strtod(str,NULL);
+  }
+  if (*ptr == 'e' || *ptr == 'E') {
+    const char *eptr = ptr+1;
+    bool eneg = false;
+    if (*eptr == '-' || *eptr == '+') {
+      eneg = (*eptr == '-');
+      eptr++;
+    }
+    if (*eptr >= '0' && *eptr <= '9') {
+      int eval = 0;
+      while (*eptr >= '0' && *eptr <= '9') {
+        if (eval < 10000) eval = 10*eval + (*eptr-'0');
+        eptr++;
+      }
+      exp10 += eneg ? -eval : eval;
+    }
+  }
+  double ret;
+  if (mant == 0) {
+    ret = 0.0;
+  } else if (mant <= (1ULL<<53) && exp10 >= -22 && exp10 <= 22) {
+    ret = static_cast<double>(mant);
+    if (exp10 < 0) {
+      ret /= pow10[-exp10];
+    } else {
+      ret *= pow10[exp10];
+    }
+  } else {
+    return strtod(str,NULL);
+  }
+  return neg ? -ret : ret;
+}
+
+// -------------------------------------------------------------
+//  class RecordField
+// -------------------------------------------------------------
+/**
+ * A single field of a record. The field points into the buffer of the
+ * RecordTokenizer that created it and is only valid until the next record
+ * is split up
+ */
+class RecordField {
+public:
+  /**
+   * Constructor
+   * @param ptr start of null terminated field
+   * @param len length of field
+   */
+  RecordField(const char *ptr = "", int len = 0)
+    : p_ptr(ptr), p_len(len)
+  {
+  }
+
+  /**
+   * @return contents of field as a null terminated string
+   */
+  const char* c_str(void) const
+  {
+    return p_ptr;
+  }
+
+  /**
+   * @return number of characters in field
+   */
+  int size(void) const
+  {
+    return p_len;
+  }
+
+  /**
+   * @return copy of field
+   */
+  std::string str(void) const
+  {
+    return std::string(p_ptr,p_len);
+  }
+
+  /**
+   * @return field converted to an integer
+   */
+  int toInt(void) const
+  {
+    return parseInt(p_ptr);
+  }
+
+  /**
+   * @return field converted to a double
+   */
+  double toDouble(void) const
+  {
+    return parseDouble(p_ptr);
+  }
+
+  /**
+   * @return true if field contains only blanks
+   */
+  bool isBlank(void) const
+  {
+    int i;
+    for (i=0; i<p_len; i++) {
+      if (p_ptr[i] != ' ') return false;
+    }
+    return true;
+  }
+
+  /**
+   * @return true if the first non-blank character is a single quote
+   */
+  bool isQuoted(void) const
+  {
+    int i = 0;
+    while (i<p_len && p_ptr[i] == ' ') i++;
+    return (i<p_len && p_ptr[i] == '\'');
+  }
+
+  /**
+   * @return field with quotes and surrounding blanks removed (the same as
+   * StringUtils::trimQuotes)
+   */
+  std::string unquoted(void) const
+  {
+    std::string tmp(p_ptr,p_len);
+    gridpack::utility::StringUtils util;
+    return util.trimQuotes(tmp);
+  }
+
+  /**
+   * @return field converted to a 2 character device tag (the same as
+   * StringUtils::clean2Char)
+   */
+  std::string tag(void) const
+  {
+    std::string tmp(p_ptr,p_len);
+    gridpack::utility::StringUtils util;
+    return util.clean2Char(tmp);
+  }
+
+private:
+  const char *p_ptr;
+  int p_len;
+};
+
+// -------------------------------------------------------------
+//  class RecordTokenizer
+// -------------------------------------------------------------
+class RecordTokenizer {
+public:
+  /**
+   * Constructor
+   */
+  RecordTokenizer(void)
+    : p_nfields(0)
+  {
+  }
+
+  /**
+   * Split a record into comma separated fields. Commas and '/' characters
+   * inside single or double quotes do not split fields or start a comment.
+   * The tokenizer can be used for any number of records and only allocates
+   * memory when a record is longer or has more fields than any previous
+   * record
+   * @param record record to be split up
+   * @param compress treat consecutive commas as a single separator
+   * @param comments remove all text after a '/' character
+   * @return number of fields
+   */
+  int tokenize(const std::string &record, bool compress = false,
+      bool comments = true)
+  {
+    return tokenize(record.data(),static_cast<int>(record.size()),compress,
+        comments);
+  }
+
+  /**
+   * Split a record into comma separated fields
+   * @param record start of record
+   * @param len number of characters in record
+   * @param compress treat consecutive commas as a single separator
+   * @param comments remove all text after a '/' character
+   * @return number of fields
+   */
+  int tokenize(const char *record, int len, bool compress, bool comments)
+  {
+    if (p_buffer.size() < static_cast<size_t>(len+1)) p_buffer.resize(len+1);
+    char *buf = &p_buffer[0];
+    if (len > 0) memcpy(buf,record,len);
+    buf[len] = '\0';
+    p_nfields = 0;
+    int start = 0;
+    char quote = '\0';
+    int i;
+    for (i=0; i<len; i++) {
+      char c = buf[i];
+      if (quote != '\0') {
+        if (c == quote) quote = '\0';
+      } else if (c == '\'' || c == '\"') {
+        quote = c;
+      } else if (c == ',') {
+        buf[i] = '\0';
+        addField(buf+start,i-start);
+        if (compress) {
+          while (i+1<len && buf[i+1] == ',') i++;
+        }
+        start = i+1;
+      } else if (c == '/' && comments) {
+        break;
+      }
+    }
+    buf[i] = '\0';
+    addField(buf+start,i-start);
+    return p_nfields;
+  }
+
+  /**
+   * @return number of fields in current record
+   */
+  int size(void) const
+  {
+    return p_nfields;
+  }
+
+  /**
+   * Return a field of the current record. Fields past the end of the record
+   * are empty
+   * @param i index of field
+   * @return field
+   */
+  const RecordField& operator[](int i) const
+  {
+    if (i < 0 || i >= p_nfields) return p_empty;
+    return p_fields[i];
+  }
+
+private:
+  /**
+   * Add a field to the list of fields in the current record
+   * @param ptr start of field
+   * @param len length of field
+   */
+  void addField(const char *ptr, int len)
+  {
+    if (p_fields.size() <= static_cast<size_t>(p_nfields)) {
+      p_fields.push_back(RecordField(ptr,len));
+    } else {
+      p_fields[p_nfields] = RecordField(ptr,len);
+    }
+    p_nfields++;
+  }
+
+  std::vector<char> p_buffer;
+  std::vector<RecordField> p_fields;
+  int p_nfields;
+  RecordField p_empty;
+};
+
+} // namespace parser
+} // namespace gridpack
+
+#endif
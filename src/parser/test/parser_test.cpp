@@ -28,6 +28,9 @@
 #include "gridpack/component/base_component.hpp"
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/parser/PTI23_parser.hpp"
+#include "gridpack/parser/PTI33_parser.hpp"
+#include "gridpack/parser/record_tokenizer.hpp"
+#include "gridpack/parser/network_snapshot.hpp"
 #include "gridpack/parser/hash_distr.hpp"
 
 class TestBus
@@ -57,6 +60,37 @@ typedef gridpack::network::BaseNetwork<TestBus, TestBranch> TestNetwork;
 struct bus_data {int idx;};
 struct branch_data {int idx1; int idx2;};
 
+// Sum quantities over all buses and branches that depend on the global
+// indices and the contents of the DataCollection objects
+void networkChecksum(boost::shared_ptr<TestNetwork> network,
+    std::vector<double> &chk)
+{
+  chk.assign(6,0.0);
+  int i, ival, idx;
+  double rval;
+  int nbus = network->numBuses();
+  for (i=0; i<nbus; i++) {
+    idx = network->getGlobalBusIndex(i)+1;
+    chk[0] += 1.0;
+    network->getBusData(i)->getValue(BUS_NUMBER,&ival);
+    chk[1] += static_cast<double>(idx*ival);
+    network->getBusData(i)->getValue(BUS_VOLTAGE_MAG,&rval);
+    chk[2] += static_cast<double>(idx)*rval;
+  }
+  int nbranch = network->numBranches();
+  for (i=0; i<nbranch; i++) {
+    idx = network->getGlobalBranchIndex(i)+1;
+    chk[3] += 1.0;
+    network->getBranchData(i)->getValue(BRANCH_FROMBUS,&ival);
+    chk[4] += static_cast<double>(idx*ival);
+    network->getBranchData(i)->getValue(BRANCH_TOBUS,&ival);
+    chk[4] += static_cast<double>(2*idx*ival);
+    network->getBranchData(i)->getValue(BRANCH_INDEX,&ival);
+    chk[5] += static_cast<double>(idx*ival);
+  }
+  network->communicator().sum(&chk[0],6);
+}
+
 // -------------------------------------------------------------
 //  Main Program
 // -------------------------------------------------------------
@@ -104,6 +138,129 @@ main(int argc, char **argv)
       printf("\nError in parsing of test configuration\n");
     }
 
+    // Check to see if records are split up and converted correctly
+    {
+      schk = 0;
+      gridpack::parser::RecordTokenizer tokens;
+      tokens.tokenize(" 101, 'BUS, 1/A',  1.0500,-12.25E-1, 7 / comment, 8");
+      if (tokens.size() != 5) schk = 1;
+      if (tokens[0].toInt() != 101) schk = 1;
+      if (tokens[1].unquoted() != "BUS, 1/A") schk = 1;
+      if (tokens[2].toDouble() != 1.05) schk = 1;
+      if (tokens[3].toDouble() != -1.225) schk = 1;
+      if (tokens[4].toInt() != 7) schk = 1;
+      if (tokens[5].size() != 0 || tokens[5].toDouble() != 0.0) schk = 1;
+      tokens.tokenize("1,,'GENCLS',,'1 ', 8.0",true);
+      if (tokens.size() != 4 || tokens[1].unquoted() != "GENCLS" ||
+          tokens[2].tag() != "1 ") schk = 1;
+      const char *nums[] = {"0.1", "-3.14159265358979", " 1.0e-5",
+        "123456789.123456789", "6.02214076e23", "1e-320", "0.000000",
+        "  -0.5D+00"};
+      for (i=0; i<8; i++) {
+        if (gridpack::parser::parseDouble(nums[i]) != atof(nums[i])) schk = 1;
+      }
+      MPI_Allreduce(&schk,&rchk,1,MPI_INT,MPI_SUM,comm);
+      if (rchk == 0 && world.rank() == 0) {
+        printf("\nRecord tokenizer is ok\n");
+      } else if (world.rank() == 0) {
+        printf("\nError in record tokenizer\n");
+      }
+    }
+
+    // Check to see if parsing a PTI v33 file on all processors gives the
+    // same network as parsing it on process 0
+    {
+      boost::shared_ptr<TestNetwork> serial(new TestNetwork(world));
+      gridpack::parser::PTI33_parser<TestNetwork> sparser(serial);
+      sparser.parse("IEEE14_PTIv33.raw");
+      boost::shared_ptr<TestNetwork> parallel(new TestNetwork(world));
+      gridpack::parser::PTI33_parser<TestNetwork> pparser(parallel);
+      pparser.setParallelParse(true);
+      pparser.parse("IEEE14_PTIv33.raw");
+      std::vector<double> schk_v, pchk_v;
+      networkChecksum(serial,schk_v);
+      networkChecksum(parallel,pchk_v);
+      schk = 0;
+      for (i=0; i<6; i++) {
+        if (fabs(schk_v[i]-pchk_v[i]) > 1.0e-8*(fabs(schk_v[i])+1.0)) schk = 1;
+      }
+      if (schk_v[0] == 0.0 || schk_v[3] == 0.0) schk = 1;
+      MPI_Allreduce(&schk,&rchk,1,MPI_INT,MPI_SUM,comm);
+      if (rchk == 0 && world.rank() == 0) {
+        printf("\nParallel parsing of PTI33 file is ok\n");
+      } else if (world.rank() == 0) {
+        printf("\nError in parallel parsing of PTI33 file\n");
+      }
+    }
+
+    // Check to see if distributing the data read on process 0 before the
+    // network is created gives the same network
+    {
+      boost::shared_ptr<TestNetwork> serial(new TestNetwork(world));
+      gridpack::parser::PTI33_parser<TestNetwork> sparser(serial);
+      sparser.parse("IEEE14_PTIv33.raw");
+      boost::shared_ptr<TestNetwork> distr(new TestNetwork(world));
+      gridpack::parser::PTI33_parser<TestNetwork> dparser(distr);
+      // Use a small buffer so that data is sent in several chunks
+      dparser.setDistributeData(true,2048);
+      dparser.parse("IEEE14_PTIv33.raw");
+      std::vector<double> schk_v, dchk_v;
+      networkChecksum(serial,schk_v);
+      networkChecksum(distr,dchk_v);
+      schk = 0;
+      for (i=0; i<6; i++) {
+        if (schk_v[i] != dchk_v[i]) schk = 1;
+      }
+      if (world.size() > 1 && world.rank() == world.size()-1 &&
+          distr->numBuses() == 0) schk = 1;
+      MPI_Allreduce(&schk,&rchk,1,MPI_INT,MPI_SUM,comm);
+      if (rchk == 0 && world.rank() == 0) {
+        printf("\nDistribution of PTI33 data is ok\n");
+      } else if (world.rank() == 0) {
+        printf("\nError in distribution of PTI33 data\n");
+      }
+    }
+
+    // Check to see if a network loaded from a snapshot is the same as the
+    // network that the snapshot was written from
+    {
+      boost::shared_ptr<TestNetwork> original(new TestNetwork(world));
+      gridpack::parser::PTI33_parser<TestNetwork> oparser(original);
+      oparser.parse("IEEE14_PTIv33.raw");
+      gridpack::parser::NetworkSnapshot<TestNetwork> writer(original);
+      writer.write("IEEE14.snapshot",false,"IEEE14_PTIv33.raw");
+      boost::shared_ptr<TestNetwork> loaded(new TestNetwork(world));
+      gridpack::parser::NetworkSnapshot<TestNetwork> reader(loaded);
+      schk = 0;
+      if (!gridpack::parser::NetworkSnapshot<TestNetwork>::isSnapshot(
+            "IEEE14.snapshot")) schk = 1;
+      // Snapshot is only current for the file and number of processors it
+      // was written from
+      if (!gridpack::parser::NetworkSnapshot<TestNetwork>::isCurrent(
+            "IEEE14.snapshot","IEEE14_PTIv33.raw",world.size())) schk = 1;
+      if (gridpack::parser::NetworkSnapshot<TestNetwork>::isCurrent(
+            "IEEE14.snapshot","parser_data.raw",world.size())) schk = 1;
+      if (gridpack::parser::NetworkSnapshot<TestNetwork>::isCurrent(
+            "IEEE14.snapshot","IEEE14_PTIv33.raw",world.size()+1)) schk = 1;
+      reader.parse("IEEE14.snapshot");
+      std::vector<double> ochk_v, lchk_v;
+      networkChecksum(original,ochk_v);
+      networkChecksum(loaded,lchk_v);
+      for (i=0; i<6; i++) {
+        if (ochk_v[i] != lchk_v[i]) schk = 1;
+      }
+      double osbase = 0.0, lsbase = 1.0;
+      original->getNetworkData()->getValue(CASE_SBASE,&osbase);
+      loaded->getNetworkData()->getValue(CASE_SBASE,&lsbase);
+      if (osbase != lsbase) schk = 1;
+      MPI_Allreduce(&schk,&rchk,1,MPI_INT,MPI_SUM,comm);
+      if (rchk == 0 && world.rank() == 0) {
+        printf("\nNetwork snapshot is ok\n");
+      } else if (world.rank() == 0) {
+        printf("\nError in network snapshot\n");
+      }
+    }
+
     // Check to see if hash distribution functionality works
     gridpack::hash_distr::HashDistribution<TestNetwork,bus_data,branch_data>
       hashMap(network);
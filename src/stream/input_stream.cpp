@@ -52,6 +52,7 @@ bool gridpack::stream::InputStream::openStringVector(const std::vector<std::stri
 {
   if (fileVec.size() == 0) return false;
   p_fileVector = fileVec;
+  p_fileIterator = p_fileVector.begin();
   p_srcVector = true;
   p_isOpen = true;
   return true;